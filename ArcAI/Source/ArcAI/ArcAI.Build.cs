@@ -104,6 +104,7 @@ public class ArcAI : ModuleRules
 				, "MassGameplayDebug"
 				, "MoverMassIntegration"
 				, "DaySequence"
+				, "DeveloperSettings"
 				// ... add private dependencies that you statically link with here ...
 			}
 			);
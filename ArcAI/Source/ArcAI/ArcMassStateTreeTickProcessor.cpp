@@ -2,10 +2,20 @@
 
 #include "ArcMassStateTreeTickProcessor.h"
 
+#include "ArcMassStateTreeTickScheduler.h"
+#include "ArcMassStateTreeTickSettings.h"
+#include "MassExecutionContext.h"
+#include "MassSignalSubsystem.h"
 #include "MassStateTreeExecutionContext.h"
 #include "MassStateTreeFragments.h"
 #include "Tasks/ArcMassDrawDebugSphereTask.h"
 
+namespace UE::ArcAI::StateTreeTick::Private
+{
+	/** Seconds between sweeps of parked entities that were destroyed while parked. */
+	constexpr double PruneInterval = 5.0;
+}
+
 UArcMassStateTreeTickProcessor::UArcMassStateTreeTickProcessor()
 	: EntityQuery_Conditional(*this)
 {
@@ -31,38 +41,162 @@ void UArcMassStateTreeTickProcessor::InitializeInternal(UObject& Owner, const TS
 	Super::InitializeInternal(Owner, MassEntityManager);
 	
 	MassStateTreeSubsystem = UWorld::GetSubsystem<UMassStateTreeSubsystem>(Owner.GetWorld());
+	TickScheduler = UWorld::GetSubsystem<UArcMassStateTreeTickScheduler>(Owner.GetWorld());
 }
 
 void UArcMassStateTreeTickProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	if (!MassStateTreeSubsystem)
+	if (!MassStateTreeSubsystem || !TickScheduler)
 	{
 		return;
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassStateTreeTick);
 
-	EntityQuery_Conditional.ForEachEntityChunk(Context, [this](FMassExecutionContext& MyContext)
+	const UWorld* World = EntityManager.GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	const bool bParkIdle = GetDefault<UArcMassStateTreeTickSettings>()->bParkIdleStateTrees;
+
+	FArcMassStateTreeTickStats Stats;
+	Stats.Woken = TickScheduler->WakeDue(Now);
+
+	if (Now - LastPruneTime > UE::ArcAI::StateTreeTick::Private::PruneInterval)
+	{
+		LastPruneTime = Now;
+		TickScheduler->PruneInvalid(EntityManager);
+	}
+
+	// Parking is applied after both passes so the parallel pass only reads the scheduler.
+	TArray<TPair<FMassEntityHandle, double>> EntitiesToPark;
+	FCriticalSection ResultsLock;
+
+	auto TickChunk = [this, Now, bParkIdle, &EntitiesToPark, &Stats, &ResultsLock](FMassExecutionContext& MyContext, bool bParallelPass)
 	{
-		const TArrayView<FMassStateTreeInstanceFragment> StateTreeInstanceList = MyContext.GetMutableFragmentView<FMassStateTreeInstanceFragment>();
 		const FMassStateTreeSharedFragment& SharedStateTree = MyContext.GetConstSharedFragment<FMassStateTreeSharedFragment>();
-			
 		const UStateTree* StateTree = SharedStateTree.StateTree;
-			
-		const float WorldDeltaTime = MyContext.GetDeltaTimeSeconds();
-			
+		if (!StateTree || TickScheduler->IsThreadSafe(StateTree) != bParallelPass)
+		{
+			return;
+		}
+
+		const TArrayView<FMassStateTreeInstanceFragment> StateTreeInstanceList = MyContext.GetMutableFragmentView<FMassStateTreeInstanceFragment>();
+
+		TArray<TPair<FMassEntityHandle, double>> ChunkToPark;
+		int32 NumTicked = 0;
+		int32 NumSkipped = 0;
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = MyContext.CreateSparseEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FMassEntityHandle Entity = MyContext.GetEntity(EntityIt);
+			if (TickScheduler->IsParked(Entity))
+			{
+				++NumSkipped;
+				continue;
+			}
 			
 			FMassStateTreeInstanceFragment& StateTreeFragment = StateTreeInstanceList[EntityIt];
 			FStateTreeInstanceData* InstanceData = MassStateTreeSubsystem->GetInstanceData(StateTreeFragment.InstanceHandle);
+			if (!InstanceData)
+			{
+				continue;
+			}
 			
 			FMassStateTreeExecutionContext StateTreeContext(*MassStateTreeSubsystem, *StateTree, *InstanceData, MyContext);
 			StateTreeContext.SetEntity(Entity);
 			StateTreeContext.SetOuterTraceId(Entity.AsNumber());
 			
-			StateTreeContext.Tick(WorldDeltaTime);
+			// Parked trees catch up on the whole time they were skipped, so delays keep their duration.
+			const float DeltaTime = static_cast<float>(Now - StateTreeFragment.LastUpdateTimeInSeconds);
+			StateTreeFragment.LastUpdateTimeInSeconds = static_cast<float>(Now);
+
+			const EStateTreeRunStatus Status = StateTreeContext.Tick(DeltaTime);
+			++NumTicked;
+
+			if (!bParkIdle || Status != EStateTreeRunStatus::Running)
+			{
+				continue;
+			}
+
+			// Active states that only wait on delays or events let the tree sleep or tick at a lower rate.
+			const FStateTreeScheduledTick NextTick = StateTreeContext.GetNextScheduledTick();
+			if (NextTick.ShouldTickEveryFrames() || NextTick.ShouldTickOnceNextFrame())
+			{
+				continue;
+			}
+
+			const double WakeTime = NextTick.ShouldSleep() ? TNumericLimits<double>::Max() : Now + NextTick.GetTickRate();
+			ChunkToPark.Emplace(Entity, WakeTime);
+		}
+
+		FScopeLock Lock(&ResultsLock);
+		EntitiesToPark.Append(ChunkToPark);
+		Stats.Ticked += NumTicked;
+		Stats.Skipped += NumSkipped;
+		if (bParallelPass)
+		{
+			Stats.ParallelTicked += NumTicked;
+		}
+	};
+
+	EntityQuery_Conditional.ParallelForEachEntityChunk(Context, [&TickChunk](FMassExecutionContext& MyContext)
+	{
+		TickChunk(MyContext, true);
+	});
+
+	EntityQuery_Conditional.ForEachEntityChunk(Context, [&TickChunk](FMassExecutionContext& MyContext)
+	{
+		TickChunk(MyContext, false);
+	});
+
+	for (const TPair<FMassEntityHandle, double>& Pair : EntitiesToPark)
+	{
+		TickScheduler->Park(Pair.Key, Pair.Value);
+	}
+	Stats.Parked = EntitiesToPark.Num();
+
+	TickScheduler->SetLastFrameStats(Stats);
+}
+
+UArcMassStateTreeTickWakeProcessor::UArcMassStateTreeTickWakeProcessor()
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ExecutionOrder.ExecuteInGroup = UE::Mass::ProcessorGroupNames::Tasks;
+	ExecutionOrder.ExecuteBefore.Add(UArcMassStateTreeTickProcessor::StaticClass()->GetFName());
+}
+
+void UArcMassStateTreeTickWakeProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FMassStateTreeInstanceFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddSparseRequirement<FArcMassTickStateTreeTag>(EMassFragmentPresence::All);
+}
+
+void UArcMassStateTreeTickWakeProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	Super::InitializeInternal(Owner, EntityManager);
+
+	TickScheduler = UWorld::GetSubsystem<UArcMassStateTreeTickScheduler>(Owner.GetWorld());
+
+	UMassSignalSubsystem* SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
+	for (const FName SignalName : GetDefault<UArcMassStateTreeTickSettings>()->WakeSignals)
+	{
+		SubscribeToSignal(*SignalSubsystem, SignalName);
+	}
+}
+
+void UArcMassStateTreeTickWakeProcessor::SignalEntities(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals)
+{
+	if (!TickScheduler)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassStateTreeTickWake);
+
+	EntityQuery.ForEachEntityChunk(Context, [this](FMassExecutionContext& MyContext)
+	{
+		for (FMassExecutionContext::FEntityIterator EntityIt = MyContext.CreateSparseEntityIterator(); EntityIt; ++EntityIt)
+		{
+			TickScheduler->RequestWake(MyContext.GetEntity(EntityIt));
 		}
 	});
 }
@@ -5,18 +5,25 @@
 #include "CoreMinimal.h"
 #include "Mass/EntityElementTypes.h"
 #include "MassProcessor.h"
+#include "MassSignalProcessorBase.h"
 #include "ArcMassStateTreeTickProcessor.generated.h"
 
+class UArcMassStateTreeTickScheduler;
 class UMassStateTreeSubsystem;
 
 USTRUCT()
-struct FArcMassTickStateTreeTag : public FMassSparseTag
+struct ARCAI_API FArcMassTickStateTreeTag : public FMassSparseTag
 {
 	GENERATED_BODY()
 };
 
 /**
- * 
+ * Ticks the StateTree of every entity with FArcMassTickStateTreeTag each frame.
+ *
+ * Instances whose tree reports it does not need a tick every frame are parked in
+ * UArcMassStateTreeTickScheduler and skipped until due or woken by a signal. Trees listed as thread-safe
+ * in UArcMassStateTreeTickSettings are ticked in parallel, chunk by chunk; every chunk shares a single
+ * tree asset. The rest are ticked serially afterwards.
  */
 UCLASS()
 class ARCAI_API UArcMassStateTreeTickProcessor : public UMassProcessor
@@ -33,4 +40,25 @@ class ARCAI_API UArcMassStateTreeTickProcessor : public UMassProcessor
 	
 	UPROPERTY(Transient)
 	TObjectPtr<UMassStateTreeSubsystem> MassStateTreeSubsystem = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UArcMassStateTreeTickScheduler> TickScheduler = nullptr;
+
+	double LastPruneTime = 0.0;
+};
+
+/** Wakes parked StateTree instances (UArcMassStateTreeTickScheduler) when they receive a wake signal. */
+UCLASS()
+class ARCAI_API UArcMassStateTreeTickWakeProcessor : public UMassSignalProcessorBase
+{
+	GENERATED_BODY()
+
+	UArcMassStateTreeTickWakeProcessor();
+
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void SignalEntities(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals) override;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UArcMassStateTreeTickScheduler> TickScheduler = nullptr;
 };
@@ -0,0 +1,92 @@
+﻿// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassStateTreeTickScheduler.h"
+
+#include "ArcMassStateTreeTickSettings.h"
+#include "MassEntityManager.h"
+#include "StateTree.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassStateTreeTickScheduler)
+
+void UArcMassStateTreeTickScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	for (const TSoftObjectPtr<UStateTree>& StateTree : GetDefault<UArcMassStateTreeTickSettings>()->ThreadSafeStateTrees)
+	{
+		if (const UStateTree* Loaded = StateTree.LoadSynchronous())
+		{
+			ThreadSafeStateTrees.Add(Loaded);
+		}
+	}
+}
+
+void UArcMassStateTreeTickScheduler::Deinitialize()
+{
+	Parked.Empty();
+	WakeHeap.Empty();
+	ThreadSafeStateTrees.Empty();
+	{
+		FScopeLock Lock(&WakeRequestsLock);
+		WakeRequests.Empty();
+	}
+
+	Super::Deinitialize();
+}
+
+void UArcMassStateTreeTickScheduler::Park(const FMassEntityHandle& Entity, double WakeTime)
+{
+	const uint32 Serial = ++NextSerial;
+	Parked.Add(Entity, Serial);
+
+	if (WakeTime < TNumericLimits<double>::Max())
+	{
+		WakeHeap.HeapPush(FWakeEvent{ WakeTime, Entity, Serial });
+	}
+}
+
+void UArcMassStateTreeTickScheduler::RequestWake(const FMassEntityHandle& Entity)
+{
+	FScopeLock Lock(&WakeRequestsLock);
+	WakeRequests.Add(Entity);
+}
+
+int32 UArcMassStateTreeTickScheduler::WakeDue(double Now)
+{
+	int32 NumWoken = 0;
+
+	{
+		FScopeLock Lock(&WakeRequestsLock);
+		for (const FMassEntityHandle& Entity : WakeRequests)
+		{
+			NumWoken += Parked.Remove(Entity);
+		}
+		WakeRequests.Reset();
+	}
+
+	while (WakeHeap.Num() > 0 && WakeHeap.HeapTop().Time <= Now)
+	{
+		FWakeEvent Event;
+		WakeHeap.HeapPop(Event, EAllowShrinking::No);
+
+		const uint32* Serial = Parked.Find(Event.Entity);
+		if (Serial && *Serial == Event.Serial)
+		{
+			Parked.Remove(Event.Entity);
+			++NumWoken;
+		}
+	}
+
+	return NumWoken;
+}
+
+void UArcMassStateTreeTickScheduler::PruneInvalid(const FMassEntityManager& EntityManager)
+{
+	for (TMap<FMassEntityHandle, uint32>::TIterator It = Parked.CreateIterator(); It; ++It)
+	{
+		if (!EntityManager.IsEntityValid(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,97 @@
+﻿// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mass/EntityHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArcMassStateTreeTickScheduler.generated.h"
+
+struct FMassEntityManager;
+class UStateTree;
+
+/** Counters of one UArcMassStateTreeTickProcessor run. */
+struct FArcMassStateTreeTickStats
+{
+	/** Instances ticked, including ParallelTicked. */
+	int32 Ticked = 0;
+
+	/** Instances ticked by parallel batches of thread-safe trees. */
+	int32 ParallelTicked = 0;
+
+	/** Instances parked after their tick. */
+	int32 Parked = 0;
+
+	/** Parked instances woken by their due time or a wake signal. */
+	int32 Woken = 0;
+
+	/** Parked instances skipped. */
+	int32 Skipped = 0;
+};
+
+/**
+ * Wake-up queue of UArcMassStateTreeTickProcessor.
+ *
+ * An instance is parked when its tree reports it does not need a tick every frame: until its next scheduled
+ * tick time, or, for a sleeping tree, until one of UArcMassStateTreeTickSettings::WakeSignals reaches it.
+ * Parked instances are skipped by the tick processor until woken.
+ *
+ * Park, WakeDue and PruneInvalid belong to the tick processor; RequestWake may be called from any thread.
+ */
+UCLASS()
+class ARCAI_API UArcMassStateTreeTickScheduler : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	bool IsParked(const FMassEntityHandle& Entity) const { return Parked.Contains(Entity); }
+
+	/** Skip Entity until WakeTime. A WakeTime of TNumericLimits<double>::Max() waits for a wake signal only. */
+	void Park(const FMassEntityHandle& Entity, double WakeTime);
+
+	/** Wake Entity on the next tick processor run. Thread-safe. */
+	void RequestWake(const FMassEntityHandle& Entity);
+
+	/** Unpark requested entities and those due by Now. Returns how many were woken. */
+	int32 WakeDue(double Now);
+
+	/** Forget parked entities that no longer exist. */
+	void PruneInvalid(const FMassEntityManager& EntityManager);
+
+	/** True if StateTree is listed in UArcMassStateTreeTickSettings::ThreadSafeStateTrees. */
+	bool IsThreadSafe(const UStateTree* StateTree) const { return ThreadSafeStateTrees.Contains(StateTree); }
+
+	void SetLastFrameStats(const FArcMassStateTreeTickStats& Stats) { LastFrameStats = Stats; }
+	const FArcMassStateTreeTickStats& GetLastFrameStats() const { return LastFrameStats; }
+
+	int32 GetNumParked() const { return Parked.Num(); }
+
+private:
+	struct FWakeEvent
+	{
+		double Time = 0.0;
+		FMassEntityHandle Entity;
+		uint32 Serial = 0;
+
+		bool operator<(const FWakeEvent& Other) const { return Time < Other.Time; }
+	};
+
+	/** Parked entity -> serial of its park; wake events with an older serial are stale. */
+	TMap<FMassEntityHandle, uint32> Parked;
+
+	/** Min-heap on FWakeEvent::Time. Sleeping instances have no entry. */
+	TArray<FWakeEvent> WakeHeap;
+
+	uint32 NextSerial = 0;
+
+	FCriticalSection WakeRequestsLock;
+	TArray<FMassEntityHandle> WakeRequests;
+
+	TSet<TObjectKey<UStateTree>> ThreadSafeStateTrees;
+
+	FArcMassStateTreeTickStats LastFrameStats;
+};
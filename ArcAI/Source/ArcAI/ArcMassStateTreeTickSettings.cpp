@@ -0,0 +1,14 @@
+﻿// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassStateTreeTickSettings.h"
+
+#include "MassStateTreeTypes.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassStateTreeTickSettings)
+
+UArcMassStateTreeTickSettings::UArcMassStateTreeTickSettings()
+{
+	WakeSignals.Add(UE::Mass::Signals::StateTreeActivate);
+	WakeSignals.Add(UE::Mass::Signals::NewStateTreeTaskRequired);
+	WakeSignals.Add(UE::Mass::Signals::DelayedTransitionWakeup);
+}
@@ -0,0 +1,40 @@
+﻿// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ArcMassStateTreeTickSettings.generated.h"
+
+class UStateTree;
+
+/** Scheduling of UArcMassStateTreeTickProcessor. */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "ArcAI StateTree Tick"))
+class ARCAI_API UArcMassStateTreeTickSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UArcMassStateTreeTickSettings();
+
+	virtual FName GetCategoryName() const override { return FName("ArcAI"); }
+	virtual FName GetSectionName() const override { return FName("StateTreeTick"); }
+
+	/**
+	 * Skip instances whose active states only wait (on a delay or a signal) until they are due.
+	 * Uses the tree's own next scheduled tick, so trees that always tick every frame are never parked.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+	bool bParkIdleStateTrees = true;
+
+	/** Signals that wake a parked instance early. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+	TArray<FName> WakeSignals;
+
+	/**
+	 * Trees whose tasks, conditions and evaluators are safe to run off the game thread and concurrently
+	 * for different entities. Their instances are ticked in parallel, one chunk (one tree) per batch.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling")
+	TArray<TSoftObjectPtr<UStateTree>> ThreadSafeStateTrees;
+};
@@ -30,6 +30,7 @@
 #include "MassSignalSubsystem.h"
 #include "StateTreeExecutionContext.h"
 #include "StateTreeTypes.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
 #include "VisualLogger/VisualLogger.h"
 
 FArcMassModifyNeedTask::FArcMassModifyNeedTask()
@@ -40,39 +41,23 @@ FArcMassModifyNeedTask::FArcMassModifyNeedTask()
 EStateTreeRunStatus FArcMassModifyNeedTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
 {
 	const FMassStateTreeExecutionContext& MassStateTreeContext = static_cast<FMassStateTreeExecutionContext&>(Context);
-	FMassEntityManager& MEM = MassStateTreeContext.GetEntityManager();
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	UMassEntitySubsystem* MES = Context.GetWorld()->GetSubsystem<UMassEntitySubsystem>();
 	UMassSignalSubsystem* MassSignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
+	UArcNeedScheduleSubsystem* NeedScheduler = Context.GetWorld()->GetSubsystem<UArcNeedScheduleSubsystem>();
+	if (!NeedScheduler)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
 
 	if (InstanceData.FillType == EArcNeedFillType::Fixed)
 	{
-		FStructView View = MEM.GetFragmentDataStruct(MassStateTreeContext.GetEntity(), InstanceData.NeedType);
-		if (!View.IsValid())
+		if (!NeedScheduler->ModifyNeed(MassStateTreeContext.GetEntity(), InstanceData.NeedType, InstanceData.Operation, InstanceData.ModifyValue))
 		{
 			UE_LOG(LogStateTree, Warning, TEXT("FArcMassModifyNeedTask::EnterState: Need not present."));
 			return EStateTreeRunStatus::Failed;
 		}
 
-		FArcNeedFragment* NeedFragment = View.GetPtr<FArcNeedFragment>();
-
-		switch (InstanceData.Operation)
-		{
-			case EArcNeedOperation::Add:
-				NeedFragment->CurrentValue += InstanceData.ModifyValue;
-				NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-				break;
-			case EArcNeedOperation::Subtract:
-				NeedFragment->CurrentValue -= InstanceData.ModifyValue;
-				NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-				break;
-			case EArcNeedOperation::Override:
-				NeedFragment->CurrentValue = InstanceData.ModifyValue;
-				NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-				break;
-		}
-
 		return EStateTreeRunStatus::Succeeded;
 	}
 	if (InstanceData.FillType != EArcNeedFillType::Fixed)
@@ -84,7 +69,7 @@ EStateTreeRunStatus FArcMassModifyNeedTask::EnterState(FStateTreeExecutionContex
 		}
 
 		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
-			[this, WeakCtx = Context.MakeWeakExecutionContext(), Entity = MassStateTreeContext.GetEntity(), MES, MassSignalSubsystem]
+			[this, WeakCtx = Context.MakeWeakExecutionContext(), Entity = MassStateTreeContext.GetEntity(), NeedScheduler, MassSignalSubsystem]
 			(float DeltaTime) -> bool
 		{
 			auto StrongCtx = WeakCtx.MakeStrongExecutionContext();
@@ -100,53 +85,35 @@ EStateTreeRunStatus FArcMassModifyNeedTask::EnterState(FStateTreeExecutionContex
 
 			if (InstanceData->CurrentPeriodTime >= InstanceData->ModifyPeriod)
 			{
-				FMassEntityManager& MEM = MES->GetMutableEntityManager();
 				InstanceData->CurrentPeriodTime = 0.f;
 				InstanceData->CurrentTicks++;
 
-				FStructView View = MEM.GetFragmentDataStruct(Entity, InstanceData->NeedType);
-				if (View.IsValid())
+				float NeedValue = 0.f;
+				if (NeedScheduler->ModifyNeed(Entity, InstanceData->NeedType, InstanceData->Operation, InstanceData->ModifyValue)
+					&& NeedScheduler->GetNeedValue(Entity, InstanceData->NeedType, NeedValue))
 				{
-					FArcNeedFragment* NeedFragment = View.GetPtr<FArcNeedFragment>();
-
-					switch (InstanceData->Operation)
-					{
-						case EArcNeedOperation::Add:
-							NeedFragment->CurrentValue += InstanceData->ModifyValue;
-							NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-							break;
-						case EArcNeedOperation::Subtract:
-							NeedFragment->CurrentValue -= InstanceData->ModifyValue;
-							NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-							break;
-						case EArcNeedOperation::Override:
-							NeedFragment->CurrentValue = InstanceData->ModifyValue;
-							NeedFragment->CurrentValue = FMath::Clamp(NeedFragment->CurrentValue, 0.f, 100.f);
-							break;
-					}
-
 					if (InstanceData->FillType == EArcNeedFillType::UntilValue)
 					{
 						bool bComparisonResult = false;
 						switch (InstanceData->TargetCompareOp)
 						{
 							case UE::StateTree::EComparisonOperator::Less:
-								 bComparisonResult = NeedFragment->CurrentValue < InstanceData->ThresholdCompareValue;
+								 bComparisonResult = NeedValue < InstanceData->ThresholdCompareValue;
 								break;
 							case UE::StateTree::EComparisonOperator::LessOrEqual:
-								 bComparisonResult = NeedFragment->CurrentValue <= InstanceData->ThresholdCompareValue;
+								 bComparisonResult = NeedValue <= InstanceData->ThresholdCompareValue;
 								break;
 							case UE::StateTree::EComparisonOperator::Equal:
-								 bComparisonResult = FMath::IsNearlyEqual(NeedFragment->CurrentValue, InstanceData->ThresholdCompareValue, 0.01);
+								 bComparisonResult = FMath::IsNearlyEqual(NeedValue, InstanceData->ThresholdCompareValue, 0.01);
 								break;
 							case UE::StateTree::EComparisonOperator::NotEqual:
-								 bComparisonResult = !FMath::IsNearlyEqual(NeedFragment->CurrentValue, InstanceData->ThresholdCompareValue, 0.01);
+								 bComparisonResult = !FMath::IsNearlyEqual(NeedValue, InstanceData->ThresholdCompareValue, 0.01);
 								break;
 							case UE::StateTree::EComparisonOperator::GreaterOrEqual:
-								 bComparisonResult = NeedFragment->CurrentValue >= InstanceData->ThresholdCompareValue;
+								 bComparisonResult = NeedValue >= InstanceData->ThresholdCompareValue;
 								break;
 							case UE::StateTree::EComparisonOperator::Greater:
-								 bComparisonResult = NeedFragment->CurrentValue > InstanceData->ThresholdCompareValue;
+								 bComparisonResult = NeedValue > InstanceData->ThresholdCompareValue;
 								break;
 						}
 
@@ -197,22 +164,18 @@ float FArcMassNeedConsideration::GetScore(FStateTreeExecutionContext& Context) c
 	FMassStateTreeExecutionContext& MassCtx = static_cast<FMassStateTreeExecutionContext&>(Context);
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	UMassEntitySubsystem* MES = Context.GetWorld()->GetSubsystem<UMassEntitySubsystem>();
-	FMassEntityManager& MEM = MES->GetMutableEntityManager();
-
-	FConstStructView Data = MEM.GetFragmentDataStruct(MassCtx.GetEntity(), InstanceData.NeedType);
-	if (!Data.IsValid())
+	const UArcNeedScheduleSubsystem* NeedScheduler = Context.GetWorld()->GetSubsystem<UArcNeedScheduleSubsystem>();
+	float NeedValue = 0.f;
+	if (!NeedScheduler || !NeedScheduler->GetNeedValue(MassCtx.GetEntity(), InstanceData.NeedType, NeedValue))
 	{
 		return 1.f;
 	}
 
-	const FArcNeedFragment* DataPtr = Data.GetPtr<FArcNeedFragment>();
-
-	InstanceData.NeedValue = DataPtr->CurrentValue;
+	InstanceData.NeedValue = NeedValue;
 
 	float Score = 0.f;
 
-	const float Normalized = DataPtr->CurrentValue / 100.f;
+	const float Normalized = NeedValue / 100.f;
 	Score = ResponseCurve.Evaluate(Normalized);
 	UE_VLOG_UELOG(Context.GetOwner(), LogArcConsiderationScore, VeryVerbose, TEXT("State %s Need %s: %.3f Normalized: %.3f"), *Context.GetActiveStateName(), *Name.ToString(), Score, Normalized);
 	return Score;
@@ -28,7 +28,9 @@ static float ReadNeedValue(const FMassEntityManager* EntityManager, FMassEntityH
 		return 0.0f;
 	}
 
-	return FMath::Clamp(NeedFragment->CurrentValue / MaxNeedValue, 0.0f, 1.0f);
+	const UWorld* World = EntityManager->GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	return FMath::Clamp(NeedFragment->GetValue(Now) / MaxNeedValue, 0.0f, 1.0f);
 }
 
 float FArcUtilityConsideration_TargetNeed::Score(const FArcUtilityTarget& Target, const FArcUtilityContext& Context) const
@@ -17,6 +17,9 @@ public class ArcAITests : ModuleRules
 			"ArcAI",
 			"MassEntity",
 			"MassCore",
+			"MassAIBehavior",
+			"StateTreeModule",
+			"StateTreeEditorModule",
 			"GameplayTags",
 			"SmartObjectsModule",
 			"MassSmartObjects",
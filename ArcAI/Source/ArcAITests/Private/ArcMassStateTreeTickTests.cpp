@@ -0,0 +1,134 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+#include "ArcMassStateTreeTickProcessor.h"
+#include "ArcMassStateTreeTickScheduler.h"
+#include "MassEntityManager.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutionContext.h"
+#include "MassProcessingContext.h"
+#include "MassStateTreeExecutionContext.h"
+#include "MassStateTreeFragments.h"
+#include "MassStateTreeSchema.h"
+#include "MassStateTreeSubsystem.h"
+#include "StateTree.h"
+#include "StateTreeCompiler.h"
+#include "StateTreeCompilerLog.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "Tasks/StateTreeDelayTask.h"
+
+namespace ArcMassStateTreeTickTestHelpers
+{
+	/** Root -> Wait (Delay Duration), tree succeeds when the delay completes. */
+	UStateTree* CreateDelayStateTree(UObject* Outer, float Duration)
+	{
+		UStateTree* StateTree = NewObject<UStateTree>(Outer);
+		UStateTreeEditorData* EditorData = NewObject<UStateTreeEditorData>(StateTree);
+		StateTree->EditorData = EditorData;
+		EditorData->Schema = NewObject<UMassStateTreeSchema>();
+
+		UStateTreeState& Root = EditorData->AddSubTree(FName(TEXT("Root")));
+		UStateTreeState& WaitState = Root.AddChildState(FName(TEXT("Wait")));
+
+		TStateTreeEditorNode<FStateTreeDelayTask>& DelayTask = WaitState.AddTask<FStateTreeDelayTask>();
+		DelayTask.GetInstanceData().Duration = Duration;
+
+		WaitState.AddTransition(EStateTreeTransitionTrigger::OnStateCompleted, EStateTreeTransitionType::Succeeded);
+
+		FStateTreeCompilerLog Log;
+		FStateTreeCompiler Compiler(Log);
+		const bool bCompiled = Compiler.Compile(*StateTree);
+		ensureAlwaysMsgf(bCompiled, TEXT("DelayStateTree failed to compile"));
+		return StateTree;
+	}
+}
+
+TEST_CLASS(ArcMassStateTreeTick_Parking, "ArcAI.StateTree.TickProcessor")
+{
+	FActorTestSpawner Spawner;
+	FMassEntityManager* EntityManager = nullptr;
+	UMassStateTreeSubsystem* MassStateTreeSubsystem = nullptr;
+	UArcMassStateTreeTickScheduler* TickScheduler = nullptr;
+	UArcMassStateTreeTickProcessor* Processor = nullptr;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+
+		UMassEntitySubsystem* MES = Spawner.GetWorld().GetSubsystem<UMassEntitySubsystem>();
+		ASSERT_THAT(IsNotNull(MES));
+		EntityManager = &MES->GetMutableEntityManager();
+
+		MassStateTreeSubsystem = Spawner.GetWorld().GetSubsystem<UMassStateTreeSubsystem>();
+		TickScheduler = Spawner.GetWorld().GetSubsystem<UArcMassStateTreeTickScheduler>();
+		ASSERT_THAT(IsNotNull(MassStateTreeSubsystem));
+		ASSERT_THAT(IsNotNull(TickScheduler));
+
+		Processor = NewObject<UArcMassStateTreeTickProcessor>();
+		Processor->CallInitialize(&Spawner.GetWorld(), EntityManager->AsShared());
+	}
+
+	void RunProcessorAt(double Time, float FrameDeltaTime)
+	{
+		Spawner.GetWorld().TimeSeconds = Time;
+		UE::Mass::FProcessingContext ProcessingContext(*EntityManager, FrameDeltaTime);
+		Processor->CallExecute(*EntityManager, ProcessingContext.GetExecutionContext());
+	}
+
+	EStateTreeRunStatus GetRunStatus(const FMassEntityHandle Entity) const
+	{
+		const FMassStateTreeInstanceFragment& Fragment = EntityManager->GetFragmentDataChecked<FMassStateTreeInstanceFragment>(Entity);
+		const FStateTreeInstanceData* InstanceData = MassStateTreeSubsystem->GetInstanceData(Fragment.InstanceHandle);
+		return InstanceData ? InstanceData->GetExecutionState()->TreeRunStatus : EStateTreeRunStatus::Unset;
+	}
+
+	TEST_METHOD(DelayCompletes_WhileParked)
+	{
+		UStateTree* StateTree = ArcMassStateTreeTickTestHelpers::CreateDelayStateTree(&Spawner.GetWorld(), 2.f);
+
+		FMassStateTreeSharedFragment SharedFragment;
+		SharedFragment.StateTree = StateTree;
+		FMassArchetypeSharedFragmentValues SharedValues;
+		SharedValues.Add(EntityManager->GetOrCreateConstSharedFragment(SharedFragment));
+		SharedValues.Sort();
+
+		TArray<FInstancedStruct> Instances;
+		Instances.Add(FInstancedStruct::Make(FMassStateTreeInstanceFragment()));
+		const FMassEntityHandle Entity = EntityManager->CreateEntity(Instances, SharedValues);
+		EntityManager->AddSparseElementToEntity<FArcMassTickStateTreeTag>(Entity);
+
+		// Start the tree at t=0, as the Mass StateTree activation does.
+		FMassStateTreeInstanceFragment& Fragment = EntityManager->GetFragmentDataChecked<FMassStateTreeInstanceFragment>(Entity);
+		Fragment.InstanceHandle = MassStateTreeSubsystem->AllocateInstanceData(StateTree);
+		Fragment.LastUpdateTimeInSeconds = 0.f;
+		{
+			FStateTreeInstanceData* InstanceData = MassStateTreeSubsystem->GetInstanceData(Fragment.InstanceHandle);
+			ASSERT_THAT(IsNotNull(InstanceData));
+
+			UE::Mass::FProcessingContext ProcessingContext(*EntityManager, 0.f);
+			FMassStateTreeExecutionContext StateTreeContext(*MassStateTreeSubsystem, *StateTree, *InstanceData, ProcessingContext.GetExecutionContext());
+			StateTreeContext.SetEntity(Entity);
+			StateTreeContext.Start();
+		}
+
+		constexpr float FrameDeltaTime = 0.1f;
+		RunProcessorAt(0.1, FrameDeltaTime);
+		ASSERT_THAT(AreEqual(GetRunStatus(Entity), EStateTreeRunStatus::Running));
+
+		// Parked for the rest of the delay, whether or not the tree asked for it.
+		TickScheduler->Park(Entity, 2.5);
+		for (double Time = 0.2; Time < 2.45; Time += FrameDeltaTime)
+		{
+			RunProcessorAt(Time, FrameDeltaTime);
+			ASSERT_THAT(IsTrue(TickScheduler->IsParked(Entity)));
+		}
+		ASSERT_THAT(AreEqual(GetRunStatus(Entity), EStateTreeRunStatus::Running));
+
+		// Woken at 2.5: the tree advances by the 2.4s it was parked, not by one frame.
+		RunProcessorAt(2.5, FrameDeltaTime);
+		ASSERT_THAT(AreEqual(GetRunStatus(Entity), EStateTreeRunStatus::Succeeded));
+	}
+};
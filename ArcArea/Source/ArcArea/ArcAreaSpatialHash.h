@@ -0,0 +1,104 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ArcAreaTypes.h"
+
+/**
+ * Grid-based spatial hash over area locations.
+ * Same layout as FArcKnowledgeSpatialHash, storing FArcAreaHandle.
+ * Areas do not move after registration, so there is no Update.
+ *
+ * Owned by UArcAreaSubsystem — maintained inline during RegisterArea / UnregisterArea.
+ */
+struct FArcAreaSpatialHash
+{
+	struct FEntry
+	{
+		FArcAreaHandle Handle;
+		FVector Location;
+	};
+
+	/** Grid cell size in world units. Larger = fewer cells, less precision. */
+	float CellSize = 5000.0f;
+
+	/** Add an area to the spatial hash. */
+	void Add(FArcAreaHandle Handle, const FVector& Location);
+
+	/** Remove an area from the spatial hash. */
+	void Remove(FArcAreaHandle Handle, const FVector& Location);
+
+	/** Clear all entries. */
+	void Clear();
+
+	/** Gather entries within a sphere. Appends to OutEntries. */
+	void QuerySphere(const FVector& Center, float Radius, TArray<FEntry>& OutEntries) const;
+
+private:
+	FIntVector WorldToGrid(const FVector& Pos) const
+	{
+		return FIntVector(
+			FMath::FloorToInt(Pos.X / CellSize),
+			FMath::FloorToInt(Pos.Y / CellSize),
+			FMath::FloorToInt(Pos.Z / CellSize)
+		);
+	}
+
+	TMap<FIntVector, TArray<FEntry>> Cells;
+};
+
+// ---------- Inline implementations ----------
+
+inline void FArcAreaSpatialHash::Add(FArcAreaHandle Handle, const FVector& Location)
+{
+	Cells.FindOrAdd(WorldToGrid(Location)).Add({Handle, Location});
+}
+
+inline void FArcAreaSpatialHash::Remove(FArcAreaHandle Handle, const FVector& Location)
+{
+	const FIntVector GridCoords = WorldToGrid(Location);
+	if (TArray<FEntry>* Bucket = Cells.Find(GridCoords))
+	{
+		Bucket->RemoveAllSwap([Handle](const FEntry& E) { return E.Handle == Handle; });
+		if (Bucket->IsEmpty())
+		{
+			Cells.Remove(GridCoords);
+		}
+	}
+}
+
+inline void FArcAreaSpatialHash::Clear()
+{
+	Cells.Empty();
+}
+
+inline void FArcAreaSpatialHash::QuerySphere(const FVector& Center, float Radius, TArray<FEntry>& OutEntries) const
+{
+	const double RadiusSq = static_cast<double>(Radius) * Radius;
+	const FIntVector MinGrid = WorldToGrid(Center - FVector(Radius));
+	const FIntVector MaxGrid = WorldToGrid(Center + FVector(Radius));
+
+	for (int32 X = MinGrid.X; X <= MaxGrid.X; ++X)
+	{
+		for (int32 Y = MinGrid.Y; Y <= MaxGrid.Y; ++Y)
+		{
+			for (int32 Z = MinGrid.Z; Z <= MaxGrid.Z; ++Z)
+			{
+				const TArray<FEntry>* Bucket = Cells.Find(FIntVector(X, Y, Z));
+				if (!Bucket)
+				{
+					continue;
+				}
+
+				for (const FEntry& E : *Bucket)
+				{
+					if (FVector::DistSquared(Center, E.Location) <= RadiusSq)
+					{
+						OutEntries.Add(E);
+					}
+				}
+			}
+		}
+	}
+}
@@ -15,6 +15,7 @@
 void UArcAreaSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	SpatialHash.CellSize = SpatialHashCellSize;
 }
 
 void UArcAreaSubsystem::Deinitialize()
@@ -22,6 +23,8 @@ void UArcAreaSubsystem::Deinitialize()
 	Areas.Empty();
 	EntityAssignmentIndex.Empty();
 	EntityAssignmentDelegates.Empty();
+	TagIndex.Empty();
+	SpatialHash.Clear();
 	Super::Deinitialize();
 }
 
@@ -54,6 +57,7 @@ FArcAreaHandle UArcAreaSubsystem::RegisterArea(
 
 	// Initialize runtime slot state
 	Data.Slots.SetNum(Definition->Slots.Num());
+	Data.VacantSlotMask.Init(true, Data.Slots.Num());
 
 	// Copy ActivityTags from SmartObject slots into runtime area slots
 	if (SOHandle.IsValid())
@@ -75,6 +79,9 @@ FArcAreaHandle UArcAreaSubsystem::RegisterArea(
 		}
 	}
 
+	AddToTagIndex(Handle, Data.AreaTags);
+	SpatialHash.Add(Handle, Data.Location);
+
 	Areas.Add(Handle, MoveTemp(Data));
 
 	// Broadcast initial Vacant state for all slots
@@ -121,7 +128,13 @@ void UArcAreaSubsystem::UnregisterArea(FArcAreaHandle Handle)
 		}
 	}
 
-	Areas.Remove(Handle);
+	// Listeners above may have unregistered the area themselves.
+	if (const FArcAreaData* Removed = Areas.Find(Handle))
+	{
+		RemoveFromTagIndex(Handle, Removed->AreaTags);
+		SpatialHash.Remove(Handle, Removed->Location);
+		Areas.Remove(Handle);
+	}
 }
 
 // ====================================================================
@@ -154,7 +167,7 @@ bool UArcAreaSubsystem::AssignToSlot(FArcAreaSlotHandle SlotHandle, FMassEntityH
 	}
 
 	// Set assignment state
-	Slot.State = EArcAreaSlotState::Assigned;
+	SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Assigned);
 	Slot.AssignedEntity = Entity;
 
 	// Add to reverse index
@@ -192,7 +205,7 @@ bool UArcAreaSubsystem::UnassignFromSlot(FArcAreaSlotHandle SlotHandle)
 	const FMassEntityHandle PreviousEntity = Slot.AssignedEntity;
 
 	// Clear assignment
-	Slot.State = EArcAreaSlotState::Vacant;
+	SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Vacant);
 	Slot.AssignedEntity = FMassEntityHandle();
 
 	// Remove from reverse index
@@ -277,7 +290,7 @@ void UArcAreaSubsystem::NotifySlotClaimed(FArcAreaSlotHandle SlotHandle)
 	FArcAreaSlotRuntime& Slot = Data->Slots[SlotHandle.SlotIndex];
 	if (Slot.State == EArcAreaSlotState::Assigned)
 	{
-		Slot.State = EArcAreaSlotState::Active;
+		SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Active);
 		BroadcastOnSlotStateChanged(SlotHandle, EArcAreaSlotState::Active);
 	}
 }
@@ -293,7 +306,7 @@ void UArcAreaSubsystem::NotifySlotReleased(FArcAreaSlotHandle SlotHandle)
 	FArcAreaSlotRuntime& Slot = Data->Slots[SlotHandle.SlotIndex];
 	if (Slot.State == EArcAreaSlotState::Active)
 	{
-		Slot.State = EArcAreaSlotState::Assigned;
+		SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Assigned);
 		BroadcastOnSlotStateChanged(SlotHandle, EArcAreaSlotState::Assigned);
 	}
 }
@@ -326,7 +339,7 @@ void UArcAreaSubsystem::DisableSlot(FArcAreaSlotHandle SlotHandle)
 		ClearNPCAssignmentFragment(PreviousEntity);
 	}
 
-	Slot.State = EArcAreaSlotState::Disabled;
+	SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Disabled);
 	BroadcastOnSlotStateChanged(SlotHandle, EArcAreaSlotState::Disabled);
 
 	if (PreviousEntity.IsValid())
@@ -352,7 +365,7 @@ void UArcAreaSubsystem::EnableSlot(FArcAreaSlotHandle SlotHandle)
 		return;
 	}
 
-	Slot.State = EArcAreaSlotState::Vacant;
+	SetSlotState(*Data, SlotHandle.SlotIndex, EArcAreaSlotState::Vacant);
 	BroadcastOnSlotStateChanged(SlotHandle, EArcAreaSlotState::Vacant);
 }
 
@@ -378,32 +391,126 @@ EArcAreaSlotState UArcAreaSubsystem::GetSlotState(FArcAreaSlotHandle SlotHandle)
 TArray<FArcAreaHandle> UArcAreaSubsystem::FindAreasByTags(const FGameplayTagQuery& TagQuery) const
 {
 	TArray<FArcAreaHandle> Result;
-	for (const auto& Pair : Areas)
+
+	TArray<FArcAreaHandle> Candidates;
+	if (!GatherTagCandidates(TagQuery, Candidates))
 	{
-		if (TagQuery.Matches(Pair.Value.AreaTags))
+		for (const auto& Pair : Areas)
 		{
-			Result.Add(Pair.Key);
+			if (TagQuery.Matches(Pair.Value.AreaTags))
+			{
+				Result.Add(Pair.Key);
+			}
+		}
+		return Result;
+	}
+
+	for (const FArcAreaHandle& Handle : Candidates)
+	{
+		const FArcAreaData* Data = Areas.Find(Handle);
+		if (Data && TagQuery.Matches(Data->AreaTags))
+		{
+			Result.Add(Handle);
 		}
 	}
 	return Result;
 }
 
-bool UArcAreaSubsystem::HasVacancy(FArcAreaHandle Handle) const
+TArray<FArcAreaHandle> UArcAreaSubsystem::FindAreasInRadius(const FVector& Origin, float Radius, const FGameplayTagQuery& TagQuery) const
 {
-	const FArcAreaData* Data = Areas.Find(Handle);
-	if (!Data)
+	TArray<FArcAreaHandle> Result;
+
+	TArray<FArcAreaSpatialHash::FEntry> Nearby;
+	SpatialHash.QuerySphere(Origin, Radius, Nearby);
+
+	for (const FArcAreaSpatialHash::FEntry& Entry : Nearby)
 	{
-		return false;
+		const FArcAreaData* Data = Areas.Find(Entry.Handle);
+		if (Data && (TagQuery.IsEmpty() || TagQuery.Matches(Data->AreaTags)))
+		{
+			Result.Add(Entry.Handle);
+		}
 	}
+	return Result;
+}
+
+FArcAreaSlotHandle UArcAreaSubsystem::FindNearestVacantSlot(const FVector& Origin, float MaxDistance, const FGameplayTagQuery& TagQuery) const
+{
+	FArcAreaHandle BestArea;
+	double BestDistSq = TNumericLimits<double>::Max();
 
-	for (const FArcAreaSlotRuntime& Slot : Data->Slots)
+	auto Consider = [&](FArcAreaHandle Handle, const FArcAreaData& Data)
 	{
-		if (Slot.State == EArcAreaSlotState::Vacant)
+		if (!Data.VacantSlotMask.Contains(true))
 		{
-			return true;
+			return;
+		}
+		if (!TagQuery.IsEmpty() && !TagQuery.Matches(Data.AreaTags))
+		{
+			return;
+		}
+
+		const double DistSq = FVector::DistSquared(Origin, Data.Location);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			BestArea = Handle;
+		}
+	};
+
+	if (MaxDistance > 0.0f)
+	{
+		TArray<FArcAreaSpatialHash::FEntry> Nearby;
+		SpatialHash.QuerySphere(Origin, MaxDistance, Nearby);
+		for (const FArcAreaSpatialHash::FEntry& Entry : Nearby)
+		{
+			if (const FArcAreaData* Data = Areas.Find(Entry.Handle))
+			{
+				Consider(Entry.Handle, *Data);
+			}
 		}
 	}
-	return false;
+	else
+	{
+		TArray<FArcAreaHandle> Candidates;
+		if (!TagQuery.IsEmpty() && GatherTagCandidates(TagQuery, Candidates))
+		{
+			for (const FArcAreaHandle& Handle : Candidates)
+			{
+				if (const FArcAreaData* Data = Areas.Find(Handle))
+				{
+					Consider(Handle, *Data);
+				}
+			}
+		}
+		else
+		{
+			for (const auto& Pair : Areas)
+			{
+				Consider(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	if (!BestArea.IsValid())
+	{
+		return FArcAreaSlotHandle();
+	}
+
+	const FArcAreaData& Best = Areas.FindChecked(BestArea);
+	return FArcAreaSlotHandle(BestArea, Best.VacantSlotMask.Find(true));
+}
+
+bool UArcAreaSubsystem::HasVacancy(FArcAreaHandle Handle) const
+{
+	const FArcAreaData* Data = Areas.Find(Handle);
+	return Data && Data->VacantSlotMask.Contains(true);
+}
+
+int32 UArcAreaSubsystem::GetVacantSlotCount(FArcAreaHandle Handle) const
+{
+	const FArcAreaData* Data = Areas.Find(Handle);
+	return Data ? Data->VacantSlotMask.CountSetBits() : 0;
 }
 
 TArray<FArcAreaSlotHandle> UArcAreaSubsystem::GetVacantSlots(FArcAreaHandle Handle) const
@@ -415,14 +522,73 @@ TArray<FArcAreaSlotHandle> UArcAreaSubsystem::GetVacantSlots(FArcAreaHandle Hand
 		return Result;
 	}
 
-	for (int32 i = 0; i < Data->Slots.Num(); ++i)
+	for (TConstSetBitIterator<> It(Data->VacantSlotMask); It; ++It)
 	{
-		if (Data->Slots[i].State == EArcAreaSlotState::Vacant)
+		Result.Emplace(Handle, It.GetIndex());
+	}
+	return Result;
+}
+
+// ====================================================================
+// Indices (Private)
+// ====================================================================
+
+void UArcAreaSubsystem::SetSlotState(FArcAreaData& Data, int32 SlotIndex, EArcAreaSlotState NewState)
+{
+	Data.Slots[SlotIndex].State = NewState;
+	Data.VacantSlotMask[SlotIndex] = NewState == EArcAreaSlotState::Vacant;
+}
+
+void UArcAreaSubsystem::AddToTagIndex(FArcAreaHandle Handle, const FGameplayTagContainer& Tags)
+{
+	for (const FGameplayTag& Tag : Tags.GetGameplayTagParents())
+	{
+		TagIndex.FindOrAdd(Tag).AddUnique(Handle);
+	}
+}
+
+void UArcAreaSubsystem::RemoveFromTagIndex(FArcAreaHandle Handle, const FGameplayTagContainer& Tags)
+{
+	for (const FGameplayTag& Tag : Tags.GetGameplayTagParents())
+	{
+		if (TArray<FArcAreaHandle>* Handles = TagIndex.Find(Tag))
 		{
-			Result.Emplace(Handle, i);
+			Handles->RemoveSingleSwap(Handle);
+			if (Handles->IsEmpty())
+			{
+				TagIndex.Remove(Tag);
+			}
 		}
 	}
-	return Result;
+}
+
+bool UArcAreaSubsystem::GatherTagCandidates(const FGameplayTagQuery& TagQuery, TArray<FArcAreaHandle>& OutCandidates) const
+{
+	// Every query term tests area tags against the tags the query references. An area holding
+	// none of them evaluates exactly like an empty container, so if that fails, only areas found
+	// under a referenced tag can match.
+	if (TagQuery.Matches(FGameplayTagContainer::EmptyContainer))
+	{
+		return false;
+	}
+
+	TSet<FArcAreaHandle> Seen;
+	for (const FGameplayTag& Tag : TagQuery.GetGameplayTagArray())
+	{
+		if (const TArray<FArcAreaHandle>* Handles = TagIndex.Find(Tag))
+		{
+			for (const FArcAreaHandle& Handle : *Handles)
+			{
+				bool bAlreadySeen = false;
+				Seen.Add(Handle, &bAlreadySeen);
+				if (!bAlreadySeen)
+				{
+					OutCandidates.Add(Handle);
+				}
+			}
+		}
+	}
+	return true;
 }
 
 // ====================================================================
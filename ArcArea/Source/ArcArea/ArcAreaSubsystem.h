@@ -6,6 +6,7 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "ArcAreaTypes.h"
 #include "ArcAreaSlotDefinition.h"
+#include "ArcAreaSpatialHash.h"
 #include "ArcMacroDefines.h"
 #include "ArcAreaSubsystem.generated.h"
 
@@ -35,6 +36,9 @@ struct FArcAreaEntityDelegates
  * Slot state changes are broadcast via OnSlotStateChanged delegate.
  * External listeners (e.g., UArcAreaAutoVacancyListener, future town manager)
  * decide whether to post advertisements to ArcKnowledge.
+ *
+ * Queries run against three indices kept current by every mutation: a spatial hash
+ * over area locations, a tag → areas index, and a per-area vacant slot bitmask.
  */
 UCLASS()
 class ARCAREA_API UArcAreaSubsystem : public UWorldSubsystem
@@ -145,10 +149,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
 	TArray<FArcAreaHandle> FindAreasByTags(const FGameplayTagQuery& TagQuery) const;
 
+	/** Find all areas within Radius of Origin matching a tag query. An empty query matches every area. */
+	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
+	TArray<FArcAreaHandle> FindAreasInRadius(const FVector& Origin, float Radius, const FGameplayTagQuery& TagQuery) const;
+
+	/**
+	 * Find the vacant slot closest to Origin whose area matches a tag query.
+	 * MaxDistance <= 0 means unbounded. Returns an invalid handle if nothing is vacant.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
+	FArcAreaSlotHandle FindNearestVacantSlot(const FVector& Origin, float MaxDistance, const FGameplayTagQuery& TagQuery) const;
+
 	/** Whether any slot in this area is vacant. */
 	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
 	bool HasVacancy(FArcAreaHandle Handle) const;
 
+	/** Number of vacant slots in an area. */
+	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
+	int32 GetVacantSlotCount(FArcAreaHandle Handle) const;
+
 	/** Get all vacant slots in an area. */
 	UFUNCTION(BlueprintCallable, Category = "ArcArea|Queries")
 	TArray<FArcAreaSlotHandle> GetVacantSlots(FArcAreaHandle Handle) const;
@@ -156,10 +175,28 @@ public:
 	/** Get all registered areas. */
 	const TMap<FArcAreaHandle, FArcAreaData>& GetAllAreas() const { return Areas; }
 
+	/** Grid cell size for the area spatial hash in world units. Larger = fewer cells, less precision. */
+	UPROPERTY(EditAnywhere, Category = "Configuration")
+	float SpatialHashCellSize = 5000.0f;
+
 private:
 	void UpdateNPCAssignmentFragment(FMassEntityHandle Entity, FArcAreaSlotHandle SlotHandle);
 	void ClearNPCAssignmentFragment(FMassEntityHandle Entity);
 
+	/** Set a slot's state and keep the area's VacantSlotMask in sync. Does not broadcast. */
+	static void SetSlotState(FArcAreaData& Data, int32 SlotIndex, EArcAreaSlotState NewState);
+
+	// Tag index management. Each tag is indexed together with its parents, so a query
+	// for Area.Work also finds areas tagged Area.Work.Forge.
+	void AddToTagIndex(FArcAreaHandle Handle, const FGameplayTagContainer& Tags);
+	void RemoveFromTagIndex(FArcAreaHandle Handle, const FGameplayTagContainer& Tags);
+
+	/**
+	 * Gather areas that may match TagQuery from the tag index. Returns false when the query
+	 * matches an empty container — then any area can match and the caller must consider all of them.
+	 */
+	bool GatherTagCandidates(const FGameplayTagQuery& TagQuery, TArray<FArcAreaHandle>& OutCandidates) const;
+
 	// ---------- Storage ----------
 
 	/** All areas, keyed by handle. */
@@ -170,4 +207,10 @@ private:
 
 	/** Per-entity delegates for assignment/unassignment notifications. */
 	TMap<FMassEntityHandle, FArcAreaEntityDelegates> EntityAssignmentDelegates;
+
+	/** Tag (and each of its parents) → areas carrying it. */
+	TMap<FGameplayTag, TArray<FArcAreaHandle>> TagIndex;
+
+	/** Spatial hash over area locations. Maintained inline during registration. */
+	FArcAreaSpatialHash SpatialHash;
 };
@@ -136,4 +136,7 @@ struct ARCAREA_API FArcAreaData
 	/** Copied from definition for runtime access without loading the asset. */
 	UPROPERTY()
 	TArray<FArcAreaSlotDefinition> SlotDefinitions;
+
+	/** Bit per slot, set while the slot is Vacant. Maintained by UArcAreaSubsystem alongside Slots. */
+	TBitArray<> VacantSlotMask;
 };
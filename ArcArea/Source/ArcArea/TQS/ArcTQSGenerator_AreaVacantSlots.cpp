@@ -19,41 +19,40 @@ void FArcTQSGenerator_AreaVacantSlots::GenerateItems(const FArcTQSQueryContext&
 		return;
 	}
 
-	const float MaxDistSq = MaxDistance > 0.0f ? MaxDistance * MaxDistance : 0.0f;
-
 	FInstancedPropertyBag TemplateBag = ArcTQS::Area::MakeSlotTemplate();
 
-	const TMap<FArcAreaHandle, FArcAreaData>& AllAreas = Subsystem->GetAllAreas();
+	// Candidate areas come from the subsystem's spatial or tag index; both apply the tag filter.
+	TArray<FArcAreaHandle> Candidates;
+	if (MaxDistance > 0.0f)
+	{
+		Candidates = Subsystem->FindAreasInRadius(QueryContext.QuerierLocation, MaxDistance, AreaTagQuery);
+	}
+	else if (!AreaTagQuery.IsEmpty())
+	{
+		Candidates = Subsystem->FindAreasByTags(AreaTagQuery);
+	}
+	else
+	{
+		Subsystem->GetAllAreas().GetKeys(Candidates);
+	}
 
-	for (const auto& [Handle, AreaData] : AllAreas)
+	for (const FArcAreaHandle& Handle : Candidates)
 	{
-		// Tag filter
-		if (!AreaTagQuery.IsEmpty() && !AreaTagQuery.Matches(AreaData.AreaTags))
+		const FArcAreaData* AreaData = Subsystem->GetAreaData(Handle);
+		if (!AreaData)
 		{
 			continue;
 		}
 
-		// Distance filter
-		if (MaxDistSq > 0.0f)
-		{
-			const float DistSq = FVector::DistSquared(QueryContext.QuerierLocation, AreaData.Location);
-			if (DistSq > MaxDistSq)
-			{
-				continue;
-			}
-		}
-
 		// Iterate vacant slots
-		const TArray<FArcAreaSlotHandle> VacantSlots = Subsystem->GetVacantSlots(Handle);
-
-		for (const FArcAreaSlotHandle& SlotHandle : VacantSlots)
+		for (TConstSetBitIterator<> It(AreaData->VacantSlotMask); It; ++It)
 		{
 			FArcTQSTargetItem Item;
 			Item.TargetType = EArcTQSTargetType::Location;
-			Item.Location = AreaData.Location;
+			Item.Location = AreaData->Location;
 
 			Item.ItemData = TemplateBag;
-			ArcTQS::Area::SetSlotHandle(Item.ItemData, SlotHandle);
+			ArcTQS::Area::SetSlotHandle(Item.ItemData, FArcAreaSlotHandle(Handle, It.GetIndex()));
 
 			OutItems.Add(MoveTemp(Item));
 		}
@@ -32,14 +32,7 @@ float FArcTQSStep_AreaVacancyFilter::ExecuteStep(const FArcTQSTargetItem& Item,
 		return 0.0f;
 	}
 
-	int32 VacantCount = 0;
-	for (const FArcAreaSlotRuntime& Slot : AreaData->Slots)
-	{
-		if (Slot.State == EArcAreaSlotState::Vacant)
-		{
-			++VacantCount;
-		}
-	}
+	const int32 VacantCount = AreaData->VacantSlotMask.CountSetBits();
 
 	return VacantCount >= MinVacantSlots ? 1.0f : 0.0f;
 }
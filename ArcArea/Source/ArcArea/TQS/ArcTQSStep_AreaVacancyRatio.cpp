@@ -32,14 +32,7 @@ float FArcTQSStep_AreaVacancyRatio::ExecuteStep(const FArcTQSTargetItem& Item, c
 		return 0.0f;
 	}
 
-	int32 VacantCount = 0;
-	for (const FArcAreaSlotRuntime& Slot : AreaData->Slots)
-	{
-		if (Slot.State == EArcAreaSlotState::Vacant)
-		{
-			++VacantCount;
-		}
-	}
+	const int32 VacantCount = AreaData->VacantSlotMask.CountSetBits();
 
 	const float Ratio = static_cast<float>(VacantCount) / static_cast<float>(AreaData->Slots.Num());
 	return bInvert ? (1.0f - Ratio) : Ratio;
@@ -0,0 +1,371 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+
+#include "NativeGameplayTags.h"
+#include "Math/RandomStream.h"
+
+#include "ArcAreaSubsystem.h"
+#include "ArcAreaDefinition.h"
+#include "ArcAreaTypes.h"
+
+// ---- Test gameplay tags ----
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestArea_Work, "TestArea.Work");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestArea_Work_Forge, "TestArea.Work.Forge");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestArea_Work_Farm, "TestArea.Work.Farm");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestArea_Market, "TestArea.Market");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestArea_Guard, "TestArea.Guard");
+
+// ===================================================================
+// Helpers
+// ===================================================================
+
+namespace ArcAreaTestHelpers
+{
+	UArcAreaSubsystem* GetSubsystem(FActorTestSpawner& Spawner)
+	{
+		UWorld* World = &Spawner.GetWorld();
+		return World ? World->GetSubsystem<UArcAreaSubsystem>() : nullptr;
+	}
+
+	UArcAreaDefinition* MakeDefinition(const FGameplayTagContainer& Tags, int32 NumSlots)
+	{
+		UArcAreaDefinition* Definition = NewObject<UArcAreaDefinition>(GetTransientPackage());
+		Definition->AreaTags = Tags;
+		Definition->Slots.SetNum(NumSlots);
+		return Definition;
+	}
+
+	FArcAreaHandle Register(UArcAreaSubsystem* Sub, FGameplayTag Tag, FVector Location, int32 NumSlots = 2)
+	{
+		return Sub->RegisterArea(MakeDefinition(FGameplayTagContainer(Tag), NumSlots), Location, FSmartObjectHandle(), FMassEntityHandle());
+	}
+
+	FMassEntityHandle MakeEntity(int32 Index)
+	{
+		return FMassEntityHandle(Index, 1);
+	}
+
+	FGameplayTag PickTag(FRandomStream& Rng)
+	{
+		const FGameplayTag Tags[] = { TAG_TestArea_Work, TAG_TestArea_Work_Forge, TAG_TestArea_Work_Farm, TAG_TestArea_Market, TAG_TestArea_Guard };
+		return Tags[Rng.RandHelper(UE_ARRAY_COUNT(Tags))];
+	}
+
+	FVector PickLocation(FRandomStream& Rng)
+	{
+		return FVector(Rng.FRandRange(-20000.0f, 20000.0f), Rng.FRandRange(-20000.0f, 20000.0f), Rng.FRandRange(-500.0f, 500.0f));
+	}
+
+	/** Reference answer for FindAreasByTags / FindAreasInRadius by scanning every area. */
+	TSet<FArcAreaHandle> BruteForceAreas(const UArcAreaSubsystem* Sub, const FGameplayTagQuery& TagQuery, const FVector& Origin, float Radius)
+	{
+		TSet<FArcAreaHandle> Result;
+		for (const auto& [Handle, Data] : Sub->GetAllAreas())
+		{
+			if (Radius > 0.0f && FVector::DistSquared(Origin, Data.Location) > FMath::Square(Radius))
+			{
+				continue;
+			}
+			if (!TagQuery.IsEmpty() && !TagQuery.Matches(Data.AreaTags))
+			{
+				continue;
+			}
+			Result.Add(Handle);
+		}
+		return Result;
+	}
+
+	/** Squared distance to the nearest area with a Vacant slot, read from slot state rather than the vacancy mask. */
+	double BruteForceNearestVacantDistSq(const UArcAreaSubsystem* Sub, const FGameplayTagQuery& TagQuery, const FVector& Origin, float MaxDistance)
+	{
+		double BestDistSq = TNumericLimits<double>::Max();
+		for (const auto& [Handle, Data] : Sub->GetAllAreas())
+		{
+			if (!TagQuery.IsEmpty() && !TagQuery.Matches(Data.AreaTags))
+			{
+				continue;
+			}
+
+			const bool bVacant = Data.Slots.ContainsByPredicate([](const FArcAreaSlotRuntime& Slot) { return Slot.State == EArcAreaSlotState::Vacant; });
+			const double DistSq = FVector::DistSquared(Origin, Data.Location);
+			if (bVacant && (MaxDistance <= 0.0f || DistSq <= FMath::Square(MaxDistance)))
+			{
+				BestDistSq = FMath::Min(BestDistSq, DistSq);
+			}
+		}
+		return BestDistSq;
+	}
+
+	/** True if every area's vacancy mask, count and slot list agree with its slot states. */
+	bool VacancyIndexMatchesSlots(const UArcAreaSubsystem* Sub)
+	{
+		for (const auto& [Handle, Data] : Sub->GetAllAreas())
+		{
+			if (Data.VacantSlotMask.Num() != Data.Slots.Num())
+			{
+				return false;
+			}
+
+			int32 Vacant = 0;
+			for (int32 i = 0; i < Data.Slots.Num(); ++i)
+			{
+				const bool bVacant = Data.Slots[i].State == EArcAreaSlotState::Vacant;
+				if (Data.VacantSlotMask[i] != bVacant)
+				{
+					return false;
+				}
+				Vacant += bVacant ? 1 : 0;
+			}
+
+			if (Sub->GetVacantSlotCount(Handle) != Vacant
+				|| Sub->GetVacantSlots(Handle).Num() != Vacant
+				|| Sub->HasVacancy(Handle) != (Vacant > 0))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** True if Found holds each handle of Expected exactly once and nothing else. */
+	bool SameAreas(const TArray<FArcAreaHandle>& Found, const TSet<FArcAreaHandle>& Expected)
+	{
+		return Found.Num() == Expected.Num() && TSet<FArcAreaHandle>(Found).Includes(Expected);
+	}
+}
+
+// ===================================================================
+// Tag Index — hierarchy and query shapes
+// ===================================================================
+
+TEST_CLASS(ArcArea_TagIndex, "ArcArea.Index.Tags")
+{
+	FActorTestSpawner Spawner;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+	}
+
+	TEST_METHOD(ParentTagQuery_FindsChildTaggedAreas)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		const FArcAreaHandle Forge = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector::ZeroVector);
+		const FArcAreaHandle Market = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Market, FVector::ZeroVector);
+
+		const TArray<FArcAreaHandle> Found = Sub->FindAreasByTags(FGameplayTagQuery::MakeQuery_MatchTag(TAG_TestArea_Work));
+		ASSERT_THAT(AreEqual(1, Found.Num()));
+		ASSERT_THAT(AreEqual(Forge, Found[0], TEXT("Query on a parent tag should find areas tagged with a child")));
+		ASSERT_THAT(IsFalse(Found.Contains(Market)));
+	}
+
+	TEST_METHOD(NegatedQuery_FindsUntaggedMatches)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector::ZeroVector);
+		const FArcAreaHandle Market = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Market, FVector::ZeroVector);
+
+		const TArray<FArcAreaHandle> Found = Sub->FindAreasByTags(FGameplayTagQuery::MakeQuery_MatchNoTags(FGameplayTagContainer(TAG_TestArea_Work)));
+		ASSERT_THAT(AreEqual(1, Found.Num()));
+		ASSERT_THAT(AreEqual(Market, Found[0], TEXT("A query that matches an empty container must not be limited to indexed tags")));
+	}
+
+	TEST_METHOD(Unregister_RemovesFromTagIndex)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		const FArcAreaHandle Forge = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector::ZeroVector);
+		Sub->UnregisterArea(Forge);
+
+		ASSERT_THAT(IsTrue(Sub->FindAreasByTags(FGameplayTagQuery::MakeQuery_MatchTag(TAG_TestArea_Work)).IsEmpty()));
+		ASSERT_THAT(IsTrue(Sub->FindAreasInRadius(FVector::ZeroVector, 1000.0f, FGameplayTagQuery()).IsEmpty()));
+	}
+};
+
+// ===================================================================
+// Vacancy — mask follows slot state, nearest vacant slot
+// ===================================================================
+
+TEST_CLASS(ArcArea_Vacancy, "ArcArea.Index.Vacancy")
+{
+	FActorTestSpawner Spawner;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+	}
+
+	TEST_METHOD(ClaimAndRelease_KeepSlotOccupied)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		const FArcAreaHandle Area = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector::ZeroVector, 1);
+		const FArcAreaSlotHandle Slot(Area, 0);
+		ASSERT_THAT(IsTrue(Sub->HasVacancy(Area)));
+
+		ASSERT_THAT(IsTrue(Sub->AssignToSlot(Slot, ArcAreaTestHelpers::MakeEntity(1))));
+		ASSERT_THAT(IsFalse(Sub->HasVacancy(Area)));
+
+		Sub->NotifySlotClaimed(Slot);
+		ASSERT_THAT(IsFalse(Sub->HasVacancy(Area), TEXT("Active slot is not vacant")));
+
+		Sub->NotifySlotReleased(Slot);
+		ASSERT_THAT(IsFalse(Sub->HasVacancy(Area), TEXT("Released slot is still assigned")));
+
+		Sub->UnassignFromSlot(Slot);
+		ASSERT_THAT(AreEqual(1, Sub->GetVacantSlotCount(Area)));
+	}
+
+	TEST_METHOD(NearestVacant_SkipsFullAndFarAreas)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		const FArcAreaHandle Near = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector(100, 0, 0), 1);
+		const FArcAreaHandle Mid = ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Work_Forge, FVector(2000, 0, 0), 2);
+		ArcAreaTestHelpers::Register(Sub, TAG_TestArea_Market, FVector(50, 0, 0), 1);
+
+		const FGameplayTagQuery WorkQuery = FGameplayTagQuery::MakeQuery_MatchTag(TAG_TestArea_Work);
+
+		ASSERT_THAT(AreEqual(FArcAreaSlotHandle(Near, 0), Sub->FindNearestVacantSlot(FVector::ZeroVector, 5000.0f, WorkQuery)));
+
+		Sub->AssignToSlot(FArcAreaSlotHandle(Near, 0), ArcAreaTestHelpers::MakeEntity(1));
+		Sub->DisableSlot(FArcAreaSlotHandle(Mid, 0));
+		ASSERT_THAT(AreEqual(FArcAreaSlotHandle(Mid, 1), Sub->FindNearestVacantSlot(FVector::ZeroVector, 5000.0f, WorkQuery)));
+		ASSERT_THAT(AreEqual(FArcAreaSlotHandle(Mid, 1), Sub->FindNearestVacantSlot(FVector::ZeroVector, 0.0f, WorkQuery)));
+
+		ASSERT_THAT(IsFalse(Sub->FindNearestVacantSlot(FVector::ZeroVector, 1000.0f, WorkQuery).IsValid(), TEXT("Mid is out of range")));
+
+		Sub->EnableSlot(FArcAreaSlotHandle(Mid, 0));
+		ASSERT_THAT(AreEqual(FArcAreaSlotHandle(Mid, 0), Sub->FindNearestVacantSlot(FVector::ZeroVector, 5000.0f, WorkQuery)));
+	}
+};
+
+// ===================================================================
+// Churn — indexed queries agree with full scans after random mutations
+// ===================================================================
+
+TEST_CLASS(ArcArea_IndexChurn, "ArcArea.Index.Churn")
+{
+	FActorTestSpawner Spawner;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+	}
+
+	TEST_METHOD(RandomMutations_IndexMatchesBruteForce)
+	{
+		UArcAreaSubsystem* Sub = ArcAreaTestHelpers::GetSubsystem(Spawner);
+		ASSERT_THAT(IsNotNull(Sub));
+
+		FRandomStream Rng(4242);
+		TArray<FArcAreaHandle> Live;
+		int32 NextEntity = 1;
+
+		const FGameplayTagQuery Queries[] =
+		{
+			FGameplayTagQuery(),
+			FGameplayTagQuery::MakeQuery_MatchTag(TAG_TestArea_Work),
+			FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>{ TAG_TestArea_Market, TAG_TestArea_Work_Farm })),
+			FGameplayTagQuery::MakeQuery_ExactMatchAnyTags(FGameplayTagContainer(TAG_TestArea_Work)),
+			FGameplayTagQuery::MakeQuery_MatchNoTags(FGameplayTagContainer(TAG_TestArea_Guard)),
+		};
+
+		for (int32 Step = 0; Step < 600; ++Step)
+		{
+			const int32 Op = Live.IsEmpty() ? 0 : Rng.RandHelper(8);
+			if (Op == 0 || Live.Num() < 8)
+			{
+				Live.Add(ArcAreaTestHelpers::Register(Sub, ArcAreaTestHelpers::PickTag(Rng), ArcAreaTestHelpers::PickLocation(Rng), 1 + Rng.RandHelper(4)));
+				continue;
+			}
+
+			const int32 AreaIndex = Rng.RandHelper(Live.Num());
+			const FArcAreaHandle Area = Live[AreaIndex];
+			const FArcAreaData* Data = Sub->GetAreaData(Area);
+			ASSERT_THAT(IsNotNull(Data));
+			const FArcAreaSlotHandle Slot(Area, Rng.RandHelper(Data->Slots.Num()));
+
+			switch (Op)
+			{
+			case 1:
+				Sub->UnregisterArea(Area);
+				Live.RemoveAtSwap(AreaIndex);
+				break;
+			case 2:
+			case 3:
+				Sub->AssignToSlot(Slot, ArcAreaTestHelpers::MakeEntity(NextEntity++));
+				break;
+			case 4:
+				Sub->UnassignFromSlot(Slot);
+				break;
+			case 5:
+				Sub->NotifySlotClaimed(Slot);
+				break;
+			case 6:
+				Sub->NotifySlotReleased(Slot);
+				break;
+			default:
+				if (Rng.FRand() < 0.5f)
+				{
+					Sub->DisableSlot(Slot);
+				}
+				else
+				{
+					Sub->EnableSlot(Slot);
+				}
+				break;
+			}
+
+			ASSERT_THAT(IsTrue(ArcAreaTestHelpers::VacancyIndexMatchesSlots(Sub), TEXT("Vacancy mask diverged from slot state")));
+
+			if (Step % 20 != 0)
+			{
+				continue;
+			}
+
+			const FVector Origin = ArcAreaTestHelpers::PickLocation(Rng);
+			const float Radius = Rng.FRandRange(1000.0f, 15000.0f);
+			for (const FGameplayTagQuery& Query : Queries)
+			{
+				if (!Query.IsEmpty())
+				{
+					ASSERT_THAT(IsTrue(ArcAreaTestHelpers::SameAreas(Sub->FindAreasByTags(Query), ArcAreaTestHelpers::BruteForceAreas(Sub, Query, Origin, 0.0f)),
+						TEXT("FindAreasByTags diverged from a full scan")));
+				}
+
+				ASSERT_THAT(IsTrue(ArcAreaTestHelpers::SameAreas(Sub->FindAreasInRadius(Origin, Radius, Query), ArcAreaTestHelpers::BruteForceAreas(Sub, Query, Origin, Radius)),
+					TEXT("FindAreasInRadius diverged from a full scan")));
+
+				for (const float MaxDistance : { Radius, 0.0f })
+				{
+					const double ExpectedDistSq = ArcAreaTestHelpers::BruteForceNearestVacantDistSq(Sub, Query, Origin, MaxDistance);
+					const FArcAreaSlotHandle Nearest = Sub->FindNearestVacantSlot(Origin, MaxDistance, Query);
+					if (ExpectedDistSq == TNumericLimits<double>::Max())
+					{
+						ASSERT_THAT(IsFalse(Nearest.IsValid(), TEXT("No vacant slot in range, but one was returned")));
+						continue;
+					}
+
+					ASSERT_THAT(IsTrue(Nearest.IsValid(), TEXT("A vacant slot is in range, but none was returned")));
+					ASSERT_THAT(IsTrue(Sub->GetSlotState(Nearest) == EArcAreaSlotState::Vacant, TEXT("Returned slot is not vacant")));
+					const FArcAreaData* NearestData = Sub->GetAreaData(Nearest.AreaHandle);
+					ASSERT_THAT(IsNotNull(NearestData));
+					ASSERT_THAT(IsNear(ExpectedDistSq, FVector::DistSquared(Origin, NearestData->Location), 1.0));
+				}
+			}
+		}
+	}
+};
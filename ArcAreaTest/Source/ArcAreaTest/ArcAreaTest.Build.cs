@@ -0,0 +1,30 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ArcAreaTest : ModuleRules
+{
+	public ArcAreaTest(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"ArcArea",
+				"GameplayTags",
+				"MassEntity",
+				"CQTest"
+			}
+		);
+	}
+}
@@ -0,0 +1,17 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcAreaTestModule.h"
+
+#define LOCTEXT_NAMESPACE "FArcAreaTestModule"
+
+void FArcAreaTestModule::StartupModule()
+{
+}
+
+void FArcAreaTestModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FArcAreaTestModule, ArcAreaTest)
@@ -162,13 +162,16 @@ void UArcBiologicalConditionProcessor::SignalEntities(FMassEntityManager& Entity
 				if (!Requests) { continue; }
 
 				FArcConditionStatesFragment& Frag = CondFrags[EntityIt];
-				FArcConditionState* Bleeding = &Frag.States[(int32)EArcConditionType::Bleeding];
-				FArcConditionState* Poisoned = &Frag.States[(int32)EArcConditionType::Poisoned];
-				FArcConditionState* Diseased = &Frag.States[(int32)EArcConditionType::Diseased];
-				FArcConditionState* Weakened = &Frag.States[(int32)EArcConditionType::Weakened];
+				FArcConditionState States[ArcConditionTypeCount];
+				Frag.GetStates(States);
 
-				const FArcConditionState* Burning = &Frag.States[(int32)EArcConditionType::Burning];
-				const FArcConditionState* Chilled = &Frag.States[(int32)EArcConditionType::Chilled];
+				FArcConditionState* Bleeding = &States[(int32)EArcConditionType::Bleeding];
+				FArcConditionState* Poisoned = &States[(int32)EArcConditionType::Poisoned];
+				FArcConditionState* Diseased = &States[(int32)EArcConditionType::Diseased];
+				FArcConditionState* Weakened = &States[(int32)EArcConditionType::Weakened];
+
+				const FArcConditionState* Burning = &States[(int32)EArcConditionType::Burning];
+				const FArcConditionState* Chilled = &States[(int32)EArcConditionType::Chilled];
 
 				const FArcConditionConfig* BleedingCfg = &Configs.Configs[(int32)EArcConditionType::Bleeding];
 				const FArcConditionConfig* PoisonedCfg = &Configs.Configs[(int32)EArcConditionType::Poisoned];
@@ -227,6 +230,8 @@ void UArcBiologicalConditionProcessor::SignalEntities(FMassEntityManager& Entity
 					}
 				}
 
+				Frag.SetStates(States);
+
 				bool bStateChanged = false, bOverloadChanged = false;
 				for (int32 i = 0; i < 4; ++i)
 				{
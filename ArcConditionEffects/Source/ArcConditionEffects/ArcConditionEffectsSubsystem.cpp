@@ -49,47 +49,52 @@ void UArcConditionEffectsSubsystem::ApplyCondition(const FMassEntityHandle& Enti
 // Per-condition state lookup via typed fragment query
 // ---------------------------------------------------------------------------
 
-const FArcConditionState* UArcConditionEffectsSubsystem::GetConditionState(const UWorld* World, const FMassEntityHandle& Entity, EArcConditionType ConditionType)
+TOptional<FArcConditionState> UArcConditionEffectsSubsystem::GetConditionState(const UWorld* World, const FMassEntityHandle& Entity, EArcConditionType ConditionType)
 {
 	if (!World || !Entity.IsValid() || ConditionType >= EArcConditionType::MAX)
 	{
-		return nullptr;
+		return {};
 	}
 
 	const UMassEntitySubsystem* EntitySubsystem = UWorld::GetSubsystem<UMassEntitySubsystem>(World);
 	if (!EntitySubsystem)
 	{
-		return nullptr;
+		return {};
 	}
 
 	const FMassEntityManager& EntityManager = EntitySubsystem->GetEntityManager();
 	if (!EntityManager.IsEntityValid(Entity))
 	{
-		return nullptr;
+		return {};
 	}
 
 	const FArcConditionStatesFragment* Frag = EntityManager.GetFragmentDataPtr<FArcConditionStatesFragment>(Entity);
-	return Frag ? &Frag->States[static_cast<int32>(ConditionType)] : nullptr;
+	if (!Frag)
+	{
+		return {};
+	}
+
+	return Frag->GetState(static_cast<int32>(ConditionType));
 }
 
 float UArcConditionEffectsSubsystem::GetConditionSaturation(const UObject* WorldContextObject, const FMassEntityHandle& Entity, EArcConditionType ConditionType)
 {
 	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
-	const FArcConditionState* State = GetConditionState(World, Entity, ConditionType);
+	const TOptional<FArcConditionState> State = GetConditionState(World, Entity, ConditionType);
 	return State ? State->Saturation : 0.f;
 }
 
 bool UArcConditionEffectsSubsystem::IsConditionActive(const UObject* WorldContextObject, const FMassEntityHandle& Entity, EArcConditionType ConditionType)
 {
 	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
-	const FArcConditionState* State = GetConditionState(World, Entity, ConditionType);
+	const TOptional<FArcConditionState> State = GetConditionState(World, Entity, ConditionType);
 	return State ? State->bActive : false;
 }
 
 EArcConditionOverloadPhase UArcConditionEffectsSubsystem::GetConditionOverloadPhase(const UObject* WorldContextObject, const FMassEntityHandle& Entity, EArcConditionType ConditionType)
 {
 	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
-	const FArcConditionState* State = GetConditionState(World, Entity, ConditionType);
+	const TOptional<FArcConditionState> State = GetConditionState(World, Entity, ConditionType);
 	return State ? State->OverloadPhase : EArcConditionOverloadPhase::None;
 }
 
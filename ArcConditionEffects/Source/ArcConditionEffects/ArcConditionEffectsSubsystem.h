@@ -89,8 +89,8 @@ public:
 	TArray<FArcConditionApplicationRequest>& GetPendingRequests() { return PendingRequests; }
 
 private:
-	/** Retrieves the per-condition FArcConditionState from the entity manager, or nullptr if entity lacks that fragment. */
-	static const FArcConditionState* GetConditionState(const UWorld* World, const FMassEntityHandle& Entity, EArcConditionType ConditionType);
+	/** Copies the per-condition FArcConditionState out of the entity manager, or unset if entity lacks that fragment. */
+	static TOptional<FArcConditionState> GetConditionState(const UWorld* World, const FMassEntityHandle& Entity, EArcConditionType ConditionType);
 
 	TArray<FArcConditionApplicationRequest> PendingRequests;
 
@@ -7,11 +7,67 @@
 
 #include "ArcConditionFragments.generated.h"
 
+/** Lanes per condition array: one per EArcConditionType, padded to whole 4-wide vector registers. */
+static constexpr int32 ArcConditionLaneCount = (ArcConditionTypeCount + 3) & ~3;
+
+/**
+ * All condition state of one entity, stored as parallel arrays indexed by EArcConditionType.
+ * Padding lanes past ArcConditionTypeCount stay zero. Rules written against FArcConditionState
+ * copy lanes out with GetState and back with SetState.
+ */
 USTRUCT()
 struct ARCCONDITIONEFFECTS_API FArcConditionStatesFragment : public FMassFragment
 {
 	GENERATED_BODY()
-	FArcConditionState States[ArcConditionTypeCount];
+
+	/** Current saturation value [0, 100]. */
+	float Saturation[ArcConditionLaneCount] = {};
+
+	/** Time remaining in the current overload phase (seconds). */
+	float OverloadTimeRemaining[ArcConditionLaneCount] = {};
+
+	/** Resistance to the condition [0, 1]. */
+	float Resistance[ArcConditionLaneCount] = {};
+
+	bool bActive[ArcConditionLaneCount] = {};
+
+	EArcConditionOverloadPhase OverloadPhase[ArcConditionLaneCount] = {};
+
+	FArcConditionState GetState(int32 Index) const
+	{
+		FArcConditionState State;
+		State.Saturation = Saturation[Index];
+		State.bActive = bActive[Index];
+		State.OverloadPhase = OverloadPhase[Index];
+		State.OverloadTimeRemaining = OverloadTimeRemaining[Index];
+		State.Resistance = Resistance[Index];
+		return State;
+	}
+
+	void SetState(int32 Index, const FArcConditionState& State)
+	{
+		Saturation[Index] = State.Saturation;
+		bActive[Index] = State.bActive;
+		OverloadPhase[Index] = State.OverloadPhase;
+		OverloadTimeRemaining[Index] = State.OverloadTimeRemaining;
+		Resistance[Index] = State.Resistance;
+	}
+
+	void GetStates(FArcConditionState (&OutStates)[ArcConditionTypeCount]) const
+	{
+		for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+		{
+			OutStates[i] = GetState(i);
+		}
+	}
+
+	void SetStates(const FArcConditionState (&States)[ArcConditionTypeCount])
+	{
+		for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+		{
+			SetState(i, States[i]);
+		}
+	}
 };
 
 USTRUCT()
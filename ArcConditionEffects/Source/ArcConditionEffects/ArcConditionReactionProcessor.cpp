@@ -134,7 +134,8 @@ void UArcConditionReactionProcessor::SignalEntities(FMassEntityManager& EntityMa
 				for (int32 i = 0; i < ArcConditionTypeCount; ++i)
 				{
 					const EArcConditionType Type = static_cast<EArcConditionType>(i);
-					const FArcConditionState* State = CondFrag ? &CondFrag->States[i] : nullptr;
+					const FArcConditionState StateCopy = CondFrag ? CondFrag->GetState(i) : FArcConditionState();
+					const FArcConditionState* State = CondFrag ? &StateCopy : nullptr;
 					const FArcConditionPrevState SnapshotPrev = EntityPrevStates[i];
 
 					ProcessConditionTransition(Type, State, EntityPrevStates[i], Entity, ASC, Subsystem);
@@ -147,14 +148,23 @@ void UArcConditionReactionProcessor::SignalEntities(FMassEntityManager& EntityMa
 
 					const float Sat = State ? State->Saturation : 0.f;
 
+					// Only push saturation that moved; setting an unchanged base still broadcasts attribute changes.
 					if (ConditionSet && ASC)
 					{
-						ASC->SetNumericAttributeBase(UArcConditionAttributeSet::GetSaturationAttributeByIndex(i), Sat);
+						const FGameplayAttribute SatAttribute = UArcConditionAttributeSet::GetSaturationAttributeByIndex(i);
+						if (ASC->GetNumericAttributeBase(SatAttribute) != Sat)
+						{
+							ASC->SetNumericAttributeBase(SatAttribute, Sat);
+						}
 					}
 
 					if (SatAttrs)
 					{
-						SatAttrs->GetSaturationByIndex(i)->SetBaseValue(Sat);
+						FArcAttribute* SatAttr = SatAttrs->GetSaturationByIndex(i);
+						if (SatAttr->GetBaseValue() != Sat)
+						{
+							SatAttr->SetBaseValue(Sat);
+						}
 					}
 				}
 			}
@@ -38,20 +38,98 @@ void UArcConditionTickProcessor::Execute(FMassEntityManager& EntityManager, FMas
             TArrayView<FArcConditionStatesFragment> Fragments = Ctx.GetMutableFragmentView<FArcConditionStatesFragment>();
             const FArcConditionConfigsShared& SharedConfig = Ctx.GetConstSharedFragment<FArcConditionConfigsShared>();
 
+            // Configs are shared by the whole chunk, so lay them out as lanes once.
+            // Padding lanes never decay and can never reach their threshold.
+            float DecayStep[ArcConditionLaneCount];
+            float Threshold[ArcConditionLaneCount];
+            uint32 HysteresisMask = 0;
+            for (int32 i = 0; i < ArcConditionLaneCount; ++i)
+            {
+                if (i < ArcConditionTypeCount)
+                {
+                    const FArcConditionConfig& Config = SharedConfig.Configs[i];
+                    DecayStep[i] = FMath::Max(0.f, Config.DecayRate) * DeltaTime;
+                    Threshold[i] = Config.ActivationThreshold;
+                    HysteresisMask |= (Config.Group == EArcConditionGroup::GroupA_Hysteresis ? 1u : 0u) << i;
+                }
+                else
+                {
+                    DecayStep[i] = 0.f;
+                    Threshold[i] = FLT_MAX;
+                }
+            }
+
+            constexpr uint32 ConditionMask = (1u << ArcConditionTypeCount) - 1;
+            const VectorRegister4Float Zero = VectorZeroFloat();
+
             for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
             {
                 FArcConditionStatesFragment& Fragment = Fragments[EntityIt];
+
+                uint32 OverloadMask = 0;
+                uint32 ActiveMask = 0;
+                for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+                {
+                    OverloadMask |= (Fragment.OverloadPhase[i] != EArcConditionOverloadPhase::None ? 1u : 0u) << i;
+                    ActiveMask |= (Fragment.bActive[i] ? 1u : 0u) << i;
+                }
+
                 bool bAnyStateChanged = false;
                 bool bAnyOverloadChanged = false;
 
-                for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+                if (OverloadMask != 0)
+                {
+                    // Overload and burnout timers are rare; run the scalar rules for this entity.
+                    for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+                    {
+                        FArcConditionState State = Fragment.GetState(i);
+                        bool bStateChanged = false;
+                        bool bOverloadChanged = false;
+                        ArcConditionHelpers::TickCondition(State, SharedConfig.Configs[i], DeltaTime, bStateChanged, bOverloadChanged);
+                        Fragment.SetState(i, State);
+
+                        bAnyStateChanged |= bStateChanged;
+                        bAnyOverloadChanged |= bOverloadChanged;
+                    }
+                }
+                else
                 {
-                    bool bStateChanged = false;
-                    bool bOverloadChanged = false;
-                    ArcConditionHelpers::TickCondition(Fragment.States[i], SharedConfig.Configs[i], DeltaTime, bStateChanged, bOverloadChanged);
+                    // Decay every lane at once. Matches TickCondition without overload: only lanes with
+                    // saturation decay, and only those lanes re-evaluate their active flag.
+                    uint32 LiveMask = 0;
+                    uint32 PositiveMask = 0;
+                    uint32 ThresholdMask = 0;
+                    for (int32 Lane = 0; Lane < ArcConditionLaneCount; Lane += 4)
+                    {
+                        const VectorRegister4Float Old = VectorLoad(Fragment.Saturation + Lane);
+                        const VectorRegister4Float Live = VectorCompareGT(Old, Zero);
+                        const VectorRegister4Float Decayed = VectorMax(Zero, VectorSubtract(Old, VectorLoad(DecayStep + Lane)));
+                        const VectorRegister4Float New = VectorSelect(Live, Decayed, Old);
+                        VectorStore(New, Fragment.Saturation + Lane);
+
+                        LiveMask |= static_cast<uint32>(VectorMaskBits(Live)) << Lane;
+                        PositiveMask |= static_cast<uint32>(VectorMaskBits(VectorCompareGT(New, Zero))) << Lane;
+                        ThresholdMask |= static_cast<uint32>(VectorMaskBits(VectorCompareGE(New, VectorLoad(Threshold + Lane)))) << Lane;
+                    }
+
+                    if (LiveMask == 0)
+                    {
+                        continue;
+                    }
+
+                    // Hysteresis lanes stay active while positive and activate at the threshold; others are active while positive.
+                    const uint32 HysteresisActive = (ActiveMask & PositiveMask) | (~ActiveMask & ThresholdMask);
+                    const uint32 NewActive = (HysteresisMask & HysteresisActive) | (~HysteresisMask & PositiveMask);
+                    const uint32 FinalActive = (LiveMask & NewActive) | (~LiveMask & ActiveMask);
 
-                    bAnyStateChanged |= bStateChanged;
-                    bAnyOverloadChanged |= bOverloadChanged;
+                    uint32 ChangedMask = (FinalActive ^ ActiveMask) & ConditionMask;
+                    bAnyStateChanged = ChangedMask != 0;
+                    while (ChangedMask != 0)
+                    {
+                        const int32 i = FMath::CountTrailingZeros(ChangedMask);
+                        Fragment.bActive[i] = !Fragment.bActive[i];
+                        ChangedMask &= ChangedMask - 1;
+                    }
                 }
 
                 if (bAnyStateChanged)    { StateChangedEntities.Add(Ctx.GetEntity(EntityIt)); }
@@ -90,11 +90,14 @@ void UArcEnvironmentalConditionProcessor::SignalEntities(FMassEntityManager& Ent
 				if (!Requests) { continue; }
 
 				FArcConditionStatesFragment& Frag = CondFrags[EntityIt];
-				FArcConditionState* Blinded     = &Frag.States[(int32)EArcConditionType::Blinded];
-				FArcConditionState* Suffocating = &Frag.States[(int32)EArcConditionType::Suffocating];
-				FArcConditionState* Exhausted   = &Frag.States[(int32)EArcConditionType::Exhausted];
-				FArcConditionState* Corroded    = &Frag.States[(int32)EArcConditionType::Corroded];
-				FArcConditionState* Shocked     = &Frag.States[(int32)EArcConditionType::Shocked];
+				FArcConditionState States[ArcConditionTypeCount];
+				Frag.GetStates(States);
+
+				FArcConditionState* Blinded     = &States[(int32)EArcConditionType::Blinded];
+				FArcConditionState* Suffocating = &States[(int32)EArcConditionType::Suffocating];
+				FArcConditionState* Exhausted   = &States[(int32)EArcConditionType::Exhausted];
+				FArcConditionState* Corroded    = &States[(int32)EArcConditionType::Corroded];
+				FArcConditionState* Shocked     = &States[(int32)EArcConditionType::Shocked];
 
 				const FArcConditionConfig* BlindedCfg     = &Configs.Configs[(int32)EArcConditionType::Blinded];
 				const FArcConditionConfig* SuffocatingCfg = &Configs.Configs[(int32)EArcConditionType::Suffocating];
@@ -142,6 +145,8 @@ void UArcEnvironmentalConditionProcessor::SignalEntities(FMassEntityManager& Ent
 					}
 				}
 
+				Frag.SetStates(States);
+
 				bool bStateChanged = false, bOverloadChanged = false;
 				for (int32 i = 0; i < 5; ++i)
 				{
@@ -340,13 +340,16 @@ void UArcThermalConditionProcessor::SignalEntities(FMassEntityManager& EntityMan
 				if (!Requests) { continue; }
 
 				FArcConditionStatesFragment& Frag = CondFrags[EntityIt];
-				FArcConditionState* Burning  = &Frag.States[(int32)EArcConditionType::Burning];
-				FArcConditionState* Chilled  = &Frag.States[(int32)EArcConditionType::Chilled];
-				FArcConditionState* Wet      = &Frag.States[(int32)EArcConditionType::Wet];
-				FArcConditionState* Oiled    = &Frag.States[(int32)EArcConditionType::Oiled];
-				FArcConditionState* Bleeding = &Frag.States[(int32)EArcConditionType::Bleeding];
-				FArcConditionState* Diseased = &Frag.States[(int32)EArcConditionType::Diseased];
-				FArcConditionState* Blinded  = &Frag.States[(int32)EArcConditionType::Blinded];
+				FArcConditionState States[ArcConditionTypeCount];
+				Frag.GetStates(States);
+
+				FArcConditionState* Burning  = &States[(int32)EArcConditionType::Burning];
+				FArcConditionState* Chilled  = &States[(int32)EArcConditionType::Chilled];
+				FArcConditionState* Wet      = &States[(int32)EArcConditionType::Wet];
+				FArcConditionState* Oiled    = &States[(int32)EArcConditionType::Oiled];
+				FArcConditionState* Bleeding = &States[(int32)EArcConditionType::Bleeding];
+				FArcConditionState* Diseased = &States[(int32)EArcConditionType::Diseased];
+				FArcConditionState* Blinded  = &States[(int32)EArcConditionType::Blinded];
 
 				const FArcConditionConfig* BurningCfg = &Configs.Configs[(int32)EArcConditionType::Burning];
 				const FArcConditionConfig* ChilledCfg = &Configs.Configs[(int32)EArcConditionType::Chilled];
@@ -387,6 +390,8 @@ void UArcThermalConditionProcessor::SignalEntities(FMassEntityManager& EntityMan
 					}
 				}
 
+				Frag.SetStates(States);
+
 				// Change detection
 				bool bStateChanged = false, bOverloadChanged = false;
 				for (int32 i = 0; i < 7; ++i)
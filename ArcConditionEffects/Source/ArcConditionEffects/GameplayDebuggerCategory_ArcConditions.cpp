@@ -224,21 +224,21 @@ void FGameplayDebuggerCategory_ArcConditions::CollectData(APlayerController* Own
 	for (int32 i = 0; i <= (int32)EArcConditionType::Weakened; ++i)
 	{
 		CollectConditionLine(EntityManager, ArcConditionHelpers::GetConditionTypeName(static_cast<EArcConditionType>(i)),
-			CondFrag->States[i], CondCfg ? &CondCfg->Configs[i] : nullptr);
+			CondFrag->GetState(i), CondCfg ? &CondCfg->Configs[i] : nullptr);
 	}
 
 	AddTextLine(TEXT("{yellow}--- Linear ---"));
 	for (int32 i = (int32)EArcConditionType::Oiled; i <= (int32)EArcConditionType::Corroded; ++i)
 	{
 		CollectConditionLine(EntityManager, ArcConditionHelpers::GetConditionTypeName(static_cast<EArcConditionType>(i)),
-			CondFrag->States[i], CondCfg ? &CondCfg->Configs[i] : nullptr);
+			CondFrag->GetState(i), CondCfg ? &CondCfg->Configs[i] : nullptr);
 	}
 
 	AddTextLine(TEXT("{cyan}--- Environmental ---"));
 	for (int32 i = (int32)EArcConditionType::Blinded; i <= (int32)EArcConditionType::Exhausted; ++i)
 	{
 		CollectConditionLine(EntityManager, ArcConditionHelpers::GetConditionTypeName(static_cast<EArcConditionType>(i)),
-			CondFrag->States[i], CondCfg ? &CondCfg->Configs[i] : nullptr);
+			CondFrag->GetState(i), CondCfg ? &CondCfg->Configs[i] : nullptr);
 	}
 }
 
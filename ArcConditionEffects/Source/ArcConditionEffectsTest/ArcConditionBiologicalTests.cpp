@@ -55,8 +55,8 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Bleeding].bActive));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Bleeding]));
     }
 
     TEST_METHOD(Bleeding_BlockedByActiveBurning)
@@ -65,15 +65,15 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Bleeding, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.001f));
     }
 
     TEST_METHOD(Bleeding_BlockedByFrozen)
@@ -82,16 +82,16 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Chilled].Saturation = 100.f;
-            Frag->States[(int32)EArcConditionType::Chilled].bActive = true;
-            Frag->States[(int32)EArcConditionType::Chilled].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+            Frag->Saturation[(int32)EArcConditionType::Chilled] = 100.f;
+            Frag->bActive[(int32)EArcConditionType::Chilled] = true;
+            Frag->OverloadPhase[(int32)EArcConditionType::Chilled] = EArcConditionOverloadPhase::Overloaded;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Bleeding, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.001f));
     }
 
     TEST_METHOD(Bleeding_NotBlockedByInactiveBurning)
@@ -100,15 +100,15 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 10.f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = false;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 10.f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = false;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Bleeding, 30.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.5f));
     }
 
     TEST_METHOD(Poison_SimpleApplication)
@@ -118,8 +118,8 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(25.f, Frag->States[(int32)EArcConditionType::Poisoned].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Poisoned].bActive));
+        ASSERT_THAT(IsNear(25.f, Frag->Saturation[(int32)EArcConditionType::Poisoned], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Poisoned]));
     }
 
     TEST_METHOD(Poison_BoostedByActiveBleeding)
@@ -128,15 +128,15 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 30.f;
-            Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Bleeding] = 30.f;
+            Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Poisoned, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Poisoned].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Poisoned], 0.5f));
     }
 
     TEST_METHOD(Poison_NotBoostedByInactiveBleeding)
@@ -145,15 +145,15 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 10.f;
-            Frag->States[(int32)EArcConditionType::Bleeding].bActive = false;
+            Frag->Saturation[(int32)EArcConditionType::Bleeding] = 10.f;
+            Frag->bActive[(int32)EArcConditionType::Bleeding] = false;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Poisoned, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, Frag->States[(int32)EArcConditionType::Poisoned].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(20.f, Frag->Saturation[(int32)EArcConditionType::Poisoned], 0.5f));
     }
 
     TEST_METHOD(Disease_SimpleApplication)
@@ -163,8 +163,8 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Diseased].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Diseased].bActive));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Diseased], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Diseased]));
     }
 
     TEST_METHOD(Weakened_SimpleApplication)
@@ -174,8 +174,8 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(25.f, Frag->States[(int32)EArcConditionType::Weakened].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Weakened].bActive));
+        ASSERT_THAT(IsNear(25.f, Frag->Saturation[(int32)EArcConditionType::Weakened], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Weakened]));
     }
 
     TEST_METHOD(NegativeAmount_BypassesInteractions_ReducesSaturation)
@@ -184,17 +184,17 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 50.f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-            Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 40.f;
-            Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 50.f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = true;
+            Frag->Saturation[(int32)EArcConditionType::Bleeding] = 40.f;
+            Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Bleeding, -20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(20.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.5f));
     }
 
     TEST_METHOD(Resistance_ReducesApplication)
@@ -203,13 +203,13 @@ TEST_CLASS(ArcCondition_Biological, "ArcConditionEffects.Biological")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Weakened].Resistance = 0.5f;
+            Frag->Resistance[(int32)EArcConditionType::Weakened] = 0.5f;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Weakened, 40.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, Frag->States[(int32)EArcConditionType::Weakened].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(20.f, Frag->Saturation[(int32)EArcConditionType::Weakened], 0.5f));
     }
 };
@@ -135,8 +135,8 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
-			Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 40.f;
+			Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
+			Frag->Saturation[(int32)EArcConditionType::Bleeding] = 40.f;
 		}
 
 		RunReaction(Entity);
@@ -149,8 +149,8 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			ASSERT_THAT(IsNear(0.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.001f));
-			ASSERT_THAT(IsFalse(Frag->States[(int32)EArcConditionType::Bleeding].bActive));
+			ASSERT_THAT(IsNear(0.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.001f));
+			ASSERT_THAT(IsFalse(Frag->bActive[(int32)EArcConditionType::Bleeding]));
 		}
 
 		// Reaction processor detects deactivation and removes bleeding effect.
@@ -179,8 +179,8 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Diseased].bActive = true;
-			Frag->States[(int32)EArcConditionType::Diseased].Saturation = 50.f;
+			Frag->bActive[(int32)EArcConditionType::Diseased] = true;
+			Frag->Saturation[(int32)EArcConditionType::Diseased] = 50.f;
 		}
 
 		RunReaction(Entity);
@@ -193,7 +193,7 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			ASSERT_THAT(IsNear(0.f, Frag->States[(int32)EArcConditionType::Diseased].Saturation, 0.001f));
+			ASSERT_THAT(IsNear(0.f, Frag->Saturation[(int32)EArcConditionType::Diseased], 0.001f));
 		}
 
 		// Reaction processor detects deactivation and removes disease effect.
@@ -222,8 +222,8 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 25.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 25.f;
 		}
 
 		RunReaction(Entity);
@@ -240,7 +240,7 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			ASSERT_THAT(IsFalse(Frag->States[(int32)EArcConditionType::Burning].bActive));
+			ASSERT_THAT(IsFalse(Frag->bActive[(int32)EArcConditionType::Burning]));
 		}
 
 		// Reaction processor detects deactivation and removes burning effect.
@@ -272,10 +272,10 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 100.f;
-			Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
-			Frag->States[(int32)EArcConditionType::Burning].OverloadTimeRemaining = 6.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 100.f;
+			Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Overloaded;
+			Frag->OverloadTimeRemaining[(int32)EArcConditionType::Burning] = 6.f;
 		}
 
 		// Reaction processor sees active + overloaded -> applies both activation and overload effects.
@@ -293,7 +293,7 @@ TEST_CLASS(ArcCondition_EndToEnd, "ArcConditionEffects.Integration.EndToEnd")
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			ASSERT_THAT(IsFalse(Frag->States[(int32)EArcConditionType::Burning].OverloadPhase == EArcConditionOverloadPhase::Overloaded));
+			ASSERT_THAT(IsFalse(Frag->OverloadPhase[(int32)EArcConditionType::Burning] == EArcConditionOverloadPhase::Overloaded));
 		}
 
 		// Reaction processor detects overload end -> removes overload effect; activation effect remains.
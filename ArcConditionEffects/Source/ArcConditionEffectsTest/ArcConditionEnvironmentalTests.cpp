@@ -55,8 +55,8 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Blinded].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Blinded].bActive));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Blinded], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Blinded]));
     }
 
     TEST_METHOD(Suffocating_SimpleApplication)
@@ -66,8 +66,8 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(40.f, Frag->States[(int32)EArcConditionType::Suffocating].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Suffocating].bActive));
+        ASSERT_THAT(IsNear(40.f, Frag->Saturation[(int32)EArcConditionType::Suffocating], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Suffocating]));
     }
 
     TEST_METHOD(Exhausted_SimpleApplication)
@@ -77,8 +77,8 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(25.f, Frag->States[(int32)EArcConditionType::Exhausted].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Exhausted].bActive));
+        ASSERT_THAT(IsNear(25.f, Frag->Saturation[(int32)EArcConditionType::Exhausted], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Exhausted]));
     }
 
     TEST_METHOD(Corroded_SimpleApplication)
@@ -88,8 +88,8 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, Frag->States[(int32)EArcConditionType::Corroded].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Corroded].bActive));
+        ASSERT_THAT(IsNear(20.f, Frag->Saturation[(int32)EArcConditionType::Corroded], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Corroded]));
     }
 
     TEST_METHOD(Shocked_SimpleApplication)
@@ -99,8 +99,8 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(35.f, Frag->States[(int32)EArcConditionType::Shocked].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Shocked].bActive));
+        ASSERT_THAT(IsNear(35.f, Frag->Saturation[(int32)EArcConditionType::Shocked], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Shocked]));
     }
 
     TEST_METHOD(Removal_ReducesSaturation)
@@ -109,15 +109,15 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Blinded].Saturation = 50.f;
-            Frag->States[(int32)EArcConditionType::Blinded].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Blinded] = 50.f;
+            Frag->bActive[(int32)EArcConditionType::Blinded] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Blinded, -20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Blinded].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Blinded], 0.5f));
     }
 
     TEST_METHOD(Removal_ClampsToZero)
@@ -126,15 +126,15 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Corroded].Saturation = 10.f;
-            Frag->States[(int32)EArcConditionType::Corroded].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Corroded] = 10.f;
+            Frag->bActive[(int32)EArcConditionType::Corroded] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Corroded, -50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, Frag->States[(int32)EArcConditionType::Corroded].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, Frag->Saturation[(int32)EArcConditionType::Corroded], 0.001f));
     }
 
     TEST_METHOD(Resistance_ReducesApplication)
@@ -143,14 +143,14 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Shocked].Resistance = 0.4f;
+            Frag->Resistance[(int32)EArcConditionType::Shocked] = 0.4f;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Shocked, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Shocked].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Shocked], 0.5f));
     }
 
     TEST_METHOD(Blinded_OverloadsAtHundred)
@@ -160,7 +160,7 @@ TEST_CLASS(ArcCondition_Environmental, "ArcConditionEffects.Environmental")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(100.f, Frag->States[(int32)EArcConditionType::Blinded].Saturation, 0.001f));
-        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::Overloaded, Frag->States[(int32)EArcConditionType::Blinded].OverloadPhase));
+        ASSERT_THAT(IsNear(100.f, Frag->Saturation[(int32)EArcConditionType::Blinded], 0.001f));
+        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::Overloaded, Frag->OverloadPhase[(int32)EArcConditionType::Blinded]));
     }
 };
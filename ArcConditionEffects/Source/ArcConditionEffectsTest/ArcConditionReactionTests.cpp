@@ -109,8 +109,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
 		}
 
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -135,8 +135,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
 		ASSERT_THAT(AreEqual(1, CountActiveEffects(Entity)));
@@ -145,8 +145,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = false;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 0.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = false;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 0.f;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
 
@@ -170,9 +170,9 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 100.f;
-			Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 100.f;
+			Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Overloaded;
 		}
 
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -197,9 +197,9 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 100.f;
-			Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 100.f;
+			Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Overloaded;
 		}
 
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionOverloadChanged);
@@ -224,9 +224,9 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 100.f;
-			Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 100.f;
+			Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Overloaded;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionOverloadChanged);
 		ASSERT_THAT(AreEqual(1, CountActiveEffects(Entity)));
@@ -235,7 +235,7 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Burnout;
+			Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Burnout;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionOverloadChanged);
 
@@ -255,8 +255,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
 		}
 
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -281,8 +281,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
 		}
 
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -312,11 +312,11 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
 
-			Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
-			Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 20.f;
+			Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
+			Frag->Saturation[(int32)EArcConditionType::Bleeding] = 20.f;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
 		ASSERT_THAT(AreEqual(2, CountActiveEffects(Entity)));
@@ -325,8 +325,8 @@ TEST_CLASS(ArcCondition_Reaction_MassEffects, "ArcConditionEffects.Integration.R
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].bActive = false;
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 0.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = false;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 0.f;
 		}
 		SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
 
@@ -96,7 +96,7 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 
 		FMassEntityView View(*EntityManager, Entity);
 		FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-		ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+		ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
 	}
 
 	TEST_METHOD(EffectAddsBleedingSaturation_IncreasesCondition)
@@ -120,7 +120,7 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 
 		FMassEntityView View(*EntityManager, Entity);
 		FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-		ASSERT_THAT(IsNear(40.f, Frag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.5f));
+		ASSERT_THAT(IsNear(40.f, Frag->Saturation[(int32)EArcConditionType::Bleeding], 0.5f));
 	}
 
 	TEST_METHOD(NegativeDelta_ReducesBiologicalCondition)
@@ -130,8 +130,8 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 50.f;
-			Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
+			Frag->Saturation[(int32)EArcConditionType::Bleeding] = 50.f;
+			Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
 		}
 
 		{
@@ -151,7 +151,7 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 
 		FMassEntityView View(*EntityManager, Entity);
 		FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-		ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Bleeding].Saturation < 50.f));
+		ASSERT_THAT(IsTrue(Frag->Saturation[(int32)EArcConditionType::Bleeding] < 50.f));
 	}
 
 	TEST_METHOD(ZeroDelta_NoChange)
@@ -161,8 +161,8 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 		{
 			FMassEntityView View(*EntityManager, Entity);
 			FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-			Frag->States[(int32)EArcConditionType::Burning].Saturation = 25.f;
-			Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+			Frag->Saturation[(int32)EArcConditionType::Burning] = 25.f;
+			Frag->bActive[(int32)EArcConditionType::Burning] = true;
 		}
 
 		{
@@ -182,6 +182,6 @@ TEST_CLASS(ArcCondition_ReversePath, "ArcConditionEffects.Integration.ReversePat
 
 		FMassEntityView View(*EntityManager, Entity);
 		FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-		ASSERT_THAT(IsNear(25.f, Frag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+		ASSERT_THAT(IsNear(25.f, Frag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
 	}
 };
@@ -55,8 +55,8 @@ TEST_CLASS(ArcCondition_SaturationAttributeSync, "ArcConditionEffects.Integratio
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 42.5f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 42.5f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -74,14 +74,14 @@ TEST_CLASS(ArcCondition_SaturationAttributeSync, "ArcConditionEffects.Integratio
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
 
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 10.f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 10.f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = true;
 
-            Frag->States[(int32)EArcConditionType::Bleeding].Saturation = 60.f;
-            Frag->States[(int32)EArcConditionType::Bleeding].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Bleeding] = 60.f;
+            Frag->bActive[(int32)EArcConditionType::Bleeding] = true;
 
-            Frag->States[(int32)EArcConditionType::Chilled].Saturation = 0.f;
-            Frag->States[(int32)EArcConditionType::Chilled].bActive = false;
+            Frag->Saturation[(int32)EArcConditionType::Chilled] = 0.f;
+            Frag->bActive[(int32)EArcConditionType::Chilled] = false;
         }
 
         SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -125,8 +125,8 @@ TEST_CLASS(ArcCondition_SaturationAttributeSync, "ArcConditionEffects.Integratio
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 50.f;
-            Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 50.f;
+            Frag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
@@ -141,7 +141,7 @@ TEST_CLASS(ArcCondition_SaturationAttributeSync, "ArcConditionEffects.Integratio
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
+            Frag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
         }
 
         SignalAndExecute(Entity, UE::ArcConditionEffects::Signals::ConditionStateChanged);
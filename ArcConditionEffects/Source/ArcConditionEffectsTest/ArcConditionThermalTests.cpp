@@ -63,8 +63,8 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Burning].bActive));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Burning]));
     }
 
     TEST_METHOD(Cauterization_ClearsBleeding)
@@ -73,16 +73,16 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BleedingFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BleedingFrag->States[(int32)EArcConditionType::Bleeding].Saturation = 40.f;
-            BleedingFrag->States[(int32)EArcConditionType::Bleeding].bActive = true;
+            BleedingFrag->Saturation[(int32)EArcConditionType::Bleeding] = 40.f;
+            BleedingFrag->bActive[(int32)EArcConditionType::Bleeding] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 10.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* BleedingFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, BleedingFrag->States[(int32)EArcConditionType::Bleeding].Saturation, 0.001f));
-        ASSERT_THAT(IsFalse(BleedingFrag->States[(int32)EArcConditionType::Bleeding].bActive));
+        ASSERT_THAT(IsNear(0.f, BleedingFrag->Saturation[(int32)EArcConditionType::Bleeding], 0.001f));
+        ASSERT_THAT(IsFalse(BleedingFrag->bActive[(int32)EArcConditionType::Bleeding]));
     }
 
     TEST_METHOD(Sterilization_ClearsDisease)
@@ -91,15 +91,15 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* DiseasedFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            DiseasedFrag->States[(int32)EArcConditionType::Diseased].Saturation = 50.f;
-            DiseasedFrag->States[(int32)EArcConditionType::Diseased].bActive = true;
+            DiseasedFrag->Saturation[(int32)EArcConditionType::Diseased] = 50.f;
+            DiseasedFrag->bActive[(int32)EArcConditionType::Diseased] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 10.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* DiseasedFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, DiseasedFrag->States[(int32)EArcConditionType::Diseased].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, DiseasedFrag->Saturation[(int32)EArcConditionType::Diseased], 0.001f));
     }
 
     TEST_METHOD(ShatterFrozen_ClearsChilled_GeneratesBlind_HalvesFire)
@@ -108,22 +108,22 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation = 80.f;
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].bActive = true;
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+            ChilledFrag->Saturation[(int32)EArcConditionType::Chilled] = 80.f;
+            ChilledFrag->bActive[(int32)EArcConditionType::Chilled] = true;
+            ChilledFrag->OverloadPhase[(int32)EArcConditionType::Chilled] = EArcConditionOverloadPhase::Overloaded;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 40.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, ChilledFrag->Saturation[(int32)EArcConditionType::Chilled], 0.001f));
 
         FArcConditionStatesFragment* BlindedFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsTrue(BlindedFrag->States[(int32)EArcConditionType::Blinded].Saturation > 0.f));
+        ASSERT_THAT(IsTrue(BlindedFrag->Saturation[(int32)EArcConditionType::Blinded] > 0.f));
 
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(20.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
     }
 
     TEST_METHOD(EvaporateWet_ConsumesWet_ReducesFire_GeneratesSteam)
@@ -132,21 +132,21 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            WetFrag->States[(int32)EArcConditionType::Wet].Saturation = 20.f;
-            WetFrag->States[(int32)EArcConditionType::Wet].bActive = true;
+            WetFrag->Saturation[(int32)EArcConditionType::Wet] = 20.f;
+            WetFrag->bActive[(int32)EArcConditionType::Wet] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.001f));
 
         FArcConditionStatesFragment* BlindedFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(10.f, BlindedFrag->States[(int32)EArcConditionType::Blinded].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(10.f, BlindedFrag->Saturation[(int32)EArcConditionType::Blinded], 0.5f));
 
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
     }
 
     TEST_METHOD(MeltChilled_CostsDouble_CreatesWet)
@@ -155,21 +155,21 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation = 20.f;
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].bActive = false;
+            ChilledFrag->Saturation[(int32)EArcConditionType::Chilled] = 20.f;
+            ChilledFrag->bActive[(int32)EArcConditionType::Chilled] = false;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, ChilledFrag->Saturation[(int32)EArcConditionType::Chilled], 0.001f));
 
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(10.f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(10.f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.5f));
 
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(40.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(40.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
     }
 
     TEST_METHOD(FuelConversion_OilConsumed_DoubledToFire)
@@ -178,18 +178,18 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* OiledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            OiledFrag->States[(int32)EArcConditionType::Oiled].Saturation = 10.f;
-            OiledFrag->States[(int32)EArcConditionType::Oiled].bActive = true;
+            OiledFrag->Saturation[(int32)EArcConditionType::Oiled] = 10.f;
+            OiledFrag->bActive[(int32)EArcConditionType::Oiled] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* OiledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, OiledFrag->States[(int32)EArcConditionType::Oiled].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, OiledFrag->Saturation[(int32)EArcConditionType::Oiled], 0.001f));
 
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(40.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(40.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
     }
 
     TEST_METHOD(Resistance_ReducesFinalBurning)
@@ -198,14 +198,14 @@ TEST_CLASS(ArcCondition_Thermal_Fire, "ArcConditionEffects.Thermal.Fire")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            Frag->States[(int32)EArcConditionType::Burning].Resistance = 0.5f;
+            Frag->Resistance[(int32)EArcConditionType::Burning] = 0.5f;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Burning, 40.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(20.f, Frag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(20.f, Frag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
     }
 };
 
@@ -254,8 +254,8 @@ TEST_CLASS(ArcCondition_Thermal_Cold, "ArcConditionEffects.Thermal.Cold")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(40.f, Frag->States[(int32)EArcConditionType::Chilled].Saturation, 0.5f));
-        ASSERT_THAT(IsTrue(Frag->States[(int32)EArcConditionType::Chilled].bActive));
+        ASSERT_THAT(IsNear(40.f, Frag->Saturation[(int32)EArcConditionType::Chilled], 0.5f));
+        ASSERT_THAT(IsTrue(Frag->bActive[(int32)EArcConditionType::Chilled]));
     }
 
     TEST_METHOD(ExtinguishBurning_DoubleEfficiency)
@@ -264,15 +264,15 @@ TEST_CLASS(ArcCondition_Thermal_Cold, "ArcConditionEffects.Thermal.Cold")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BurningFrag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
-            BurningFrag->States[(int32)EArcConditionType::Burning].bActive = true;
+            BurningFrag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
+            BurningFrag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Chilled, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.001f));
     }
 
     TEST_METHOD(Condensation_ExcessColdBecomesWet_WhenFireExtinguished)
@@ -281,18 +281,18 @@ TEST_CLASS(ArcCondition_Thermal_Cold, "ArcConditionEffects.Thermal.Cold")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BurningFrag->States[(int32)EArcConditionType::Burning].Saturation = 10.f;
-            BurningFrag->States[(int32)EArcConditionType::Burning].bActive = true;
+            BurningFrag->Saturation[(int32)EArcConditionType::Burning] = 10.f;
+            BurningFrag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Chilled, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(7.5f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(7.5f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.5f));
 
         FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, ChilledFrag->Saturation[(int32)EArcConditionType::Chilled], 0.001f));
     }
 
     TEST_METHOD(FlashFreeze_WetConsumed_ColdTripled)
@@ -301,18 +301,18 @@ TEST_CLASS(ArcCondition_Thermal_Cold, "ArcConditionEffects.Thermal.Cold")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            WetFrag->States[(int32)EArcConditionType::Wet].Saturation = 30.f;
-            WetFrag->States[(int32)EArcConditionType::Wet].bActive = true;
+            WetFrag->Saturation[(int32)EArcConditionType::Wet] = 30.f;
+            WetFrag->bActive[(int32)EArcConditionType::Wet] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Chilled, 10.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.001f));
 
         FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, ChilledFrag->Saturation[(int32)EArcConditionType::Chilled], 0.5f));
     }
 
     TEST_METHOD(SteamFromExtinguishing)
@@ -321,15 +321,15 @@ TEST_CLASS(ArcCondition_Thermal_Cold, "ArcConditionEffects.Thermal.Cold")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BurningFrag->States[(int32)EArcConditionType::Burning].Saturation = 40.f;
-            BurningFrag->States[(int32)EArcConditionType::Burning].bActive = true;
+            BurningFrag->Saturation[(int32)EArcConditionType::Burning] = 40.f;
+            BurningFrag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Chilled, 50.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* BlindedFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(12.f, BlindedFrag->States[(int32)EArcConditionType::Blinded].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(12.f, BlindedFrag->Saturation[(int32)EArcConditionType::Blinded], 0.5f));
     }
 };
 
@@ -378,7 +378,7 @@ TEST_CLASS(ArcCondition_Thermal_Oil, "ArcConditionEffects.Thermal.Oil")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(25.f, Frag->States[(int32)EArcConditionType::Oiled].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(25.f, Frag->Saturation[(int32)EArcConditionType::Oiled], 0.5f));
     }
 
     TEST_METHOD(Stoking_OilOnBurningTarget_FeedsFire)
@@ -387,18 +387,18 @@ TEST_CLASS(ArcCondition_Thermal_Oil, "ArcConditionEffects.Thermal.Oil")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BurningFrag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
-            BurningFrag->States[(int32)EArcConditionType::Burning].bActive = true;
+            BurningFrag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
+            BurningFrag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Oiled, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(60.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(60.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
 
         FArcConditionStatesFragment* OiledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, OiledFrag->States[(int32)EArcConditionType::Oiled].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, OiledFrag->Saturation[(int32)EArcConditionType::Oiled], 0.001f));
     }
 };
 
@@ -447,7 +447,7 @@ TEST_CLASS(ArcCondition_Thermal_Water, "ArcConditionEffects.Thermal.Water")
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(30.f, Frag->States[(int32)EArcConditionType::Wet].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(30.f, Frag->Saturation[(int32)EArcConditionType::Wet], 0.5f));
     }
 
     TEST_METHOD(Ablative_WaterReducesBurning)
@@ -456,18 +456,18 @@ TEST_CLASS(ArcCondition_Thermal_Water, "ArcConditionEffects.Thermal.Water")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            BurningFrag->States[(int32)EArcConditionType::Burning].Saturation = 30.f;
-            BurningFrag->States[(int32)EArcConditionType::Burning].bActive = true;
+            BurningFrag->Saturation[(int32)EArcConditionType::Burning] = 30.f;
+            BurningFrag->bActive[(int32)EArcConditionType::Burning] = true;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Wet, 20.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* BurningFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(10.f, BurningFrag->States[(int32)EArcConditionType::Burning].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(10.f, BurningFrag->Saturation[(int32)EArcConditionType::Burning], 0.5f));
 
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.001f));
     }
 
     TEST_METHOD(ThermalMass_WaterOnChilled_BoostsCold)
@@ -476,17 +476,17 @@ TEST_CLASS(ArcCondition_Thermal_Water, "ArcConditionEffects.Thermal.Water")
         {
             FMassEntityView View(*EntityManager, Entity);
             FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation = 20.f;
-            ChilledFrag->States[(int32)EArcConditionType::Chilled].bActive = false;
+            ChilledFrag->Saturation[(int32)EArcConditionType::Chilled] = 20.f;
+            ChilledFrag->bActive[(int32)EArcConditionType::Chilled] = false;
         }
 
         ApplyAndExecute(Entity, EArcConditionType::Wet, 30.f);
 
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* ChilledFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(35.f, ChilledFrag->States[(int32)EArcConditionType::Chilled].Saturation, 0.5f));
+        ASSERT_THAT(IsNear(35.f, ChilledFrag->Saturation[(int32)EArcConditionType::Chilled], 0.5f));
 
         FArcConditionStatesFragment* WetFrag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, WetFrag->States[(int32)EArcConditionType::Wet].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, WetFrag->Saturation[(int32)EArcConditionType::Wet], 0.001f));
     }
 };
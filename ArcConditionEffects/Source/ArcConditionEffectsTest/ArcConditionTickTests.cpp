@@ -55,15 +55,15 @@ TEST_CLASS(ArcConditionTick_Burning, "ArcConditionEffects.Tick.Burning")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Burning].Saturation = 50.f;
-        Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+        Frag->Saturation[(int32)EArcConditionType::Burning] = 50.f;
+        Frag->bActive[(int32)EArcConditionType::Burning] = true;
 
         ExecuteTick(1.f);
 
         FMassEntityView ViewAfter(*EntityManager, Entity);
         FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
         // Default burning decay = 3.0/sec, so 50 - 3 = 47
-        ASSERT_THAT(IsNear(47.f, FragAfter->States[(int32)EArcConditionType::Burning].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(47.f, FragAfter->Saturation[(int32)EArcConditionType::Burning], 0.001f));
     }
 
     TEST_METHOD(NoDecayAtZeroSaturation)
@@ -71,13 +71,13 @@ TEST_CLASS(ArcConditionTick_Burning, "ArcConditionEffects.Tick.Burning")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Burning].Saturation = 0.f;
+        Frag->Saturation[(int32)EArcConditionType::Burning] = 0.f;
 
         ExecuteTick(1.f);
 
         FMassEntityView ViewAfter(*EntityManager, Entity);
         FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, FragAfter->States[(int32)EArcConditionType::Burning].Saturation, 0.001f));
+        ASSERT_THAT(IsNear(0.f, FragAfter->Saturation[(int32)EArcConditionType::Burning], 0.001f));
     }
 
     TEST_METHOD(OverloadTransitionsToBurnout)
@@ -85,16 +85,16 @@ TEST_CLASS(ArcConditionTick_Burning, "ArcConditionEffects.Tick.Burning")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Burning].Saturation = 100.f;
-        Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-        Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
-        Frag->States[(int32)EArcConditionType::Burning].OverloadTimeRemaining = 0.5f;
+        Frag->Saturation[(int32)EArcConditionType::Burning] = 100.f;
+        Frag->bActive[(int32)EArcConditionType::Burning] = true;
+        Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Overloaded;
+        Frag->OverloadTimeRemaining[(int32)EArcConditionType::Burning] = 0.5f;
 
         ExecuteTick(1.f);
 
         FMassEntityView ViewAfter(*EntityManager, Entity);
         FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::Burnout, FragAfter->States[(int32)EArcConditionType::Burning].OverloadPhase));
+        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::Burnout, FragAfter->OverloadPhase[(int32)EArcConditionType::Burning]));
     }
 
     TEST_METHOD(BurnoutEndsAndReturnsToNone)
@@ -102,16 +102,16 @@ TEST_CLASS(ArcConditionTick_Burning, "ArcConditionEffects.Tick.Burning")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Burning].Saturation = 10.f;
-        Frag->States[(int32)EArcConditionType::Burning].bActive = true;
-        Frag->States[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Burnout;
-        Frag->States[(int32)EArcConditionType::Burning].OverloadTimeRemaining = 0.1f;
+        Frag->Saturation[(int32)EArcConditionType::Burning] = 10.f;
+        Frag->bActive[(int32)EArcConditionType::Burning] = true;
+        Frag->OverloadPhase[(int32)EArcConditionType::Burning] = EArcConditionOverloadPhase::Burnout;
+        Frag->OverloadTimeRemaining[(int32)EArcConditionType::Burning] = 0.1f;
 
         ExecuteTick(1.f);
 
         FMassEntityView ViewAfter(*EntityManager, Entity);
         FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::None, FragAfter->States[(int32)EArcConditionType::Burning].OverloadPhase));
+        ASSERT_THAT(AreEqual(EArcConditionOverloadPhase::None, FragAfter->OverloadPhase[(int32)EArcConditionType::Burning]));
     }
 
     TEST_METHOD(HysteresisDeactivatesOnlyAtZero)
@@ -119,16 +119,16 @@ TEST_CLASS(ArcConditionTick_Burning, "ArcConditionEffects.Tick.Burning")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Burning].Saturation = 5.f;
-        Frag->States[(int32)EArcConditionType::Burning].bActive = true;
+        Frag->Saturation[(int32)EArcConditionType::Burning] = 5.f;
+        Frag->bActive[(int32)EArcConditionType::Burning] = true;
 
         ExecuteTick(1.f);
         FMassEntityView V1(*EntityManager, Entity);
-        ASSERT_THAT(IsTrue(V1.GetFragmentDataPtr<FArcConditionStatesFragment>()->States[(int32)EArcConditionType::Burning].bActive));
+        ASSERT_THAT(IsTrue(V1.GetFragmentDataPtr<FArcConditionStatesFragment>()->bActive[(int32)EArcConditionType::Burning]));
 
         ExecuteTick(1.f);
         FMassEntityView V2(*EntityManager, Entity);
-        ASSERT_THAT(IsFalse(V2.GetFragmentDataPtr<FArcConditionStatesFragment>()->States[(int32)EArcConditionType::Burning].bActive));
+        ASSERT_THAT(IsFalse(V2.GetFragmentDataPtr<FArcConditionStatesFragment>()->bActive[(int32)EArcConditionType::Burning]));
     }
 };
 
@@ -170,14 +170,124 @@ TEST_CLASS(ArcConditionTick_Oiled, "ArcConditionEffects.Tick.Oiled")
         FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
         FMassEntityView View(*EntityManager, Entity);
         FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        Frag->States[(int32)EArcConditionType::Oiled].Saturation = 0.5f;
-        Frag->States[(int32)EArcConditionType::Oiled].bActive = true;
+        Frag->Saturation[(int32)EArcConditionType::Oiled] = 0.5f;
+        Frag->bActive[(int32)EArcConditionType::Oiled] = true;
 
         ExecuteTick(1.f);
 
         FMassEntityView ViewAfter(*EntityManager, Entity);
         FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
-        ASSERT_THAT(IsNear(0.f, FragAfter->States[(int32)EArcConditionType::Oiled].Saturation, 0.001f));
-        ASSERT_THAT(IsFalse(FragAfter->States[(int32)EArcConditionType::Oiled].bActive));
+        ASSERT_THAT(IsNear(0.f, FragAfter->Saturation[(int32)EArcConditionType::Oiled], 0.001f));
+        ASSERT_THAT(IsFalse(FragAfter->bActive[(int32)EArcConditionType::Oiled]));
+    }
+};
+
+// ============================================================================
+// Tick Processor — vectorized decay matches the scalar TickCondition rules
+// ============================================================================
+
+TEST_CLASS(ArcConditionTick_AllLanes, "ArcConditionEffects.Tick.AllLanes")
+{
+    FActorTestSpawner Spawner;
+    FMassEntityManager* EntityManager = nullptr;
+    UArcConditionTickProcessor* TickProcessor = nullptr;
+
+    BEFORE_EACH()
+    {
+        FAutomationTestBase::bSuppressLogWarnings = true;
+        FAutomationTestBase::SuppressedLogCategories.AddUnique("LogUObjectGlobals");
+        FAutomationTestBase::SuppressedLogCategories.AddUnique("LogRHI");
+        Spawner.GetWorld();
+        Spawner.InitializeGameSubsystems();
+
+        UMassEntitySubsystem* MES = Spawner.GetWorld().GetSubsystem<UMassEntitySubsystem>();
+        check(MES);
+        EntityManager = &MES->GetMutableEntityManager();
+
+        TSharedRef<FMassEntityManager> SharedEM = EntityManager->AsShared();
+        TickProcessor = NewObject<UArcConditionTickProcessor>();
+        TickProcessor->CallInitialize(EntityManager->GetOwner(), SharedEM);
+    }
+
+    void ExecuteTick(float DeltaTime)
+    {
+        FMassProcessingContext ProcessingContext(*EntityManager, DeltaTime);
+        UE::Mass::Executor::Run(*TickProcessor, ProcessingContext);
+    }
+
+    void ExpectMatchesScalarTick(const FArcConditionState (&Initial)[ArcConditionTypeCount], float DeltaTime)
+    {
+        FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
+        FMassEntityView View(*EntityManager, Entity);
+        View.GetFragmentDataPtr<FArcConditionStatesFragment>()->SetStates(Initial);
+
+        FArcConditionConfig Configs[ArcConditionTypeCount];
+        InitDefaultConditionConfigs(Configs);
+
+        ExecuteTick(DeltaTime);
+
+        FMassEntityView ViewAfter(*EntityManager, Entity);
+        const FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
+        for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+        {
+            FArcConditionState Expected = Initial[i];
+            bool bStateChanged = false;
+            bool bOverloadChanged = false;
+            ArcConditionHelpers::TickCondition(Expected, Configs[i], DeltaTime, bStateChanged, bOverloadChanged);
+
+            const FArcConditionState Actual = FragAfter->GetState(i);
+            ASSERT_THAT(IsNear(Expected.Saturation, Actual.Saturation, 0.001f));
+            ASSERT_THAT(AreEqual(Expected.bActive, Actual.bActive));
+            ASSERT_THAT(AreEqual(Expected.OverloadPhase, Actual.OverloadPhase));
+        }
+    }
+
+    TEST_METHOD(DecayAndActiveFlagsMatchScalarRules)
+    {
+        FArcConditionState Initial[ArcConditionTypeCount];
+        for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+        {
+            // Mix of empty, below-threshold, above-threshold and just-decaying-to-zero lanes.
+            Initial[i].Saturation = (i % 4 == 0) ? 0.f : (i % 4 == 1) ? 1.f : (i % 4 == 2) ? 15.f : 60.f;
+            Initial[i].bActive = (i % 3) != 0;
+        }
+
+        ExpectMatchesScalarTick(Initial, 0.5f);
+    }
+
+    TEST_METHOD(OverloadedEntityMatchesScalarRules)
+    {
+        FArcConditionState Initial[ArcConditionTypeCount];
+        for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+        {
+            Initial[i].Saturation = 40.f;
+            Initial[i].bActive = true;
+        }
+        Initial[(int32)EArcConditionType::Burning].Saturation = 100.f;
+        Initial[(int32)EArcConditionType::Burning].OverloadPhase = EArcConditionOverloadPhase::Overloaded;
+        Initial[(int32)EArcConditionType::Burning].OverloadTimeRemaining = 0.1f;
+
+        ExpectMatchesScalarTick(Initial, 1.f);
+    }
+
+    TEST_METHOD(PaddingLanesStayZero)
+    {
+        FMassEntityHandle Entity = ArcConditionTestHelpers::CreateConditionEntity(*EntityManager);
+        FMassEntityView View(*EntityManager, Entity);
+        FArcConditionStatesFragment* Frag = View.GetFragmentDataPtr<FArcConditionStatesFragment>();
+        for (int32 i = 0; i < ArcConditionTypeCount; ++i)
+        {
+            Frag->Saturation[i] = 50.f;
+        }
+
+        ExecuteTick(1.f);
+
+        FMassEntityView ViewAfter(*EntityManager, Entity);
+        const FArcConditionStatesFragment* FragAfter = ViewAfter.GetFragmentDataPtr<FArcConditionStatesFragment>();
+        for (int32 i = ArcConditionTypeCount; i < ArcConditionLaneCount; ++i)
+        {
+            ASSERT_THAT(AreEqual(0.f, FragAfter->Saturation[i]));
+            ASSERT_THAT(IsFalse(FragAfter->bActive[i]));
+        }
     }
 };
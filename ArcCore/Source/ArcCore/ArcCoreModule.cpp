@@ -33,6 +33,7 @@
 #include "Development/ArcDeveloperSettings.h"
 #include "GameMode/ArcExperienceData.h"
 #include "GameMode/ArcUserFacingExperienceDefinition.h"
+#include "Items/Fragments/ArcItemFragment.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/CommandLine.h"
 #include "Misc/CoreDelegates.h"
@@ -136,6 +137,7 @@ namespace Arcx
 }
 void FArcCoreModule::OnAllModuleLoadingPhasesComplete()
 {
+	FArcItemFragmentTypeIds::RegisterLoadedTypes();
 }
 
 void FArcCoreModule::StartupModule()
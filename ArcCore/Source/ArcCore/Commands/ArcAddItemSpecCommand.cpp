@@ -24,6 +24,7 @@
 
 #include "Items/ArcItemsComponent.h"
 #include "Items/ArcItemsStoreComponent.h"
+#include "Items/ArcItemsStoreTransaction.h"
 
 bool FArcAddItemSpecCommand::CanSendCommand() const
 {
@@ -43,4 +44,28 @@ bool FArcAddItemSpecCommand::Execute()
 	FArcItemId ItemId = ItemsStore->AddItem(Item, FArcItemId());
 	
 	return true;
+}
+
+bool FArcAddItemSpecsCommand::CanSendCommand() const
+{
+	if (ItemsStore == nullptr || Items.IsEmpty())
+	{
+		return false;
+	}
+	return true;
+}
+
+void FArcAddItemSpecsCommand::PreSendCommand()
+{
+}
+
+bool FArcAddItemSpecsCommand::Execute()
+{
+	FArcItemsStoreTransaction Transaction;
+	for (const FArcItemSpec& Spec : Items)
+	{
+		Transaction.AddItem(Spec);
+	}
+
+	return ItemsStore->CommitTransaction(Transaction);
 }
\ No newline at end of file
@@ -76,3 +76,54 @@ struct TStructOpsTypeTraits<FArcAddItemSpecCommand> : public TStructOpsTypeTrait
 		WithCopy = true // Necessary so that TSharedPtr<FHitResult> Data is copied around
 	};
 };
+
+/** Adds all specs in one store transaction. Either every item is added or none. */
+USTRUCT(BlueprintType)
+struct ARCCORE_API FArcAddItemSpecsCommand : public FArcReplicatedCommand
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+	TObjectPtr<UArcItemsStoreComponent> ItemsStore;
+
+	UPROPERTY()
+	TArray<FArcItemSpec> Items;
+
+public:
+	virtual bool CanSendCommand() const override;
+
+	virtual void PreSendCommand() override;
+
+	virtual bool Execute() override;
+
+	FArcAddItemSpecsCommand()
+		: ItemsStore(nullptr)
+	{
+	}
+
+	FArcAddItemSpecsCommand(UArcItemsStoreComponent* InItemsStore
+							, const TArray<FArcItemSpec>& InItems)
+		: ItemsStore(InItemsStore)
+		, Items(InItems)
+	{
+	}
+
+	virtual ~FArcAddItemSpecsCommand() override
+	{
+	}
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return FArcAddItemSpecsCommand::StaticStruct();
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FArcAddItemSpecsCommand> : public TStructOpsTypeTraitsBase2<FArcAddItemSpecsCommand>
+{
+	enum
+	{
+		WithCopy = true
+	};
+};
@@ -0,0 +1,89 @@
+/**
+ * This file is part of Velesarc
+ * Copyright (C) 2025-2025 Lukasz Baran
+ *
+ * Licensed under the European Union Public License (EUPL), Version 1.2 or –
+ * as soon as they will be approved by the European Commission – later versions
+ * of the EUPL (the "License");
+ *
+ * You may not use this work except in compliance with the License.
+ * You may get a copy of the License at:
+ *
+ * https://eupl.eu/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ */
+
+#include "Commands/ArcItemsStoreTransactionCommand.h"
+
+#include "Items/ArcItemsStoreComponent.h"
+
+DEFINE_LOG_CATEGORY(LogArcItemsStoreTransactionCommand);
+
+bool FArcItemsStoreTransactionCommand::CanSendCommand() const
+{
+	if (ItemsStore == nullptr || Transaction.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FArcItemTransactionEntry& Entry : Transaction.GetEntries())
+	{
+		if (Entry.Op == EArcItemTransactionOp::Add)
+		{
+			continue;
+		}
+
+		if (ItemsStore->IsPending(Entry.ItemId))
+		{
+			UE_LOG(LogArcItemsStoreTransactionCommand, Log, TEXT("Item %s Is currently pending."), *Entry.ItemId.ToString())
+			return false;
+		}
+
+		if (ItemsStore->GetItemPtr(Entry.ItemId) == nullptr)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FArcItemsStoreTransactionCommand::PreSendCommand()
+{
+	if (ItemsStore)
+	{
+		Transaction.GetAffectedItems(PendingItemIds);
+		ItemsStore->AddPendingItems(PendingItemIds);
+		CaptureExpectedVersions(ItemsStore);
+	}
+}
+
+void FArcItemsStoreTransactionCommand::CommandConfirmed(bool bSuccess)
+{
+	if (!bSuccess && ItemsStore)
+	{
+		ItemsStore->RemovePendingItems(PendingItemIds);
+	}
+}
+
+bool FArcItemsStoreTransactionCommand::Execute()
+{
+	if (ItemsStore == nullptr)
+	{
+		return false;
+	}
+
+	if (!ValidateVersions(ItemsStore))
+	{
+		UE_LOG(LogArcItemsStoreTransactionCommand, Log, TEXT("FArcItemsStoreTransactionCommand::Execute version mismatch, rejecting."))
+		return false;
+	}
+
+	return ItemsStore->CommitTransaction(Transaction);
+}
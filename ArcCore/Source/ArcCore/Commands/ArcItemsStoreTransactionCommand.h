@@ -0,0 +1,77 @@
+/**
+ * This file is part of Velesarc
+ * Copyright (C) 2025-2025 Lukasz Baran
+ *
+ * Licensed under the European Union Public License (EUPL), Version 1.2 or –
+ * as soon as they will be approved by the European Commission – later versions
+ * of the EUPL (the "License");
+ *
+ * You may not use this work except in compliance with the License.
+ * You may get a copy of the License at:
+ *
+ * https://eupl.eu/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ */
+
+#pragma once
+
+#include "Commands/ArcItemReplicatedCommand.h"
+#include "Items/ArcItemsStoreTransaction.h"
+#include "ArcItemsStoreTransactionCommand.generated.h"
+
+class UArcItemsStoreComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogArcItemsStoreTransactionCommand, Log, All);
+
+/**
+ * Sends a whole FArcItemsStoreTransaction to the server as one command, e.g. removing crafting
+ * ingredients and adding the result. Items it removes or moves are pending until replication confirms them.
+ */
+USTRUCT(BlueprintType)
+struct ARCCORE_API FArcItemsStoreTransactionCommand : public FArcItemReplicatedCommand
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+	TObjectPtr<UArcItemsStoreComponent> ItemsStore = nullptr;
+
+	UPROPERTY()
+	FArcItemsStoreTransaction Transaction;
+
+public:
+	virtual bool CanSendCommand() const override;
+	virtual void PreSendCommand() override;
+	virtual bool Execute() override;
+	virtual bool NeedsConfirmation() const override { return true; }
+	virtual void CommandConfirmed(bool bSuccess) override;
+
+	FArcItemsStoreTransactionCommand()
+		: ItemsStore(nullptr)
+	{}
+
+	FArcItemsStoreTransactionCommand(UArcItemsStoreComponent* InItemsStore
+		, const FArcItemsStoreTransaction& InTransaction)
+		: ItemsStore(InItemsStore)
+		, Transaction(InTransaction)
+	{}
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return FArcItemsStoreTransactionCommand::StaticStruct();
+	}
+	virtual ~FArcItemsStoreTransactionCommand() override = default;
+};
+
+template <>
+struct TStructOpsTypeTraits<FArcItemsStoreTransactionCommand>
+	: public TStructOpsTypeTraitsBase2<FArcItemsStoreTransactionCommand>
+{
+	enum { WithCopy = true };
+};
@@ -23,6 +23,7 @@
 
 #include "ArcCore/Items/ArcItemsStoreComponent.h"
 #include "ArcCore/Items/ArcItemSpec.h"
+#include "ArcCore/Items/ArcItemsStoreTransaction.h"
 #include "ArcCore/Items/Loot/ArcLootFragments.h"
 
 #include "MassEntityManager.h"
@@ -83,9 +84,16 @@ bool FArcLootItemCommand::Execute()
 		return true;
 	}
 
-	for (FArcItemSpec& ItemSpec : LootFragment->Items)
+	FArcItemsStoreTransaction Transaction;
+	for (const FArcItemSpec& ItemSpec : LootFragment->Items)
 	{
-		TargetItemsStore->AddItem(ItemSpec, FArcItemId());
+		Transaction.AddItem(ItemSpec);
+	}
+
+	if (!TargetItemsStore->CommitTransaction(Transaction))
+	{
+		UE_LOG(LogArcLootItem, Log, TEXT("Execute: TargetItemsStore cannot take all %d items."), LootFragment->Items.Num());
+		return false;
 	}
 
 	UE_LOG(LogArcLootItem, Log, TEXT("Transferred %d items from loot entity."), LootFragment->Items.Num());
@@ -28,6 +28,7 @@
 #include "Items/ArcItemsComponent.h"
 #include "Items/ArcItemsHelpers.h"
 #include "Items/ArcItemsStoreComponent.h"
+#include "Items/ArcItemsStoreTransaction.h"
 
 #include "Items/ArcItemStackMethod.h"
 #include "Items/Fragments/ArcItemFragment_Stacks.h"
@@ -64,3 +65,64 @@ bool FArcMoveItemBetweenStoresCommand::Execute()
 	return true;
 }
 
+bool FArcMoveItemsBetweenStoresCommand::CanSendCommand() const
+{
+	if (SourceStore == nullptr || TargetStore == nullptr || TargetStore == SourceStore)
+	{
+		return false;
+	}
+
+	if (ItemIds.IsEmpty())
+	{
+		return false;
+	}
+
+	for (const FArcItemId& ItemId : ItemIds)
+	{
+		if (SourceStore->IsPending(ItemId) || SourceStore->GetItemPtr(ItemId) == nullptr)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FArcMoveItemsBetweenStoresCommand::PreSendCommand()
+{
+	if (SourceStore)
+	{
+		PendingItemIds = ItemIds;
+		SourceStore->AddPendingItems(PendingItemIds);
+		CaptureExpectedVersions(SourceStore);
+	}
+}
+
+void FArcMoveItemsBetweenStoresCommand::CommandConfirmed(bool bSuccess)
+{
+	if (!bSuccess && SourceStore)
+	{
+		SourceStore->RemovePendingItems(PendingItemIds);
+	}
+}
+
+bool FArcMoveItemsBetweenStoresCommand::Execute()
+{
+	if (SourceStore == nullptr || TargetStore == nullptr)
+	{
+		return false;
+	}
+
+	if (!ValidateVersions(SourceStore))
+	{
+		return false;
+	}
+
+	FArcItemsStoreTransaction Transaction;
+	for (const FArcItemId& ItemId : ItemIds)
+	{
+		Transaction.MoveItem(ItemId, TargetStore);
+	}
+
+	return SourceStore->CommitTransaction(Transaction);
+}
+
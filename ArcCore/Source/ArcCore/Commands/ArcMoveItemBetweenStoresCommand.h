@@ -26,6 +26,7 @@
 
 #include "GameplayTagContainer.h"
 #include "ArcReplicatedCommand.h"
+#include "Commands/ArcItemReplicatedCommand.h"
 #include "Items/ArcItemId.h"
 
 #include "ArcMoveItemBetweenStoresCommand.generated.h"
@@ -83,3 +84,57 @@ public:
 	
 	virtual ~FArcMoveItemBetweenStoresCommand() override = default;
 };
+
+/**
+ * Moves many items, with their attachments, in one store transaction. Either every item is moved or none.
+ */
+USTRUCT()
+struct ARCCORE_API FArcMoveItemsBetweenStoresCommand : public FArcItemReplicatedCommand
+{
+	GENERATED_BODY()
+protected:
+	UPROPERTY()
+	TObjectPtr<UArcItemsStoreComponent> SourceStore;
+	
+	UPROPERTY()
+	TObjectPtr<UArcItemsStoreComponent> TargetStore;
+	
+	UPROPERTY()
+	TArray<FArcItemId> ItemIds;
+	
+public:
+	virtual bool CanSendCommand() const override;
+	virtual void PreSendCommand() override;
+	virtual bool Execute() override;
+	virtual bool NeedsConfirmation() const override { return true; }
+	virtual void CommandConfirmed(bool bSuccess) override;
+
+	FArcMoveItemsBetweenStoresCommand()
+		: SourceStore(nullptr)
+		, TargetStore(nullptr)
+	{}
+	
+	FArcMoveItemsBetweenStoresCommand(UArcItemsStoreComponent* InSourceStore
+									, UArcItemsStoreComponent* InTargetStore
+									, const TArray<FArcItemId>& InItemIds)
+		: SourceStore(InSourceStore)
+		, TargetStore(InTargetStore)
+		, ItemIds(InItemIds)
+	{
+
+	}
+	
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return FArcMoveItemsBetweenStoresCommand::StaticStruct();
+	}
+	
+	virtual ~FArcMoveItemsBetweenStoresCommand() override = default;
+};
+
+template <>
+struct TStructOpsTypeTraits<FArcMoveItemsBetweenStoresCommand>
+	: public TStructOpsTypeTraitsBase2<FArcMoveItemsBetweenStoresCommand>
+{
+	enum { WithCopy = true };
+};
@@ -27,9 +27,16 @@
 #include "ArcCoreGameplayTags.h"
 #include "ArcEventTags.h"
 #include "GameplayTagsManager.h"
+#include "GeneralProjectSettings.h"
 #include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "Items/ArcItemBundleNames.h"
+#include "Items/ArcItemDefinition.h"
 #include "Misc/App.h"
 #include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Stats/StatsMisc.h"
 
@@ -52,6 +59,32 @@ static FAutoConsoleCommand CVarDumpLoadedAssets(TEXT("Arc.DumpLoadedAssets")
 
 DEFINE_LOG_CATEGORY(LogArcAssetManager)
 
+namespace Arcx::AssetManager
+{
+	static FString GetItemDefinitionManifestPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("ArcCore") / TEXT("ItemDefinitionManifest.txt");
+	}
+
+	/**
+	 * Cooked content can change under the same build (patches, DLC, content plugins), and nothing short of
+	 * discovery itself tells which item definitions exist, so cooked builds always discover.
+	 */
+	static bool CanUseItemDefinitionManifest()
+	{
+		return !GIsEditor && !FPlatformProperties::RequiresCookedData();
+	}
+
+	/** Manifest is only valid for the build and project version that wrote it. */
+	static FString GetItemDefinitionManifestVersion()
+	{
+		return FString::Printf(TEXT("%s-%u-%s")
+			, FApp::GetBuildVersion()
+			, FEngineVersion::Current().GetChangelist()
+			, *GetDefault<UGeneralProjectSettings>()->ProjectVersion);
+	}
+}
+
 TSharedPtr<FStreamableHandle> FArcAssetManagerStartupJob::DoJob() const
 {
 	const double JobStartTime = FPlatformTime::Seconds();
@@ -211,6 +244,12 @@ void UArcCoreAssetManager::StartInitialLoading()
 	STARTUP_JOB(InitializeAbilitySystem());
 	STARTUP_JOB(InitializeGameplayCueManager());
 
+	// Editor preloads before PIE instead, so opening the editor does not load every item.
+	if (!GIsEditor)
+	{
+		STARTUP_JOB_WEIGHTED(PreloadItemDefinitions(LoadHandle), 5.f);
+	}
+
 	DoAllStartupJobs();
 }
 
@@ -237,6 +276,160 @@ void UArcCoreAssetManager::InitializeGameplayCueManager()
 	GCM->LoadAlwaysLoadedCues();
 }
 
+void UArcCoreAssetManager::PreloadItemDefinitions(TSharedPtr<FStreamableHandle>& OutHandle)
+{
+	SCOPED_BOOT_TIMING("UArcCoreAssetManager::PreloadItemDefinitions");
+
+	if (!bPreloadItemDefinitions)
+	{
+		return;
+	}
+
+	TArray<FPrimaryAssetId> ItemIds;
+	const bool bUseManifest = bUseItemDefinitionManifest && Arcx::AssetManager::CanUseItemDefinitionManifest();
+	const bool bFromManifest = bUseManifest && LoadItemDefinitionManifest(ItemIds);
+	if (!bFromManifest)
+	{
+		GatherItemDefinitionIds(ItemIds);
+		if (bUseManifest)
+		{
+			SaveItemDefinitionManifest(ItemIds);
+		}
+	}
+
+	if (ItemIds.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FName> Bundles;
+	if (!IsRunningDedicatedServer())
+	{
+		Bundles.Add(FArcItemBundleNames::ItemDefinitionAsyncBundle);
+		Bundles.Add(FArcItemBundleNames::ItemDefinitionSyncBundle);
+	}
+	if (!IsRunningClientOnly())
+	{
+		Bundles.Add(FArcItemBundleNames::ItemDefinitionServerAsyncBundle);
+		Bundles.Add(FArcItemBundleNames::ItemDefinitionServerSyncBundle);
+	}
+
+	UE_LOG(LogArcAssetManager
+		, Log
+		, TEXT("Preloading %d item definitions (%s)")
+		, ItemIds.Num()
+		, bFromManifest ? TEXT("manifest") : TEXT("discovered"));
+
+	// One request for everything lets the async loader work on all definitions and bundles in parallel.
+	OutHandle = LoadPrimaryAssets(ItemIds
+		, Bundles
+		, FStreamableDelegate::CreateUObject(this, &UArcCoreAssetManager::OnItemDefinitionsPreloaded, ItemIds, bFromManifest));
+
+	if (!OutHandle.IsValid())
+	{
+		// Everything was already resident.
+		OnItemDefinitionsPreloaded(MoveTemp(ItemIds), bFromManifest);
+	}
+}
+
+void UArcCoreAssetManager::GatherItemDefinitionIds(TArray<FPrimaryAssetId>& OutIds) const
+{
+	TArray<FPrimaryAssetTypeInfo> TypeInfos;
+	GetPrimaryAssetTypeInfoList(TypeInfos);
+
+	for (const FPrimaryAssetTypeInfo& TypeInfo : TypeInfos)
+	{
+		const UClass* BaseClass = TypeInfo.AssetBaseClassLoaded;
+		if (BaseClass == nullptr || !BaseClass->IsChildOf(UArcItemDefinition::StaticClass()))
+		{
+			continue;
+		}
+
+		TArray<FPrimaryAssetId> TypeIds;
+		GetPrimaryAssetIdList(TypeInfo.PrimaryAssetType, TypeIds);
+		OutIds.Append(TypeIds);
+	}
+}
+
+bool UArcCoreAssetManager::LoadItemDefinitionManifest(TArray<FPrimaryAssetId>& OutIds) const
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Arcx::AssetManager::GetItemDefinitionManifestPath()))
+	{
+		return false;
+	}
+
+	if (Lines.IsEmpty() || Lines[0] != Arcx::AssetManager::GetItemDefinitionManifestVersion())
+	{
+		return false;
+	}
+
+	OutIds.Reserve(Lines.Num() - 1);
+	for (int32 Idx = 1; Idx < Lines.Num(); Idx++)
+	{
+		const FPrimaryAssetId Id = FPrimaryAssetId::ParseTypeAndName(Lines[Idx]);
+		if (Id.IsValid())
+		{
+			OutIds.Add(Id);
+		}
+	}
+
+	return true;
+}
+
+void UArcCoreAssetManager::SaveItemDefinitionManifest(const TArray<FPrimaryAssetId>& InIds) const
+{
+	TArray<FString> Lines;
+	Lines.Reserve(InIds.Num() + 1);
+	Lines.Add(Arcx::AssetManager::GetItemDefinitionManifestVersion());
+	for (const FPrimaryAssetId& Id : InIds)
+	{
+		Lines.Add(Id.ToString());
+	}
+
+	const FString ManifestPath = Arcx::AssetManager::GetItemDefinitionManifestPath();
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *ManifestPath))
+	{
+		UE_LOG(LogArcAssetManager
+			, Warning
+			, TEXT("Failed to write item definition manifest %s")
+			, *ManifestPath);
+	}
+}
+
+void UArcCoreAssetManager::OnItemDefinitionsPreloaded(TArray<FPrimaryAssetId> InIds, bool bFromManifest)
+{
+	// Fragment lookups are compiled in PostLoad, so loaded definitions are ready to use as they are.
+	int32 NumMissing = 0;
+	PreloadedAssets.Reserve(PreloadedAssets.Num() + InIds.Num());
+	for (const FPrimaryAssetId& Id : InIds)
+	{
+		UArcItemDefinition* ItemDefinition = Cast<UArcItemDefinition>(GetPrimaryAssetObject(Id));
+		if (ItemDefinition == nullptr)
+		{
+			NumMissing++;
+			continue;
+		}
+
+		PreloadedAssets.Add(Id, ItemDefinition);
+	}
+
+	if (NumMissing > 0)
+	{
+		UE_LOG(LogArcAssetManager
+			, Warning
+			, TEXT("%d of %d item definitions failed to preload")
+			, NumMissing
+			, InIds.Num());
+
+		// Stale manifest, rediscover on next boot.
+		if (bFromManifest)
+		{
+			IFileManager::Get().Delete(*Arcx::AssetManager::GetItemDefinitionManifestPath());
+		}
+	}
+}
+
 void UArcCoreAssetManager::LoadGameData()
 {
 	if (DefaultGameData.Get())
@@ -508,6 +701,14 @@ void UArcCoreAssetManager::PreBeginPIE(bool bStartSimulate)
 		// You could add preloading of anything else needed for the experience we'll be
 		// using here (e.g., by grabbing the default experience from the world settings +
 		// the experience override in developer settings)
+
+		TSharedPtr<FStreamableHandle> ItemDefinitionsHandle;
+		PreloadItemDefinitions(ItemDefinitionsHandle);
+		if (ItemDefinitionsHandle.IsValid())
+		{
+			ItemDefinitionsHandle->WaitUntilComplete(0.0f
+				, false);
+		}
 	}
 }
 #endif
@@ -269,9 +269,35 @@ protected:
 
 	UPROPERTY(Config)
 	TArray<FName> DefaultServerBundles;
+
+	/**
+	 * Async load every item definition with its item bundles during startup (before PIE in editor),
+	 * so loot tables and vendors do not load them synchronously on first use.
+	 */
+	UPROPERTY(Config)
+	bool bPreloadItemDefinitions = true;
+
+	/**
+	 * Remember discovered item definition ids per build and project version, so later boots skip discovery.
+	 * Only used by uncooked standalone runs; editor and cooked builds always discover.
+	 */
+	UPROPERTY(Config)
+	bool bUseItemDefinitionManifest = true;
+
 private:
 	void DoAllStartupJobs();
 
+	/** Starts loading all item definitions. OutHandle is left empty if there is nothing to wait for. */
+	void PreloadItemDefinitions(TSharedPtr<FStreamableHandle>& OutHandle);
+
+	/** Every primary asset whose type is based on UArcItemDefinition. */
+	void GatherItemDefinitionIds(TArray<FPrimaryAssetId>& OutIds) const;
+
+	bool LoadItemDefinitionManifest(TArray<FPrimaryAssetId>& OutIds) const;
+	void SaveItemDefinitionManifest(const TArray<FPrimaryAssetId>& InIds) const;
+
+	void OnItemDefinitionsPreloaded(TArray<FPrimaryAssetId> InIds, bool bFromManifest);
+
 	// Sets up the ability system
 	void InitializeAbilitySystem();
 
@@ -294,6 +320,10 @@ private:
 
 	TArray<FName> ExperienceBundles;
 
+	/** Warm cache of preloaded item definitions. Checked by GetAsset before the asset registry. */
+	UPROPERTY(Transient)
+	TMap<FPrimaryAssetId, TObjectPtr<UObject>> PreloadedAssets;
+
 public:
 	void SetExperienceBundlesSync(UWorld* InWorld, const TArray<FName>& InExperienceBundles);
 	void SetExperienceBundlesAsync(UWorld* InWorld, const TArray<FName>& InExperienceBundles);
@@ -334,6 +364,11 @@ AssetType* UArcCoreAssetManager::GetAsset(const FPrimaryAssetId& AssetId
 {
 	AssetType* LoadedAsset = nullptr;
 
+	if (const TObjectPtr<UObject>* Preloaded = Get().PreloadedAssets.Find(AssetId))
+	{
+		return Cast<AssetType>(*Preloaded);
+	}
+
 	FAssetData Data;
 	Get().GetPrimaryAssetData(AssetId
 		, Data);
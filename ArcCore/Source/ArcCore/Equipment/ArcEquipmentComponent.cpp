@@ -178,19 +178,13 @@ TArray<const FArcItemData*> UArcEquipmentComponent::GetItemsFromStoreForSlot(con
 		return Items;
 	}
 
-	TArray<const FArcItemData*> StoreItems = FromItemsStore->GetItems();
-	for (const FArcItemData* ItemData : StoreItems)
+	FromItemsStore->ForEachItem([this, &Items, FromItemsStore, &InSlotId](const FArcItemData* ItemData)
 	{
-		if (ItemData == nullptr)
-		{
-			continue;
-		}
-
 		if (CanEquipItem(ItemData->GetItemId(), FromItemsStore, InSlotId))
 		{
 			Items.Add(ItemData);
 		}
-	}
+	});
 
 	return Items;
 }
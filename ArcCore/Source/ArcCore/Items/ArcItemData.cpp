@@ -101,8 +101,7 @@ const TArray<const FArcItemData*>& FArcItemData::GetItemsInSockets() const
 	{
 		ItemsInSockets.Empty();
 		ItemsInSockets.Reserve(AttachedItems.Num());
-		TArray<const FArcItemData*> Attached = GetItemsStoreComponent()->GetItemsAttachedTo(GetItemId());
-		ItemsInSockets.Append(Attached);
+		ItemsInSockets.Append(GetItemsStoreComponent()->GetItemsAttachedTo(GetItemId()));
 
 	}
 	return ItemsInSockets;
@@ -462,6 +461,7 @@ void FArcItemData::AddToSlot(const FGameplayTag& InSlotId)
 	if (GetItemsStoreComponent()->HasAuthority())
 	{
 		Slot = InSlotId;
+		GetItemsStoreComponent()->ItemsArray.UpdateItemIndex(this);
 		NotifyFragmentsSlotAdded(InSlotId);
 	}
 	else
@@ -502,6 +502,7 @@ void FArcItemData::RemoveFromSlot(const FGameplayTag& InSlotId)
 
 		OldSlot = Slot;
 		Slot = FGameplayTag::EmptyTag;
+		GetItemsStoreComponent()->ItemsArray.UpdateItemIndex(this);
 	}
 	else
 	{
@@ -538,7 +539,8 @@ void FArcItemData::ChangeSlot(const FGameplayTag& InNewSlot)
 	if (GetItemsStoreComponent()->HasAuthority())
 	{
 		OldSlot = Slot;
-		Slot = InNewSlot;	
+		Slot = InNewSlot;
+		GetItemsStoreComponent()->ItemsArray.UpdateItemIndex(this);
 	}
 
 	//bAddedToSlot = false;
@@ -564,6 +566,7 @@ void FArcItemData::AttachToItem(const FArcItemId& InOwnerItem, const FGameplayTa
 		OldAttachedToSlot = AttachedToSlot;
 		AttachedToSlot = InAttachSlot;
 		GetOwnerPtr();
+		OwnerComponent->ItemsArray.UpdateItemIndex(this);
 	}
 	
 	const TSet<FArcInstancedStruct>& IS = GetItemDefinition()->GetScalableFloatFragments();
@@ -699,6 +702,7 @@ void FArcItemData::DetachFromItem()
 			OwnerId.Reset();
 
 			OldOwnerId = OwnerId;
+			OwnerComponent->ItemsArray.UpdateItemIndex(this);
 		}
 
 		return;
@@ -712,6 +716,7 @@ void FArcItemData::DetachFromItem()
 		OwnerId.Reset();
 		OldAttachedToSlot = AttachedToSlot;
 		AttachedToSlot = FGameplayTag::EmptyTag;
+		OwnerComponent->ItemsArray.UpdateItemIndex(this);
 	
 		OwnerComponent->MarkItemDirtyById(OwnerData->GetItemId());
 		OwnerComponent->MarkItemDirtyById(GetItemId());
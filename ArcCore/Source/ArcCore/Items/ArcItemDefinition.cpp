@@ -73,6 +73,8 @@ void UArcItemDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyC
 			IS.PreSave();
 		}
 	}
+
+	RebuildFragmentLookups();
 }
 
 EDataValidationResult UArcItemDefinition::IsDataValid(FDataValidationContext& Context) const
@@ -134,6 +136,8 @@ void UArcItemDefinition::PostDuplicate(EDuplicateMode::Type DuplicateMode)
 	{
 		ItemId = FGuid::NewGuid();
 	}
+
+	RebuildFragmentLookups();
 }
 
 void UArcItemDefinition::UpdateAssetBundleData()
@@ -159,6 +163,44 @@ void UArcItemDefinition::UpdateAssetBundleData()
 void UArcItemDefinition::PostInitProperties()
 {
 	Super::PostInitProperties();
+	RebuildFragmentLookups();
+}
+
+void UArcItemDefinition::PostLoad()
+{
+	Super::PostLoad();
+	RebuildFragmentLookups();
+}
+
+void UArcItemDefinition::RebuildFragmentLookups()
+{
+	CompileLookup(FragmentSet, FragmentLookup);
+	CompileLookup(ScalableFloatFragmentSet, ScalableFloatFragmentLookup);
+}
+
+void UArcItemDefinition::CompileLookup(const TSet<FArcInstancedStruct>& InSet, TArray<int16>& OutLookup)
+{
+	OutLookup.Reset();
+	for (auto It = InSet.CreateConstIterator(); It; ++It)
+	{
+		const int32 TypeId = FArcItemFragmentTypeIds::Get(It->GetScriptStruct());
+		const int32 ElementIndex = It.GetId().AsInteger();
+		if (TypeId == INDEX_NONE || !ensure(ElementIndex <= MAX_int16))
+		{
+			continue;
+		}
+
+		if (TypeId >= OutLookup.Num())
+		{
+			const int32 OldNum = OutLookup.Num();
+			OutLookup.SetNumUninitialized(TypeId + 1);
+			for (int32 Idx = OldNum; Idx < OutLookup.Num(); ++Idx)
+			{
+				OutLookup[Idx] = INDEX_NONE;
+			}
+		}
+		OutLookup[TypeId] = static_cast<int16>(ElementIndex);
+	}
 }
 
 void UArcItemDefinition::PreSave(FObjectPreSaveContext SaveContext)
@@ -431,6 +473,7 @@ bool UArcItemDefinition::AddFragmentByType(UScriptStruct* InFragmentType)
 		FInstancedStruct Instance;
 		Instance.InitializeAs(InFragmentType);
 		FragmentSet.Add(FArcInstancedStruct(Instance));
+		RebuildFragmentLookups();
 		return true;
 	}
 	else if (InFragmentType->IsChildOf(FArcScalableFloatItemFragment::StaticStruct()))
@@ -442,6 +485,7 @@ bool UArcItemDefinition::AddFragmentByType(UScriptStruct* InFragmentType)
 		FInstancedStruct Instance;
 		Instance.InitializeAs(InFragmentType);
 		ScalableFloatFragmentSet.Add(FArcInstancedStruct(Instance));
+		RebuildFragmentLookups();
 		return true;
 	}
 
@@ -461,13 +505,17 @@ bool UArcItemDefinition::RemoveFragmentByType(UScriptStruct* InFragmentType)
 	{
 		FArcInstancedStruct Key;
 		Key.StructName = StructName;
-		return FragmentSet.Remove(Key) > 0;
+		const bool bRemoved = FragmentSet.Remove(Key) > 0;
+		RebuildFragmentLookups();
+		return bRemoved;
 	}
 	else if (InFragmentType->IsChildOf(FArcScalableFloatItemFragment::StaticStruct()))
 	{
 		FArcInstancedStruct Key;
 		Key.StructName = StructName;
-		return ScalableFloatFragmentSet.Remove(Key) > 0;
+		const bool bRemoved = ScalableFloatFragmentSet.Remove(Key) > 0;
+		RebuildFragmentLookups();
+		return bRemoved;
 	}
 
 	return false;
@@ -589,6 +637,8 @@ void UArcItemDefinitionTemplate::SetNewOrReplaceItemTemplate(UArcItemDefinition*
 	}
 	TargetItemDefinition->SourceTemplate = this;
 	TargetItemDefinition->ItemType = ItemType;
+
+	TargetItemDefinition->RebuildFragmentLookups();
 }
 
 void UArcItemDefinitionTemplate::SetItemTemplate(UArcItemDefinition* TargetItemDefinition)
@@ -731,6 +781,8 @@ void UArcItemDefinitionTemplate::SetItemTemplate(UArcItemDefinition* TargetItemD
 
 	TargetItemDefinition->SourceTemplate = this;
 	TargetItemDefinition->ItemType = ItemType;
+
+	TargetItemDefinition->RebuildFragmentLookups();
 }
 
 void UArcItemDefinitionTemplate::UpdateFromTemplate(UArcItemDefinition* TargetItemDefinition)
@@ -977,6 +1029,8 @@ void UArcItemDefinitionTemplate::UpdateFromTemplate(UArcItemDefinition* TargetIt
 			TargetItemDefinition->EditorFragmentSet.Add(NewInstance);
 		}
 	}
+
+	TargetItemDefinition->RebuildFragmentLookups();
 }
 
 void UArcItemDefinitionTemplate::PushFromItem(UArcItemDefinition* SourceItem)
@@ -1033,5 +1087,7 @@ void UArcItemDefinitionTemplate::PushFromItem(UArcItemDefinition* SourceItem)
 	}
 
 	ItemType = SourceItem->ItemType;
+
+	RebuildFragmentLookups();
 }
 #endif
\ No newline at end of file
@@ -150,6 +150,7 @@ public:
 		FInstancedStruct Instance;
 		Instance.InitializeAs<T>(InFragment);
 		FragmentSet.Add(FArcInstancedStruct(Instance));
+		RebuildFragmentLookups();
 	}
 
 	/**
@@ -165,6 +166,12 @@ public:
 	 */
 	bool RemoveFragmentByType(UScriptStruct* InFragmentType);
 
+	/**
+	 * Recompile the fragment lookups from FragmentSet and ScalableFloatFragmentSet.
+	 * Done on load, init, duplicate and edit; call it after changing the sets any other way.
+	 */
+	void RebuildFragmentLookups();
+
 public:
 	UArcItemDefinition();
 
@@ -188,6 +195,8 @@ public:
 	
 	virtual void PostInitProperties() override;
 
+	virtual void PostLoad() override;
+
 	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
 
 	// Reverse index ItemTags (Tag Key, PropertyNAme = Value);
@@ -218,17 +227,23 @@ public:
 	template <typename T>
 	const T* FindFragment() const
 	{
-		if (const FArcInstancedStruct* IS = FragmentSet.FindByHash(GetTypeHash(T::StaticStruct()->GetFName()), T::StaticStruct()->GetFName()))
+		if (const FArcInstancedStruct* IS = FindInLookup(FragmentSet, FragmentLookup, T::StaticStruct(), FArcItemFragmentTypeIds::Get<T>()))
 		{
 			return IS->GetPtr<T>();
 		}
 		return nullptr;
 	}
 
+	/** True if FragmentSet holds a fragment of exactly type T. */
+	template <typename T>
+	bool HasFragment() const
+	{
+		return FindInLookup(FragmentSet, FragmentLookup, T::StaticStruct(), FArcItemFragmentTypeIds::Get<T>()) != nullptr;
+	}
+
 	const uint8* GetFragment(UScriptStruct* InStructType) const
 	{
-		if (const FArcInstancedStruct* IS = FragmentSet.FindByHash(GetTypeHash(InStructType->GetFName())
-			, InStructType->GetFName()))
+		if (const FArcInstancedStruct* IS = FindInLookup(FragmentSet, FragmentLookup, InStructType, FArcItemFragmentTypeIds::Get(InStructType)))
 		{
 			return IS->GetMemory();
 		}
@@ -239,8 +254,7 @@ public:
 	template <typename T>
 	const T* GetScalableFloatFragment() const
 	{
-		if (const FArcInstancedStruct* IS = ScalableFloatFragmentSet.FindByHash(GetTypeHash(T::StaticStruct()->GetFName())
-			, T::StaticStruct()->GetFName()))
+		if (const FArcInstancedStruct* IS = FindInLookup(ScalableFloatFragmentSet, ScalableFloatFragmentLookup, T::StaticStruct(), FArcItemFragmentTypeIds::Get<T>()))
 		{
 			return IS->GetPtr<T>();
 		}
@@ -250,7 +264,7 @@ public:
 
 	const FArcScalableFloatItemFragment* GetScalableFloatFragment(const UScriptStruct* InStructType) const
 	{
-		if (const FArcInstancedStruct* IS = ScalableFloatFragmentSet.FindByHash(GetTypeHash(InStructType->GetFName()), InStructType->GetFName()))
+		if (const FArcInstancedStruct* IS = FindInLookup(ScalableFloatFragmentSet, ScalableFloatFragmentLookup, InStructType, FArcItemFragmentTypeIds::Get(InStructType)))
 		{
 			return IS->GetPtr<FArcScalableFloatItemFragment>();
 		}
@@ -282,6 +296,39 @@ public:
 #endif
 	
 private:
+	/**
+	 * Compiled fragment lookups, indexed by FArcItemFragmentTypeIds. Each entry is the FSetElementId
+	 * of that type's fragment in the matching set, or INDEX_NONE. Sized to the highest id present.
+	 */
+	TArray<int16> FragmentLookup;
+	TArray<int16> ScalableFloatFragmentLookup;
+
+	static void CompileLookup(const TSet<FArcInstancedStruct>& InSet, TArray<int16>& OutLookup);
+
+	static const FArcInstancedStruct* FindInLookup(const TSet<FArcInstancedStruct>& InSet
+												   , const TArray<int16>& InLookup
+												   , const UScriptStruct* InStructType
+												   , int32 InTypeId)
+	{
+		if (InLookup.IsValidIndex(InTypeId) && InLookup[InTypeId] != INDEX_NONE)
+		{
+			const FSetElementId ElementId = FSetElementId::FromInteger(InLookup[InTypeId]);
+			if (InSet.IsValidId(ElementId) && InSet[ElementId].GetScriptStruct() == InStructType)
+			{
+				return &InSet[ElementId];
+			}
+		}
+
+#if WITH_EDITOR
+		// Editor tools edit the sets through reflection without recompiling; fall back to the set.
+		if (InStructType)
+		{
+			return InSet.FindByHash(GetTypeHash(InStructType->GetFName()), InStructType->GetFName());
+		}
+#endif
+		return nullptr;
+	}
+
 	static FGameplayTagContainer GetTagsFromAssetData(const FAssetData& AssetData
 													  , FName KeyName);
 
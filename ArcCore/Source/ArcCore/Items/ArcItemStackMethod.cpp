@@ -29,6 +29,7 @@
 #include "Items/ArcItemDefinition.h"
 
 #include "Items/ArcItemsStoreComponent.h"
+#include "Items/ArcItemsStoreTransaction.h"
 
 bool FArcItemStackMethod::TryStackSpec(TArray<FArcItemSpec>& ExistingSpecs, FArcItemSpec&& InSpec) const
 {
@@ -81,6 +82,17 @@ bool FArcItemStackMethod_CanNotStackUnique::CanAdd(UArcItemsStoreComponent* Owne
 	return true;
 }
 
+bool FArcItemStackMethod_CanNotStackUnique::CanAddPending(UArcItemsStoreComponent* Owner, const FArcItemSpec& InSpec, const FArcItemsStorePendingChanges& Pending) const
+{
+	if (!Owner)
+	{
+		return false;
+	}
+
+	const int32 ExistingNum = Owner->GetItemByDefinition(InSpec.GetItemDefinition()) != nullptr ? 1 : 0;
+	return ExistingNum + Pending.GetDefinitionDelta(InSpec.GetItemDefinition()) <= 0;
+}
+
 bool FArcItemStackMethod_CanNotStackUnique::TryStackSpec(TArray<FArcItemSpec>& ExistingSpecs, FArcItemSpec&& InSpec) const
 {
 	const FPrimaryAssetId InDefId = InSpec.GetItemDefinitionId();
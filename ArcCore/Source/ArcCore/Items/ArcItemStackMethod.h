@@ -29,6 +29,7 @@
 #include "ArcItemStackMethod.generated.h"
 
 struct FArcItemSpec;
+struct FArcItemsStorePendingChanges;
 class UArcItemsStoreComponent;
 struct FMassEntityManager;
 
@@ -60,6 +61,9 @@ public:
 	 */
 	virtual bool CanAdd(UArcItemsStoreComponent* Owner, const FArcItemSpec& InSpec) const { return true; }
 
+	/** CanAdd for a transaction entry, as if the earlier entries in Pending were already applied. */
+	virtual bool CanAddPending(UArcItemsStoreComponent* Owner, const FArcItemSpec& InSpec, const FArcItemsStorePendingChanges& Pending) const { return CanAdd(Owner, InSpec); }
+
 	/**
 	 * Attempt to merge InSpec into ExistingSpecs according to this stack method.
 	 * Returns true if a matching definition was found — InSpec was merged into
@@ -124,6 +128,8 @@ public:
 
 	virtual bool CanAdd(UArcItemsStoreComponent* Owner, const FArcItemSpec& InSpec) const override;
 
+	virtual bool CanAddPending(UArcItemsStoreComponent* Owner, const FArcItemSpec& InSpec, const FArcItemsStorePendingChanges& Pending) const override;
+
 	virtual bool TryStackSpec(TArray<FArcItemSpec>& ExistingSpecs, FArcItemSpec&& InSpec) const override;
 
 	virtual ~FArcItemStackMethod_CanNotStackUnique() override = default;
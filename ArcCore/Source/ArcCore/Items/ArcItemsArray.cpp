@@ -66,9 +66,7 @@ FArcItemCopyContainerHelper FArcItemCopyContainerHelper::New(UArcItemsStoreCompo
 	Container.SlotId = InData->GetSlotId();
 	CopyPersistentInstances(Container.Item, InData);
 
-	TArray<const FArcItemData*> AttachedItems = InItemsStore->GetItemsArray().GetItemsAttachedTo(InData->GetItemId());
-
-	for (const FArcItemData* Item : AttachedItems)
+	for (const FArcItemData* Item : InItemsStore->GetItemsArray().GetItemsAttachedTo(InData->GetItemId()))
 	{
 		if (Item)
 		{
@@ -141,6 +139,7 @@ void FArcItemDataInternalWrapper::PreReplicatedRemove(const FArcItemsArray& InAr
 	{
 		OnItemRemovedDelegate.Broadcast(Data->GetItemId());
 		Data->PreReplicatedRemove(InArraySerializer);
+		InArraySerializer.RemoveItemIndex(Data->GetItemId());
 		InArraySerializer.RemoveCachedItem(Data->GetItemId());
 	}
 }
@@ -151,6 +150,7 @@ void FArcItemDataInternalWrapper::PostReplicatedAdd(const FArcItemsArray& InArra
 	if (Data)
 	{
 		InArraySerializer.AddCachedItem(Data->GetItemId(), Data);
+		InArraySerializer.UpdateItemIndex(Data);
 		Data->PostReplicatedAdd(InArraySerializer);
 	}
 }
@@ -160,6 +160,8 @@ void FArcItemDataInternalWrapper::PostReplicatedChange(const FArcItemsArray& InA
 	FArcItemData* Data = ToItem();
 	if (Data)
 	{
+		// Slot and OwnerId already hold the replicated values.
+		InArraySerializer.UpdateItemIndex(Data);
 		Data->PostReplicatedChange(InArraySerializer);
 	}
 }
@@ -188,6 +190,100 @@ void FArcItemsArray::PostReplicatedChange(const TArrayView<int32>& ChangedIndice
 	}
 }
 
+void FArcItemsArray::UpdateItemIndex(const FArcItemData* InItem) const
+{
+	if (InItem == nullptr)
+	{
+		return;
+	}
+
+	// Item copies and subsystem-held items share ids with entries here.
+	FArcItemData* const* Cached = ItemsMap.Find(InItem->GetItemId());
+	if (Cached == nullptr || *Cached != InItem)
+	{
+		return;
+	}
+
+	FIndexedItem& Indexed = IndexedItems.FindOrAdd(InItem->GetItemId());
+	if (Indexed.Item != InItem)
+	{
+		RemoveFromSlotIndex(Indexed);
+		RemoveFromAttachmentIndex(Indexed);
+		Indexed = FIndexedItem();
+		Indexed.Item = InItem;
+	}
+
+	const FGameplayTag NewSlot = InItem->GetSlotId();
+	if (Indexed.Slot != NewSlot)
+	{
+		RemoveFromSlotIndex(Indexed);
+		Indexed.Slot = NewSlot;
+		if (NewSlot.IsValid())
+		{
+			SlotIndex.FindOrAdd(NewSlot).Add(InItem);
+			SlottedItems.Add(InItem);
+		}
+	}
+
+	// Reset() and the default constructor leave different invalid ids.
+	const FArcItemId NewOwnerId = InItem->GetOwnerId().IsValid() ? InItem->GetOwnerId() : FArcItemId();
+	if (Indexed.OwnerId != NewOwnerId)
+	{
+		RemoveFromAttachmentIndex(Indexed);
+		Indexed.OwnerId = NewOwnerId;
+		if (NewOwnerId.IsValid())
+		{
+			AttachmentIndex.FindOrAdd(NewOwnerId).Add(InItem);
+		}
+	}
+}
+
+void FArcItemsArray::RemoveItemIndex(const FArcItemId& InId) const
+{
+	FIndexedItem Indexed;
+	if (IndexedItems.RemoveAndCopyValue(InId, Indexed))
+	{
+		RemoveFromSlotIndex(Indexed);
+		RemoveFromAttachmentIndex(Indexed);
+	}
+}
+
+void FArcItemsArray::RemoveFromSlotIndex(const FIndexedItem& InIndexed) const
+{
+	if (InIndexed.Slot.IsValid() == false)
+	{
+		return;
+	}
+
+	if (TArray<const FArcItemData*, TInlineAllocator<1>>* OnSlot = SlotIndex.Find(InIndexed.Slot))
+	{
+		OnSlot->RemoveSingle(InIndexed.Item);
+		if (OnSlot->IsEmpty())
+		{
+			SlotIndex.Remove(InIndexed.Slot);
+		}
+	}
+
+	SlottedItems.RemoveSingle(InIndexed.Item);
+}
+
+void FArcItemsArray::RemoveFromAttachmentIndex(const FIndexedItem& InIndexed) const
+{
+	if (InIndexed.OwnerId.IsValid() == false)
+	{
+		return;
+	}
+
+	if (TArray<const FArcItemData*>* Attached = AttachmentIndex.Find(InIndexed.OwnerId))
+	{
+		Attached->RemoveSingle(InIndexed.Item);
+		if (Attached->IsEmpty())
+		{
+			AttachmentIndex.Remove(InIndexed.OwnerId);
+		}
+	}
+}
+
 void FArcItemsArray::AddInternalItem(UArcItemsStoreComponent* NewItemStoreComponent, FInstancedStruct&& InItem
 	, TArray<FInstancedStruct>& AttachedItems)
 {
@@ -199,6 +295,7 @@ void FArcItemsArray::AddInternalItem(UArcItemsStoreComponent* NewItemStoreCompon
 	int32 Idx = Items.Add(MoveTemp(Wrapper));
 	FArcItemData* AddedData = Items[Idx].ToItem();
 	AddCachedItem(AddedData->GetItemId(), AddedData);
+	UpdateItemIndex(AddedData);
 
 	for (FInstancedStruct& AttachedItem : AttachedItems)
 	{
@@ -210,6 +307,7 @@ void FArcItemsArray::AddInternalItem(UArcItemsStoreComponent* NewItemStoreCompon
 		int32 AttachIdx = Items.Add(MoveTemp(AttachWrapper));
 		FArcItemData* AddedAttach = Items[AttachIdx].ToItem();
 		AddCachedItem(AddedAttach->GetItemId(), AddedAttach);
+		UpdateItemIndex(AddedAttach);
 
 		AddedAttach->AttachToItem(AddedData->ItemId, AddedAttach->GetAttachSlot());
 		Edit().MarkItemDirty(Items[AttachIdx]);
@@ -266,12 +364,14 @@ int32 FArcItemsArray::AddItem(const FArcItemSpec& NewItemSpec
 
 	FArcItemData* Data = Items[Idx].ToItem();
 	AddCachedItem(Data->GetItemId(), Data);
+	UpdateItemIndex(Data);
 
 	return Items.Num() - 1;
 }
 
 void FArcItemsArray::RemoveItem(const FArcItemId& InItemId)
 {
+	RemoveItemIndex(InItemId);
 	RemoveCachedItem(InItemId);
 
 	int32 Idx = IndexOf(InItemId);
@@ -292,6 +392,7 @@ void FArcItemsArray::RemoveItem(int32 Idx)
 	FArcItemData* Data = Items[Idx].ToItem();
 	if (Data)
 	{
+		RemoveItemIndex(Data->GetItemId());
 		RemoveCachedItem(Data->GetItemId());
 	}
 	MarkItemDirtyIdx(Idx);
@@ -218,6 +218,28 @@ protected:
 	TArray<FArcItemDataInternalWrapper> Items;
 
 	mutable TMap<FArcItemId, FArcItemData*> ItemsMap;
+
+	/** Slot and owner an item is currently filed under in the indexes below. */
+	struct FIndexedItem
+	{
+		const FArcItemData* Item = nullptr;
+		FGameplayTag Slot;
+		FArcItemId OwnerId;
+	};
+
+	mutable TMap<FArcItemId, FIndexedItem> IndexedItems;
+
+	/** Items by slot. A slot holds more than one item only while replication settles a swap. */
+	mutable TMap<FGameplayTag, TArray<const FArcItemData*, TInlineAllocator<1>>> SlotIndex;
+
+	/** Every item on a valid slot, in the order they were put there. */
+	mutable TArray<const FArcItemData*> SlottedItems;
+
+	/** Attached items by owner item id. */
+	mutable TMap<FArcItemId, TArray<const FArcItemData*>> AttachmentIndex;
+
+	void RemoveFromSlotIndex(const FIndexedItem& InIndexed) const;
+	void RemoveFromAttachmentIndex(const FIndexedItem& InIndexed) const;
 	
 public:
 	const TArray<FArcItemDataInternalWrapper>& GetItems() const
@@ -257,6 +279,10 @@ public:
 	~FArcItemsArray()
 	{
 		ItemsMap.Reset();
+		IndexedItems.Reset();
+		SlotIndex.Reset();
+		SlottedItems.Reset();
+		AttachmentIndex.Reset();
 	}
 	
 public:
@@ -271,6 +297,16 @@ public:
 		ItemsMap.Remove(InId);
 	}
 
+	/**
+	 * Files InItem under its current slot and owner, dropping the entries it was filed under
+	 * before. Must follow every change to Slot or OwnerId, local or replicated. Items not
+	 * cached in this array are ignored.
+	 */
+	void UpdateItemIndex(const FArcItemData* InItem) const;
+
+	/** Drops InId from the slot and attachment indexes. Does not read the item itself. */
+	void RemoveItemIndex(const FArcItemId& InId) const;
+
 
 	using ItemArrayType = TArray<FArcItemDataInternalWrapper>;
 	
@@ -349,9 +385,11 @@ public:
 		return nullptr;
 	}
 	
+	/** Copies item pointers out. Use ForEachItem unless the array changes while iterating. */
 	TArray<const FArcItemData*> GetItemsPtr() const
 	{
 		TArray<const FArcItemData*> OutItems;
+		OutItems.Reserve(Items.Num());
 		for (const FArcItemDataInternalWrapper& W : Items)
 		{
 			OutItems.Add(W.ToItem());
@@ -359,51 +397,43 @@ public:
 		return OutItems;
 	}
 
-	const FArcItemData* GetItemFromSlot(const FGameplayTag& InSlotId) const
+	template<typename TFunc>
+	void ForEachItem(TFunc&& Func) const
 	{
 		for (const FArcItemDataInternalWrapper& W : Items)
 		{
-			if(W.ToItem()->GetSlotId() == InSlotId)
+			if (const FArcItemData* Data = W.ToItem())
 			{
-				return W.ToItem();
+				Func(Data);
 			}
 		}
-
-		return nullptr;
 	}
 
-	TArray<const FArcItemData*> GetAllItemsOnSlots() const
+	const FArcItemData* GetItemFromSlot(const FGameplayTag& InSlotId) const
 	{
-		TArray<const FArcItemData*> Out;
-		for (const FArcItemDataInternalWrapper& W : Items)
+		if (const TArray<const FArcItemData*, TInlineAllocator<1>>* OnSlot = SlotIndex.Find(InSlotId))
 		{
-			if(W.ToItem()->GetSlotId().IsValid())
-			{
-				Out.Add(W.ToItem());
-			}
+			return (*OnSlot)[0];
 		}
 
-		return Out;
+		return nullptr;
 	}
 
-	TArray<const FArcItemData*> GetItemsAttachedTo(const FArcItemId& InItemId) const
+	/** Valid until the next slot change. */
+	TConstArrayView<const FArcItemData*> GetAllItemsOnSlots() const
 	{
-		TArray<const FArcItemData*> Out;
+		return SlottedItems;
+	}
 
-		if (InItemId.IsValid() == false)
-		{
-			return Out;
-		}
-		
-		for (const FArcItemDataInternalWrapper& W : Items)
+	/** Valid until the next attach or detach. */
+	TConstArrayView<const FArcItemData*> GetItemsAttachedTo(const FArcItemId& InItemId) const
+	{
+		if (const TArray<const FArcItemData*>* Attached = AttachmentIndex.Find(InItemId))
 		{
-			if(W.ToItem()->GetOwnerId() == InItemId)
-			{
-				Out.Add(W.ToItem());
-			}
+			return *Attached;
 		}
 
-		return Out;
+		return TConstArrayView<const FArcItemData*>();
 	}
 
 	
@@ -313,10 +313,7 @@ FArcItemId UArcItemsStoreComponent::AddItem(const FArcItemSpec& InItem, const FA
 			
 			FArcItemData* Entry = ItemsStoreSubsystem->GetItemPtr(ItemId);
 			
-			ItemsSubsystem->BroadcastOnItemAddedToStore(this, Entry);
-			ItemsSubsystem->OnItemAddedToStoreDynamic.Broadcast(this, Entry->GetItemId());
-			ItemsSubsystem->BroadcastActorOnItemAddedToStore(GetOwner(), this, Entry);
-			ItemsSubsystem->BroadcastActorOnItemAddedToStoreMap(GetOwner(), Entry->GetItemId(), this, Entry);
+			BroadcastItemAdded(ItemsSubsystem, Entry);
 
 			return ItemId;
 		}
@@ -359,8 +356,11 @@ FArcItemId UArcItemsStoreComponent::AddItem(const FArcItemSpec& InItem, const FA
 	
 	int32 Idx = ItemsArray.AddItem(InItem, bAlreadyExists);
 
-	ItemNum = ItemsArray.Num();
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ItemNum, this);
+	if (TransactionDepth == 0)
+	{
+		ItemNum = ItemsArray.Num();
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ItemNum, this);
+	}
 	
 	SetupItem(Idx, OwnerItemId);
 
@@ -382,6 +382,26 @@ FArcItemId UArcItemsStoreComponent::AddItem(const FArcItemSpec& InItem, const FA
 		}
 	}
 	
+	BroadcastItemAdded(ItemsSubsystem, Entry);
+	
+	Entry->OnItemAdded();
+	
+	return Entry->GetItemId();
+}
+
+void UArcItemsStoreComponent::BroadcastItemAdded(UArcItemsSubsystem* ItemsSubsystem, const FArcItemData* Entry)
+{
+	if (TransactionDepth > 0)
+	{
+		// Store-wide listeners get the aggregated OnItemsStoreTransactionCommitted instead.
+		TransactionChanges.AddedItems.Add(Entry->GetItemId());
+		if (ItemsSubsystem != nullptr)
+		{
+			ItemsSubsystem->BroadcastActorOnItemAddedToStoreMap(GetOwner(), Entry->GetItemId(), this, Entry);
+		}
+		return;
+	}
+
 	if (ItemsSubsystem != nullptr)
 	{
 		ItemsSubsystem->BroadcastOnItemAddedToStore(this, Entry);
@@ -389,10 +409,6 @@ FArcItemId UArcItemsStoreComponent::AddItem(const FArcItemSpec& InItem, const FA
 		ItemsSubsystem->BroadcastActorOnItemAddedToStore(GetOwner(), this, Entry);
 		ItemsSubsystem->BroadcastActorOnItemAddedToStoreMap(GetOwner(), Entry->GetItemId(), this, Entry);
 	}
-	
-	Entry->OnItemAdded();
-	
-	return Entry->GetItemId();
 }
 
 void UArcItemsStoreComponent::AddLoadedItem(UArcItemsStoreComponent* NewItemStoreComponent, FArcItemData&& InItem)
@@ -508,6 +524,10 @@ void UArcItemsStoreComponent::RemoveItem(const FArcItemId& Item, int32 Stacks, b
 			ItemsArray.MarkArrayDirty();
 			ItemsArray.MarkItemDirtyIdx(Idx);
 
+			if (TransactionDepth > 0)
+			{
+				TransactionChanges.RemovedItems.Add(Item);
+			}
 		}
 		else
 		{
@@ -515,14 +535,23 @@ void UArcItemsStoreComponent::RemoveItem(const FArcItemId& Item, int32 Stacks, b
 
 			ItemData->SetStacks(RemainingStacks);
 			ItemsArray.MarkItemDirtyIdx(Idx);
-			GetOwner()->ForceNetUpdate();
+
+			if (TransactionDepth > 0)
+			{
+				TransactionChanges.ChangedItems.AddUnique(Item);
+			}
+			else
+			{
+				GetOwner()->ForceNetUpdate();
+			}
 		}
 	}
 }
 
 void UArcItemsStoreComponent::DestroyItem(const FArcItemId& ItemId)
 {
-	TArray<const FArcItemData*> AttachedItems = GetItemsAttachedTo(ItemId);
+	// Copied, destroying attachments shrinks the index entry.
+	const TArray<const FArcItemData*> AttachedItems(GetItemsAttachedTo(ItemId));
 
 	for (int32 Idx = AttachedItems.Num() - 1; Idx > -1; Idx--)
 	{
@@ -541,9 +570,279 @@ void UArcItemsStoreComponent::DestroyItem(const FArcItemId& ItemId)
 	
 	ItemsArray.RemoveItem(ItemId);
 
+	if (TransactionDepth > 0)
+	{
+		TransactionChanges.RemovedItems.Add(ItemId);
+	}
+
 	//MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ItemsArray, this);
 }
 
+bool UArcItemsStoreComponent::CanCommitTransaction(const FArcItemsStoreTransaction& InTransaction)
+{
+	if (GetOwnerRole() < ENetRole::ROLE_Authority)
+	{
+		return false;
+	}
+
+	// Remove and Move both consume the item and its attachments, so each id may be consumed once.
+	TSet<FArcItemId> TouchedItems;
+	TouchedItems.Reserve(InTransaction.Num());
+
+	// Each entry is validated as if the entries before it were already applied.
+	TMap<UArcItemsStoreComponent*, FArcItemsStorePendingChanges> PendingChanges;
+	PendingChanges.Add(this);
+
+	TArray<const FArcItemData*, TInlineAllocator<8>> ConsumedItems;
+
+	for (const FArcItemTransactionEntry& Entry : InTransaction.GetEntries())
+	{
+		switch (Entry.Op)
+		{
+			case EArcItemTransactionOp::Add:
+			{
+				const UArcItemDefinition* ItemDefinition = Entry.Spec.GetItemDefinition();
+				if (ItemDefinition == nullptr)
+				{
+					UE_LOGFMT(LogArcItems, Warning, "Transaction on {0}: item spec without definition", GetName());
+					return false;
+				}
+
+				FArcItemsStorePendingChanges& Pending = PendingChanges.FindChecked(this);
+				const FArcItemStackMethod* StackMethod = ItemDefinition->GetStackMethod<FArcItemStackMethod>();
+				if (StackMethod != nullptr && !StackMethod->CanAddPending(this, Entry.Spec, Pending))
+				{
+					UE_LOGFMT(LogArcItems, Log, "Transaction on {0}: cannot add {1}", GetName(), ItemDefinition->GetName());
+					return false;
+				}
+
+				Pending.AddDefinitionDelta(ItemDefinition, 1);
+				break;
+			}
+			case EArcItemTransactionOp::Remove:
+			case EArcItemTransactionOp::Move:
+			{
+				if (TouchedItems.Contains(Entry.ItemId))
+				{
+					UE_LOGFMT(LogArcItems, Warning, "Transaction on {0}: item {1} used by more than one entry", GetName(), Entry.ItemId.ToString());
+					return false;
+				}
+
+				const FArcItemData* ItemData = GetItemPtr(Entry.ItemId);
+				if (ItemData == nullptr)
+				{
+					UE_LOGFMT(LogArcItems, Log, "Transaction on {0}: item {1} does not exist", GetName(), Entry.ItemId.ToString());
+					return false;
+				}
+
+				if (Entry.Op == EArcItemTransactionOp::Move)
+				{
+					if (Entry.TargetStore == nullptr || Entry.TargetStore == this)
+					{
+						return false;
+					}
+
+					// Attachments move with their owner.
+					if (ItemData->GetOwnerId().IsValid())
+					{
+						return false;
+					}
+
+					if (Entry.TargetStore->GetItemPtr(Entry.ItemId) != nullptr)
+					{
+						UE_LOGFMT(LogArcItems, Error, "Item {0} Already exists", Entry.ItemId.ToString());
+						return false;
+					}
+				}
+
+				// A partial remove only takes stacks; the item stays in the store.
+				const bool bConsumesItem = Entry.Op == EArcItemTransactionOp::Move
+					|| Entry.Stacks < 0
+					|| ItemData->GetStacks() <= Entry.Stacks;
+				if (!bConsumesItem)
+				{
+					TouchedItems.Add(Entry.ItemId);
+					break;
+				}
+
+				ConsumedItems.Reset();
+				ConsumedItems.Add(ItemData);
+				for (int32 Idx = 0; Idx < ConsumedItems.Num(); Idx++)
+				{
+					ConsumedItems.Append(GetItemsAttachedTo(ConsumedItems[Idx]->GetItemId()));
+				}
+
+				FArcItemsStorePendingChanges& Pending = PendingChanges.FindChecked(this);
+				for (const FArcItemData* ConsumedItem : ConsumedItems)
+				{
+					bool bAlreadyTouched = false;
+					TouchedItems.Add(ConsumedItem->GetItemId(), &bAlreadyTouched);
+					if (bAlreadyTouched)
+					{
+						UE_LOGFMT(LogArcItems, Warning, "Transaction on {0}: item {1} used by more than one entry", GetName(), ConsumedItem->GetItemId().ToString());
+						return false;
+					}
+
+					Pending.AddDefinitionDelta(ConsumedItem->GetItemDefinition(), -1);
+				}
+
+				if (Entry.Op == EArcItemTransactionOp::Move)
+				{
+					FArcItemsStorePendingChanges& TargetPending = PendingChanges.FindOrAdd(Entry.TargetStore);
+					for (const FArcItemData* ConsumedItem : ConsumedItems)
+					{
+						const UArcItemDefinition* ItemDefinition = ConsumedItem->GetItemDefinition();
+						const FArcItemStackMethod* StackMethod = ItemDefinition != nullptr ? ItemDefinition->GetStackMethod<FArcItemStackMethod>() : nullptr;
+						if (StackMethod != nullptr)
+						{
+							const FArcItemSpec MovedSpec = FArcItemSpec::NewItem(ItemDefinition, ConsumedItem->GetLevel(), ConsumedItem->GetStacks());
+							if (!StackMethod->CanAddPending(Entry.TargetStore, MovedSpec, TargetPending))
+							{
+								UE_LOGFMT(LogArcItems, Log, "Transaction on {0}: cannot move {1} to {2}", GetName(), ItemDefinition->GetName(), Entry.TargetStore->GetName());
+								return false;
+							}
+						}
+
+						TargetPending.AddDefinitionDelta(ItemDefinition, 1);
+					}
+				}
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool UArcItemsStoreComponent::CommitTransaction(const FArcItemsStoreTransaction& InTransaction, FArcItemsStoreChanges* OutChanges)
+{
+	if (!CanCommitTransaction(InTransaction))
+	{
+		return false;
+	}
+
+	TArray<UArcItemsStoreComponent*, TInlineAllocator<2>> TargetStores;
+	for (const FArcItemTransactionEntry& Entry : InTransaction.GetEntries())
+	{
+		if (Entry.Op == EArcItemTransactionOp::Move)
+		{
+			TargetStores.AddUnique(Entry.TargetStore);
+		}
+	}
+
+	bool bCommitted = true;
+
+	BeginTransactionScope();
+	for (UArcItemsStoreComponent* TargetStore : TargetStores)
+	{
+		TargetStore->BeginTransactionScope();
+	}
+
+	for (const FArcItemTransactionEntry& Entry : InTransaction.GetEntries())
+	{
+		switch (Entry.Op)
+		{
+			case EArcItemTransactionOp::Add:
+			{
+				// Validation should have caught this; whatever was applied so far stays applied.
+				const FArcItemId NewItemId = AddItem(Entry.Spec, FArcItemId::InvalidId);
+				if (!ensureMsgf(NewItemId.IsValid(), TEXT("Transaction on %s: adding %s failed after validation"), *GetName(), *GetNameSafe(Entry.Spec.GetItemDefinition())))
+				{
+					bCommitted = false;
+				}
+				break;
+			}
+			case EArcItemTransactionOp::Remove:
+			{
+				RemoveItem(Entry.ItemId, Entry.Stacks);
+				break;
+			}
+			case EArcItemTransactionOp::Move:
+			{
+				FArcItemCopyContainerHelper Copy = GetItemCopyHelper(Entry.ItemId);
+				Copy.SlotId = FGameplayTag::EmptyTag;
+
+				UArcItemsStoreComponent* TargetStore = Entry.TargetStore;
+				TargetStore->TransactionChanges.AddedItems.Append(TargetStore->AddItemDataInternal(Copy));
+
+				DestroyItem(Entry.ItemId);
+				break;
+			}
+		}
+	}
+
+	for (UArcItemsStoreComponent* TargetStore : TargetStores)
+	{
+		TargetStore->EndTransactionScope(nullptr);
+	}
+	EndTransactionScope(OutChanges);
+
+	return bCommitted;
+}
+
+void UArcItemsStoreComponent::BeginTransactionScope()
+{
+	TransactionDepth++;
+}
+
+void UArcItemsStoreComponent::EndTransactionScope(FArcItemsStoreChanges* OutChanges)
+{
+	check(TransactionDepth > 0);
+	if (--TransactionDepth > 0)
+	{
+		return;
+	}
+
+	FArcItemsStoreChanges Changes = MoveTemp(TransactionChanges);
+	TransactionChanges = FArcItemsStoreChanges();
+
+	// One version bump and one fast array dirty mark per item, however many times it was touched.
+	for (const FArcItemId& ItemId : DeferredDirtyItems)
+	{
+		FArcItemData* ItemData = GetItemPtr(ItemId);
+		if (ItemData == nullptr)
+		{
+			continue;
+		}
+
+		ItemData->IncrementVersion();
+		ItemsArray.MarkItemDirtyHandle(ItemId);
+
+		if (!Changes.AddedItems.Contains(ItemId))
+		{
+			Changes.ChangedItems.AddUnique(ItemId);
+		}
+	}
+	DeferredDirtyItems.Reset();
+
+	Changes.ChangedItems.RemoveAll([&Changes](const FArcItemId& ItemId)
+	{
+		return Changes.RemovedItems.Contains(ItemId);
+	});
+
+	ItemNum = ItemsArray.Num();
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ItemNum, this);
+
+	if (!Changes.IsEmpty())
+	{
+		if (AActor* Owner = GetOwner())
+		{
+			Owner->ForceNetUpdate();
+		}
+
+		if (UArcItemsSubsystem* ItemsSubsystem = UArcItemsSubsystem::Get(this))
+		{
+			ItemsSubsystem->BroadcastOnItemsStoreTransactionCommitted(this, Changes);
+			ItemsSubsystem->BroadcastActorOnItemsStoreTransactionCommitted(GetOwner(), this, Changes);
+		}
+	}
+
+	if (OutChanges != nullptr)
+	{
+		*OutChanges = MoveTemp(Changes);
+	}
+}
+
 const FArcItemData* UArcItemsStoreComponent::GetItemPtr(const FArcItemId& Handle) const
 {
 	if (bUseSubsystemForItemStore)
@@ -610,6 +909,12 @@ void UArcItemsStoreComponent::MarkItemDirtyById(const FArcItemId& InItemId)
 		return;
 	}
 
+	if (TransactionDepth > 0)
+	{
+		DeferredDirtyItems.Add(InItemId);
+		return;
+	}
+
 	if (FArcItemData* ItemData = GetItemPtr(InItemId))
 	{
 		ItemData->IncrementVersion();
@@ -638,22 +943,11 @@ void UArcItemsStoreComponent::MarkItemInstanceDirtyById(const FArcItemId& InItem
 const FArcItemData* UArcItemsStoreComponent::FindAttachedItemOnSlot(const FArcItemId& InOwnerId
 															  , const FGameplayTag& InAttachSlot) const
 {
-	const TArray<FArcItemDataInternalWrapper>& Items = ItemsArray.Items;
-	for (const FArcItemDataInternalWrapper& Item : Items)
+	for (const FArcItemData* ItemData : ItemsArray.GetItemsAttachedTo(InOwnerId))
 	{
-		if (Item.ToItem()->GetOwnerId() == InOwnerId)
+		if (ItemData->GetAttachSlot() == InAttachSlot)
 		{
-			const FArcItemData* ItemData = Item.ToItem();
-			
-			if (ItemData == nullptr)
-			{
-				continue;
-			}
-
-			if (ItemData->GetAttachSlot() == InAttachSlot)
-			{
-				return ItemData;
-			}
+			return ItemData;
 		}
 	}
 
@@ -662,23 +956,7 @@ const FArcItemData* UArcItemsStoreComponent::FindAttachedItemOnSlot(const FArcIt
 
 TArray<const FArcItemData*> UArcItemsStoreComponent::GetAttachedItems(const FArcItemId& InOwnerId) const
 {
-	TArray<const FArcItemData*> Out;
-
-	const TArray<FArcItemDataInternalWrapper>& Items = ItemsArray.Items;
-	for (const FArcItemDataInternalWrapper& Item : Items)
-	{
-		if (Item.ToItem()->GetOwnerId() == InOwnerId)
-		{
-			const FArcItemData* ItemData = Item.ToItem();
-			if (ItemData == nullptr)
-			{
-				continue;
-			}
-			Out.Add(ItemData);
-		}
-	}
-
-	return Out;
+	return TArray<const FArcItemData*>(ItemsArray.GetItemsAttachedTo(InOwnerId));
 }
 
 FArcItemId UArcItemsStoreComponent::InternalAttachToItemNew(const FArcItemId& OwnerId
@@ -880,7 +1158,7 @@ bool UArcItemsStoreComponent::IsOnAnySlot(const FArcItemId& InItemId) const
 	return false;
 }
 
-TArray<const FArcItemData*> UArcItemsStoreComponent::GetItemsAttachedTo(const FArcItemId& InItemId) const
+TConstArrayView<const FArcItemData*> UArcItemsStoreComponent::GetItemsAttachedTo(const FArcItemId& InItemId) const
 {
 	return ItemsArray.GetItemsAttachedTo(InItemId);
 }
@@ -888,18 +1166,11 @@ TArray<const FArcItemData*> UArcItemsStoreComponent::GetItemsAttachedTo(const FA
 const FArcItemData* UArcItemsStoreComponent::GetItemAttachedTo(const FArcItemId& InOwnerItemId
 	, const FGameplayTag& AttachSlot) const
 {
-	for (const FArcItemDataInternalWrapper& Item : ItemsArray.Items)
-	{
-		if (Item.ToItem()->GetOwnerId() == InOwnerItemId && Item.ToItem()->GetAttachSlot() == AttachSlot)
-		{
-			return Item.ToItem();
-		}
-	}
-	return nullptr;
+	return FindAttachedItemOnSlot(InOwnerItemId, AttachSlot);
 }
 
 
-TArray<const FArcItemData*> UArcItemsStoreComponent::GetAllItemsOnSlots() const
+TConstArrayView<const FArcItemData*> UArcItemsStoreComponent::GetAllItemsOnSlots() const
 {
 	return ItemsArray.GetAllItemsOnSlots();
 }
@@ -30,12 +30,14 @@
 #include "Fragments/ArcItemFragment_RequiredItems.h"
 #include "Items/ArcItemTypes.h"
 #include "Items/ArcItemId.h"
+#include "Items/ArcItemsStoreTransaction.h"
 
 #include "ArcItemsStoreComponent.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogArcItems, Log, All);
 
 class UArcItemDefinition;
+class UArcItemsSubsystem;
 struct FArcItemId;
 struct FArcItemData;
 
@@ -92,6 +94,20 @@ private:
 	 */
 	TSet<FArcItemId> PendingItems;
 
+	/** Open transaction scopes. While above zero item dirty marks and store-wide events are deferred. */
+	int32 TransactionDepth = 0;
+
+	/** Items marked dirty inside the open transaction, flushed once when it ends. */
+	TSet<FArcItemId> DeferredDirtyItems;
+
+	FArcItemsStoreChanges TransactionChanges;
+
+	void BeginTransactionScope();
+	void EndTransactionScope(FArcItemsStoreChanges* OutChanges);
+
+	/** Item added events, or only the per-item one plus a TransactionChanges entry while in a transaction. */
+	void BroadcastItemAdded(UArcItemsSubsystem* ItemsSubsystem, const FArcItemData* Entry);
+
 public:
 	void AddPendingItems(const TArray<FArcItemId>& Items);
 	void RemovePendingItems(const TArray<FArcItemId>& Items);
@@ -165,6 +181,26 @@ public:
 	 */
 	void DestroyItem(const FArcItemId& ItemId);
 
+	/**
+	 * Checks every entry without changing anything, each against the store state the entries before it
+	 * would leave, including what moves put into target stores. Authority only.
+	 */
+	bool CanCommitTransaction(const FArcItemsStoreTransaction& InTransaction);
+
+	/**
+	 * Validates the whole transaction once, then applies all entries. Dirty marks are coalesced per item,
+	 * net update is forced once per touched store and OnItemsStoreTransactionCommitted fires once per store
+	 * instead of the per-item store-wide added/removed events. Per-item map delegates still fire.
+	 * @return false if validation failed, in which case nothing was changed, or if an add still failed
+	 * while applying, in which case the other entries were applied.
+	 */
+	bool CommitTransaction(const FArcItemsStoreTransaction& InTransaction, FArcItemsStoreChanges* OutChanges = nullptr);
+
+	bool IsInTransaction() const
+	{
+		return TransactionDepth > 0;
+	}
+
 	const FArcItemData* GetItemByIdx(int32 Idx) const;
 
 	bool Contains(const UArcItemDefinition* InItemDefinition) const;
@@ -195,10 +231,12 @@ public:
 	
 	bool IsOnAnySlot(const FArcItemId& InItemId) const;
 
-	TArray<const FArcItemData*> GetItemsAttachedTo(const FArcItemId& InItemId) const;
+	/** Indexed, valid until the next attach or detach. Copy it before changing attachments. */
+	TConstArrayView<const FArcItemData*> GetItemsAttachedTo(const FArcItemId& InItemId) const;
 	const FArcItemData* GetItemAttachedTo(const FArcItemId& InOwnerItemId, const FGameplayTag& AttachSlot) const;
 
-	TArray<const FArcItemData*> GetAllItemsOnSlots() const;
+	/** Indexed, valid until the next slot change. Copy it before changing slots. */
+	TConstArrayView<const FArcItemData*> GetAllItemsOnSlots() const;
 	/*
 	 * Public. Need for some unit tests.
 	 */
@@ -213,6 +251,13 @@ public:
 	{
 		return ItemsArray.GetItemsPtr();
 	}
+
+	/** Visits items without copying them out. Func must not add or remove items. */
+	template<typename TFunc>
+	void ForEachItem(TFunc&& Func) const
+	{
+		ItemsArray.ForEachItem(Forward<TFunc>(Func));
+	}
 	
 	void MarkItemDirtyById(const FArcItemId& InItemId);
 
@@ -0,0 +1,176 @@
+/**
+ * This file is part of Velesarc
+ * Copyright (C) 2025-2025 Lukasz Baran
+ *
+ * Licensed under the European Union Public License (EUPL), Version 1.2 or –
+ * as soon as they will be approved by the European Commission – later versions
+ * of the EUPL (the "License");
+ *
+ * You may not use this work except in compliance with the License.
+ * You may get a copy of the License at:
+ *
+ * https://eupl.eu/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ */
+
+#pragma once
+
+#include "Items/ArcItemId.h"
+#include "Items/ArcItemSpec.h"
+#include "UObject/ObjectPtr.h"
+
+#include "ArcItemsStoreTransaction.generated.h"
+
+class UArcItemsStoreComponent;
+class UArcItemDefinition;
+
+UENUM()
+enum class EArcItemTransactionOp : uint8
+{
+	Add,
+	Remove,
+	Move
+};
+
+/** One change queued in FArcItemsStoreTransaction. */
+USTRUCT()
+struct ARCCORE_API FArcItemTransactionEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EArcItemTransactionOp Op = EArcItemTransactionOp::Add;
+
+	/** Add: the new item. */
+	UPROPERTY()
+	FArcItemSpec Spec;
+
+	/** Remove, Move: item in the committing store. */
+	UPROPERTY()
+	FArcItemId ItemId;
+
+	/** Remove: stacks to take. Negative removes the item with its attachments. */
+	UPROPERTY()
+	int32 Stacks = -1;
+
+	/** Move: receiving store. Attachments travel with their owner. */
+	UPROPERTY()
+	TObjectPtr<UArcItemsStoreComponent> TargetStore = nullptr;
+};
+
+/**
+ * Item changes applied to one store at once by UArcItemsStoreComponent::CommitTransaction.
+ *
+ *	FArcItemsStoreTransaction Transaction;
+ *	Transaction.AddItem(SpecA).AddItem(SpecB).MoveItem(ItemId, Chest);
+ *	ItemsStore->CommitTransaction(Transaction);
+ *
+ * Replicated commands carry it as-is, so keep it to UPROPERTY data.
+ */
+USTRUCT()
+struct ARCCORE_API FArcItemsStoreTransaction
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+	TArray<FArcItemTransactionEntry> Entries;
+
+public:
+	FArcItemsStoreTransaction& AddItem(const FArcItemSpec& InSpec)
+	{
+		FArcItemTransactionEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Op = EArcItemTransactionOp::Add;
+		Entry.Spec = InSpec;
+		return *this;
+	}
+
+	FArcItemsStoreTransaction& RemoveItem(const FArcItemId& InItemId, int32 InStacks = -1)
+	{
+		FArcItemTransactionEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Op = EArcItemTransactionOp::Remove;
+		Entry.ItemId = InItemId;
+		Entry.Stacks = InStacks;
+		return *this;
+	}
+
+	FArcItemsStoreTransaction& MoveItem(const FArcItemId& InItemId, UArcItemsStoreComponent* InTargetStore)
+	{
+		FArcItemTransactionEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Op = EArcItemTransactionOp::Move;
+		Entry.ItemId = InItemId;
+		Entry.TargetStore = InTargetStore;
+		return *this;
+	}
+
+	/** Ids of existing items the transaction removes or moves. */
+	void GetAffectedItems(TArray<FArcItemId>& OutItemIds) const
+	{
+		for (const FArcItemTransactionEntry& Entry : Entries)
+		{
+			if (Entry.Op != EArcItemTransactionOp::Add)
+			{
+				OutItemIds.AddUnique(Entry.ItemId);
+			}
+		}
+	}
+
+	const TArray<FArcItemTransactionEntry>& GetEntries() const
+	{
+		return Entries;
+	}
+
+	int32 Num() const
+	{
+		return Entries.Num();
+	}
+
+	bool IsEmpty() const
+	{
+		return Entries.IsEmpty();
+	}
+
+	void Reset()
+	{
+		Entries.Reset();
+	}
+};
+
+/** What a committed transaction did to one store. */
+struct FArcItemsStoreChanges
+{
+	TArray<FArcItemId> AddedItems;
+	TArray<FArcItemId> RemovedItems;
+
+	/** Items that stayed in the store and were marked dirty, e.g. stacked into or partially removed. */
+	TArray<FArcItemId> ChangedItems;
+
+	bool IsEmpty() const
+	{
+		return AddedItems.IsEmpty() && RemovedItems.IsEmpty() && ChangedItems.IsEmpty();
+	}
+};
+
+/** What the already validated entries of a transaction will do to one store, so later entries are checked against it. */
+struct FArcItemsStorePendingChanges
+{
+	/** Net number of items per definition the earlier entries add (positive) or take out (negative). */
+	TMap<const UArcItemDefinition*, int32> DefinitionDeltas;
+
+	int32 GetDefinitionDelta(const UArcItemDefinition* InItemDefinition) const
+	{
+		const int32* Delta = DefinitionDeltas.Find(InItemDefinition);
+		return Delta != nullptr ? *Delta : 0;
+	}
+
+	void AddDefinitionDelta(const UArcItemDefinition* InItemDefinition, int32 InDelta)
+	{
+		DefinitionDeltas.FindOrAdd(InItemDefinition) += InDelta;
+	}
+};
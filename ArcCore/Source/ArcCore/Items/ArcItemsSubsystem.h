@@ -33,6 +33,7 @@
 
 struct FArcItemData;
 struct FArcItemAttachment;
+struct FArcItemsStoreChanges;
 
 class AActor;
 class UArcItemsComponent;
@@ -89,6 +90,10 @@ DECLARE_MULTICAST_DELEGATE_ThreeParams(FArcItemStateDelegate
 	, const FArcItemId& /* ItemData */
 	, bool /* bIsLocked */);
 
+DECLARE_MULTICAST_DELEGATE_TwoParams(FArcItemsStoreChangesDelegate
+	, UArcItemsStoreComponent* /* ItemsComponent */
+	, const FArcItemsStoreChanges& /* Changes */);
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FArcGenericItemStoreDynamicDelegate
 	, UArcItemsStoreComponent*, ItemsComponent
 	, FArcItemId, ItemData);
@@ -126,6 +131,10 @@ public:
 	DEFINE_ARC_CHANNEL_DELEGATE_MAP(AActor*, Actor, FArcItemId, FArcGenericItemStoreDelegate, OnItemChangedStore);
 	DEFINE_ARC_CHANNEL_DELEGATE_MAP(AActor*, Actor, FArcItemId, FArcGenericItemStoreDelegate, OnItemRemovedFromStore);
 
+	/** Fired once per store by UArcItemsStoreComponent::CommitTransaction, in place of per-item store events. */
+	DEFINE_ARC_DELEGATE(FArcItemsStoreChangesDelegate, OnItemsStoreTransactionCommitted);
+	DEFINE_ARC_CHANNEL_DELEGATE(AActor*, Actor, FArcItemsStoreChangesDelegate, OnItemsStoreTransactionCommitted);
+
 	/**
 	 * Item Slots delegates.
 	 */
@@ -21,6 +21,8 @@
 
 #include "ArcItemFragment.h"
 #include "ScalableFloat.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/UObjectIterator.h"
 
 void FArcScalableFloatItemFragment::Initialize(const UScriptStruct* InStruct)
 {
@@ -44,3 +46,40 @@ void FArcScalableFloatItemFragment::Initialize(const UScriptStruct* InStruct)
 		}
 	}
 }
+
+namespace ArcItemFragmentTypeIds
+{
+	FRWLock Lock;
+	TMap<const UScriptStruct*, int32> Ids;
+}
+
+int32 FArcItemFragmentTypeIds::Get(const UScriptStruct* InStruct)
+{
+	if (InStruct == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	{
+		FReadScopeLock ReadLock(ArcItemFragmentTypeIds::Lock);
+		if (const int32* Id = ArcItemFragmentTypeIds::Ids.Find(InStruct))
+		{
+			return *Id;
+		}
+	}
+
+	FWriteScopeLock WriteLock(ArcItemFragmentTypeIds::Lock);
+	const int32 NextId = ArcItemFragmentTypeIds::Ids.Num();
+	return ArcItemFragmentTypeIds::Ids.FindOrAdd(InStruct, NextId);
+}
+
+void FArcItemFragmentTypeIds::RegisterLoadedTypes()
+{
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		if (It->IsChildOf(FArcItemFragment::StaticStruct()) || It->IsChildOf(FArcScalableFloatItemFragment::StaticStruct()))
+		{
+			Get(*It);
+		}
+	}
+}
@@ -286,4 +286,27 @@ public:
 	}
 #endif
 	void Initialize(const UScriptStruct* InStruct);
+};
+
+/**
+ * Dense, process-local ids for fragment struct types. UArcItemDefinition indexes its compiled
+ * fragment lookups with them, so they are never serialized or replicated.
+ *
+ * Every loaded FArcItemFragment / FArcScalableFloatItemFragment type is numbered once module
+ * loading completes; types loaded later get the next free id on first use.
+ */
+struct ARCCORE_API FArcItemFragmentTypeIds
+{
+	/** Thread-safe. */
+	static int32 Get(const UScriptStruct* InStruct);
+
+	template <typename T>
+	static int32 Get()
+	{
+		static const int32 Id = Get(T::StaticStruct());
+		return Id;
+	}
+
+	/** Assign ids to all currently loaded fragment types. */
+	static void RegisterLoadedTypes();
 };
\ No newline at end of file
@@ -900,7 +900,7 @@ bool UArcQuickBarComponent::InternalTryBindInput(const int32 BarIdx
 
 		if (Data)
 		{
-			TArray<const FArcItemData*> Extensions = SlotComp->GetItemsAttachedTo(Data->GetItemId());
+			TArray<const FArcItemData*> Extensions(SlotComp->GetItemsAttachedTo(Data->GetItemId()));
 			Extensions.Add(Data);
 			return Handling->OnAddedToQuickBar(InArcASC, Extensions);	
 		}
@@ -924,7 +924,7 @@ bool UArcQuickBarComponent::InternalTryUnbindInput(const int32 BarIdx
 		const FArcItemData* Data = FindQuickSlotItem(BarId, QuickSlotId);
 		if (Data)
 		{
-			TArray<const FArcItemData*> Extensions = SlotComp->GetItemsAttachedTo(Data->GetItemId());
+			TArray<const FArcItemData*> Extensions(SlotComp->GetItemsAttachedTo(Data->GetItemId()));
 			Extensions.Add(Data);
 			return Handling->OnRemovedFromQuickBar(InArcASC, Extensions);
 		}
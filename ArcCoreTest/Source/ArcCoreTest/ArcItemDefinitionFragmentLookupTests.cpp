@@ -0,0 +1,76 @@
+#include "CQTest.h"
+#include "Items/ArcItemDefinition.h"
+#include "Items/Fragments/ArcItemFragment_Stacks.h"
+#include "Items/Fragments/ArcItemFragment_Tags.h"
+#include "Targeting/ArcScalableFloatItemFragment_TargetingShape.h"
+
+namespace ArcItemFragmentLookupTestHelpers
+{
+	UArcItemDefinition* CreateTransientItemDef(const FName& Name)
+	{
+		UArcItemDefinition* Def = NewObject<UArcItemDefinition>(
+			GetTransientPackage(), Name, RF_Transient);
+		Def->RegenerateItemId();
+		return Def;
+	}
+}
+
+// ===================================================================
+// Compiled fragment lookups follow FragmentSet / ScalableFloatFragmentSet
+// ===================================================================
+
+TEST_CLASS(ArcItemDefinition_FragmentLookup, "ArcCore.Items.FragmentLookup")
+{
+	TEST_METHOD(TypeIds_AreStablePerType)
+	{
+		const int32 TagsId = FArcItemFragmentTypeIds::Get<FArcItemFragment_Tags>();
+		const int32 StacksId = FArcItemFragmentTypeIds::Get<FArcItemFragment_Stacks>();
+
+		ASSERT_THAT(AreEqual(TagsId, FArcItemFragmentTypeIds::Get(FArcItemFragment_Tags::StaticStruct())));
+		ASSERT_THAT(AreNotEqual(TagsId, StacksId, TEXT("Distinct types must get distinct ids")));
+		ASSERT_THAT(AreEqual(INDEX_NONE, FArcItemFragmentTypeIds::Get(nullptr)));
+	}
+
+	TEST_METHOD(AddAndRemove_UpdateFindFragment)
+	{
+		UArcItemDefinition* Def = ArcItemFragmentLookupTestHelpers::CreateTransientItemDef(TEXT("TestDef_FragmentLookup"));
+
+		ASSERT_THAT(IsNull(Def->FindFragment<FArcItemFragment_Tags>()));
+		ASSERT_THAT(IsFalse(Def->HasFragment<FArcItemFragment_Tags>()));
+
+		ASSERT_THAT(IsTrue(Def->AddFragmentByType(FArcItemFragment_Tags::StaticStruct())));
+		ASSERT_THAT(IsTrue(Def->AddFragmentByType(FArcItemFragment_Stacks::StaticStruct())));
+
+		ASSERT_THAT(IsNotNull(Def->FindFragment<FArcItemFragment_Tags>()));
+		ASSERT_THAT(IsNotNull(Def->FindFragment<FArcItemFragment_Stacks>()));
+		ASSERT_THAT(IsTrue(Def->GetFragment(FArcItemFragment_Tags::StaticStruct()) == reinterpret_cast<const uint8*>(Def->FindFragment<FArcItemFragment_Tags>())));
+
+		ASSERT_THAT(IsTrue(Def->RemoveFragmentByType(FArcItemFragment_Tags::StaticStruct())));
+		ASSERT_THAT(IsNull(Def->FindFragment<FArcItemFragment_Tags>(), TEXT("Removed fragment must not be found")));
+		ASSERT_THAT(IsNotNull(Def->FindFragment<FArcItemFragment_Stacks>(), TEXT("Other fragments must survive a removal")));
+	}
+
+	TEST_METHOD(ScalableFloatFragments_UseTheirOwnLookup)
+	{
+		UArcItemDefinition* Def = ArcItemFragmentLookupTestHelpers::CreateTransientItemDef(TEXT("TestDef_ScalableFloatLookup"));
+
+		ASSERT_THAT(IsTrue(Def->AddFragmentByType(FArcScalableFloatItemFragment_TargetingShape::StaticStruct())));
+
+		ASSERT_THAT(IsNotNull(Def->GetScalableFloatFragment<FArcScalableFloatItemFragment_TargetingShape>()));
+		ASSERT_THAT(IsNotNull(Def->GetScalableFloatFragment(FArcScalableFloatItemFragment_TargetingShape::StaticStruct())));
+		ASSERT_THAT(IsNull(Def->GetFragment(FArcScalableFloatItemFragment_TargetingShape::StaticStruct()), TEXT("Scalable float fragments are not in FragmentSet")));
+	}
+
+	TEST_METHOD(DuplicatedDefinition_FindsItsOwnFragments)
+	{
+		UArcItemDefinition* Def = ArcItemFragmentLookupTestHelpers::CreateTransientItemDef(TEXT("TestDef_FragmentLookupSource"));
+		Def->AddFragmentByType(FArcItemFragment_Tags::StaticStruct());
+
+		UArcItemDefinition* Copy = DuplicateObject(Def, GetTransientPackage(), TEXT("TestDef_FragmentLookupCopy"));
+		ASSERT_THAT(IsNotNull(Copy));
+
+		const FArcItemFragment_Tags* CopyTags = Copy->FindFragment<FArcItemFragment_Tags>();
+		ASSERT_THAT(IsNotNull(CopyTags));
+		ASSERT_THAT(IsTrue(CopyTags != Def->FindFragment<FArcItemFragment_Tags>(), TEXT("Copy must not point into the source's sets")));
+	}
+};
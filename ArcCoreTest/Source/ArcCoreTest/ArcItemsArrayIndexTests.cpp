@@ -0,0 +1,233 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcItemsTests.h"
+
+#include "CQTest.h"
+
+#include "Items/ArcItemSpec.h"
+#include "ArcItemTestsSettings.h"
+#include "NativeGameplayTags.h"
+#include "PIEIrisNetworkComponent.h"
+#include "Items/ArcItemsStoreComponent.h"
+#include "Items/ArcItemsArray.h"
+#include "Items/ArcItemData.h"
+#include "Components/ActorTestSpawner.h"
+#include "GameFramework/GameModeBase.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_IndexSlot_01, "SlotId.ArcCoreTest.Index.01");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_IndexSlot_02, "SlotId.ArcCoreTest.Index.02");
+
+namespace ArcItemsArrayIndexTests
+{
+	/** Compares every indexed query of Store against a scan over its items. */
+	bool IndexMatchesScan(const UArcItemsStoreComponent* Store)
+	{
+		const FArcItemsArray& ItemsArray = Store->GetItemsArray();
+		const TArray<const FArcItemData*> Items = Store->GetItems();
+
+		int32 NumOnSlots = 0;
+		for (const FArcItemData* Item : Items)
+		{
+			if (Item->GetSlotId().IsValid())
+			{
+				NumOnSlots++;
+				if (ItemsArray.GetItemFromSlot(Item->GetSlotId()) != Item
+					|| ItemsArray.GetAllItemsOnSlots().Contains(Item) == false)
+				{
+					return false;
+				}
+			}
+
+			int32 NumAttached = 0;
+			for (const FArcItemData* Other : Items)
+			{
+				if (Other->GetOwnerId().IsValid() && Other->GetOwnerId() == Item->GetItemId())
+				{
+					NumAttached++;
+					if (ItemsArray.GetItemsAttachedTo(Item->GetItemId()).Contains(Other) == false)
+					{
+						return false;
+					}
+				}
+			}
+
+			if (ItemsArray.GetItemsAttachedTo(Item->GetItemId()).Num() != NumAttached)
+			{
+				return false;
+			}
+		}
+
+		return ItemsArray.GetAllItemsOnSlots().Num() == NumOnSlots;
+	}
+}
+
+TEST_CLASS(ArcItemsArrayIndex, "ArcCore.Integration")
+{
+	FActorTestSpawner Spawner;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+	}
+
+	FArcItemId AddSimpleItem(UArcItemsStoreComponent* Store)
+	{
+		const UArcItemTestsSettings* Settings = GetDefault<UArcItemTestsSettings>();
+		FArcItemSpec Spec;
+		Spec.SetItemDefinition(Settings->SimpleBaseItem).SetAmount(1).SetItemLevel(1);
+		return Store->AddItem(Spec, FArcItemId::InvalidId);
+	}
+
+	TEST_METHOD(SlotIndex_FollowsAddChangeAndRemove)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = *FGuid::NewGuid().ToString();
+		AArcItemsTestActor& Actor = Spawner.SpawnActor<AArcItemsTestActor>(SpawnParameters);
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemId IdA = AddSimpleItem(Store);
+		const FArcItemId IdB = AddSimpleItem(Store);
+		ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 0));
+
+		Store->AddItemToSlot(IdA, TAG_IndexSlot_01);
+		ASSERT_THAT(IsTrue(Store->GetItemFromSlot(TAG_IndexSlot_01) == Store->GetItemPtr(IdA)));
+		ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+
+		Store->ChangeItemSlot(IdA, TAG_IndexSlot_02);
+		ASSERT_THAT(IsNull(Store->GetItemFromSlot(TAG_IndexSlot_01)));
+		ASSERT_THAT(IsTrue(Store->GetItemFromSlot(TAG_IndexSlot_02) == Store->GetItemPtr(IdA)));
+
+		Store->AddItemToSlot(IdB, TAG_IndexSlot_01);
+		ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 2));
+		ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+
+		Store->RemoveItemFromSlot(IdA);
+		ASSERT_THAT(IsNull(Store->GetItemFromSlot(TAG_IndexSlot_02)));
+		ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 1));
+		ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+	}
+
+	TEST_METHOD(AttachmentIndex_FollowsAttachAndDetach)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = *FGuid::NewGuid().ToString();
+		AArcItemsTestActor& Actor = Spawner.SpawnActor<AArcItemsTestActor>(SpawnParameters);
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemId OwnerId = AddSimpleItem(Store);
+		const FArcItemId AttachedIdA = AddSimpleItem(Store);
+		const FArcItemId AttachedIdB = AddSimpleItem(Store);
+
+		Store->InternalAttachToItem(OwnerId, AttachedIdA, FGameplayTag::EmptyTag);
+		Store->InternalAttachToItem(OwnerId, AttachedIdB, FGameplayTag::EmptyTag);
+		ASSERT_THAT(AreEqual(Store->GetItemsAttachedTo(OwnerId).Num(), 2));
+		ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+
+		Store->DetachItemFrom(AttachedIdA);
+		ASSERT_THAT(AreEqual(Store->GetItemsAttachedTo(OwnerId).Num(), 1));
+		ASSERT_THAT(IsTrue(Store->GetItemsAttachedTo(OwnerId)[0] == Store->GetItemPtr(AttachedIdB)));
+		ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+	}
+
+	TEST_METHOD(DestroyItem_DropsIndexEntries)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = *FGuid::NewGuid().ToString();
+		AArcItemsTestActor& Actor = Spawner.SpawnActor<AArcItemsTestActor>(SpawnParameters);
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemId OwnerId = AddSimpleItem(Store);
+		const FArcItemId AttachedId = AddSimpleItem(Store);
+		Store->AddItemToSlot(OwnerId, TAG_IndexSlot_01);
+		Store->InternalAttachToItem(OwnerId, AttachedId, FGameplayTag::EmptyTag);
+
+		Store->DestroyItem(OwnerId);
+
+		ASSERT_THAT(AreEqual(Store->GetItemNum(), 0));
+		ASSERT_THAT(IsNull(Store->GetItemFromSlot(TAG_IndexSlot_01)));
+		ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 0));
+		ASSERT_THAT(AreEqual(Store->GetItemsAttachedTo(OwnerId).Num(), 0));
+	}
+};
+
+NETWORK_TEST_CLASS(ArcItemsArrayIndexNetwork, "ArcCore.Network")
+{
+	struct DerivedState : public FBasePIEIrisNetworkComponentState
+	{
+		AArcItemsTestActor* ReplicatedActor = nullptr;
+	};
+
+	FArcItemId OwnerId;
+	FArcItemId AttachedId;
+	FArcItemId SlottedId;
+	FPIEIrisNetworkComponent<DerivedState> Network{ TestRunner, TestCommandBuilder, bInitializing };
+
+	BEFORE_EACH()
+	{
+		FAutomationTestBase::bSuppressLogWarnings = true;
+
+		FIrisNetworkComponentBuilder<DerivedState>()
+			.WithClients(1)
+			.AsDedicatedServer()
+			.WithGameInstanceClass(UGameInstance::StaticClass())
+			.WithGameMode(AGameModeBase::StaticClass())
+			.Build(Network);
+	}
+
+	TEST_METHOD(Index_MatchesScan_AfterReplicatedAddChangeAndRemove)
+	{
+		Network.SpawnAndReplicate<AArcItemsTestActor, &DerivedState::ReplicatedActor>(true)
+		.ThenServer([&](DerivedState& ServerState) {
+			UArcItemsStoreComponent* Store = ServerState.ReplicatedActor->ItemsStore;
+			const UArcItemTestsSettings* Settings = GetDefault<UArcItemTestsSettings>();
+
+			FArcItemSpec Spec;
+			Spec.SetItemDefinition(Settings->SimpleBaseItem).SetAmount(1).SetItemLevel(1);
+			OwnerId = Store->AddItem(Spec, FArcItemId::InvalidId);
+			AttachedId = Store->AddItem(Spec, FArcItemId::InvalidId);
+			SlottedId = Store->AddItem(Spec, FArcItemId::InvalidId);
+
+			Store->AddItemToSlot(OwnerId, TAG_IndexSlot_01);
+			Store->AddItemToSlot(SlottedId, TAG_IndexSlot_02);
+			Store->InternalAttachToItem(OwnerId, AttachedId, FGameplayTag::EmptyTag);
+		})
+		.UntilClients([&](DerivedState& ClientState) -> bool {
+			const UArcItemsStoreComponent* Store = ClientState.ReplicatedActor->ItemsStore;
+			return Store->GetItemNum() == 3 && Store->GetItemsAttachedTo(OwnerId).Num() == 1;
+		})
+		.ThenClients([&](DerivedState& ClientState) {
+			UArcItemsStoreComponent* Store = ClientState.ReplicatedActor->ItemsStore;
+			ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+			ASSERT_THAT(IsTrue(Store->GetItemFromSlot(TAG_IndexSlot_01) == Store->GetItemPtr(OwnerId)));
+			ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 2));
+		})
+		.ThenServer([&](DerivedState& ServerState) {
+			UArcItemsStoreComponent* Store = ServerState.ReplicatedActor->ItemsStore;
+			Store->RemoveItemFromSlot(SlottedId);
+			Store->ChangeItemSlot(OwnerId, TAG_IndexSlot_02);
+			Store->DetachItemFrom(AttachedId);
+		})
+		.UntilClients([&](DerivedState& ClientState) -> bool {
+			const UArcItemsStoreComponent* Store = ClientState.ReplicatedActor->ItemsStore;
+			return Store->GetItemsAttachedTo(OwnerId).Num() == 0 && Store->GetAllItemsOnSlots().Num() == 1;
+		})
+		.ThenClients([&](DerivedState& ClientState) {
+			UArcItemsStoreComponent* Store = ClientState.ReplicatedActor->ItemsStore;
+			ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+			ASSERT_THAT(IsNull(Store->GetItemFromSlot(TAG_IndexSlot_01)));
+			ASSERT_THAT(IsTrue(Store->GetItemFromSlot(TAG_IndexSlot_02) == Store->GetItemPtr(OwnerId)));
+		})
+		.ThenServer([&](DerivedState& ServerState) {
+			ServerState.ReplicatedActor->ItemsStore->DestroyItem(OwnerId);
+		})
+		.UntilClients([&](DerivedState& ClientState) -> bool {
+			return ClientState.ReplicatedActor->ItemsStore->GetItemNum() == 2;
+		})
+		.ThenClients([&](DerivedState& ClientState) {
+			UArcItemsStoreComponent* Store = ClientState.ReplicatedActor->ItemsStore;
+			ASSERT_THAT(IsTrue(ArcItemsArrayIndexTests::IndexMatchesScan(Store)));
+			ASSERT_THAT(AreEqual(Store->GetAllItemsOnSlots().Num(), 0));
+		});
+	}
+};
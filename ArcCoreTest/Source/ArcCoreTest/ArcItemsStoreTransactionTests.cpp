@@ -0,0 +1,191 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcItemsTests.h"
+
+#include "CQTest.h"
+
+#include "Items/ArcItemSpec.h"
+#include "Items/ArcItemDefinition.h"
+#include "Items/ArcItemStackMethod.h"
+#include "ArcItemTestsSettings.h"
+#include "Items/ArcItemsStoreComponent.h"
+#include "Items/ArcItemsStoreTransaction.h"
+#include "Items/ArcItemsSubsystem.h"
+#include "Items/ArcItemData.h"
+#include "Components/ActorTestSpawner.h"
+
+TEST_CLASS(ArcItemsStoreTransaction, "ArcCore.Integration")
+{
+	FActorTestSpawner Spawner;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+	}
+
+	FArcItemSpec MakeSimpleSpec() const
+	{
+		const UArcItemTestsSettings* Settings = GetDefault<UArcItemTestsSettings>();
+		FArcItemSpec Spec;
+		Spec.SetItemDefinition(Settings->SimpleBaseItem).SetAmount(1).SetItemLevel(1);
+		return Spec;
+	}
+
+	FArcItemSpec MakeUniqueSpec(const FName& Name) const
+	{
+		UArcItemDefinition* Def = NewObject<UArcItemDefinition>(GetTransientPackage(), Name, RF_Transient);
+		Def->RegenerateItemId();
+
+		FProperty* StackProp = Def->GetClass()->FindPropertyByName(TEXT("StackMethod"));
+		check(StackProp);
+		StackProp->ContainerPtrToValuePtr<FInstancedStruct>(Def)->InitializeAs<FArcItemStackMethod_CanNotStackUnique>();
+
+		FArcItemSpec Spec;
+		Spec.SetItemDefinition(Def->GetPrimaryAssetId()).SetItemDefinitionAsset(Def).SetAmount(1).SetItemLevel(1);
+		return Spec;
+	}
+
+	AArcItemsTestActor& SpawnActor()
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = *FGuid::NewGuid().ToString();
+		return Spawner.SpawnActor<AArcItemsTestActor>(SpawnParameters);
+	}
+
+	TEST_METHOD(Commit_AddsRemovesAndMovesItems)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+		UArcItemsStoreComponent* Chest = Actor.ItemsStore;
+
+		const FArcItemId RemovedId = Store->AddItem(MakeSimpleSpec(), FArcItemId::InvalidId);
+		const FArcItemId MovedId = Store->AddItem(MakeSimpleSpec(), FArcItemId::InvalidId);
+
+		FArcItemsStoreTransaction Transaction;
+		for (int32 Idx = 0; Idx < 8; Idx++)
+		{
+			Transaction.AddItem(MakeSimpleSpec());
+		}
+		Transaction.RemoveItem(RemovedId).MoveItem(MovedId, Chest);
+
+		FArcItemsStoreChanges Changes;
+		ASSERT_THAT(IsTrue(Store->CommitTransaction(Transaction, &Changes)));
+
+		ASSERT_THAT(AreEqual(Store->GetItemNum(), 8));
+		ASSERT_THAT(IsNull(Store->GetItemPtr(RemovedId)));
+		ASSERT_THAT(IsNull(Store->GetItemPtr(MovedId)));
+		ASSERT_THAT(IsNotNull(Chest->GetItemPtr(MovedId)));
+		ASSERT_THAT(IsFalse(Store->IsInTransaction()));
+
+		ASSERT_THAT(AreEqual(Changes.AddedItems.Num(), 8));
+		ASSERT_THAT(AreEqual(Changes.RemovedItems.Num(), 2));
+		ASSERT_THAT(IsTrue(Changes.RemovedItems.Contains(MovedId)));
+	}
+
+	TEST_METHOD(Commit_InvalidEntryChangesNothing)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemId ExistingId = Store->AddItem(MakeSimpleSpec(), FArcItemId::InvalidId);
+
+		FArcItemsStoreTransaction Transaction;
+		Transaction.AddItem(MakeSimpleSpec())
+			.RemoveItem(ExistingId)
+			.RemoveItem(ExistingId);
+
+		ASSERT_THAT(IsFalse(Store->CanCommitTransaction(Transaction)));
+		ASSERT_THAT(IsFalse(Store->CommitTransaction(Transaction)));
+		ASSERT_THAT(AreEqual(Store->GetItemNum(), 1));
+		ASSERT_THAT(IsNotNull(Store->GetItemPtr(ExistingId)));
+	}
+
+	TEST_METHOD(Commit_TwoUniqueAddsRejected)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemSpec UniqueSpec = MakeUniqueSpec(TEXT("TransactionTest_UniqueTwice"));
+
+		FArcItemsStoreTransaction Transaction;
+		Transaction.AddItem(UniqueSpec).AddItem(UniqueSpec);
+
+		ASSERT_THAT(IsFalse(Store->CanCommitTransaction(Transaction)));
+		ASSERT_THAT(IsFalse(Store->CommitTransaction(Transaction)));
+		ASSERT_THAT(AreEqual(Store->GetItemNum(), 0));
+	}
+
+	TEST_METHOD(Commit_UniqueAddAfterRemovingExistingCopy)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		const FArcItemSpec UniqueSpec = MakeUniqueSpec(TEXT("TransactionTest_UniqueReplace"));
+		const FArcItemId ExistingId = Store->AddItem(UniqueSpec, FArcItemId::InvalidId);
+		ASSERT_THAT(IsTrue(ExistingId.IsValid()));
+
+		FArcItemsStoreTransaction Transaction;
+		Transaction.RemoveItem(ExistingId).AddItem(UniqueSpec);
+
+		ASSERT_THAT(IsTrue(Store->CommitTransaction(Transaction)));
+		ASSERT_THAT(AreEqual(Store->GetItemNum(), 1));
+		ASSERT_THAT(IsNull(Store->GetItemPtr(ExistingId)));
+	}
+
+	TEST_METHOD(Commit_MoveChecksTargetStore)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+		UArcItemsStoreComponent* Chest = Actor.ItemsStore;
+
+		const FArcItemSpec UniqueSpec = MakeUniqueSpec(TEXT("TransactionTest_UniqueMove"));
+		const FArcItemId MovedId = Store->AddItem(UniqueSpec, FArcItemId::InvalidId);
+		Chest->AddItem(UniqueSpec, FArcItemId::InvalidId);
+
+		FArcItemsStoreTransaction Transaction;
+		Transaction.MoveItem(MovedId, Chest);
+
+		ASSERT_THAT(IsFalse(Store->CommitTransaction(Transaction)));
+		ASSERT_THAT(IsNotNull(Store->GetItemPtr(MovedId)));
+		ASSERT_THAT(AreEqual(Chest->GetItemNum(), 1));
+	}
+
+	TEST_METHOD(Commit_BroadcastsOnceInsteadOfPerItem)
+	{
+		AArcItemsTestActor& Actor = SpawnActor();
+		UArcItemsStoreComponent* Store = Actor.ItemsStoreNotReplicated;
+
+		UArcItemsSubsystem* ItemsSubsystem = UArcItemsSubsystem::Get(Store);
+		ASSERT_THAT(IsNotNull(ItemsSubsystem));
+
+		int32 NumAddedEvents = 0;
+		int32 NumCommitEvents = 0;
+		int32 NumCommittedItems = 0;
+		const FDelegateHandle AddedHandle = ItemsSubsystem->AddActorOnItemAddedToStore(&Actor
+			, FArcGenericItemStoreDelegate::FDelegate::CreateLambda([&NumAddedEvents](UArcItemsStoreComponent*, const FArcItemData*)
+			{
+				NumAddedEvents++;
+			}));
+		const FDelegateHandle CommitHandle = ItemsSubsystem->AddActorOnItemsStoreTransactionCommitted(&Actor
+			, FArcItemsStoreChangesDelegate::FDelegate::CreateLambda([&NumCommitEvents, &NumCommittedItems](UArcItemsStoreComponent*, const FArcItemsStoreChanges& Changes)
+			{
+				NumCommitEvents++;
+				NumCommittedItems += Changes.AddedItems.Num();
+			}));
+
+		FArcItemsStoreTransaction Transaction;
+		for (int32 Idx = 0; Idx < 16; Idx++)
+		{
+			Transaction.AddItem(MakeSimpleSpec());
+		}
+		ASSERT_THAT(IsTrue(Store->CommitTransaction(Transaction)));
+
+		ItemsSubsystem->RemoveActorOnItemAddedToStore(&Actor, AddedHandle);
+		ItemsSubsystem->RemoveActorOnItemsStoreTransactionCommitted(&Actor, CommitHandle);
+
+		ASSERT_THAT(AreEqual(NumAddedEvents, 0));
+		ASSERT_THAT(AreEqual(NumCommitEvents, 1));
+		ASSERT_THAT(AreEqual(NumCommittedItems, 16));
+	}
+};
@@ -1324,10 +1324,10 @@ NETWORK_TEST_CLASS(ArcCoreNetworkTests, "ArcCore.Network")
 		
 			FArcItemSpec Spec;
 			Spec.SetItemDefinition(Settings->ItemWithGrantedAbility).SetAmount(1).SetItemLevel(1);
-			TArray<const FArcItemData*> Items = ServerState.ReplicatedActor->ItemsStore->GetAllItemsOnSlots();
+			TConstArrayView<const FArcItemData*> Items = ServerState.ReplicatedActor->ItemsStore->GetAllItemsOnSlots();
 			ServerState.ReplicatedActor->ItemsStore->RemoveItemFromSlot(Items[0]->GetItemId());
 		}).UntilClients([&](DerivedState& ClientState) -> bool {
-				TArray<const FArcItemData*> Items = ClientState.ReplicatedActor->ItemsStore->GetAllItemsOnSlots();
+				TConstArrayView<const FArcItemData*> Items = ClientState.ReplicatedActor->ItemsStore->GetAllItemsOnSlots();
 				if (Items.Num() == 0)
 				{
 					return true;
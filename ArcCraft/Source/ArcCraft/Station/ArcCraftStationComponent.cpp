@@ -24,7 +24,7 @@
 #include "MassEntityManager.h"
 #include "MassEntitySubsystem.h"
 #include "ArcCraft/Mass/ArcCraftMassFragments.h"
-#include "ArcCraft/Station/ArcRecipeLookup.h"
+#include "ArcCraft/Station/ArcRecipeIndexSubsystem.h"
 #include "Items/ArcItemDefinition.h"
 #include "Items/ArcItemSpec.h"
 #include "Items/Fragments/ArcItemFragment_Tags.h"
@@ -187,40 +187,19 @@ UArcRecipeDefinition* UArcCraftStationComponent::DiscoverAndQueueRecipe(UObject*
 		return nullptr;
 	}
 
-	// Build union of all available item tags (for coarse filtering)
-	FGameplayTagContainer AvailableItemTags;
-	for (const FArcItemSpec& Item : AvailableItems)
-	{
-		if (Item.GetItemDefinitionId().IsValid())
-		{
-			const UArcItemDefinition* Def = Item.GetItemDefinition();
-			if (Def)
-			{
-				const FArcItemFragment_Tags* TagsFragment = Def->FindFragment<FArcItemFragment_Tags>();
-				if (TagsFragment)
-				{
-					AvailableItemTags.AppendTags(TagsFragment->ItemTags);
-				}
-			}
-		}
-	}
-
 	// Get cached station recipes
 	EnsureRecipesCached();
 
-	// Coarse filter by ingredient tags
-	TArray<FAssetData> Candidates = FArcRecipeLookup::FilterByAvailableIngredients(
-		CachedStationRecipes, AvailableItemTags);
-
-	if (Candidates.Num() == 0)
+	UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get();
+	if (!RecipeIndex || CachedStationRecipeIds.Num() == 0)
 	{
 		return nullptr;
 	}
 
-	// Find best match (loads candidate assets)
+	// Ingredient bitset filter, then exact scoring (loads only surviving candidates)
 	float MatchScore = 0.0f;
-	UArcRecipeDefinition* BestRecipe = FArcRecipeLookup::FindBestRecipeForIngredients(
-		Candidates, AvailableItems, StationTags, MatchScore);
+	UArcRecipeDefinition* BestRecipe = RecipeIndex->FindBestRecipeForIngredients(
+		CachedStationRecipeIds, AvailableItems, StationTags, MatchScore);
 
 	if (!BestRecipe)
 	{
@@ -405,9 +384,15 @@ TArray<UArcRecipeDefinition*> UArcCraftStationComponent::GetAvailableRecipes()
 	EnsureRecipesCached();
 
 	TArray<UArcRecipeDefinition*> Recipes;
-	for (const FAssetData& Data : CachedStationRecipes)
+	UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get();
+	if (!RecipeIndex)
 	{
-		UArcRecipeDefinition* Recipe = Cast<UArcRecipeDefinition>(Data.GetAsset());
+		return Recipes;
+	}
+
+	for (const int32 RecipeId : CachedStationRecipeIds)
+	{
+		UArcRecipeDefinition* Recipe = RecipeIndex->LoadRecipe(RecipeId);
 		if (Recipe)
 		{
 			Recipes.Add(Recipe);
@@ -490,17 +475,25 @@ void UArcCraftStationComponent::TickComponent(
 
 void UArcCraftStationComponent::EnsureRecipesCached()
 {
-	if (bRecipesCached)
+	UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get();
+	if (!RecipeIndex)
+	{
+		return;
+	}
+
+	// The index grows as assets are discovered; re-resolve when it changed since the last query.
+	if (bRecipesCached && CachedRecipeIndexVersion == RecipeIndex->GetVersion())
 	{
 		return;
 	}
 
-	CachedStationRecipes = FArcRecipeLookup::FindRecipesForStation(StationTags);
+	RecipeIndex->GetRecipesForStation(StationTags, CachedStationRecipeIds);
+	CachedRecipeIndexVersion = RecipeIndex->GetVersion();
 	bRecipesCached = true;
 
-	UE_LOG(LogArcCraftStation, Log,
+	UE_LOG(LogArcCraftStation, Verbose,
 		TEXT("Cached %d recipes for station %s"),
-		CachedStationRecipes.Num(),
+		CachedStationRecipeIds.Num(),
 		*GetOwner()->GetName());
 }
 
@@ -102,8 +102,9 @@ protected:
 
 	// ---- Recipe Cache ----
 
-	/** Cached asset data for recipes matching this station's tags. */
-	TArray<FAssetData> CachedStationRecipes;
+	/** Recipe index ids matching this station's tags. Refreshed when the index version changes. */
+	TArray<int32> CachedStationRecipeIds;
+	uint32 CachedRecipeIndexVersion = 0;
 	bool bRecipesCached = false;
 
 	// ---- Delegates ----
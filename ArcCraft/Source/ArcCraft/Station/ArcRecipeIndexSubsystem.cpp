@@ -0,0 +1,445 @@
+/**
+ * This file is part of Velesarc
+ * Copyright (C) 2025-2025 Lukasz Baran
+ *
+ * Licensed under the European Union Public License (EUPL), Version 1.2 or -
+ * as soon as they will be approved by the European Commission - later versions
+ * of the EUPL (the "License");
+ *
+ * You may not use this work except in compliance with the License.
+ * You may get a copy of the License at:
+ *
+ * https://eupl.eu/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ */
+
+#include "ArcCraft/Station/ArcRecipeIndexSubsystem.h"
+
+#include "ArcCraft/Recipe/ArcRecipeDefinition.h"
+#include "ArcCraft/Station/ArcRecipeLookup.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Engine.h"
+#include "Items/ArcItemDefinition.h"
+#include "Items/ArcItemSpec.h"
+#include "Items/Fragments/ArcItemFragment_Tags.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogArcRecipeIndex, Log, All);
+
+namespace Arc::RecipeIndex
+{
+	static TArray<FPrimaryAssetId> ParseItemIds(const FAssetData& AssetData)
+	{
+		TArray<FPrimaryAssetId> ItemIds;
+
+		FString ItemIdsString;
+		if (!AssetData.GetTagValue(UArcRecipeDefinition::IngredientItemDefsName, ItemIdsString) || ItemIdsString.IsEmpty())
+		{
+			return ItemIds;
+		}
+
+		TArray<FString> Parts;
+		ItemIdsString.ParseIntoArray(Parts, TEXT(","), true);
+		for (const FString& Part : Parts)
+		{
+			const FPrimaryAssetId ItemId = FPrimaryAssetId::FromString(Part);
+			if (ItemId.IsValid())
+			{
+				ItemIds.AddUnique(ItemId);
+			}
+		}
+		return ItemIds;
+	}
+
+	/** True when every bit of Required is also set in Available. Available must be at least as long. */
+	static bool ContainsAllBits(const TBitArray<>& Available, const TBitArray<>& Required)
+	{
+		const uint32* RESTRICT AvailableWords = Available.GetData();
+		const uint32* RESTRICT RequiredWords = Required.GetData();
+		const int32 NumWords = FMath::DivideAndRoundUp(Required.Num(), static_cast<int32>(NumBitsPerDWORD));
+		for (int32 WordIdx = 0; WordIdx < NumWords; ++WordIdx)
+		{
+			if (RequiredWords[WordIdx] & ~AvailableWords[WordIdx])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// -------------------------------------------------------------------
+// Lifetime
+// -------------------------------------------------------------------
+
+UArcRecipeIndexSubsystem* UArcRecipeIndexSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UArcRecipeIndexSubsystem>() : nullptr;
+}
+
+void UArcRecipeIndexSubsystem::Deinitialize()
+{
+	if (bBuilt)
+	{
+		if (IAssetRegistry* AR = IAssetRegistry::Get())
+		{
+			AR->OnAssetAdded().RemoveAll(this);
+			AR->OnAssetRemoved().RemoveAll(this);
+			AR->OnAssetUpdated().RemoveAll(this);
+			AR->OnAssetRenamed().RemoveAll(this);
+		}
+	}
+
+	Entries.Empty();
+	LoadedRecipes.Empty();
+	bBuilt = false;
+
+	Super::Deinitialize();
+}
+
+// -------------------------------------------------------------------
+// Index build
+// -------------------------------------------------------------------
+
+void UArcRecipeIndexSubsystem::EnsureBuilt()
+{
+	if (bBuilt)
+	{
+		return;
+	}
+
+	BuildIndex();
+
+	// Built lazily on first query: the asset registry is guaranteed to exist by then.
+	// Assets discovered afterwards (async scan, editor imports, DLC mounts) arrive through these.
+	if (IAssetRegistry* AR = IAssetRegistry::Get())
+	{
+		AR->OnAssetAdded().AddUObject(this, &UArcRecipeIndexSubsystem::HandleAssetAdded);
+		AR->OnAssetRemoved().AddUObject(this, &UArcRecipeIndexSubsystem::HandleAssetRemoved);
+		AR->OnAssetUpdated().AddUObject(this, &UArcRecipeIndexSubsystem::HandleAssetUpdated);
+		AR->OnAssetRenamed().AddUObject(this, &UArcRecipeIndexSubsystem::HandleAssetRenamed);
+	}
+	bBuilt = true;
+}
+
+void UArcRecipeIndexSubsystem::BuildIndex()
+{
+	IAssetRegistry* AR = IAssetRegistry::Get();
+	if (!AR)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcRecipeIndex_Build);
+
+	FARFilter AssetFilter;
+	AssetFilter.ClassPaths.Add(UArcRecipeDefinition::StaticClass()->GetClassPathName());
+
+	RecipeClassPaths.Reset();
+	AR->GetDerivedClassNames(AssetFilter.ClassPaths, TSet<FTopLevelAssetPath>(), RecipeClassPaths);
+	RecipeClassPaths.Add(UArcRecipeDefinition::StaticClass()->GetClassPathName());
+	AssetFilter.ClassPaths = RecipeClassPaths.Array();
+	AssetFilter.bRecursiveClasses = true;
+
+	TArray<FAssetData> AllRecipes;
+	AR->GetAssets(AssetFilter, AllRecipes);
+
+	for (const FAssetData& AssetData : AllRecipes)
+	{
+		AddRecipe(AssetData);
+	}
+
+	UE_LOG(LogArcRecipeIndex, Log, TEXT("Recipe index built: %d recipes, %d ingredient keys."),
+		IdByPath.Num(), RecipesByKey.Num());
+}
+
+bool UArcRecipeIndexSubsystem::IsRecipeAsset(const FAssetData& AssetData) const
+{
+	return RecipeClassPaths.Contains(AssetData.AssetClassPath);
+}
+
+int32 UArcRecipeIndexSubsystem::FindOrAddKey(const FGameplayTag& Tag)
+{
+	if (const int32* Existing = KeyByTag.Find(Tag))
+	{
+		return *Existing;
+	}
+	const int32 Key = RecipesByKey.AddDefaulted();
+	KeyByTag.Add(Tag, Key);
+	return Key;
+}
+
+int32 UArcRecipeIndexSubsystem::FindOrAddKey(const FPrimaryAssetId& ItemId)
+{
+	if (const int32* Existing = KeyByItem.Find(ItemId))
+	{
+		return *Existing;
+	}
+	const int32 Key = RecipesByKey.AddDefaulted();
+	KeyByItem.Add(ItemId, Key);
+	return Key;
+}
+
+void UArcRecipeIndexSubsystem::AddRecipe(const FAssetData& AssetData)
+{
+	const FSoftObjectPath RecipePath = AssetData.GetSoftObjectPath();
+	if (IdByPath.Contains(RecipePath))
+	{
+		RemoveRecipe(RecipePath);
+	}
+
+	const int32 RecipeId = FreeRecipeIds.Num() > 0 ? FreeRecipeIds.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	LoadedRecipes.SetNum(Entries.Num());
+	LoadedRecipes[RecipeId] = nullptr;
+
+	FArcRecipeIndexEntry& Entry = Entries[RecipeId];
+	Entry = FArcRecipeIndexEntry();
+	Entry.AssetData = AssetData;
+	Entry.RequiredStationTags = UArcRecipeDefinition::GetRequiredStationTagsFromAssetData(AssetData);
+	Entry.IngredientTags = UArcRecipeDefinition::GetIngredientTagsFromAssetData(AssetData);
+	Entry.IngredientItemIds = Arc::RecipeIndex::ParseItemIds(AssetData);
+	Entry.IngredientCount = UArcRecipeDefinition::GetIngredientCountFromAssetData(AssetData);
+	Entry.bValid = true;
+
+	IdByPath.Add(RecipePath, RecipeId);
+
+	if (Entry.RequiredStationTags.IsEmpty())
+	{
+		StationlessRecipes.Add(RecipeId);
+	}
+	for (const FGameplayTag& StationTag : Entry.RequiredStationTags)
+	{
+		RecipesByStationTag.FindOrAdd(StationTag).Add(RecipeId);
+	}
+
+	TArray<int32, TInlineAllocator<8>> Keys;
+	for (const FGameplayTag& IngredientTag : Entry.IngredientTags)
+	{
+		Keys.Add(FindOrAddKey(IngredientTag));
+	}
+	for (const FPrimaryAssetId& ItemId : Entry.IngredientItemIds)
+	{
+		Keys.Add(FindOrAddKey(ItemId));
+	}
+
+	Entry.RequiredKeys.Init(false, RecipesByKey.Num());
+	for (const int32 Key : Keys)
+	{
+		Entry.RequiredKeys[Key] = true;
+		RecipesByKey[Key].Add(RecipeId);
+	}
+
+	++Version;
+}
+
+void UArcRecipeIndexSubsystem::RemoveRecipe(const FSoftObjectPath& RecipePath)
+{
+	int32 RecipeId = INDEX_NONE;
+	if (!IdByPath.RemoveAndCopyValue(RecipePath, RecipeId))
+	{
+		return;
+	}
+
+	FArcRecipeIndexEntry& Entry = Entries[RecipeId];
+
+	StationlessRecipes.RemoveSwap(RecipeId);
+	for (const FGameplayTag& StationTag : Entry.RequiredStationTags)
+	{
+		if (TArray<int32>* Recipes = RecipesByStationTag.Find(StationTag))
+		{
+			Recipes->RemoveSwap(RecipeId);
+		}
+	}
+	for (TConstSetBitIterator<> It(Entry.RequiredKeys); It; ++It)
+	{
+		RecipesByKey[It.GetIndex()].RemoveSwap(RecipeId);
+	}
+
+	Entry = FArcRecipeIndexEntry();
+	LoadedRecipes[RecipeId] = nullptr;
+	FreeRecipeIds.Add(RecipeId);
+	++Version;
+}
+
+// -------------------------------------------------------------------
+// Asset registry events
+// -------------------------------------------------------------------
+
+void UArcRecipeIndexSubsystem::HandleAssetAdded(const FAssetData& AssetData)
+{
+	if (IsRecipeAsset(AssetData))
+	{
+		AddRecipe(AssetData);
+	}
+}
+
+void UArcRecipeIndexSubsystem::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	if (IsRecipeAsset(AssetData))
+	{
+		RemoveRecipe(AssetData.GetSoftObjectPath());
+	}
+}
+
+void UArcRecipeIndexSubsystem::HandleAssetUpdated(const FAssetData& AssetData)
+{
+	// Saving a recipe refreshes its registry tags; AddRecipe replaces the stale entry.
+	if (IsRecipeAsset(AssetData))
+	{
+		AddRecipe(AssetData);
+	}
+}
+
+void UArcRecipeIndexSubsystem::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (IsRecipeAsset(AssetData))
+	{
+		RemoveRecipe(FSoftObjectPath(OldObjectPath));
+		AddRecipe(AssetData);
+	}
+}
+
+// -------------------------------------------------------------------
+// Queries
+// -------------------------------------------------------------------
+
+void UArcRecipeIndexSubsystem::GetRecipesForStation(const FGameplayTagContainer& StationTags, TArray<int32>& OutRecipeIds)
+{
+	EnsureBuilt();
+
+	OutRecipeIds.Reset();
+	OutRecipeIds.Append(StationlessRecipes);
+
+	// A required tag is satisfied by the same tag or any of its children, so expand the station's
+	// tags with their parents and count hits: a recipe matches once every required tag was hit.
+	TArray<int32> Hits;
+	Hits.SetNumZeroed(Entries.Num());
+
+	const FGameplayTagContainer ExpandedStationTags = StationTags.GetGameplayTagParents();
+	for (const FGameplayTag& StationTag : ExpandedStationTags)
+	{
+		const TArray<int32>* Recipes = RecipesByStationTag.Find(StationTag);
+		if (!Recipes)
+		{
+			continue;
+		}
+
+		for (const int32 RecipeId : *Recipes)
+		{
+			if (++Hits[RecipeId] == Entries[RecipeId].RequiredStationTags.Num())
+			{
+				OutRecipeIds.Add(RecipeId);
+			}
+		}
+	}
+}
+
+void UArcRecipeIndexSubsystem::BuildAvailableKeys(const TArray<FArcItemSpec>& AvailableItems, TBitArray<>& OutKeys) const
+{
+	OutKeys.Init(false, RecipesByKey.Num());
+
+	for (const FArcItemSpec& ItemSpec : AvailableItems)
+	{
+		const FPrimaryAssetId ItemId = ItemSpec.GetItemDefinitionId();
+		if (!ItemId.IsValid())
+		{
+			continue;
+		}
+
+		if (const int32* Key = KeyByItem.Find(ItemId))
+		{
+			OutKeys[*Key] = true;
+		}
+
+		const UArcItemDefinition* Def = ItemSpec.GetItemDefinition();
+		const FArcItemFragment_Tags* TagsFragment = Def ? Def->FindFragment<FArcItemFragment_Tags>() : nullptr;
+		if (!TagsFragment)
+		{
+			continue;
+		}
+
+		// Tag ingredients use HasAll on the item's asset tags, which also accepts child tags.
+		const FGameplayTagContainer ExpandedItemTags = TagsFragment->AssetTags.GetGameplayTagParents();
+		for (const FGameplayTag& ItemTag : ExpandedItemTags)
+		{
+			if (const int32* Key = KeyByTag.Find(ItemTag))
+			{
+				OutKeys[*Key] = true;
+			}
+		}
+	}
+}
+
+void UArcRecipeIndexSubsystem::FilterByAvailableItems(
+	TConstArrayView<int32> CandidateRecipeIds,
+	const TArray<FArcItemSpec>& AvailableItems,
+	TArray<int32>& OutRecipeIds) const
+{
+	OutRecipeIds.Reset();
+
+	TBitArray<> AvailableKeys;
+	BuildAvailableKeys(AvailableItems, AvailableKeys);
+
+	for (const int32 RecipeId : CandidateRecipeIds)
+	{
+		const FArcRecipeIndexEntry* Entry = GetEntry(RecipeId);
+		if (!Entry || Entry->IngredientCount == 0)
+		{
+			continue;
+		}
+
+		if (Arc::RecipeIndex::ContainsAllBits(AvailableKeys, Entry->RequiredKeys))
+		{
+			OutRecipeIds.Add(RecipeId);
+		}
+	}
+}
+
+UArcRecipeDefinition* UArcRecipeIndexSubsystem::FindBestRecipeForIngredients(
+	TConstArrayView<int32> CandidateRecipeIds,
+	const TArray<FArcItemSpec>& AvailableItems,
+	const FGameplayTagContainer& StationTags,
+	float& OutMatchScore)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcRecipeIndex_FindBestRecipe);
+
+	OutMatchScore = 0.0f;
+	UArcRecipeDefinition* BestRecipe = nullptr;
+
+	TArray<int32> Survivors;
+	FilterByAvailableItems(CandidateRecipeIds, AvailableItems, Survivors);
+
+	for (const int32 RecipeId : Survivors)
+	{
+		UArcRecipeDefinition* Recipe = LoadRecipe(RecipeId);
+		const float Score = FArcRecipeLookup::ScoreRecipe(Recipe, AvailableItems, StationTags);
+		if (Score > OutMatchScore)
+		{
+			OutMatchScore = Score;
+			BestRecipe = Recipe;
+		}
+	}
+
+	return BestRecipe;
+}
+
+UArcRecipeDefinition* UArcRecipeIndexSubsystem::LoadRecipe(int32 RecipeId)
+{
+	const FArcRecipeIndexEntry* Entry = GetEntry(RecipeId);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	TObjectPtr<UArcRecipeDefinition>& Loaded = LoadedRecipes[RecipeId];
+	if (!Loaded)
+	{
+		Loaded = Cast<UArcRecipeDefinition>(Entry->AssetData.GetAsset());
+	}
+	return Loaded;
+}
@@ -0,0 +1,145 @@
+/**
+ * This file is part of Velesarc
+ * Copyright (C) 2025-2025 Lukasz Baran
+ *
+ * Licensed under the European Union Public License (EUPL), Version 1.2 or -
+ * as soon as they will be approved by the European Commission - later versions
+ * of the EUPL (the "License");
+ *
+ * You may not use this work except in compliance with the License.
+ * You may get a copy of the License at:
+ *
+ * https://eupl.eu/
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" basis,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ * See the License for the specific language governing permissions
+ * and limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "AssetRegistry/AssetData.h"
+#include "GameplayTagContainer.h"
+#include "ArcRecipeIndexSubsystem.generated.h"
+
+class UArcRecipeDefinition;
+struct FArcItemSpec;
+
+/**
+ * Everything the index knows about one recipe, parsed once from asset registry tags.
+ * Recipe ids are stable for the session; removed recipes leave an invalid entry whose id is reused.
+ */
+struct ARCCRAFT_API FArcRecipeIndexEntry
+{
+	FAssetData AssetData;
+	FGameplayTagContainer RequiredStationTags;
+	FGameplayTagContainer IngredientTags;
+	TArray<FPrimaryAssetId> IngredientItemIds;
+	int32 IngredientCount = 0;
+
+	/** One bit per ingredient key (tag or item definition) the recipe needs. See UArcRecipeIndexSubsystem. */
+	TBitArray<> RequiredKeys;
+
+	bool bValid = false;
+};
+
+/**
+ * Engine-wide recipe index built once from the asset registry and kept current from
+ * registry add/remove/update events, so runtime recipe queries never scan the registry.
+ *
+ * Holds:
+ *  - Station tag -> recipe ids (inverted), answering "recipes usable at this station".
+ *  - Ingredient key -> recipe ids, where a key is a required ingredient tag or an ingredient item definition.
+ *  - Per-recipe required-key bitsets. A recipe can only be satisfied when every required key is
+ *    present in the available items, which rejects most candidates before any asset is loaded.
+ *
+ * Candidates that pass the bitset test are loaded once and kept, then scored exactly
+ * (FArcRecipeLookup::ScoreRecipe).
+ */
+UCLASS()
+class ARCCRAFT_API UArcRecipeIndexSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UArcRecipeIndexSubsystem* Get();
+
+	virtual void Deinitialize() override;
+
+	/** Recipe ids whose RequiredStationTags are satisfied by StationTags (recipes without requirements always match). */
+	void GetRecipesForStation(const FGameplayTagContainer& StationTags, TArray<int32>& OutRecipeIds);
+
+	/** Keeps only recipes whose required ingredient keys are all present in AvailableItems. Does not load assets. */
+	void FilterByAvailableItems(
+		TConstArrayView<int32> CandidateRecipeIds,
+		const TArray<FArcItemSpec>& AvailableItems,
+		TArray<int32>& OutRecipeIds) const;
+
+	/**
+	 * Best recipe among CandidateRecipeIds for AvailableItems, using the same scoring as
+	 * FArcRecipeLookup::FindBestRecipeForIngredients. Only bitset survivors are loaded.
+	 */
+	UArcRecipeDefinition* FindBestRecipeForIngredients(
+		TConstArrayView<int32> CandidateRecipeIds,
+		const TArray<FArcItemSpec>& AvailableItems,
+		const FGameplayTagContainer& StationTags,
+		float& OutMatchScore);
+
+	/** Loads (first call only) and returns the recipe asset. */
+	UArcRecipeDefinition* LoadRecipe(int32 RecipeId);
+
+	const FArcRecipeIndexEntry* GetEntry(int32 RecipeId) const
+	{
+		return Entries.IsValidIndex(RecipeId) && Entries[RecipeId].bValid ? &Entries[RecipeId] : nullptr;
+	}
+
+	int32 FindRecipeId(const FSoftObjectPath& RecipePath) const
+	{
+		const int32* Found = IdByPath.Find(RecipePath);
+		return Found ? *Found : INDEX_NONE;
+	}
+
+	/** Bumped on every index change. Callers caching recipe id lists compare against it. */
+	uint32 GetVersion() const { return Version; }
+
+private:
+	void EnsureBuilt();
+	void BuildIndex();
+	void AddRecipe(const FAssetData& AssetData);
+	void RemoveRecipe(const FSoftObjectPath& RecipePath);
+	bool IsRecipeAsset(const FAssetData& AssetData) const;
+	int32 FindOrAddKey(const FGameplayTag& Tag);
+	int32 FindOrAddKey(const FPrimaryAssetId& ItemId);
+	void BuildAvailableKeys(const TArray<FArcItemSpec>& AvailableItems, TBitArray<>& OutKeys) const;
+
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TArray<FArcRecipeIndexEntry> Entries;
+	TArray<int32> FreeRecipeIds;
+	TMap<FSoftObjectPath, int32> IdByPath;
+
+	TMap<FGameplayTag, TArray<int32>> RecipesByStationTag;
+	TArray<int32> StationlessRecipes;
+
+	TMap<FGameplayTag, int32> KeyByTag;
+	TMap<FPrimaryAssetId, int32> KeyByItem;
+	TArray<TArray<int32>> RecipesByKey;
+
+	/** UArcRecipeDefinition and every native subclass, resolved at build time. */
+	TSet<FTopLevelAssetPath> RecipeClassPaths;
+
+	/** Recipes loaded by queries, indexed by recipe id. Keeps them resident for later queries. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UArcRecipeDefinition>> LoadedRecipes;
+
+	uint32 Version = 0;
+	bool bBuilt = false;
+};
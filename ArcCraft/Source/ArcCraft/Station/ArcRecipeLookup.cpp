@@ -22,7 +22,7 @@
 #include "ArcCraft/Station/ArcRecipeLookup.h"
 
 #include "ArcCraft/Recipe/ArcRecipeDefinition.h"
-#include "Engine/AssetManager.h"
+#include "ArcCraft/Station/ArcRecipeIndexSubsystem.h"
 #include "Items/ArcItemSpec.h"
 #include "Items/Fragments/ArcItemFragment_Tags.h"
 #include "ArcCraft/Recipe/ArcRecipeIngredient.h"
@@ -30,22 +30,23 @@
 TArray<FAssetData> FArcRecipeLookup::FindRecipesForStation(
 	const FGameplayTagContainer& StationTags)
 {
-	IAssetRegistry& AR = UAssetManager::Get().GetAssetRegistry();
+	TArray<FAssetData> Recipes;
 
-	// Build filter for all UArcRecipeDefinition assets (and derived classes)
-	FARFilter AssetFilter;
-	AssetFilter.ClassPaths.Add(UArcRecipeDefinition::StaticClass()->GetClassPathName());
-
-	TSet<FTopLevelAssetPath> DerivedClassNames;
-	AR.GetDerivedClassNames(AssetFilter.ClassPaths, TSet<FTopLevelAssetPath>(), DerivedClassNames);
-	AssetFilter.ClassPaths.Append(DerivedClassNames.Array());
-	AssetFilter.bRecursiveClasses = true;
+	UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get();
+	if (!RecipeIndex)
+	{
+		return Recipes;
+	}
 
-	TArray<FAssetData> AllRecipes;
-	AR.GetAssets(AssetFilter, AllRecipes);
+	TArray<int32> RecipeIds;
+	RecipeIndex->GetRecipesForStation(StationTags, RecipeIds);
 
-	// Filter by station tags using asset registry data
-	return UArcRecipeDefinition::FilterByStationTags(AllRecipes, StationTags);
+	Recipes.Reserve(RecipeIds.Num());
+	for (const int32 RecipeId : RecipeIds)
+	{
+		Recipes.Add(RecipeIndex->GetEntry(RecipeId)->AssetData);
+	}
+	return Recipes;
 }
 
 TArray<FAssetData> FArcRecipeLookup::FilterByAvailableIngredients(
@@ -54,10 +55,17 @@ TArray<FAssetData> FArcRecipeLookup::FilterByAvailableIngredients(
 {
 	TArray<FAssetData> Filtered;
 
+	const UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get();
+
 	for (const FAssetData& Data : CandidateRecipes)
 	{
-		// Get ingredient tags from asset registry
-		FGameplayTagContainer IngredientTags = UArcRecipeDefinition::GetIngredientTagsFromAssetData(Data);
+		// Ingredient tags come pre-parsed from the index; unindexed asset data falls back to the registry tag
+		const FArcRecipeIndexEntry* Entry = RecipeIndex
+			? RecipeIndex->GetEntry(RecipeIndex->FindRecipeId(Data.GetSoftObjectPath()))
+			: nullptr;
+		const FGameplayTagContainer IngredientTags = Entry
+			? Entry->IngredientTags
+			: UArcRecipeDefinition::GetIngredientTagsFromAssetData(Data);
 
 		// If recipe has no ingredient tags (e.g. all item-def based), include it
 		if (IngredientTags.Num() == 0)
@@ -89,78 +97,86 @@ UArcRecipeDefinition* FArcRecipeLookup::FindBestRecipeForIngredients(
 	{
 		// Load the recipe asset
 		UArcRecipeDefinition* Recipe = Cast<UArcRecipeDefinition>(Data.GetAsset());
-		if (!Recipe)
-		{
-			continue;
-		}
+		const float Score = ScoreRecipe(Recipe, AvailableItems, StationTags);
 
-		// Validate station tags again (in case of race condition)
-		if (Recipe->RequiredStationTags.Num() > 0 && !StationTags.HasAll(Recipe->RequiredStationTags))
+		if (Score > OutMatchScore)
 		{
-			continue;
+			OutMatchScore = Score;
+			BestRecipe = Recipe;
 		}
+	}
 
-		// Try to match all ingredient slots against available items
-		TSet<int32> UsedItemIndices;
-		int32 MatchedSlots = 0;
-		const int32 TotalSlots = Recipe->Ingredients.Num();
+	return BestRecipe;
+}
 
-		if (TotalSlots == 0)
+float FArcRecipeLookup::ScoreRecipe(
+	const UArcRecipeDefinition* Recipe,
+	const TArray<FArcItemSpec>& AvailableItems,
+	const FGameplayTagContainer& StationTags)
+{
+	if (!Recipe)
+	{
+		return 0.0f;
+	}
+
+	// Validate station tags again (in case of race condition)
+	if (Recipe->RequiredStationTags.Num() > 0 && !StationTags.HasAll(Recipe->RequiredStationTags))
+	{
+		return 0.0f;
+	}
+
+	// Try to match all ingredient slots against available items
+	TSet<int32> UsedItemIndices;
+	int32 MatchedSlots = 0;
+	const int32 TotalSlots = Recipe->Ingredients.Num();
+
+	if (TotalSlots == 0)
+	{
+		return 0.0f;
+	}
+
+	for (int32 SlotIdx = 0; SlotIdx < TotalSlots; ++SlotIdx)
+	{
+		const FArcRecipeIngredient* Ingredient = Recipe->GetIngredientBase(SlotIdx);
+		if (!Ingredient)
 		{
 			continue;
 		}
 
-		for (int32 SlotIdx = 0; SlotIdx < TotalSlots; ++SlotIdx)
+		for (int32 ItemIdx = 0; ItemIdx < AvailableItems.Num(); ++ItemIdx)
 		{
-			const FArcRecipeIngredient* Ingredient = Recipe->GetIngredientBase(SlotIdx);
-			if (!Ingredient)
+			if (UsedItemIndices.Contains(ItemIdx))
 			{
 				continue;
 			}
 
-			for (int32 ItemIdx = 0; ItemIdx < AvailableItems.Num(); ++ItemIdx)
+			const FArcItemSpec& ItemSpec = AvailableItems[ItemIdx];
+			if (!ItemSpec.GetItemDefinitionId().IsValid())
 			{
-				if (UsedItemIndices.Contains(ItemIdx))
-				{
-					continue;
-				}
-
-				const FArcItemSpec& ItemSpec = AvailableItems[ItemIdx];
-				if (!ItemSpec.GetItemDefinitionId().IsValid())
-				{
-					continue;
-				}
-
-				// We pass nullptr for tier table since we don't have it without loading more.
-				// This is a best-effort match.
-				if (Ingredient->DoesItemSatisfy(ItemSpec, nullptr) &&
-					ItemSpec.Amount >= static_cast<uint16>(Ingredient->Amount))
-				{
-					UsedItemIndices.Add(ItemIdx);
-					MatchedSlots++;
-					break;
-				}
+				continue;
 			}
-		}
 
-		// Only consider recipes where ALL slots are satisfied
-		if (MatchedSlots < TotalSlots)
-		{
-			continue;
+			// We pass nullptr for tier table since we don't have it without loading more.
+			// This is a best-effort match.
+			if (Ingredient->DoesItemSatisfy(ItemSpec, nullptr) &&
+				ItemSpec.Amount >= static_cast<uint16>(Ingredient->Amount))
+			{
+				UsedItemIndices.Add(ItemIdx);
+				MatchedSlots++;
+				break;
+			}
 		}
+	}
 
-		// Score: more ingredient slots = more specific recipe = better match.
-		// Tie-break by closeness of available items count to required count.
-		const float SlotScore = static_cast<float>(TotalSlots);
-		const float Closeness = 1.0f / (1.0f + FMath::Abs(static_cast<float>(AvailableItems.Num() - TotalSlots)));
-		const float Score = SlotScore + Closeness;
-
-		if (Score > OutMatchScore)
-		{
-			OutMatchScore = Score;
-			BestRecipe = Recipe;
-		}
+	// Only consider recipes where ALL slots are satisfied
+	if (MatchedSlots < TotalSlots)
+	{
+		return 0.0f;
 	}
 
-	return BestRecipe;
+	// Score: more ingredient slots = more specific recipe = better match.
+	// Tie-break by closeness of available items count to required count.
+	const float SlotScore = static_cast<float>(TotalSlots);
+	const float Closeness = 1.0f / (1.0f + FMath::Abs(static_cast<float>(AvailableItems.Num() - TotalSlots)));
+	return SlotScore + Closeness;
 }
@@ -29,26 +29,29 @@ class UArcRecipeDefinition;
 struct FArcItemSpec;
 
 /**
- * Stateless utility class for discovering recipes via the asset registry.
+ * Stateless utility class for discovering recipes by asset data.
+ * Backed by UArcRecipeIndexSubsystem, so none of these scan the asset registry.
  *
  * Flow:
- *  1. FindRecipesForStation() — query asset registry for recipes matching station tags
- *  2. FilterByAvailableIngredients() — coarse filter using ingredient tags from registry
+ *  1. FindRecipesForStation() — recipes matching station tags, from the station tag index
+ *  2. FilterByAvailableIngredients() — coarse filter using indexed ingredient tags
  *  3. FindBestRecipeForIngredients() — load candidates and score them
+ *
+ * Hot paths should prefer the id-based queries on UArcRecipeIndexSubsystem directly.
  */
 class ARCCRAFT_API FArcRecipeLookup
 {
 public:
 	/**
 	 * Find all recipe asset data whose RequiredStationTags are satisfied by the station's tags.
-	 * Uses asset registry only — does NOT load recipe assets.
+	 * Uses the recipe index only — does NOT load recipe assets.
 	 */
 	static TArray<FAssetData> FindRecipesForStation(
 		const FGameplayTagContainer& StationTags);
 
 	/**
 	 * Coarse filter: keep only recipes whose ingredient tags have any overlap with available items' tags.
-	 * Uses asset registry tags — does NOT load recipe assets.
+	 * Uses indexed ingredient tags — does NOT load recipe assets.
 	 *
 	 * @param CandidateRecipes  Asset data from FindRecipesForStation().
 	 * @param AvailableItemTags Union of all tags from available items.
@@ -73,4 +76,15 @@ public:
 		const TArray<FArcItemSpec>& AvailableItems,
 		const FGameplayTagContainer& StationTags,
 		float& OutMatchScore);
+
+	/**
+	 * Score a loaded recipe against the given ingredients. Every ingredient slot must be satisfied
+	 * by a distinct item; more slots score higher, ties broken by closeness of item count.
+	 *
+	 * @return Match score, or 0 if the recipe cannot be crafted from AvailableItems at this station.
+	 */
+	static float ScoreRecipe(
+		const UArcRecipeDefinition* Recipe,
+		const TArray<FArcItemSpec>& AvailableItems,
+		const FGameplayTagContainer& StationTags);
 };
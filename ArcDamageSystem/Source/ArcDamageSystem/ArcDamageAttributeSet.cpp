@@ -169,6 +169,6 @@ void UArcDamageAttributeSet::SyncConditionResistances()
 		float ResistanceValue = 0.f;
 		CaptureSpec.AttemptCalculateAttributeMagnitude(EvalParams, ResistanceValue);
 
-		StatesFragment->States[Mapping.ConditionTypeIndex].Resistance = FMath::Clamp(ResistanceValue, 0.f, 1.f);
+		StatesFragment->Resistance[Mapping.ConditionTypeIndex] = FMath::Clamp(ResistanceValue, 0.f, 1.f);
 	}
 }
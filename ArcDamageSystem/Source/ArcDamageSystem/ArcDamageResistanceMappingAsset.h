@@ -21,7 +21,7 @@ struct ARCDAMAGESYSTEM_API FArcDamageConditionMapping
 	UPROPERTY(EditAnywhere)
 	FGameplayTag DamageTypeTag;
 
-	/** Index into FArcConditionStatesFragment::States (cast of EArcConditionType). */
+	/** Lane index into FArcConditionStatesFragment arrays (cast of EArcConditionType). */
 	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", ClampMax = "12"))
 	int32 ConditionTypeIndex = 0;
 };
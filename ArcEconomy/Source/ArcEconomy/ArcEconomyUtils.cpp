@@ -3,7 +3,7 @@
 #include "ArcEconomyUtils.h"
 #include "Mass/ArcEconomyFragments.h"
 #include "ArcCraft/Recipe/ArcRecipeDefinition.h"
-#include "Engine/AssetManager.h"
+#include "ArcCraft/Station/ArcRecipeIndexSubsystem.h"
 
 const TArray<UArcRecipeDefinition*>& ArcEconomy::ResolveAllowedRecipes(FArcBuildingEconomyConfig& EconomyConfig)
 {
@@ -27,28 +27,19 @@ const TArray<UArcRecipeDefinition*>& ArcEconomy::ResolveAllowedRecipes(FArcBuild
     // Dynamic discovery via station tags
     else if (!EconomyConfig.ProductionStationTags.IsEmpty())
     {
-        IAssetRegistry& AR = UAssetManager::Get().GetAssetRegistry();
-
-        FARFilter AssetFilter;
-        AssetFilter.ClassPaths.Add(UArcRecipeDefinition::StaticClass()->GetClassPathName());
-
-        TSet<FTopLevelAssetPath> DerivedClassNames;
-        AR.GetDerivedClassNames(AssetFilter.ClassPaths, TSet<FTopLevelAssetPath>(), DerivedClassNames);
-        AssetFilter.ClassPaths.Append(DerivedClassNames.Array());
-        AssetFilter.bRecursiveClasses = true;
-
-        TArray<FAssetData> AllRecipes;
-        AR.GetAssets(AssetFilter, AllRecipes);
-
-        TArray<FAssetData> FilteredAssets = UArcRecipeDefinition::FilterByStationTags(AllRecipes, EconomyConfig.ProductionStationTags);
-
-        EconomyConfig.CachedRecipes.Reserve(FilteredAssets.Num());
-        for (const FAssetData& AssetData : FilteredAssets)
+        if (UArcRecipeIndexSubsystem* RecipeIndex = UArcRecipeIndexSubsystem::Get())
         {
-            UArcRecipeDefinition* Recipe = Cast<UArcRecipeDefinition>(AssetData.GetAsset());
-            if (Recipe)
+            TArray<int32> RecipeIds;
+            RecipeIndex->GetRecipesForStation(EconomyConfig.ProductionStationTags, RecipeIds);
+
+            EconomyConfig.CachedRecipes.Reserve(RecipeIds.Num());
+            for (const int32 RecipeId : RecipeIds)
             {
-                EconomyConfig.CachedRecipes.Add(Recipe);
+                UArcRecipeDefinition* Recipe = RecipeIndex->LoadRecipe(RecipeId);
+                if (Recipe)
+                {
+                    EconomyConfig.CachedRecipes.Add(Recipe);
+                }
             }
         }
     }
@@ -19,4 +19,8 @@ struct ARCECONOMY_API FArcItemEconomyFragment : public FArcItemFragment
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pricing")
 	float MaxPrice = 100.0f;
+
+	/** Multiplier on the settlement's price adjustment speed (K) for this item. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pricing", meta = (ClampMin = "0.0"))
+	float PriceElasticity = 1.0f;
 };
@@ -19,12 +19,15 @@ void UArcSettlementSubsystem::Deinitialize()
     SettlementToBuildings.Empty();
     SettlementToNPCs.Empty();
     NPCDelegates.Empty();
+    TransportBoards.Empty();
+    DemandGraphs.Empty();
     Super::Deinitialize();
 }
 
 void UArcSettlementSubsystem::RegisterBuilding(FMassEntityHandle SettlementHandle, FMassEntityHandle BuildingHandle)
 {
     SettlementToBuildings.FindOrAdd(SettlementHandle).AddUnique(BuildingHandle);
+    MarkBuildingDirty(SettlementHandle, BuildingHandle);
 }
 
 void UArcSettlementSubsystem::UnregisterBuilding(FMassEntityHandle SettlementHandle, FMassEntityHandle BuildingHandle)
@@ -34,6 +37,16 @@ void UArcSettlementSubsystem::UnregisterBuilding(FMassEntityHandle SettlementHan
     {
         Buildings->RemoveSingle(BuildingHandle);
     }
+
+    if (FArcSettlementTransportBoard* Board = TransportBoards.Find(SettlementHandle))
+    {
+        Board->RemoveBuilding(BuildingHandle);
+    }
+
+    if (ArcDemandGraph::FIncrementalDemandGraph* Graph = DemandGraphs.Find(SettlementHandle))
+    {
+        Graph->RemoveBuilding(BuildingHandle);
+    }
 }
 
 const TArray<FMassEntityHandle>& UArcSettlementSubsystem::GetBuildingsForSettlement(FMassEntityHandle SettlementHandle) const
@@ -42,6 +55,29 @@ const TArray<FMassEntityHandle>& UArcSettlementSubsystem::GetBuildingsForSettlem
     return Buildings ? *Buildings : EmptyHandleArray;
 }
 
+void UArcSettlementSubsystem::MarkBuildingDirty(FMassEntityHandle SettlementHandle, FMassEntityHandle BuildingHandle)
+{
+    if (!SettlementHandle.IsValid())
+    {
+        return;
+    }
+    TransportBoards.FindOrAdd(SettlementHandle).DirtyBuildings.Add(BuildingHandle);
+    DemandGraphs.FindOrAdd(SettlementHandle).MarkBuildingDirty(BuildingHandle);
+}
+
+FArcSettlementTransportBoard* UArcSettlementSubsystem::FindTransportBoard(FMassEntityHandle SettlementHandle)
+{
+    return TransportBoards.Find(SettlementHandle);
+}
+
+const ArcDemandGraph::FDemandGraph& UArcSettlementSubsystem::UpdateDemandGraph(FMassEntityManager& EntityManager,
+    FMassEntityHandle SettlementHandle, const FArcSettlementMarketFragment& Market)
+{
+    ArcDemandGraph::FIncrementalDemandGraph& Graph = DemandGraphs.FindOrAdd(SettlementHandle);
+    Graph.Update(EntityManager, SettlementHandle, GetBuildingsForSettlement(SettlementHandle), Market);
+    return Graph.GetGraph();
+}
+
 void UArcSettlementSubsystem::RegisterNPC(FMassEntityHandle SettlementHandle, FMassEntityHandle NPCHandle)
 {
     SettlementToNPCs.FindOrAdd(SettlementHandle).AddUnique(NPCHandle);
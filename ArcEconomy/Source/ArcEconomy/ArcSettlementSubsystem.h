@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "MassEntityTypes.h"
+#include "Mass/ArcTransportJobBoard.h"
+#include "Mass/ArcDemandGraph.h"
 #include "ArcSettlementSubsystem.generated.h"
 
 struct FMassEntityManager;
@@ -43,6 +45,28 @@ public:
     void UnregisterNPC(FMassEntityHandle SettlementHandle, FMassEntityHandle NPCHandle);
     const TArray<FMassEntityHandle>& GetNPCsForSettlement(FMassEntityHandle SettlementHandle) const;
 
+    // ---- Dirty Building Tracking ----
+
+    /**
+     * Flags a building whose stock, staffing or recipes changed. Its transport classification and
+     * demands, and its demand graph record, are rebuilt the next time they are read for its settlement.
+     * Registered buildings start dirty.
+     */
+    void MarkBuildingDirty(FMassEntityHandle SettlementHandle, FMassEntityHandle BuildingHandle);
+
+    // ---- Transport Board ----
+
+    FArcSettlementTransportBoard* FindTransportBoard(FMassEntityHandle SettlementHandle);
+
+    // ---- Demand Graph ----
+
+    /**
+     * Applies pending building deltas to the settlement's persistent demand graph and returns it.
+     * Clean settlements only refresh the settlement node from the market.
+     */
+    const ArcDemandGraph::FDemandGraph& UpdateDemandGraph(FMassEntityManager& EntityManager, FMassEntityHandle SettlementHandle,
+        const FArcSettlementMarketFragment& Market);
+
     // ---- Spatial Discovery ----
 
     /**
@@ -68,5 +92,10 @@ private:
     TMap<FMassEntityHandle, TArray<FMassEntityHandle>> SettlementToNPCs;
     TMap<FMassEntityHandle, FArcEconomyNPCDelegates> NPCDelegates;
 
+    UPROPERTY()
+    TMap<FMassEntityHandle, FArcSettlementTransportBoard> TransportBoards;
+
+    TMap<FMassEntityHandle, ArcDemandGraph::FIncrementalDemandGraph> DemandGraphs;
+
     static const TArray<FMassEntityHandle> EmptyHandleArray;
 };
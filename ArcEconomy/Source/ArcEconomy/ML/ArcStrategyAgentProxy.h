@@ -49,4 +49,10 @@ public:
     int32 TargetFactionIndex = INDEX_NONE;
     int32 TargetLocationIndex = INDEX_NONE;
     int32 TargetNeighborIndex = INDEX_NONE;
+
+    /** Training instance this agent belongs to. Targets resolve within the instance. */
+    int32 InstanceIndex = INDEX_NONE;
+
+    /** Per-agent random stream so the settlement simulation can run in parallel. */
+    FRandomStream RandomStream;
 };
@@ -29,6 +29,20 @@
 #include "Strategy/ArcFactionStrategySubsystem.h"
 #include "Strategy/ArcStrategicState.h"
 #include "StructUtils/InstancedStruct.h"
+#include "Async/ParallelFor.h"
+#include "Misc/CommandLine.h"
+#include "Engine/World.h"
+
+namespace ArcStrategyTraining
+{
+    /** Enables the subsystem in game worlds (e.g. -game -nullrhi) for headless training runs. */
+    static const TCHAR* HeadlessParam = TEXT("ArcStrategyTraining");
+
+    static bool IsHeadlessRun()
+    {
+        return FParse::Param(FCommandLine::Get(), HeadlessParam);
+    }
+}
 
 bool UArcStrategyTrainingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
@@ -37,7 +51,11 @@ bool UArcStrategyTrainingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
         return false;
     }
     const UWorld* World = Cast<UWorld>(Outer);
-    return World && World->IsEditorWorld();
+    if (!World)
+    {
+        return false;
+    }
+    return World->IsEditorWorld() || (World->IsGameWorld() && ArcStrategyTraining::IsHeadlessRun());
 }
 
 void UArcStrategyTrainingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -45,6 +63,46 @@ void UArcStrategyTrainingSubsystem::Initialize(FSubsystemCollectionBase& Collect
     Super::Initialize(Collection);
     SettlementRewardHistory.Reserve(MaxRewardHistory);
     FactionRewardHistory.Reserve(MaxRewardHistory);
+    ApplyCommandLineSettings();
+}
+
+void UArcStrategyTrainingSubsystem::ApplyCommandLineSettings()
+{
+    const TCHAR* CommandLine = FCommandLine::Get();
+    FParse::Value(CommandLine, TEXT("ArcStrategyInstances="), NumInstances);
+    FParse::Value(CommandLine, TEXT("ArcStrategyStepsPerTick="), StepsPerTick);
+    FParse::Value(CommandLine, TEXT("ArcStrategyCheckpointEvery="), CheckpointIntervalEpisodes);
+    FParse::Value(CommandLine, TEXT("ArcStrategySavePath="), SavePathPrefix);
+
+    NumInstances = FMath::Max(1, NumInstances);
+    StepsPerTick = FMath::Max(1, StepsPerTick);
+    CheckpointIntervalEpisodes = FMath::Max(0, CheckpointIntervalEpisodes);
+}
+
+void UArcStrategyTrainingSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (!InWorld.IsGameWorld() || !ArcStrategyTraining::IsHeadlessRun())
+    {
+        return;
+    }
+
+    // Headless runs start themselves: -ArcStrategyCurriculum=<asset path> -ArcStrategyRewardWeights=<asset path>
+    FString CurriculumPath;
+    FString RewardWeightsPath;
+    FParse::Value(FCommandLine::Get(), TEXT("ArcStrategyCurriculum="), CurriculumPath);
+    FParse::Value(FCommandLine::Get(), TEXT("ArcStrategyRewardWeights="), RewardWeightsPath);
+
+    UArcStrategyCurriculumAsset* Curriculum = CurriculumPath.IsEmpty() ? nullptr : LoadObject<UArcStrategyCurriculumAsset>(nullptr, *CurriculumPath);
+    UArcArchetypeRewardWeights* RewardWeights = RewardWeightsPath.IsEmpty() ? nullptr : LoadObject<UArcArchetypeRewardWeights>(nullptr, *RewardWeightsPath);
+    if (!Curriculum || !RewardWeights)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UArcStrategyTrainingSubsystem: Headless run needs -ArcStrategyCurriculum= and -ArcStrategyRewardWeights=."));
+        return;
+    }
+
+    StartTraining(Curriculum, RewardWeights);
 }
 
 void UArcStrategyTrainingSubsystem::Deinitialize()
@@ -58,10 +116,17 @@ void UArcStrategyTrainingSubsystem::Deinitialize()
 
 void UArcStrategyTrainingSubsystem::Tick(float DeltaTime)
 {
-    if (!bIsTraining)
+    // Every training step advances the simulation by one fixed decision step, so running
+    // several per tick trains faster than real time without changing episode semantics.
+    for (int32 Step = 0; Step < StepsPerTick && bIsTraining; ++Step)
     {
-        return;
+        StepTraining();
     }
+}
+
+void UArcStrategyTrainingSubsystem::StepTraining()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ArcStrategyTrainingStep);
 
 #if WITH_EDITOR
     // Check for trainer failure
@@ -208,6 +273,11 @@ void UArcStrategyTrainingSubsystem::StopTraining()
 }
 
 void UArcStrategyTrainingSubsystem::SavePoliciesNow()
+{
+    SavePolicies(FString());
+}
+
+void UArcStrategyTrainingSubsystem::SavePolicies(const FString& Suffix)
 {
 #if WITH_EDITOR
     if (SettlementPolicy)
@@ -215,7 +285,7 @@ void UArcStrategyTrainingSubsystem::SavePoliciesNow()
         ULearningAgentsNeuralNetwork* Network = SettlementPolicy->GetPolicyNetworkAsset();
         if (Network)
         {
-            const FString Path = SavePathPrefix + TEXT("SettlementPolicy");
+            const FString Path = SavePathPrefix + TEXT("SettlementPolicy") + Suffix;
             Network->SaveNetworkToSnapshot(FFilePath{Path});
             UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem: Saved settlement policy to %s"), *Path);
         }
@@ -225,7 +295,7 @@ void UArcStrategyTrainingSubsystem::SavePoliciesNow()
         ULearningAgentsNeuralNetwork* Network = FactionPolicy->GetPolicyNetworkAsset();
         if (Network)
         {
-            const FString Path = SavePathPrefix + TEXT("FactionPolicy");
+            const FString Path = SavePathPrefix + TEXT("FactionPolicy") + Suffix;
             Network->SaveNetworkToSnapshot(FFilePath{Path});
             UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem: Saved faction policy to %s"), *Path);
         }
@@ -259,13 +329,28 @@ void UArcStrategyTrainingSubsystem::SetupWorld(const FArcCurriculumStage& Stage)
         FactionActionMask &= ~(1u << 2); // ProposeAlliance
     }
 
+    Instances.SetNum(NumInstances);
+    for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+    {
+        SetupInstance(Stage, InstanceIndex);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem::SetupWorld — Instances=%d Factions=%d Settlements=%d"),
+        Instances.Num(), SpawnedFactions.Num(), SpawnedSettlements.Num());
+}
+
+void UArcStrategyTrainingSubsystem::SetupInstance(const FArcCurriculumStage& Stage, int32 InstanceIndex)
+{
+    FArcStrategyTrainingInstance& Instance = Instances[InstanceIndex];
+    Instance.Origin = FVector(InstanceSpacing * static_cast<float>(InstanceIndex), 0.0f, 0.0f);
+
     // Spawn faction entities evenly spaced in a circle
     const float AngleStep = (Stage.NumFactions > 0) ? (2.0f * UE_PI / static_cast<float>(Stage.NumFactions)) : 0.0f;
 
     for (int32 FactionIdx = 0; FactionIdx < Stage.NumFactions; ++FactionIdx)
     {
         const float Angle = AngleStep * static_cast<float>(FactionIdx);
-        const FVector FactionPos(
+        const FVector FactionPos = Instance.Origin + FVector(
             FMath::Cos(Angle) * Stage.WorldRadius * 0.5f,
             FMath::Sin(Angle) * Stage.WorldRadius * 0.5f,
             0.0f);
@@ -287,15 +372,16 @@ void UArcStrategyTrainingSubsystem::SetupWorld(const FArcCurriculumStage& Stage)
         // Initialize faction data
         FArcFactionFragment& FactionFrag = CachedEntityManager->GetFragmentDataChecked<FArcFactionFragment>(FactionHandle);
         FactionFrag.Archetype = Archetype;
-        FactionFrag.FactionName = *FString::Printf(TEXT("Faction_%d"), FactionIdx);
+        FactionFrag.FactionName = *FString::Printf(TEXT("Faction_%d_%d"), InstanceIndex, FactionIdx);
 
         FArcFactionSettlementsFragment& SettlementsFrag = CachedEntityManager->GetFragmentDataChecked<FArcFactionSettlementsFragment>(FactionHandle);
 
         SpawnedFactions.Add(FactionHandle);
+        Instance.Factions.Add(FactionHandle);
 
-        // Set neutral diplomacy to all other existing factions
+        // Set neutral diplomacy to all other factions in this instance
         FArcFactionDiplomacyFragment& DiplomacyFrag = CachedEntityManager->GetFragmentDataChecked<FArcFactionDiplomacyFragment>(FactionHandle);
-        for (const FMassEntityHandle& OtherFaction : SpawnedFactions)
+        for (const FMassEntityHandle& OtherFaction : Instance.Factions)
         {
             if (OtherFaction != FactionHandle)
             {
@@ -333,7 +419,7 @@ void UArcStrategyTrainingSubsystem::SetupWorld(const FArcCurriculumStage& Stage)
 
             FArcSettlementFragment& Settlement = CachedEntityManager->GetFragmentDataChecked<FArcSettlementFragment>(SettlementHandle);
             Settlement.bPlayerOwned = false;
-            Settlement.SettlementName = *FString::Printf(TEXT("Settlement_%d_%d"), FactionIdx, SettlementIdx);
+            Settlement.SettlementName = *FString::Printf(TEXT("Settlement_%d_%d_%d"), InstanceIndex, FactionIdx, SettlementIdx);
 
             FArcSettlementFactionFragment& FactionLink = CachedEntityManager->GetFragmentDataChecked<FArcSettlementFactionFragment>(SettlementHandle);
             FactionLink.OwningFaction = FactionHandle;
@@ -363,9 +449,6 @@ void UArcStrategyTrainingSubsystem::SetupWorld(const FArcCurriculumStage& Stage)
             }
         }
     }
-
-    UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem::SetupWorld — Factions=%d Settlements=%d"),
-        SpawnedFactions.Num(), SpawnedSettlements.Num());
 }
 
 void UArcStrategyTrainingSubsystem::TeardownWorld()
@@ -399,6 +482,7 @@ void UArcStrategyTrainingSubsystem::TeardownWorld()
 
     SpawnedSettlements.Empty();
     SpawnedFactions.Empty();
+    Instances.Empty();
 }
 
 void UArcStrategyTrainingSubsystem::SetupLearningAgents()
@@ -424,15 +508,24 @@ void UArcStrategyTrainingSubsystem::SetupLearningAgents()
         SettlementMgr, UArcSettlementStrategyInteractor::StaticClass(), TEXT("SettlementInteractor"));
     SettlementInteractor = Cast<UArcSettlementStrategyInteractor>(SettlementInteractorBase);
 
-    // Create and register settlement proxies
-    for (const FMassEntityHandle& Handle : SpawnedSettlements)
+    // Create and register settlement proxies, walking instances so each proxy knows its instance
+    for (int32 InstanceIndex = 0; InstanceIndex < Instances.Num(); ++InstanceIndex)
     {
-        UArcStrategyAgentProxy* Proxy = NewObject<UArcStrategyAgentProxy>(this);
-        Proxy->EntityHandle = Handle;
-        Proxy->AgentId = SettlementMgr->AddAgent(Proxy);
-        Proxy->SettlementState.Security = 50.0f;
-        Proxy->SettlementState.Military = 30.0f;
-        SettlementProxies.Add(Proxy);
+        for (const FMassEntityHandle& FactionHandle : Instances[InstanceIndex].Factions)
+        {
+            const FArcFactionSettlementsFragment& Owned = CachedEntityManager->GetFragmentDataChecked<FArcFactionSettlementsFragment>(FactionHandle);
+            for (const FMassEntityHandle& Handle : Owned.OwnedSettlements)
+            {
+                UArcStrategyAgentProxy* Proxy = NewObject<UArcStrategyAgentProxy>(this);
+                Proxy->EntityHandle = Handle;
+                Proxy->InstanceIndex = InstanceIndex;
+                Proxy->RandomStream.Initialize(static_cast<int32>(GetTypeHash(Handle)));
+                Proxy->AgentId = SettlementMgr->AddAgent(Proxy);
+                Proxy->SettlementState.Security = 50.0f;
+                Proxy->SettlementState.Military = 30.0f;
+                SettlementProxies.Add(Proxy);
+            }
+        }
     }
 
     ULearningAgentsTrainingEnvironment* SettlementEnvBase = ULearningAgentsTrainingEnvironment::MakeTrainingEnvironment(
@@ -479,12 +572,17 @@ void UArcStrategyTrainingSubsystem::SetupLearningAgents()
         FactionMgr, UArcFactionStrategyInteractor::StaticClass(), TEXT("FactionInteractor"));
     FactionInteractor = Cast<UArcFactionStrategyInteractor>(FactionInteractorBase);
 
-    for (const FMassEntityHandle& Handle : SpawnedFactions)
+    for (int32 InstanceIndex = 0; InstanceIndex < Instances.Num(); ++InstanceIndex)
     {
-        UArcStrategyAgentProxy* Proxy = NewObject<UArcStrategyAgentProxy>(this);
-        Proxy->EntityHandle = Handle;
-        Proxy->AgentId = FactionMgr->AddAgent(Proxy);
-        FactionProxies.Add(Proxy);
+        for (const FMassEntityHandle& Handle : Instances[InstanceIndex].Factions)
+        {
+            UArcStrategyAgentProxy* Proxy = NewObject<UArcStrategyAgentProxy>(this);
+            Proxy->EntityHandle = Handle;
+            Proxy->InstanceIndex = InstanceIndex;
+            Proxy->RandomStream.Initialize(static_cast<int32>(GetTypeHash(Handle)));
+            Proxy->AgentId = FactionMgr->AddAgent(Proxy);
+            FactionProxies.Add(Proxy);
+        }
     }
 
     ULearningAgentsTrainingEnvironment* FactionEnvBase = ULearningAgentsTrainingEnvironment::MakeTrainingEnvironment(
@@ -524,7 +622,7 @@ void UArcStrategyTrainingSubsystem::SetupLearningAgents()
 
     FLearningAgentsTrainingGameSettings GameSettings;
     GameSettings.bUseFixedTimeStep = true;
-    GameSettings.FixedTimeStepFrequency = 60.0f;
+    GameSettings.FixedTimeStepFrequency = FixedTimeStepFrequency;
     GameSettings.bDisableVSync = true;
     GameSettings.bDisableMaxFPS = true;
 
@@ -532,7 +630,7 @@ void UArcStrategyTrainingSubsystem::SetupLearningAgents()
     FactionTrainer->BeginTraining(TrainingSettings, GameSettings, true);
 
     UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem::SetupLearningAgents — pipelines ready. "
-        "SettlementAgents=%d FactionAgents=%d"), SettlementProxies.Num(), FactionProxies.Num());
+        "Instances=%d SettlementAgents=%d FactionAgents=%d"), Instances.Num(), SettlementProxies.Num(), FactionProxies.Num());
 #endif
 }
 
@@ -595,6 +693,11 @@ void UArcStrategyTrainingSubsystem::CheckCurriculumAdvancement()
 
         ++TotalEpisodes;
 
+        if (CheckpointIntervalEpisodes > 0 && TotalEpisodes % CheckpointIntervalEpisodes == 0)
+        {
+            SavePolicies(FString::Printf(TEXT("_Stage%d_Ep%06d"), CurrentStageIndex, TotalEpisodes));
+        }
+
         UE_LOG(LogTemp, Log, TEXT("UArcStrategyTrainingSubsystem: Episode %d complete. "
             "Stage=%d SettlementMean=%.3f FactionMean=%.3f"),
             TotalEpisodes, CurrentStageIndex, SettlementMean, FactionMean);
@@ -651,15 +754,23 @@ void UArcStrategyTrainingSubsystem::UpdateProxyStates()
         return;
     }
 
+    TRACE_CPUPROFILER_EVENT_SCOPE(ArcStrategyTrainingUpdateProxyStates);
+
+    const FMassEntityManager& EntityManager = *CachedEntityManager;
+
+    // Every proxy reads fragments and writes only its own state, so agents from all
+    // instances are processed in one parallel pass.
+
     // Settlement proxies: compute simplified state from fragments
-    for (UArcStrategyAgentProxy* Proxy : SettlementProxies)
+    ParallelFor(SettlementProxies.Num(), [this, &EntityManager](int32 ProxyIdx)
     {
-        if (!Proxy || !CachedEntityManager->IsEntityValid(Proxy->EntityHandle))
+        UArcStrategyAgentProxy* Proxy = SettlementProxies[ProxyIdx];
+        if (!Proxy || !EntityManager.IsEntityValid(Proxy->EntityHandle))
         {
-            continue;
+            return;
         }
 
-        const FMassEntityView View(*CachedEntityManager, Proxy->EntityHandle);
+        const FMassEntityView View(EntityManager, Proxy->EntityHandle);
 
         const FArcSettlementMarketFragment* Market = View.GetFragmentDataPtr<FArcSettlementMarketFragment>();
         const FArcSettlementWorkforceFragment* Workforce = View.GetFragmentDataPtr<FArcSettlementWorkforceFragment>();
@@ -696,17 +807,18 @@ void UArcStrategyTrainingSubsystem::UpdateProxyStates()
         // Decay Security and Military toward baseline each tick — Defend action counteracts this
         State.Security = FMath::Clamp(State.Security - 0.5f, 0.0f, 100.0f);
         State.Military = FMath::Clamp(State.Military - 0.3f, 0.0f, 100.0f);
-    }
+    });
 
     // Faction proxies: compute from owned settlement states
-    for (UArcStrategyAgentProxy* Proxy : FactionProxies)
+    ParallelFor(FactionProxies.Num(), [this, &EntityManager](int32 ProxyIdx)
     {
-        if (!Proxy || !CachedEntityManager->IsEntityValid(Proxy->EntityHandle))
+        UArcStrategyAgentProxy* Proxy = FactionProxies[ProxyIdx];
+        if (!Proxy || !EntityManager.IsEntityValid(Proxy->EntityHandle))
         {
-            continue;
+            return;
         }
 
-        const FMassEntityView FactionView(*CachedEntityManager, Proxy->EntityHandle);
+        const FMassEntityView FactionView(EntityManager, Proxy->EntityHandle);
         const FArcFactionSettlementsFragment* Settlements = FactionView.GetFragmentDataPtr<FArcFactionSettlementsFragment>();
         const FArcFactionDiplomacyFragment* Diplomacy = FactionView.GetFragmentDataPtr<FArcFactionDiplomacyFragment>();
 
@@ -723,11 +835,11 @@ void UArcStrategyTrainingSubsystem::UpdateProxyStates()
             int32 ValidCount = 0;
             for (const FMassEntityHandle& SettlementHandle : Settlements->OwnedSettlements)
             {
-                if (!CachedEntityManager->IsEntityValid(SettlementHandle))
+                if (!EntityManager.IsEntityValid(SettlementHandle))
                 {
                     continue;
                 }
-                const FMassEntityView SettlementView(*CachedEntityManager, SettlementHandle);
+                const FMassEntityView SettlementView(EntityManager, SettlementHandle);
                 const FArcSettlementMarketFragment* Market = SettlementView.GetFragmentDataPtr<FArcSettlementMarketFragment>();
                 if (Market && Market->TotalStorageCap > 0)
                 {
@@ -752,7 +864,7 @@ void UArcStrategyTrainingSubsystem::UpdateProxyStates()
             }
         }
         State.Stability = FMath::Clamp(80.0f - static_cast<float>(HostileCount) * 20.0f, 0.0f, 100.0f);
-    }
+    });
 }
 
 void UArcStrategyTrainingSubsystem::RecordTelemetry()
@@ -791,14 +903,21 @@ void UArcStrategyTrainingSubsystem::SimulateSettlementActions()
         return;
     }
 
-    for (UArcStrategyAgentProxy* Proxy : SettlementProxies)
+    TRACE_CPUPROFILER_EVENT_SCOPE(ArcStrategyTrainingSimulateSettlements);
+
+    FMassEntityManager& EntityManager = *CachedEntityManager;
+
+    // Settlement actions only mutate the settlement's own fragments and proxy (faction data is
+    // read-only here) and draw from the proxy's random stream, so they run in parallel.
+    ParallelFor(SettlementProxies.Num(), [this, &EntityManager](int32 ProxyIdx)
     {
-        if (!Proxy || !CachedEntityManager->IsEntityValid(Proxy->EntityHandle))
+        UArcStrategyAgentProxy* Proxy = SettlementProxies[ProxyIdx];
+        if (!Proxy || !EntityManager.IsEntityValid(Proxy->EntityHandle))
         {
-            continue;
+            return;
         }
 
-        FMassEntityView View(*CachedEntityManager, Proxy->EntityHandle);
+        FMassEntityView View(EntityManager, Proxy->EntityHandle);
 
         FArcSettlementMarketFragment* Market = View.GetFragmentDataPtr<FArcSettlementMarketFragment>();
         FArcSettlementWorkforceFragment* Workforce = View.GetFragmentDataPtr<FArcSettlementWorkforceFragment>();
@@ -806,7 +925,7 @@ void UArcStrategyTrainingSubsystem::SimulateSettlementActions()
 
         if (!Market || !Workforce || !Pop)
         {
-            continue;
+            return;
         }
 
         // --- Population drift ---
@@ -847,7 +966,7 @@ void UArcStrategyTrainingSubsystem::SimulateSettlementActions()
             case EArcSettlementAction::Trade:
             {
                 Market->CurrentTotalStorage += FMath::FloorToInt32(15.0f * I);
-                if (FMath::FRand() < 0.2f)
+                if (Proxy->RandomStream.FRand() < 0.2f)
                 {
                     Market->CurrentTotalStorage -= 3;
                 }
@@ -857,9 +976,9 @@ void UArcStrategyTrainingSubsystem::SimulateSettlementActions()
             {
                 // Only grant aid if the owning faction has at least one Allied faction
                 const FArcSettlementFactionFragment* FactionFrag = View.GetFragmentDataPtr<FArcSettlementFactionFragment>();
-                if (FactionFrag && CachedEntityManager->IsEntityValid(FactionFrag->OwningFaction))
+                if (FactionFrag && EntityManager.IsEntityValid(FactionFrag->OwningFaction))
                 {
-                    const FMassEntityView FactionView(*CachedEntityManager, FactionFrag->OwningFaction);
+                    const FMassEntityView FactionView(EntityManager, FactionFrag->OwningFaction);
                     const FArcFactionDiplomacyFragment* Diplomacy = FactionView.GetFragmentDataPtr<FArcFactionDiplomacyFragment>();
                     bool bHasAlly = false;
                     if (Diplomacy)
@@ -911,7 +1030,7 @@ void UArcStrategyTrainingSubsystem::SimulateSettlementActions()
         Proxy->SettlementState.Security = FMath::Clamp(Proxy->SettlementState.Security, 0.0f, 100.0f);
         Proxy->SettlementState.Military = FMath::Clamp(Proxy->SettlementState.Military, 0.0f, 100.0f);
         Proxy->SettlementState.Prosperity = FMath::Clamp(Proxy->SettlementState.Prosperity, 0.0f, 100.0f);
-    }
+    });
 }
 
 void UArcStrategyTrainingSubsystem::SimulateFactionActions()
@@ -941,16 +1060,20 @@ void UArcStrategyTrainingSubsystem::SimulateFactionActions()
         const float I = Decision.Intensity;
         const EArcFactionAction Action = static_cast<EArcFactionAction>(Decision.ActionIndex);
 
-        // Resolve target faction
-        const int32 ClampedTargetIdx = (Proxy->TargetFactionIndex != INDEX_NONE && SpawnedFactions.Num() > 0)
-            ? FMath::Clamp(Proxy->TargetFactionIndex, 0, SpawnedFactions.Num() - 1)
+        // Resolve target faction within the proxy's own instance
+        const TArray<FMassEntityHandle>& CandidateFactions = Instances.IsValidIndex(Proxy->InstanceIndex)
+            ? Instances[Proxy->InstanceIndex].Factions
+            : SpawnedFactions;
+
+        const int32 ClampedTargetIdx = (Proxy->TargetFactionIndex != INDEX_NONE && CandidateFactions.Num() > 0)
+            ? FMath::Clamp(Proxy->TargetFactionIndex, 0, CandidateFactions.Num() - 1)
             : INDEX_NONE;
 
         const bool bTargetValid = ClampedTargetIdx != INDEX_NONE
-            && SpawnedFactions[ClampedTargetIdx] != Proxy->EntityHandle
-            && CachedEntityManager->IsEntityValid(SpawnedFactions[ClampedTargetIdx]);
+            && CandidateFactions[ClampedTargetIdx] != Proxy->EntityHandle
+            && CachedEntityManager->IsEntityValid(CandidateFactions[ClampedTargetIdx]);
 
-        const FMassEntityHandle TargetHandle = bTargetValid ? SpawnedFactions[ClampedTargetIdx] : FMassEntityHandle{};
+        const FMassEntityHandle TargetHandle = bTargetValid ? CandidateFactions[ClampedTargetIdx] : FMassEntityHandle{};
 
         FArcFactionDiplomacyFragment* TargetDiplomacy = nullptr;
         UArcStrategyAgentProxy* TargetProxy = nullptr;
@@ -1096,6 +1219,8 @@ void UArcStrategyTrainingSubsystem::SimulateFactionActions()
 
                 UArcStrategyAgentProxy* NewProxy = NewObject<UArcStrategyAgentProxy>(this);
                 NewProxy->EntityHandle = NewHandle;
+                NewProxy->InstanceIndex = Proxy->InstanceIndex;
+                NewProxy->RandomStream.Initialize(static_cast<int32>(GetTypeHash(NewHandle)));
                 NewProxy->SettlementState.Security = 50.0f;
                 NewProxy->SettlementState.Military = 30.0f;
 
@@ -38,8 +38,21 @@ struct FArcTrainingTelemetry
 };
 
 /**
- * Editor-only world subsystem that orchestrates PPO training for settlement
- * and faction strategy agents via the Learning Agents plugin.
+ * One independent training world. All instances live side by side in the same Mass world,
+ * offset by InstanceSpacing, and never interact: faction targets resolve against the
+ * instance's own faction list.
+ */
+struct FArcStrategyTrainingInstance
+{
+    FVector Origin = FVector::ZeroVector;
+    TArray<FMassEntityHandle> Factions;
+};
+
+/**
+ * World subsystem that orchestrates PPO training for settlement and faction strategy
+ * agents via the Learning Agents plugin. Created in editor worlds, and in game worlds
+ * when launched with -ArcStrategyTraining for headless runs (e.g. -game -nullrhi).
+ * Training settings can be overridden from the command line in both cases.
  */
 UCLASS()
 class ARCECONOMY_API UArcStrategyTrainingSubsystem : public UTickableWorldSubsystem
@@ -50,6 +63,7 @@ public:
     virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
     virtual void Tick(float DeltaTime) override;
     virtual TStatId GetStatId() const override;
     virtual bool IsTickableInEditor() const override { return true; }
@@ -85,18 +99,44 @@ public:
     const TArray<float>& GetFactionRewardHistory() const { return FactionRewardHistory; }
     FArcTrainingTelemetry GetPerChannelRewards() const { return ChannelTelemetry; }
 
+    int32 GetNumInstances() const { return Instances.Num(); }
+
     // ----- Settings (configurable from dashboard) -----
 
     UPROPERTY(EditAnywhere, Category = "Training")
     FString SavePathPrefix = TEXT("/Game/ML/Strategy/");
 
+    /** Independent settlement/faction worlds simulated side by side. All share one policy per agent type. */
+    UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "1"))
+    int32 NumInstances = 1;
+
+    /** World-space distance between instance origins. */
+    UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "0.0"))
+    float InstanceSpacing = 100000.0f;
+
+    /** Training steps run per world tick. Values above 1 step the simulation faster than real time. */
+    UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "1"))
+    int32 StepsPerTick = 1;
+
+    /** Fixed tick rate the trainer forces on the engine while training. */
+    UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "1.0"))
+    float FixedTimeStepFrequency = 60.0f;
+
+    /** Save a numbered policy snapshot every N completed episodes. 0 disables checkpoints. */
+    UPROPERTY(EditAnywhere, Category = "Training", meta = (ClampMin = "0"))
+    int32 CheckpointIntervalEpisodes = 0;
+
     /** Action bitmask derived from current curriculum stage. Bit N set = action N allowed. */
     uint32 SettlementActionMask = 0xFFFFFFFF;
     uint32 FactionActionMask = 0xFFFFFFFF;
 
 private:
     // ----- Pipeline Setup -----
+    void ApplyCommandLineSettings();
+    void StepTraining();
+    void SavePolicies(const FString& Suffix);
     void SetupWorld(const struct FArcCurriculumStage& Stage);
+    void SetupInstance(const struct FArcCurriculumStage& Stage, int32 InstanceIndex);
     void TeardownWorld();
     void SetupLearningAgents();
     void TeardownLearningAgents();
@@ -186,6 +226,7 @@ private:
     // ----- Spawned Training Entities -----
     TArray<FMassEntityHandle> SpawnedSettlements;
     TArray<FMassEntityHandle> SpawnedFactions;
+    TArray<FArcStrategyTrainingInstance> Instances;
 
     FMassEntityManager* CachedEntityManager = nullptr;
 };
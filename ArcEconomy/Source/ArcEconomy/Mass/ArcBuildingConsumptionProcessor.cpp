@@ -2,6 +2,8 @@
 
 #include "Mass/ArcBuildingConsumptionProcessor.h"
 #include "Mass/ArcEconomyFragments.h"
+#include "Mass/ArcTransportJobBoard.h"
+#include "ArcSettlementSubsystem.h"
 #include "Mass/ArcMassItemFragments.h"
 #include "Knowledge/ArcEconomyKnowledgeTypes.h"
 #include "ArcKnowledgeSubsystem.h"
@@ -11,7 +13,7 @@
 #include "Items/ArcItemDefinition.h"
 #include "Items/ArcItemSpec.h"
 #include "Items/Fragments/ArcItemFragment_Tags.h"
-#include "ArcItemEconomyFragment.h"
+#include "Mass/ArcMarketPriceTable.h"
 
 UArcBuildingConsumptionProcessor::UArcBuildingConsumptionProcessor()
 	: ConsumerQuery{*this}
@@ -45,10 +47,11 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 	}
 
 	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
+	UArcSettlementSubsystem* SettlementSub = Context.GetWorld()->GetSubsystem<UArcSettlementSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcBuildingConsumption);
 
-	ConsumerQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem](FMassExecutionContext& Ctx)
+	ConsumerQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem, SettlementSub](FMassExecutionContext& Ctx)
 	{
 		const FArcBuildingEconomyConfig& EconomyConfig = Ctx.GetSharedFragment<FArcBuildingEconomyConfig>();
 		if (EconomyConfig.ConsumptionNeeds.IsEmpty())
@@ -66,6 +69,7 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 			FArcBuildingFragment& Building = Buildings[EntityIndex];
 			const FArcMassItemSpecArrayFragment& ItemArrayFrag = ItemArrays[EntityIndex];
 			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIndex);
+			const uint32 DemandSignature = ArcTransport::GetDemandSignature(Building);
 
 			// Remove excess handles if config changed
 			for (int32 ExcessIdx = NeedCount; ExcessIdx < Building.ConsumptionDemandHandles.Num(); ++ExcessIdx)
@@ -91,6 +95,7 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 				continue;
 			}
 
+			uint32 DeficitSignature = 0;
 			for (int32 NeedIdx = 0; NeedIdx < NeedCount; ++NeedIdx)
 			{
 				const FArcBuildingConsumptionEntry& Need = EconomyConfig.ConsumptionNeeds[NeedIdx];
@@ -120,6 +125,7 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 				}
 
 				const int32 Deficit = Need.DesiredStockLevel - CurrentStock;
+				DeficitSignature = HashCombineFast(DeficitSignature, GetTypeHash(FMath::Max(Deficit, 0)));
 
 				// Satisfied — remove stale handle
 				if (Deficit <= 0)
@@ -217,16 +223,8 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 							DemandPayload.OfferingPrice = MarketData->Price;
 						}
 
-						FArcResourceMarketData& CounterData = Market->PriceTable.FindOrAdd(Need.Item);
-						if (CounterData.Price <= 0.0f)
-						{
-							const FArcItemEconomyFragment* EconFrag = Need.Item->FindFragment<FArcItemEconomyFragment>();
-							if (EconFrag)
-							{
-								CounterData.Price = EconFrag->BasePrice;
-							}
-						}
-						CounterData.DemandCounter += Deficit;
+						FArcResourceMarketData& CounterData = ArcMarket::FindOrAddEntry(*Market, Need.Item);
+						ArcMarket::AddDemand(*Market, CounterData, Deficit);
 					}
 				}
 				else if (Need.ItemTag.IsValid())
@@ -249,6 +247,14 @@ void UArcBuildingConsumptionProcessor::Execute(FMassEntityManager& EntityManager
 					}
 				}
 			}
+
+			// Needs started or stopped advertising, or deficits moved — transport board and demand graph rebuild this building
+			const bool bDeficitsChanged = (DeficitSignature != Building.ConsumptionDeficitSignature);
+			Building.ConsumptionDeficitSignature = DeficitSignature;
+			if (SettlementSub && (bDeficitsChanged || DemandSignature != ArcTransport::GetDemandSignature(Building)))
+			{
+				SettlementSub->MarkBuildingDirty(Building.SettlementHandle, Entity);
+			}
 		}
 	});
 }
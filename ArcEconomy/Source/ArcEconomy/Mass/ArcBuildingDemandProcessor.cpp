@@ -2,6 +2,8 @@
 
 #include "Mass/ArcBuildingDemandProcessor.h"
 #include "Mass/ArcEconomyFragments.h"
+#include "Mass/ArcTransportJobBoard.h"
+#include "ArcSettlementSubsystem.h"
 #include "Knowledge/ArcEconomyKnowledgeTypes.h"
 #include "ArcCraft/Mass/ArcCraftMassFragments.h"
 #include "ArcKnowledgeSubsystem.h"
@@ -12,7 +14,7 @@
 #include "Items/ArcItemDefinition.h"
 #include "Items/ArcItemSpec.h"
 #include "Core/ArcCoreAssetManager.h"
-#include "ArcItemEconomyFragment.h"
+#include "Mass/ArcMarketPriceTable.h"
 #include "ArcCraft/Recipe/ArcRecipeDefinition.h"
 #include "ArcCraft/Recipe/ArcRecipeQuality.h"
 #include "Items/Fragments/ArcItemFragment_Tags.h"
@@ -49,10 +51,11 @@ void UArcBuildingDemandProcessor::Execute(FMassEntityManager& EntityManager, FMa
 	}
 
 	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
+	UArcSettlementSubsystem* SettlementSub = Context.GetWorld()->GetSubsystem<UArcSettlementSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcBuildingDemand);
 
-	BuildingQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem](FMassExecutionContext& Ctx)
+	BuildingQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem, SettlementSub](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FArcBuildingFragment> Buildings = Ctx.GetFragmentView<FArcBuildingFragment>();
 		TArrayView<FArcBuildingWorkforceFragment> Workforces = Ctx.GetMutableFragmentView<FArcBuildingWorkforceFragment>();
@@ -64,6 +67,7 @@ void UArcBuildingDemandProcessor::Execute(FMassEntityManager& EntityManager, FMa
 			const FArcBuildingFragment& Building = Buildings[EntityIndex];
 			FArcBuildingWorkforceFragment& Workforce = Workforces[EntityIndex];
 			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIndex);
+			const uint32 DemandSignature = ArcTransport::GetDemandSignature(Workforce);
 
 			for (int32 SlotIndex = 0; SlotIndex < Workforce.Slots.Num(); ++SlotIndex)
 			{
@@ -200,16 +204,8 @@ void UArcBuildingDemandProcessor::Execute(FMassEntityManager& EntityManager, FMa
 							{
 								DemandPayload.OfferingPrice = MarketData->Price;
 							}
-							FArcResourceMarketData& CounterData = Market->PriceTable.FindOrAdd(ItemDef);
-							if (CounterData.Price <= 0.0f)
-							{
-								const FArcItemEconomyFragment* EconFrag = ItemDef->FindFragment<FArcItemEconomyFragment>();
-								if (EconFrag)
-								{
-									CounterData.Price = EconFrag->BasePrice;
-								}
-							}
-							CounterData.DemandCounter += MissingQuantity;
+							FArcResourceMarketData& CounterData = ArcMarket::FindOrAddEntry(*Market, ItemDef);
+							ArcMarket::AddDemand(*Market, CounterData, MissingQuantity);
 						}
 					}
 					else if (TagsIngredient)
@@ -272,6 +268,12 @@ void UArcBuildingDemandProcessor::Execute(FMassEntityManager& EntityManager, FMa
 					}
 				}
 			}
+
+			// Advertised demand changed — transport board rebuilds this building on its next match
+			if (SettlementSub && DemandSignature != ArcTransport::GetDemandSignature(Workforce))
+			{
+				SettlementSub->MarkBuildingDirty(Building.SettlementHandle, Entity);
+			}
 		}
 	});
 }
@@ -2,12 +2,13 @@
 
 #include "Mass/ArcBuildingSupplyProcessor.h"
 #include "Mass/ArcEconomyFragments.h"
+#include "ArcSettlementSubsystem.h"
 #include "Knowledge/ArcEconomyKnowledgeTypes.h"
 #include "ArcCraft/Mass/ArcCraftMassFragments.h"
 #include "ArcKnowledgeSubsystem.h"
 #include "ArcKnowledgeEntry.h"
 #include "Items/ArcItemSpec.h"
-#include "ArcItemEconomyFragment.h"
+#include "Mass/ArcMarketPriceTable.h"
 #include "MassExecutionContext.h"
 #include "MassSignalSubsystem.h"
 #include "Items/ArcItemDefinition.h"
@@ -44,10 +45,11 @@ void UArcBuildingSupplyProcessor::Execute(FMassEntityManager& EntityManager, FMa
 	}
 
 	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
+	UArcSettlementSubsystem* SettlementSub = Context.GetWorld()->GetSubsystem<UArcSettlementSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcBuildingSupply);
 
-	BuildingQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem, bTimerElapsed](FMassExecutionContext& Ctx)
+	BuildingQuery.ForEachEntityChunk(Context, [&EntityManager, KnowledgeSub, SignalSubsystem, SettlementSub, bTimerElapsed](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcBuildingFragment> Buildings = Ctx.GetMutableFragmentView<FArcBuildingFragment>();
 		TArrayView<FArcCraftOutputFragment> Outputs = Ctx.GetMutableFragmentView<FArcCraftOutputFragment>();
@@ -71,6 +73,7 @@ void UArcBuildingSupplyProcessor::Execute(FMassEntityManager& EntityManager, FMa
 			{
 				TotalOutputCount += OutItem.Amount;
 			}
+			const bool bOutputCountChanged = (Building.CurrentOutputCount != TotalOutputCount);
 			Building.CurrentOutputCount = TotalOutputCount;
 
 			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIndex);
@@ -78,6 +81,12 @@ void UArcBuildingSupplyProcessor::Execute(FMassEntityManager& EntityManager, FMa
 			{
 				continue;
 			}
+
+			// Output buffer level drives producer backpressure in the demand graph
+			if (SettlementSub && bOutputCountChanged)
+			{
+				SettlementSub->MarkBuildingDirty(Building.SettlementHandle, Entity);
+			}
 			
 			const FArcSettlementMarketFragment* Market = EntityManager.GetFragmentDataPtr<FArcSettlementMarketFragment>(Building.SettlementHandle);
 
@@ -131,16 +140,8 @@ void UArcBuildingSupplyProcessor::Execute(FMassEntityManager& EntityManager, FMa
 				FArcSettlementMarketFragment* MutableMarket = EntityManager.GetFragmentDataPtr<FArcSettlementMarketFragment>(Building.SettlementHandle);
 				if (MutableMarket)
 				{
-					FArcResourceMarketData& MarketData = MutableMarket->PriceTable.FindOrAdd(ItemDef);
-					if (MarketData.Price <= 0.0f)
-					{
-						const FArcItemEconomyFragment* EconFrag = ItemDef->FindFragment<FArcItemEconomyFragment>();
-						if (EconFrag)
-						{
-							MarketData.Price = EconFrag->BasePrice;
-						}
-					}
-					MarketData.SupplyCounter += ItemSpec.Amount;
+					FArcResourceMarketData& MarketData = ArcMarket::FindOrAddEntry(*MutableMarket, ItemDef);
+					ArcMarket::AddSupply(*MutableMarket, MarketData, ItemSpec.Amount);
 
 					// Update supply source entry for this building + item
 					bool bFoundSource = false;
@@ -16,291 +16,174 @@
 namespace ArcDemandGraph
 {
 
-void FDemandGraph::Reset()
-{
-    Nodes.Reset();
-    Edges.Reset();
-    PotentialProducerIndex.Reset();
-    VisitedChainLinks.Reset();
-}
-
-int32 FDemandGraph::FindOrCreateActiveProducer(
-    FMassEntityManager& EntityManager,
-    UArcItemDefinition* ItemDef,
-    const TArray<FMassEntityHandle>& BuildingHandles)
+namespace Private
 {
-    // Check if we already have a producer node for this item.
-    for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); ++NodeIdx)
+    /** Builds a consumer node for one recipe ingredient. Returns false for unknown ingredient types. */
+    bool MakeIngredientConsumer(
+        const UArcRecipeDefinition& Recipe,
+        int32 IngIdx,
+        FMassEntityHandle BuildingHandle,
+        FName BuildingName,
+        FNode& OutNode)
     {
-        const FNode& Node = Nodes[NodeIdx];
-        if (Node.Type == ENodeType::Producer
-            && Node.Status != ENodeStatus::Potential
-            && Node.ItemDef == ItemDef)
+        const FArcRecipeIngredient* BaseIngredient = Recipe.GetIngredientBase(IngIdx);
+        if (!BaseIngredient)
         {
-            return NodeIdx;
+            return false;
         }
-    }
 
-    // Scan buildings for one with DesiredRecipe outputting ItemDef.
-    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
-    {
-        if (!EntityManager.IsEntityValid(BuildingHandle))
-        {
-            continue;
-        }
+        const FArcRecipeIngredient_ItemDef* ItemDefIngredient = Recipe.GetIngredient<FArcRecipeIngredient_ItemDef>(IngIdx);
+        const FArcRecipeIngredient_Tags* TagsIngredient = Recipe.GetIngredient<FArcRecipeIngredient_Tags>(IngIdx);
 
-        const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
-        const FArcBuildingWorkforceFragment* WorkforceFrag = EntityManager.GetFragmentDataPtr<FArcBuildingWorkforceFragment>(BuildingHandle);
-        const FArcBuildingEconomyConfig* EconomyConfig = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
+        OutNode = FNode();
+        OutNode.Type = ENodeType::Consumer;
+        OutNode.Entity = BuildingHandle;
+        OutNode.BuildingName = BuildingName;
+        OutNode.DemandQuantity = BaseIngredient->Amount;
+        OutNode.Status = ENodeStatus::UnmetDemand;
 
-        if (!BuildingFrag || !WorkforceFrag || !EconomyConfig)
+        if (ItemDefIngredient && ItemDefIngredient->ItemDefinitionId.IsValid())
         {
-            continue;
+            OutNode.ItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(ItemDefIngredient->ItemDefinitionId.AssetId);
         }
-
-        for (const FArcBuildingSlotData& Slot : WorkforceFrag->Slots)
+        else if (TagsIngredient)
         {
-            if (!Slot.DesiredRecipe)
-            {
-                continue;
-            }
-
-            if (!Slot.DesiredRecipe->OutputItemDefinition.IsValid())
-            {
-                continue;
-            }
-
-            UArcItemDefinition* OutputItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(
-                Slot.DesiredRecipe->OutputItemDefinition.AssetId);
-
-            if (OutputItemDef != ItemDef)
-            {
-                continue;
-            }
-
-            const int32 ProducerIdx = Nodes.Num();
-
-            FNode ProducerNode;
-            ProducerNode.Type = ENodeType::Producer;
-            ProducerNode.Entity = BuildingHandle;
-            ProducerNode.BuildingName = BuildingFrag->BuildingName;
-            ProducerNode.ItemDef = OutputItemDef;
-            ProducerNode.StorageCap = EconomyConfig->OutputBufferSize;
-            ProducerNode.CurrentStock = BuildingFrag->CurrentOutputCount;
-            ProducerNode.bBackpressured = (BuildingFrag->CurrentOutputCount >= EconomyConfig->OutputBufferSize);
-            ProducerNode.bStaffed = (Slot.RequiredWorkerCount > 0);
-
-            if (ProducerNode.bBackpressured)
-            {
-                ProducerNode.Status = ENodeStatus::Backpressured;
-            }
-            else if (!ProducerNode.bStaffed)
-            {
-                ProducerNode.Status = ENodeStatus::Unstaffed;
-            }
-            else
-            {
-                ProducerNode.Status = ENodeStatus::Flowing;
-            }
-
-            Nodes.Add(ProducerNode);
-            return ProducerIdx;
+            OutNode.ItemTag = TagsIngredient->RequiredTags.IsEmpty()
+                ? FGameplayTag()
+                : TagsIngredient->RequiredTags.First();
         }
-    }
-
-    // Check gathering buildings — they are active producers if they have gatherers assigned.
-    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
-    {
-        if (!EntityManager.IsEntityValid(BuildingHandle))
+        else
         {
-            continue;
+            // Unknown ingredient type; skip.
+            return false;
         }
 
-        const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
-        const FArcBuildingEconomyConfig* EconomyConfig = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
+        return true;
+    }
 
-        if (!BuildingFrag || !EconomyConfig || !EconomyConfig->IsGatheringBuilding())
+    int32 CountStockForNeed(const FArcBuildingConsumptionEntry& Need, const FArcMassItemSpecArrayFragment* ItemStorage)
+    {
+        if (!ItemStorage)
         {
-            continue;
+            return 0;
         }
 
-        bool bProducesItem = false;
-        for (UArcItemDefinition* GatherItem : EconomyConfig->GatherOutputItems)
+        int32 CurrentStock = 0;
+        for (const FArcItemSpec& ItemSpec : ItemStorage->Items)
         {
-            if (GatherItem == ItemDef)
+            const UArcItemDefinition* SpecItemDef = ItemSpec.GetItemDefinition();
+            if (Need.Item)
             {
-                bProducesItem = true;
-                break;
+                if (SpecItemDef == Need.Item)
+                {
+                    CurrentStock += ItemSpec.Amount;
+                }
+            }
+            else if (Need.ItemTag.IsValid() && SpecItemDef)
+            {
+                const FArcItemFragment_Tags* TagsFrag = SpecItemDef->FindFragment<FArcItemFragment_Tags>();
+                if (TagsFrag && TagsFrag->AssetTags.HasTag(Need.ItemTag))
+                {
+                    CurrentStock += ItemSpec.Amount;
+                }
             }
         }
-        if (!bProducesItem)
-        {
-            continue;
-        }
+        return CurrentStock;
+    }
 
-        const int32 ProducerIdx = Nodes.Num();
+    /** First active output of Record for ItemDef. Recipe outputs precede gathering ones, matching producer selection. */
+    const FActiveOutput* FindActiveOutput(const FBuildingRecord& Record, const UArcItemDefinition* ItemDef)
+    {
+        return Record.ActiveOutputs.FindByPredicate([ItemDef](const FActiveOutput& Output)
+        {
+            return Output.ItemDef == ItemDef;
+        });
+    }
 
-        FNode ProducerNode;
-        ProducerNode.Type = ENodeType::Producer;
-        ProducerNode.Entity = BuildingHandle;
-        ProducerNode.BuildingName = BuildingFrag->BuildingName;
-        ProducerNode.ItemDef = ItemDef;
-        ProducerNode.StorageCap = EconomyConfig->OutputBufferSize;
-        ProducerNode.CurrentStock = BuildingFrag->CurrentOutputCount;
-        ProducerNode.bBackpressured = (BuildingFrag->CurrentOutputCount >= EconomyConfig->OutputBufferSize);
-        ProducerNode.bStaffed = true; // Staffing is determined by governor gatherer assignment
+    void ApplyActiveProducerState(FNode& ProducerNode, const FBuildingRecord& Record, const FActiveOutput& Output)
+    {
+        ProducerNode.StorageCap = Record.StorageCap;
+        ProducerNode.CurrentStock = Record.CurrentOutputCount;
+        ProducerNode.bBackpressured = (Record.CurrentOutputCount >= Record.StorageCap);
+        ProducerNode.bStaffed = Output.bStaffed;
 
         if (ProducerNode.bBackpressured)
         {
             ProducerNode.Status = ENodeStatus::Backpressured;
         }
+        else if (!ProducerNode.bStaffed)
+        {
+            ProducerNode.Status = ENodeStatus::Unstaffed;
+        }
         else
         {
             ProducerNode.Status = ENodeStatus::Flowing;
         }
-
-        Nodes.Add(ProducerNode);
-        return ProducerIdx;
     }
-
-    return INDEX_NONE;
 }
 
-int32 FDemandGraph::CreatePotentialProducerAndEnqueueInputs(
-    FMassEntityManager& EntityManager,
-    const FPotentialProducer& Producer,
-    TArray<int32>& BFSQueue)
+// -------------------------------------------------------------------------
+// FBuildingRecord
+// -------------------------------------------------------------------------
+
+bool FBuildingRecord::Build(FMassEntityManager& EntityManager, FMassEntityHandle InBuildingHandle)
 {
-    const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(Producer.BuildingHandle);
-    const FArcBuildingEconomyConfig* EconomyConfig = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(Producer.BuildingHandle);
+    *this = FBuildingRecord();
+    BuildingHandle = InBuildingHandle;
 
-    UArcItemDefinition* OutputItemDef = nullptr;
-    if (Producer.Recipe && Producer.Recipe->OutputItemDefinition.IsValid())
+    if (!EntityManager.IsEntityValid(BuildingHandle))
     {
-        OutputItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(Producer.Recipe->OutputItemDefinition.AssetId);
+        return false;
     }
 
-    const int32 ProducerIdx = Nodes.Num();
-
-    FNode ProducerNode;
-    ProducerNode.Type = ENodeType::Producer;
-    ProducerNode.Status = ENodeStatus::Potential;
-    ProducerNode.Entity = Producer.BuildingHandle;
-    ProducerNode.BuildingName = Producer.BuildingName;
-    ProducerNode.ItemDef = OutputItemDef;
-    if (EconomyConfig)
+    const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
+    if (!BuildingFrag)
     {
-        ProducerNode.StorageCap = EconomyConfig->OutputBufferSize;
-    }
-    if (BuildingFrag)
-    {
-        ProducerNode.CurrentStock = BuildingFrag->CurrentOutputCount;
+        return false;
     }
 
-    Nodes.Add(ProducerNode);
+    const FArcBuildingWorkforceFragment* WorkforceFrag = EntityManager.GetFragmentDataPtr<FArcBuildingWorkforceFragment>(BuildingHandle);
+    FArcBuildingEconomyConfig* EconomyConfig = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
 
-    // Enqueue consumer nodes for each ingredient.
-    if (!Producer.Recipe)
-    {
-        return ProducerIdx;
-    }
+    BuildingName = BuildingFrag->BuildingName;
+    CurrentOutputCount = BuildingFrag->CurrentOutputCount;
+    StorageCap = EconomyConfig ? EconomyConfig->OutputBufferSize : 0;
 
-    const int32 IngredientCount = Producer.Recipe->GetIngredientCount();
-    for (int32 IngIdx = 0; IngIdx < IngredientCount; ++IngIdx)
+    // Active outputs: slots with a DesiredRecipe, then gathered items.
+    if (WorkforceFrag && EconomyConfig)
     {
-        const FArcRecipeIngredient* BaseIngredient = Producer.Recipe->GetIngredientBase(IngIdx);
-        if (!BaseIngredient)
+        for (const FArcBuildingSlotData& Slot : WorkforceFrag->Slots)
         {
-            continue;
-        }
-
-        const FArcRecipeIngredient_ItemDef* ItemDefIngredient = Producer.Recipe->GetIngredient<FArcRecipeIngredient_ItemDef>(IngIdx);
-        const FArcRecipeIngredient_Tags* TagsIngredient = Producer.Recipe->GetIngredient<FArcRecipeIngredient_Tags>(IngIdx);
-
-        const int32 ConsumerIdx = Nodes.Num();
-
-        FNode ConsumerNode;
-        ConsumerNode.Type = ENodeType::Consumer;
-        ConsumerNode.Entity = Producer.BuildingHandle;
-        ConsumerNode.BuildingName = Producer.BuildingName;
-        ConsumerNode.DemandQuantity = BaseIngredient->Amount;
-        ConsumerNode.Status = ENodeStatus::UnmetDemand;
+            if (!Slot.DesiredRecipe || !Slot.DesiredRecipe->OutputItemDefinition.IsValid())
+            {
+                continue;
+            }
 
-        if (ItemDefIngredient && ItemDefIngredient->ItemDefinitionId.IsValid())
-        {
-            UArcItemDefinition* IngItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(
-                ItemDefIngredient->ItemDefinitionId.AssetId);
-            ConsumerNode.ItemDef = IngItemDef;
-        }
-        else if (TagsIngredient)
-        {
-            ConsumerNode.ItemTag = TagsIngredient->RequiredTags.IsEmpty()
-                ? FGameplayTag()
-                : TagsIngredient->RequiredTags.First();
+            FActiveOutput& Output = ActiveOutputs.AddDefaulted_GetRef();
+            Output.ItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(Slot.DesiredRecipe->OutputItemDefinition.AssetId);
+            Output.bStaffed = (Slot.RequiredWorkerCount > 0);
         }
-        else
-        {
-            // Unknown ingredient type; skip.
-            continue;
-        }
-
-        Nodes.Add(ConsumerNode);
-        BFSQueue.Add(ConsumerIdx);
     }
 
-    return ProducerIdx;
-}
-
-void FDemandGraph::Rebuild(
-    FMassEntityManager& EntityManager,
-    FMassEntityHandle SettlementEntity,
-    const TArray<FMassEntityHandle>& BuildingHandles,
-    const FArcSettlementMarketFragment& Market)
-{
-    Reset();
-
-    // Node 0 is always the settlement node.
-    {
-        FNode SettlementNode;
-        SettlementNode.Type = ENodeType::Settlement;
-        SettlementNode.Entity = SettlementEntity;
-        SettlementNode.CurrentStock = Market.CurrentTotalStorage;
-        SettlementNode.StorageCap = Market.TotalStorageCap;
-        SettlementNode.bBackpressured = (Market.CurrentTotalStorage >= Market.TotalStorageCap);
-        SettlementNode.Status = SettlementNode.bBackpressured ? ENodeStatus::Backpressured : ENodeStatus::Flowing;
-        Nodes.Add(SettlementNode);
-    }
-
-    // -------------------------------------------------------------------------
-    // Pass 1: Build PotentialProducerIndex
-    // For every building, scan AllowedRecipes (via ResolveAllowedRecipes) and
-    // map output item def -> buildings that could produce it.
-    // -------------------------------------------------------------------------
-    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
+    if (EconomyConfig && EconomyConfig->IsGatheringBuilding())
     {
-        if (!EntityManager.IsEntityValid(BuildingHandle))
-        {
-            continue;
-        }
-
-        const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
-        FArcBuildingEconomyConfig* EconomyConfig =
-            EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
-
-        if (!BuildingFrag || !EconomyConfig)
+        for (UArcItemDefinition* GatherItem : EconomyConfig->GatherOutputItems)
         {
-            continue;
+            FActiveOutput& Output = ActiveOutputs.AddDefaulted_GetRef();
+            Output.ItemDef = GatherItem;
+            // Staffing is determined by governor gatherer assignment
+            Output.bStaffed = true;
+            Output.bGathering = true;
         }
+    }
 
+    if (EconomyConfig)
+    {
+        // Potential producers: every AllowedRecipe output.
         const TArray<UArcRecipeDefinition*>& AllowedRecipes = ArcEconomy::ResolveAllowedRecipes(*EconomyConfig);
         for (UArcRecipeDefinition* Recipe : AllowedRecipes)
         {
-            if (!Recipe)
-            {
-                continue;
-            }
-
-            if (!Recipe->OutputItemDefinition.IsValid())
+            if (!Recipe || !Recipe->OutputItemDefinition.IsValid())
             {
                 continue;
             }
@@ -312,18 +195,24 @@ void FDemandGraph::Rebuild(
                 continue;
             }
 
-            FPotentialProducer PotentialProducer;
+            FPotentialProducer& PotentialProducer = PotentialProducers.AddDefaulted_GetRef();
             PotentialProducer.BuildingHandle = BuildingHandle;
             PotentialProducer.Recipe = Recipe;
-            PotentialProducer.BuildingName = BuildingFrag->BuildingName;
+            PotentialProducer.BuildingName = BuildingName;
+            PotentialProducer.OutputItemDef = OutputItemDef;
 
-            TArray<FPotentialProducer>& ProducersForItem = PotentialProducerIndex.FindOrAdd(
-                TObjectPtr<UArcItemDefinition>(OutputItemDef));
-            ProducersForItem.Add(PotentialProducer);
+            const int32 IngredientCount = Recipe->GetIngredientCount();
+            for (int32 IngIdx = 0; IngIdx < IngredientCount; ++IngIdx)
+            {
+                FNode InputNode;
+                if (Private::MakeIngredientConsumer(*Recipe, IngIdx, BuildingHandle, BuildingName, InputNode))
+                {
+                    PotentialProducer.InputNodes.Add(InputNode);
+                }
+            }
         }
 
-        // Gathering buildings: register as potential producers for each GatherOutputItem.
-        // These are leaf producers (no recipe, no ingredients).
+        // Gathering buildings are leaf producers (no recipe, no ingredients).
         if (EconomyConfig->IsGatheringBuilding())
         {
             for (UArcItemDefinition* GatherItem : EconomyConfig->GatherOutputItems)
@@ -333,119 +222,40 @@ void FDemandGraph::Rebuild(
                     continue;
                 }
 
-                FPotentialProducer PotentialProducer;
+                FPotentialProducer& PotentialProducer = PotentialProducers.AddDefaulted_GetRef();
                 PotentialProducer.BuildingHandle = BuildingHandle;
-                PotentialProducer.Recipe = nullptr; // No recipe — gathering
-                PotentialProducer.BuildingName = BuildingFrag->BuildingName;
-
-                TArray<FPotentialProducer>& ProducersForItem = PotentialProducerIndex.FindOrAdd(
-                    TObjectPtr<UArcItemDefinition>(GatherItem));
-                ProducersForItem.Add(PotentialProducer);
+                PotentialProducer.BuildingName = BuildingName;
+                PotentialProducer.OutputItemDef = GatherItem;
             }
         }
-    }
-
-    // -------------------------------------------------------------------------
-    // Pass 2: Seed consumer nodes from ConsumptionNeeds
-    // Buildings with ConsumptionNeeds that are below desired stock level.
-    // Seeds the BFS queue.
-    // -------------------------------------------------------------------------
-    TArray<int32> BFSQueue;
-
-    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
-    {
-        if (!EntityManager.IsEntityValid(BuildingHandle))
-        {
-            continue;
-        }
-
-        const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
-        const FArcBuildingEconomyConfig* EconomyConfig = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
-
-        if (!BuildingFrag || !EconomyConfig)
-        {
-            continue;
-        }
-
-        if (EconomyConfig->ConsumptionNeeds.IsEmpty())
-        {
-            continue;
-        }
 
+        // Consumption seeds: needs below desired stock level.
         const FArcMassItemSpecArrayFragment* ItemStorage = EntityManager.GetFragmentDataPtr<FArcMassItemSpecArrayFragment>(BuildingHandle);
-
         for (const FArcBuildingConsumptionEntry& Need : EconomyConfig->ConsumptionNeeds)
         {
-            UArcItemDefinition* NeedItemDef = Need.Item;
-
-            int32 CurrentStock = 0;
-            if (ItemStorage)
-            {
-                for (const FArcItemSpec& ItemSpec : ItemStorage->Items)
-                {
-                    if (NeedItemDef)
-                    {
-                        const UArcItemDefinition* SpecItemDef = ItemSpec.GetItemDefinition();
-                        if (SpecItemDef == NeedItemDef)
-                        {
-                            CurrentStock += ItemSpec.Amount;
-                        }
-                    }
-                    else if (Need.ItemTag.IsValid())
-                    {
-                        const UArcItemDefinition* SpecItemDef = ItemSpec.GetItemDefinition();
-                        if (SpecItemDef)
-                        {
-                            const FArcItemFragment_Tags* TagsFrag = SpecItemDef->FindFragment<FArcItemFragment_Tags>();
-                            if (TagsFrag && TagsFrag->AssetTags.HasTag(Need.ItemTag))
-                            {
-                                CurrentStock += ItemSpec.Amount;
-                            }
-                        }
-                    }
-                }
-            }
-
+            const int32 CurrentStock = Private::CountStockForNeed(Need, ItemStorage);
             const int32 Deficit = Need.DesiredStockLevel - CurrentStock;
             if (Deficit <= 0)
             {
                 continue;
             }
 
-            const int32 ConsumerIdx = Nodes.Num();
-
-            FNode ConsumerNode;
+            FNode& ConsumerNode = ConsumptionSeeds.AddDefaulted_GetRef();
             ConsumerNode.Type = ENodeType::Consumer;
             ConsumerNode.Entity = BuildingHandle;
-            ConsumerNode.BuildingName = BuildingFrag->BuildingName;
-            ConsumerNode.ItemDef = NeedItemDef;
+            ConsumerNode.BuildingName = BuildingName;
+            ConsumerNode.ItemDef = Need.Item;
             ConsumerNode.ItemTag = Need.ItemTag;
             ConsumerNode.DemandQuantity = Deficit;
             ConsumerNode.CurrentStock = CurrentStock;
             ConsumerNode.StorageCap = Need.DesiredStockLevel;
             ConsumerNode.Status = ENodeStatus::UnmetDemand;
-
-            Nodes.Add(ConsumerNode);
-            BFSQueue.Add(ConsumerIdx);
         }
     }
 
-    // Also seed consumer nodes from production input needs (halted slots with active demand handles).
-    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
+    // Ingredient seeds: halted slots with active demand handles.
+    if (WorkforceFrag)
     {
-        if (!EntityManager.IsEntityValid(BuildingHandle))
-        {
-            continue;
-        }
-
-        const FArcBuildingFragment* BuildingFrag = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
-        const FArcBuildingWorkforceFragment* WorkforceFrag = EntityManager.GetFragmentDataPtr<FArcBuildingWorkforceFragment>(BuildingHandle);
-
-        if (!BuildingFrag || !WorkforceFrag)
-        {
-            continue;
-        }
-
         for (const FArcBuildingSlotData& Slot : WorkforceFrag->Slots)
         {
             if (!Slot.DesiredRecipe || Slot.HaltDuration <= 0.0f)
@@ -454,115 +264,265 @@ void FDemandGraph::Rebuild(
             }
 
             const int32 IngredientCount = Slot.DesiredRecipe->GetIngredientCount();
-
             for (int32 IngIdx = 0; IngIdx < IngredientCount; ++IngIdx)
             {
-                if (!Slot.DemandKnowledgeHandles.IsValidIndex(IngIdx))
-                {
-                    continue;
-                }
-                if (!Slot.DemandKnowledgeHandles[IngIdx].IsValid())
+                if (!Slot.DemandKnowledgeHandles.IsValidIndex(IngIdx) || !Slot.DemandKnowledgeHandles[IngIdx].IsValid())
                 {
                     continue;
                 }
 
-                const FArcRecipeIngredient* BaseIngredient = Slot.DesiredRecipe->GetIngredientBase(IngIdx);
-                if (!BaseIngredient)
+                FNode ConsumerNode;
+                if (Private::MakeIngredientConsumer(*Slot.DesiredRecipe, IngIdx, BuildingHandle, BuildingName, ConsumerNode))
                 {
-                    continue;
+                    IngredientSeeds.Add(ConsumerNode);
                 }
+            }
+        }
+    }
 
-                const FArcRecipeIngredient_ItemDef* ItemDefIngredient =
-                    Slot.DesiredRecipe->GetIngredient<FArcRecipeIngredient_ItemDef>(IngIdx);
-                const FArcRecipeIngredient_Tags* TagsIngredient =
-                    Slot.DesiredRecipe->GetIngredient<FArcRecipeIngredient_Tags>(IngIdx);
+    return true;
+}
 
-                const int32 ConsumerIdx = Nodes.Num();
+// -------------------------------------------------------------------------
+// FDemandGraph
+// -------------------------------------------------------------------------
 
-                FNode ConsumerNode;
-                ConsumerNode.Type = ENodeType::Consumer;
-                ConsumerNode.Entity = BuildingHandle;
-                ConsumerNode.BuildingName = BuildingFrag->BuildingName;
-                ConsumerNode.DemandQuantity = BaseIngredient->Amount;
-                ConsumerNode.Status = ENodeStatus::UnmetDemand;
+void FDemandGraph::Reset()
+{
+    Nodes.Reset();
+    Edges.Reset();
+}
 
-                if (ItemDefIngredient && ItemDefIngredient->ItemDefinitionId.IsValid())
-                {
-                    UArcItemDefinition* IngItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(
-                        ItemDefIngredient->ItemDefinitionId.AssetId);
-                    ConsumerNode.ItemDef = IngItemDef;
-                }
-                else if (TagsIngredient)
-                {
-                    ConsumerNode.ItemTag = TagsIngredient->RequiredTags.IsEmpty()
-                        ? FGameplayTag()
-                        : TagsIngredient->RequiredTags.First();
-                }
-                else
-                {
-                    continue;
-                }
+void FDemandGraph::UpdateSettlementNode(const FArcSettlementMarketFragment& Market)
+{
+    if (!Nodes.IsValidIndex(0))
+    {
+        return;
+    }
+
+    FNode& SettlementNode = Nodes[0];
+    SettlementNode.CurrentStock = Market.CurrentTotalStorage;
+    SettlementNode.StorageCap = Market.TotalStorageCap;
+    SettlementNode.bBackpressured = (Market.CurrentTotalStorage >= Market.TotalStorageCap);
+    SettlementNode.Status = SettlementNode.bBackpressured ? ENodeStatus::Backpressured : ENodeStatus::Flowing;
+}
 
-                Nodes.Add(ConsumerNode);
-                BFSQueue.Add(ConsumerIdx);
+void FDemandGraph::Rebuild(
+    FMassEntityManager& EntityManager,
+    FMassEntityHandle SettlementEntity,
+    const TArray<FMassEntityHandle>& BuildingHandles,
+    const FArcSettlementMarketFragment& Market)
+{
+    TArray<FBuildingRecord> Records;
+    Records.Reserve(BuildingHandles.Num());
+    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
+    {
+        FBuildingRecord Record;
+        if (Record.Build(EntityManager, BuildingHandle))
+        {
+            Records.Add(MoveTemp(Record));
+        }
+    }
+
+    TArray<const FBuildingRecord*> RecordPtrs;
+    RecordPtrs.Reserve(Records.Num());
+    for (const FBuildingRecord& Record : Records)
+    {
+        RecordPtrs.Add(&Record);
+    }
+
+    BuildFromRecords(SettlementEntity, Market, RecordPtrs);
+}
+
+void FDemandGraph::BuildFromRecords(
+    FMassEntityHandle SettlementEntity,
+    const FArcSettlementMarketFragment& Market,
+    TConstArrayView<const FBuildingRecord*> Records)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ArcDemandGraph_BuildFromRecords);
+
+    Reset();
+    ++Version;
+
+    // Node 0 is always the settlement node.
+    {
+        FNode SettlementNode;
+        SettlementNode.Type = ENodeType::Settlement;
+        SettlementNode.Entity = SettlementEntity;
+        Nodes.Add(SettlementNode);
+        UpdateSettlementNode(Market);
+    }
+
+    // -------------------------------------------------------------------------
+    // Pass 1: Producer indexes
+    // Output item def -> buildings that could produce it (potential), and the
+    // first building actively producing it (recipe slot or gathering).
+    // -------------------------------------------------------------------------
+    struct FActiveProducerRef
+    {
+        const FBuildingRecord* Record = nullptr;
+        const FActiveOutput* Output = nullptr;
+    };
+
+    TMap<TObjectPtr<UArcItemDefinition>, TArray<const FPotentialProducer*>> PotentialProducerIndex;
+    TMap<TObjectPtr<UArcItemDefinition>, FActiveProducerRef> ActiveRecipeProducers;
+    TMap<TObjectPtr<UArcItemDefinition>, FActiveProducerRef> ActiveGatherProducers;
+    TMap<FMassEntityHandle, const FBuildingRecord*> RecordsByHandle;
+    RecordsByHandle.Reserve(Records.Num());
+
+    for (const FBuildingRecord* Record : Records)
+    {
+        RecordsByHandle.Add(Record->BuildingHandle, Record);
+
+        for (const FPotentialProducer& Potential : Record->PotentialProducers)
+        {
+            PotentialProducerIndex.FindOrAdd(Potential.OutputItemDef).Add(&Potential);
+        }
+
+        for (const FActiveOutput& Output : Record->ActiveOutputs)
+        {
+            TMap<TObjectPtr<UArcItemDefinition>, FActiveProducerRef>& Index = Output.bGathering ? ActiveGatherProducers : ActiveRecipeProducers;
+            if (!Index.Contains(Output.ItemDef))
+            {
+                Index.Add(Output.ItemDef, FActiveProducerRef{Record, &Output});
             }
         }
     }
 
+    // -------------------------------------------------------------------------
+    // Pass 2: Seed consumer nodes
+    // Consumption needs first, then production input needs, in building order.
+    // -------------------------------------------------------------------------
+    TArray<int32> BFSQueue;
+
+    for (const FBuildingRecord* Record : Records)
+    {
+        for (const FNode& Seed : Record->ConsumptionSeeds)
+        {
+            BFSQueue.Add(Nodes.Add(Seed));
+        }
+    }
+
+    for (const FBuildingRecord* Record : Records)
+    {
+        for (const FNode& Seed : Record->IngredientSeeds)
+        {
+            BFSQueue.Add(Nodes.Add(Seed));
+        }
+    }
+
     // -------------------------------------------------------------------------
     // Pass 3: Demand-pull BFS
     // For each consumer node in the queue, try to find or create a producer.
     // If a producer is found, link with an edge and set consumer status to Flowing.
     // If the producer is a potential one, enqueue its ingredient consumers too.
     // -------------------------------------------------------------------------
+    TMap<TObjectPtr<UArcItemDefinition>, int32> ActiveProducerNodes;
+    TSet<FChainLink> VisitedChainLinks;
+
+    auto FindOrCreateActiveProducer = [this, &ActiveProducerNodes, &ActiveRecipeProducers, &ActiveGatherProducers](UArcItemDefinition* ItemDef) -> int32
+    {
+        if (const int32* Existing = ActiveProducerNodes.Find(ItemDef))
+        {
+            return *Existing;
+        }
+
+        const FActiveProducerRef* Ref = ActiveRecipeProducers.Find(ItemDef);
+        if (!Ref)
+        {
+            Ref = ActiveGatherProducers.Find(ItemDef);
+        }
+        if (!Ref)
+        {
+            return INDEX_NONE;
+        }
+
+        FNode ProducerNode;
+        ProducerNode.Type = ENodeType::Producer;
+        ProducerNode.Entity = Ref->Record->BuildingHandle;
+        ProducerNode.BuildingName = Ref->Record->BuildingName;
+        ProducerNode.ItemDef = ItemDef;
+        Private::ApplyActiveProducerState(ProducerNode, *Ref->Record, *Ref->Output);
+
+        const int32 ProducerIdx = Nodes.Add(ProducerNode);
+        ActiveProducerNodes.Add(ItemDef, ProducerIdx);
+        return ProducerIdx;
+    };
+
+    auto CreatePotentialProducer = [this, &RecordsByHandle, &BFSQueue](const FPotentialProducer& Potential) -> int32
+    {
+        FNode ProducerNode;
+        ProducerNode.Type = ENodeType::Producer;
+        ProducerNode.Status = ENodeStatus::Potential;
+        ProducerNode.Entity = Potential.BuildingHandle;
+        ProducerNode.BuildingName = Potential.BuildingName;
+        ProducerNode.ItemDef = Potential.OutputItemDef;
+
+        if (const FBuildingRecord* const* Record = RecordsByHandle.Find(Potential.BuildingHandle))
+        {
+            ProducerNode.StorageCap = (*Record)->StorageCap;
+            ProducerNode.CurrentStock = (*Record)->CurrentOutputCount;
+        }
+
+        const int32 ProducerIdx = Nodes.Add(ProducerNode);
+
+        // Enqueue consumer nodes for each ingredient.
+        for (const FNode& InputNode : Potential.InputNodes)
+        {
+            BFSQueue.Add(Nodes.Add(InputNode));
+        }
+
+        return ProducerIdx;
+    };
+
+    auto TryPotentialProducers = [&VisitedChainLinks, &CreatePotentialProducer](const TArray<const FPotentialProducer*>& PotentialList) -> int32
+    {
+        for (const FPotentialProducer* Potential : PotentialList)
+        {
+            FChainLink ChainKey;
+            ChainKey.BuildingHandle = Potential->BuildingHandle;
+            ChainKey.Recipe = Potential->Recipe;
+
+            if (VisitedChainLinks.Contains(ChainKey))
+            {
+                continue;
+            }
+
+            VisitedChainLinks.Add(ChainKey);
+            // Use first viable potential producer.
+            return CreatePotentialProducer(*Potential);
+        }
+        return INDEX_NONE;
+    };
+
     for (int32 QueuePos = 0; QueuePos < BFSQueue.Num(); ++QueuePos)
     {
         const int32 ConsumerIdx = BFSQueue[QueuePos];
         // Note: Nodes array may grow during BFS; fetch by index each iteration.
-        FNode& ConsumerNode = Nodes[ConsumerIdx];
-
-        UArcItemDefinition* NeedItemDef = ConsumerNode.ItemDef;
-        const FGameplayTag NeedItemTag = ConsumerNode.ItemTag;
+        UArcItemDefinition* NeedItemDef = Nodes[ConsumerIdx].ItemDef;
+        const FGameplayTag NeedItemTag = Nodes[ConsumerIdx].ItemTag;
 
         int32 ProducerIdx = INDEX_NONE;
 
         if (NeedItemDef)
         {
             // 1. Try active producer first (building with DesiredRecipe).
-            ProducerIdx = FindOrCreateActiveProducer(EntityManager, NeedItemDef, BuildingHandles);
+            ProducerIdx = FindOrCreateActiveProducer(NeedItemDef);
 
             // 2. If no active producer, look in PotentialProducerIndex.
             if (ProducerIdx == INDEX_NONE)
             {
-                TArray<FPotentialProducer>* PotentialList = PotentialProducerIndex.Find(
-                    TObjectPtr<UArcItemDefinition>(NeedItemDef));
-                if (PotentialList)
+                if (const TArray<const FPotentialProducer*>* PotentialList = PotentialProducerIndex.Find(NeedItemDef))
                 {
-                    for (const FPotentialProducer& Potential : *PotentialList)
-                    {
-                        FChainLink ChainKey;
-                        ChainKey.BuildingHandle = Potential.BuildingHandle;
-                        ChainKey.Recipe = Potential.Recipe;
-
-                        if (VisitedChainLinks.Contains(ChainKey))
-                        {
-                            continue;
-                        }
-
-                        VisitedChainLinks.Add(ChainKey);
-                        ProducerIdx = CreatePotentialProducerAndEnqueueInputs(EntityManager, Potential, BFSQueue);
-                        // Use first viable potential producer.
-                        break;
-                    }
+                    ProducerIdx = TryPotentialProducers(*PotentialList);
                 }
             }
         }
         else if (NeedItemTag.IsValid())
         {
-            // Tag-based: try active producers first.
-            for (const TPair<TObjectPtr<UArcItemDefinition>, TArray<FPotentialProducer>>& PotentialEntry : PotentialProducerIndex)
+            for (const TPair<TObjectPtr<UArcItemDefinition>, TArray<const FPotentialProducer*>>& PotentialEntry : PotentialProducerIndex)
             {
-                const UArcItemDefinition* KeyItemDef = PotentialEntry.Key;
+                UArcItemDefinition* KeyItemDef = PotentialEntry.Key;
                 if (!KeyItemDef)
                 {
                     continue;
@@ -573,32 +533,11 @@ void FDemandGraph::Rebuild(
                     continue;
                 }
 
-                // Try active producer for this item def.
-                ProducerIdx = FindOrCreateActiveProducer(
-                    EntityManager,
-                    const_cast<UArcItemDefinition*>(KeyItemDef),
-                    BuildingHandles);
-
-                if (ProducerIdx != INDEX_NONE)
+                // Try active producer for this item def, then the first potential one.
+                ProducerIdx = FindOrCreateActiveProducer(KeyItemDef);
+                if (ProducerIdx == INDEX_NONE)
                 {
-                    break;
-                }
-
-                // No active producer; use first potential one.
-                for (const FPotentialProducer& Potential : PotentialEntry.Value)
-                {
-                    FChainLink ChainKey;
-                    ChainKey.BuildingHandle = Potential.BuildingHandle;
-                    ChainKey.Recipe = Potential.Recipe;
-
-                    if (VisitedChainLinks.Contains(ChainKey))
-                    {
-                        continue;
-                    }
-
-                    VisitedChainLinks.Add(ChainKey);
-                    ProducerIdx = CreatePotentialProducerAndEnqueueInputs(EntityManager, Potential, BFSQueue);
-                    break;
+                    ProducerIdx = TryPotentialProducers(PotentialEntry.Value);
                 }
 
                 if (ProducerIdx != INDEX_NONE)
@@ -684,4 +623,245 @@ void FDemandGraph::FindBottlenecks(TArray<FBottleneckEntry>& OutBottlenecks) con
     }
 }
 
+// -------------------------------------------------------------------------
+// FIncrementalDemandGraph
+// -------------------------------------------------------------------------
+
+void FIncrementalDemandGraph::MarkBuildingDirty(FMassEntityHandle BuildingHandle)
+{
+    DirtyBuildings.Add(BuildingHandle);
+}
+
+void FIncrementalDemandGraph::RemoveBuilding(FMassEntityHandle BuildingHandle)
+{
+    Records.Remove(BuildingHandle);
+    DirtyBuildings.Remove(BuildingHandle);
+    bStructureDirty = true;
+}
+
+bool FIncrementalDemandGraph::HasSameShape(const FBuildingRecord& Old, const FBuildingRecord& New)
+{
+    if (Old.BuildingName != New.BuildingName
+        || Old.ActiveOutputs.Num() != New.ActiveOutputs.Num()
+        || Old.PotentialProducers.Num() != New.PotentialProducers.Num()
+        || Old.ConsumptionSeeds.Num() != New.ConsumptionSeeds.Num()
+        || Old.IngredientSeeds.Num() != New.IngredientSeeds.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Old.ActiveOutputs.Num(); ++Index)
+    {
+        const FActiveOutput& A = Old.ActiveOutputs[Index];
+        const FActiveOutput& B = New.ActiveOutputs[Index];
+        if (A.ItemDef != B.ItemDef || A.bGathering != B.bGathering)
+        {
+            return false;
+        }
+    }
+
+    // Input nodes derive from the recipe alone.
+    for (int32 Index = 0; Index < Old.PotentialProducers.Num(); ++Index)
+    {
+        const FPotentialProducer& A = Old.PotentialProducers[Index];
+        const FPotentialProducer& B = New.PotentialProducers[Index];
+        if (A.Recipe != B.Recipe || A.OutputItemDef != B.OutputItemDef)
+        {
+            return false;
+        }
+    }
+
+    // Consumption seed quantities are patched; ingredient seed quantities come from the recipe and feed
+    // potential producer chains, so they are part of the shape.
+    for (int32 Index = 0; Index < Old.ConsumptionSeeds.Num(); ++Index)
+    {
+        const FNode& A = Old.ConsumptionSeeds[Index];
+        const FNode& B = New.ConsumptionSeeds[Index];
+        if (A.ItemDef != B.ItemDef || A.ItemTag != B.ItemTag)
+        {
+            return false;
+        }
+    }
+
+    for (int32 Index = 0; Index < Old.IngredientSeeds.Num(); ++Index)
+    {
+        const FNode& A = Old.IngredientSeeds[Index];
+        const FNode& B = New.IngredientSeeds[Index];
+        if (A.ItemDef != B.ItemDef || A.ItemTag != B.ItemTag || A.DemandQuantity != B.DemandQuantity)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FIncrementalDemandGraph::IndexGraph(TConstArrayView<const FBuildingRecord*> OrderedRecords)
+{
+    NodesByBuilding.Reset();
+
+    int32 SeedNodeIdx = 1;
+    for (const FBuildingRecord* Record : OrderedRecords)
+    {
+        FBuildingNodes& BuildingNodes = NodesByBuilding.Add(Record->BuildingHandle);
+        BuildingNodes.FirstConsumptionSeed = SeedNodeIdx;
+        SeedNodeIdx += Record->ConsumptionSeeds.Num();
+    }
+
+    for (int32 NodeIdx = 0; NodeIdx < Graph.Nodes.Num(); ++NodeIdx)
+    {
+        const FNode& Node = Graph.Nodes[NodeIdx];
+        if (Node.Type != ENodeType::Producer)
+        {
+            continue;
+        }
+
+        if (FBuildingNodes* BuildingNodes = NodesByBuilding.Find(Node.Entity))
+        {
+            BuildingNodes->Producers.Add(NodeIdx);
+        }
+    }
+
+    EdgeByConsumer.Init(INDEX_NONE, Graph.Nodes.Num());
+    for (int32 EdgeIdx = 0; EdgeIdx < Graph.Edges.Num(); ++EdgeIdx)
+    {
+        EdgeByConsumer[Graph.Edges[EdgeIdx].ConsumerIdx] = EdgeIdx;
+    }
+}
+
+void FIncrementalDemandGraph::PatchBuilding(const FBuildingRecord& Record)
+{
+    const FBuildingNodes* BuildingNodes = NodesByBuilding.Find(Record.BuildingHandle);
+    if (!BuildingNodes)
+    {
+        return;
+    }
+
+    for (int32 SeedIdx = 0; SeedIdx < Record.ConsumptionSeeds.Num(); ++SeedIdx)
+    {
+        const int32 NodeIdx = BuildingNodes->FirstConsumptionSeed + SeedIdx;
+        FNode& Node = Graph.Nodes[NodeIdx];
+        const ENodeStatus Status = Node.Status;
+        Node = Record.ConsumptionSeeds[SeedIdx];
+        Node.Status = Status;
+
+        if (EdgeByConsumer[NodeIdx] != INDEX_NONE)
+        {
+            Graph.Edges[EdgeByConsumer[NodeIdx]].DemandQuantity = Node.DemandQuantity;
+        }
+    }
+
+    for (const int32 ProducerIdx : BuildingNodes->Producers)
+    {
+        FNode& Node = Graph.Nodes[ProducerIdx];
+        if (Node.Status == ENodeStatus::Potential)
+        {
+            Node.StorageCap = Record.StorageCap;
+            Node.CurrentStock = Record.CurrentOutputCount;
+        }
+        else if (const FActiveOutput* Output = Private::FindActiveOutput(Record, Node.ItemDef))
+        {
+            Private::ApplyActiveProducerState(Node, Record, *Output);
+        }
+    }
+}
+
+bool FIncrementalDemandGraph::Update(
+    FMassEntityManager& EntityManager,
+    FMassEntityHandle SettlementEntity,
+    const TArray<FMassEntityHandle>& BuildingHandles,
+    const FArcSettlementMarketFragment& Market)
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(ArcDemandGraph_IncrementalUpdate);
+
+    // Membership or order change (register/unregister) invalidates BFS tie-breaking, not the records themselves.
+    if (!bStructureDirty && LastBuildingOrder != BuildingHandles)
+    {
+        bStructureDirty = true;
+    }
+
+    if (bStructureDirty)
+    {
+        for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
+        {
+            if (!Records.Contains(BuildingHandle))
+            {
+                DirtyBuildings.Add(BuildingHandle);
+            }
+        }
+    }
+
+    if (DirtyBuildings.IsEmpty() && !bStructureDirty)
+    {
+        Graph.UpdateSettlementNode(Market);
+        return false;
+    }
+
+    bool bNeedsRebuild = bStructureDirty;
+    TArray<FMassEntityHandle, TInlineAllocator<16>> PatchedBuildings;
+
+    for (const FMassEntityHandle& BuildingHandle : DirtyBuildings)
+    {
+        FBuildingRecord NewRecord;
+        const bool bValid = NewRecord.Build(EntityManager, BuildingHandle);
+        FBuildingRecord* Existing = Records.Find(BuildingHandle);
+
+        if (!bValid)
+        {
+            if (Existing)
+            {
+                Records.Remove(BuildingHandle);
+                bNeedsRebuild = true;
+            }
+            continue;
+        }
+
+        if (!Existing)
+        {
+            Records.Add(BuildingHandle, MoveTemp(NewRecord));
+            bNeedsRebuild = true;
+            continue;
+        }
+
+        if (!bNeedsRebuild && HasSameShape(*Existing, NewRecord))
+        {
+            PatchedBuildings.Add(BuildingHandle);
+        }
+        else
+        {
+            bNeedsRebuild = true;
+        }
+        *Existing = MoveTemp(NewRecord);
+    }
+    DirtyBuildings.Reset();
+
+    if (!bNeedsRebuild)
+    {
+        for (const FMassEntityHandle& BuildingHandle : PatchedBuildings)
+        {
+            PatchBuilding(Records.FindChecked(BuildingHandle));
+        }
+        Graph.UpdateSettlementNode(Market);
+        ++Graph.Version;
+        return true;
+    }
+
+    TArray<const FBuildingRecord*> OrderedRecords;
+    OrderedRecords.Reserve(BuildingHandles.Num());
+    for (const FMassEntityHandle& BuildingHandle : BuildingHandles)
+    {
+        if (const FBuildingRecord* Record = Records.Find(BuildingHandle))
+        {
+            OrderedRecords.Add(Record);
+        }
+    }
+
+    Graph.BuildFromRecords(SettlementEntity, Market, OrderedRecords);
+    IndexGraph(OrderedRecords);
+
+    LastBuildingOrder = BuildingHandles;
+    bStructureDirty = false;
+    return true;
+}
+
 } // namespace ArcDemandGraph
@@ -73,6 +73,45 @@ namespace ArcDemandGraph
         FMassEntityHandle BuildingHandle;
         TObjectPtr<UArcRecipeDefinition> Recipe = nullptr;
         FName BuildingName;
+        TObjectPtr<UArcItemDefinition> OutputItemDef = nullptr;
+
+        /** Consumer nodes for each recipe ingredient, resolved once when the owning building record is rebuilt. */
+        TArray<FNode> InputNodes;
+    };
+
+    /** An item a building is actively producing, either through a slot's DesiredRecipe or by gathering. */
+    struct FActiveOutput
+    {
+        TObjectPtr<UArcItemDefinition> ItemDef = nullptr;
+        bool bStaffed = true;
+        bool bGathering = false;
+    };
+
+    /**
+     * Everything the graph needs to know about one building, extracted from its fragments.
+     * Rebuilding a record is the only part of graph construction that touches Mass data or the asset manager.
+     */
+    struct FBuildingRecord
+    {
+        FMassEntityHandle BuildingHandle;
+        FName BuildingName;
+        int32 StorageCap = 0;
+        int32 CurrentOutputCount = 0;
+
+        /** Recipe producers first (DesiredRecipe slot order), then gathering outputs. */
+        TArray<FActiveOutput> ActiveOutputs;
+
+        /** AllowedRecipes outputs, then gathering outputs. */
+        TArray<FPotentialProducer> PotentialProducers;
+
+        /** Consumer seeds from ConsumptionNeeds below desired stock. */
+        TArray<FNode> ConsumptionSeeds;
+
+        /** Consumer seeds from halted slots with active demand handles. */
+        TArray<FNode> IngredientSeeds;
+
+        /** Reads the building's fragments. Returns false if the entity is gone or is not an economy building. */
+        bool Build(FMassEntityManager& EntityManager, FMassEntityHandle InBuildingHandle);
     };
 
     /** Key for cycle detection during demand-pull BFS: one visited (building, recipe) pair. */
@@ -92,40 +131,110 @@ namespace ArcDemandGraph
         return HashCombine(GetTypeHash(Key.BuildingHandle), GetTypeHash(Key.Recipe));
     }
 
+    /** Read-only view of a demand graph, cheap to pass around by value. */
+    struct FDemandGraphView
+    {
+        TConstArrayView<FNode> Nodes;
+        TConstArrayView<FEdge> Edges;
+
+        /** Increments whenever the underlying graph is rebuilt or patched. */
+        uint32 Version = 0;
+    };
+
     struct ARCECONOMY_API FDemandGraph
     {
         TArray<FNode> Nodes;
         TArray<FEdge> Edges;
 
+        /** Increments on every rebuild or patch so consumers can cache derived data. */
+        uint32 Version = 0;
+
+        /** Full rebuild from Mass data. Prefer UArcSettlementSubsystem::UpdateDemandGraph for per-tick use. */
         void Rebuild(
             FMassEntityManager& EntityManager,
             FMassEntityHandle SettlementEntity,
             const TArray<FMassEntityHandle>& BuildingHandles,
             const FArcSettlementMarketFragment& Market);
 
+        /**
+         * Builds the graph from already extracted building records, in the given order. Does not touch Mass data.
+         * Node 0 is the settlement, followed by every record's consumption seeds in record order.
+         */
+        void BuildFromRecords(
+            FMassEntityHandle SettlementEntity,
+            const FArcSettlementMarketFragment& Market,
+            TConstArrayView<const FBuildingRecord*> Records);
+
+        /** Refreshes the settlement root node (node 0) from the market without rebuilding. */
+        void UpdateSettlementNode(const FArcSettlementMarketFragment& Market);
+
+        FDemandGraphView GetView() const
+        {
+            return FDemandGraphView{Nodes, Edges, Version};
+        }
+
         void FindUnmetDemand(TArray<FUnmetDemandEntry>& OutUnmet) const;
         void FindBottlenecks(TArray<FBottleneckEntry>& OutBottlenecks) const;
         void Reset();
+    };
+
+    /**
+     * Persistent per-settlement demand graph. Building records are re-extracted only for buildings marked
+     * dirty (stock, staffing or recipe changes). When a fresh record has the same shape as the cached one
+     * (same outputs, recipes and seeded items), only its values changed and they are written into the
+     * building's existing nodes and edges. The demand-pull pass re-runs only for shape changes and for
+     * buildings registering, unregistering or reordering. A clean settlement costs one root-node refresh.
+     */
+    struct ARCECONOMY_API FIncrementalDemandGraph
+    {
+        void MarkBuildingDirty(FMassEntityHandle BuildingHandle);
+        void RemoveBuilding(FMassEntityHandle BuildingHandle);
+
+        /** Applies pending building deltas. Returns true if the graph was rebuilt or patched. */
+        bool Update(
+            FMassEntityManager& EntityManager,
+            FMassEntityHandle SettlementEntity,
+            const TArray<FMassEntityHandle>& BuildingHandles,
+            const FArcSettlementMarketFragment& Market);
+
+        const FDemandGraph& GetGraph() const
+        {
+            return Graph;
+        }
+
+        int32 NumDirtyBuildings() const
+        {
+            return DirtyBuildings.Num();
+        }
 
     private:
-        /** Index built in Pass 1: maps output item def to buildings that could produce it. */
-        TMap<TObjectPtr<UArcItemDefinition>, TArray<FPotentialProducer>> PotentialProducerIndex;
+        /** Nodes a building owns in the current graph. */
+        struct FBuildingNodes
+        {
+            int32 FirstConsumptionSeed = INDEX_NONE;
+            TArray<int32> Producers;
+        };
 
-        /** Cycle detection: (BuildingHandle, Recipe) pairs already visited during BFS. */
-        TSet<FChainLink> VisitedChainLinks;
+        /** True if both records seed the same nodes and offer the same producers, so BFS would link them identically. */
+        static bool HasSameShape(const FBuildingRecord& Old, const FBuildingRecord& New);
 
-        /** Find or create an active producer node for a building that already has DesiredRecipe outputting ItemDef.
-         *  Returns INDEX_NONE if none found. */
-        int32 FindOrCreateActiveProducer(
-            FMassEntityManager& EntityManager,
-            UArcItemDefinition* ItemDef,
-            const TArray<FMassEntityHandle>& BuildingHandles);
+        /** Rebuilds the node and edge lookups PatchBuilding relies on. */
+        void IndexGraph(TConstArrayView<const FBuildingRecord*> OrderedRecords);
 
-        /** Create a potential producer node and enqueue its input ingredients as new consumer nodes.
-         *  Returns the index of the created producer node. */
-        int32 CreatePotentialProducerAndEnqueueInputs(
-            FMassEntityManager& EntityManager,
-            const FPotentialProducer& Producer,
-            TArray<int32>& BFSQueue);
+        /** Writes stock, demand and staffing from Record into the building's nodes and edges. */
+        void PatchBuilding(const FBuildingRecord& Record);
+
+        TMap<FMassEntityHandle, FBuildingRecord> Records;
+        TSet<FMassEntityHandle> DirtyBuildings;
+        FDemandGraph Graph;
+
+        TMap<FMassEntityHandle, FBuildingNodes> NodesByBuilding;
+
+        /** Edge index per node, INDEX_NONE for nodes that are not a linked consumer. */
+        TArray<int32> EdgeByConsumer;
+
+        /** Building order the last graph was built with. A change in membership forces a rebuild. */
+        TArray<FMassEntityHandle> LastBuildingOrder;
+        bool bStructureDirty = true;
     };
 }
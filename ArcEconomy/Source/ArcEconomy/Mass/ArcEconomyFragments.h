@@ -10,6 +10,7 @@
 #include "ArcKnowledgeTypes.h"
 #include "ArcMass/PlacedEntities/ArcEntityRef.h"
 #include "Strategy/ArcStrategyTypes.h"
+#include "Mass/ArcMarketPriceTable.h"
 #include "ArcEconomyFragments.generated.h"
 
 class UArcItemDefinition;
@@ -61,6 +62,9 @@ struct ARCECONOMY_API FArcResourceMarketData
      *  Maintained by ArcBuildingSupplyProcessor each tick. */
     UPROPERTY()
     TArray<FArcMarketSupplySource> SupplySources;
+
+    /** Slot in FArcSettlementMarketFragment::PriceArrays. Session-local, bound by ArcMarket::FindOrAddEntry/BindEntries. */
+    int32 ResourceId = INDEX_NONE;
 };
 
 USTRUCT()
@@ -105,9 +109,16 @@ struct ARCECONOMY_API FArcSettlementMarketFragment : public FMassFragment
 {
     GENERATED_BODY()
 
+    /**
+     * Per-item view of the market, kept for lookups by item and for persistence.
+     * Prices and counters must be written through ArcMarket helpers so PriceArrays stays in sync.
+     */
     UPROPERTY()
     TMap<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData> PriceTable;
 
+    /** Dense price/supply/demand/stock arrays indexed by global resource id. Drives the pricing pass. */
+    FArcMarketPriceArrays PriceArrays;
+
     /** Price adjustment speed. Higher = more volatile. */
     UPROPERTY(EditAnywhere, Category = "Market")
     float K = 0.3f;
@@ -223,6 +234,9 @@ struct ARCECONOMY_API FArcBuildingFragment : public FMassFragment
     UPROPERTY()
     TArray<FArcKnowledgeHandle> ConsumptionDemandHandles;
 
+    /** Hash of per-need deficits from the last consumption pass. A change marks the building dirty for the demand graph. */
+    uint32 ConsumptionDeficitSignature = 0;
+
     /** Debug-only: when false, governor skips this building entirely. */
     UPROPERTY()
     bool bProductionEnabled = true;
@@ -80,7 +80,8 @@ namespace ArcGovernor
         TArray<FNPCData> NPCs;
         UArcAreaSubsystem* AreaSubsystem;
         UArcMassSpatialHashSubsystem* SpatialHashSubsystem;
-        ArcDemandGraph::FDemandGraph DemandGraph;
+        /** Snapshot of the settlement's persistent demand graph, owned by UArcSettlementSubsystem. */
+        ArcDemandGraph::FDemandGraphView DemandGraph;
 
         /** Settlement need values snapshot. Empty if no needs configured. */
         TMap<UScriptStruct*, float> NeedValues;
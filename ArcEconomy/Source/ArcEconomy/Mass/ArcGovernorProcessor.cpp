@@ -113,13 +113,13 @@ void UArcGovernorProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
                     if (NeedView.IsValid())
                     {
                         const FArcNeedFragment& Need = NeedView.Get<FArcNeedFragment>();
-                        GovCtx.NeedValues.Add(ConfigPair.Key, Need.CurrentValue);
+                        GovCtx.NeedValues.Add(ConfigPair.Key, Need.GetValue(WorldTime));
                     }
                 }
             }
 
-            // Build the demand graph for this settlement
-            GovCtx.DemandGraph.Rebuild(EntityManager, SettlementEntity, BuildingHandles, Market);
+            // Bring the settlement's demand graph up to date (only dirty buildings are re-read)
+            GovCtx.DemandGraph = SettlementSub->UpdateDemandGraph(EntityManager, SettlementEntity, Market).GetView();
 
             // Drain debug command queue (if debugger has injected commands)
             FArcDebugCommandQueueFragment* DebugQueue = EntityManager.GetFragmentDataPtr<FArcDebugCommandQueueFragment>(SettlementEntity);
@@ -139,6 +139,7 @@ void UArcGovernorProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
                     if (DebugWorkforce && DebugWorkforce->Slots.IsValidIndex(DebugSlotChange.SlotIndex))
                     {
                         DebugWorkforce->Slots[DebugSlotChange.SlotIndex].DesiredRecipe = DebugSlotChange.NewDesiredRecipe;
+                        SettlementSub->MarkBuildingDirty(SettlementEntity, DebugSlotChange.BuildingHandle);
                     }
                 }
                 AllSlotChanges.Append(MoveTemp(DebugQueue->PendingSlotChanges));
@@ -162,6 +163,7 @@ void UArcGovernorProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
                 if (Workforce && Workforce->Slots.IsValidIndex(Change.SlotIndex))
                 {
                     Workforce->Slots[Change.SlotIndex].DesiredRecipe = Change.NewDesiredRecipe;
+                    SettlementSub->MarkBuildingDirty(SettlementEntity, Change.BuildingHandle);
                 }
             }
 
@@ -291,6 +293,11 @@ void UArcGovernorProcessor::Execute(FMassEntityManager& EntityManager, FMassExec
                 if (Workforce && Workforce->Slots.IsValidIndex(Change.SlotIndex))
                 {
                     Workforce->Slots[Change.SlotIndex].DesiredRecipe = Change.NewDesiredRecipe;
+
+                    if (const FArcBuildingFragment* Building = Mgr.GetFragmentDataPtr<FArcBuildingFragment>(Change.BuildingHandle))
+                    {
+                        SettlementSub->MarkBuildingDirty(Building->SettlementHandle, Change.BuildingHandle);
+                    }
                 }
             }
 
@@ -0,0 +1,224 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "Mass/ArcMarketPriceTable.h"
+#include "Mass/ArcEconomyFragments.h"
+#include "Items/ArcItemDefinition.h"
+#include "ArcItemEconomyFragment.h"
+
+namespace ArcMarket
+{
+    // -------------------------------------------------------------------------
+    // FResourceRegistry
+    // -------------------------------------------------------------------------
+
+    FResourceRegistry& FResourceRegistry::Get()
+    {
+        static FResourceRegistry Registry;
+        return Registry;
+    }
+
+    int32 FResourceRegistry::FindOrAddResourceId(const UArcItemDefinition* ItemDef)
+    {
+        check(IsInGameThread());
+
+        if (!ItemDef)
+        {
+            return INDEX_NONE;
+        }
+
+        const FObjectKey Key(ItemDef);
+        if (const int32* Existing = IdByItem.Find(Key))
+        {
+            return *Existing;
+        }
+
+        // Items without pricing data keep price 0 and are never clamped.
+        float BasePrice = 0.0f;
+        float MinPrice = 0.0f;
+        float MaxPrice = TNumericLimits<float>::Max();
+        float Elasticity = 1.0f;
+        if (const FArcItemEconomyFragment* EconFragment = ItemDef->FindFragment<FArcItemEconomyFragment>())
+        {
+            BasePrice = EconFragment->BasePrice;
+            MinPrice = EconFragment->MinPrice;
+            MaxPrice = EconFragment->MaxPrice;
+            Elasticity = EconFragment->PriceElasticity;
+        }
+
+        const int32 NewId = BasePrices.Add(BasePrice);
+        MinPrices.Add(MinPrice);
+        MaxPrices.Add(MaxPrice);
+        Elasticities.Add(Elasticity);
+        IdByItem.Add(Key, NewId);
+        return NewId;
+    }
+
+    int32 FResourceRegistry::FindResourceId(const UArcItemDefinition* ItemDef) const
+    {
+        const int32* Existing = IdByItem.Find(FObjectKey(ItemDef));
+        return Existing ? *Existing : INDEX_NONE;
+    }
+
+    // -------------------------------------------------------------------------
+    // Entry binding and writes
+    // -------------------------------------------------------------------------
+
+    namespace Private
+    {
+        void BindEntry(FArcMarketPriceArrays& Arrays, const UArcItemDefinition* ItemDef, FArcResourceMarketData& Entry)
+        {
+            Entry.ResourceId = FResourceRegistry::Get().FindOrAddResourceId(ItemDef);
+            if (Entry.ResourceId == INDEX_NONE)
+            {
+                return;
+            }
+
+            Arrays.EnsureNum(Entry.ResourceId + 1);
+            Arrays.Prices[Entry.ResourceId] = Entry.Price;
+            Arrays.SupplyCounters[Entry.ResourceId] = Entry.SupplyCounter;
+            Arrays.DemandCounters[Entry.ResourceId] = Entry.DemandCounter;
+        }
+    }
+
+    FArcResourceMarketData& FindOrAddEntry(FArcSettlementMarketFragment& Market, UArcItemDefinition* ItemDef)
+    {
+        FArcResourceMarketData& Entry = Market.PriceTable.FindOrAdd(ItemDef);
+        if (Entry.ResourceId == INDEX_NONE)
+        {
+            if (Entry.Price <= 0.0f)
+            {
+                const int32 ResourceId = FResourceRegistry::Get().FindOrAddResourceId(ItemDef);
+                if (ResourceId != INDEX_NONE)
+                {
+                    Entry.Price = FResourceRegistry::Get().GetBasePrices()[ResourceId];
+                }
+            }
+            Private::BindEntry(Market.PriceArrays, ItemDef, Entry);
+        }
+        return Entry;
+    }
+
+    void BindEntries(FArcSettlementMarketFragment& Market)
+    {
+        for (TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& Pair : Market.PriceTable)
+        {
+            if (Pair.Value.ResourceId == INDEX_NONE)
+            {
+                Private::BindEntry(Market.PriceArrays, Pair.Key, Pair.Value);
+            }
+        }
+    }
+
+    void AddSupply(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Amount)
+    {
+        Entry.SupplyCounter += Amount;
+        if (Market.PriceArrays.SupplyCounters.IsValidIndex(Entry.ResourceId))
+        {
+            Market.PriceArrays.SupplyCounters[Entry.ResourceId] = Entry.SupplyCounter;
+        }
+    }
+
+    void AddDemand(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Amount)
+    {
+        Entry.DemandCounter += Amount;
+        if (Market.PriceArrays.DemandCounters.IsValidIndex(Entry.ResourceId))
+        {
+            Market.PriceArrays.DemandCounters[Entry.ResourceId] = Entry.DemandCounter;
+        }
+    }
+
+    void SetPrice(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Price)
+    {
+        Entry.Price = Price;
+        if (Market.PriceArrays.Prices.IsValidIndex(Entry.ResourceId))
+        {
+            Market.PriceArrays.Prices[Entry.ResourceId] = Price;
+        }
+    }
+
+    void ResetCounters(FArcSettlementMarketFragment& Market)
+    {
+        for (TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& Pair : Market.PriceTable)
+        {
+            Pair.Value.SupplyCounter = 0.0f;
+            Pair.Value.DemandCounter = 0.0f;
+        }
+        FMemory::Memzero(Market.PriceArrays.SupplyCounters.GetData(), Market.PriceArrays.SupplyCounters.Num() * sizeof(float));
+        FMemory::Memzero(Market.PriceArrays.DemandCounters.GetData(), Market.PriceArrays.DemandCounters.Num() * sizeof(float));
+    }
+
+    // -------------------------------------------------------------------------
+    // Pricing pass
+    // -------------------------------------------------------------------------
+
+    void UpdatePrices(FArcMarketPriceArrays& Arrays, float K)
+    {
+        const FResourceRegistry& Registry = FResourceRegistry::Get();
+        const int32 Num = Arrays.Num();
+        check(Registry.Num() >= Num);
+
+        float* RESTRICT Prices = Arrays.Prices.GetData();
+        float* RESTRICT Supply = Arrays.SupplyCounters.GetData();
+        float* RESTRICT Demand = Arrays.DemandCounters.GetData();
+        const float* RESTRICT MinPrices = Registry.GetMinPrices().GetData();
+        const float* RESTRICT MaxPrices = Registry.GetMaxPrices().GetData();
+        const float* RESTRICT Elasticities = Registry.GetElasticities().GetData();
+
+        const VectorRegister4Float VecK = VectorSetFloat1(K);
+        const VectorRegister4Float VecOne = VectorSetFloat1(1.0f);
+
+        int32 Idx = 0;
+        for (; Idx + 4 <= Num; Idx += 4)
+        {
+            const VectorRegister4Float S = VectorLoad(Supply + Idx);
+            const VectorRegister4Float D = VectorLoad(Demand + Idx);
+            const VectorRegister4Float MaxSD = VectorMax(VectorMax(S, D), VecOne);
+            const VectorRegister4Float Pressure = VectorDivide(VectorSubtract(D, S), MaxSD);
+            const VectorRegister4Float Rate = VectorMultiply(VecK, VectorLoad(Elasticities + Idx));
+
+            VectorRegister4Float P = VectorMultiply(VectorLoad(Prices + Idx), VectorMultiplyAdd(Rate, Pressure, VecOne));
+            P = VectorMin(VectorMax(P, VectorLoad(MinPrices + Idx)), VectorLoad(MaxPrices + Idx));
+            VectorStore(P, Prices + Idx);
+        }
+
+        for (; Idx < Num; ++Idx)
+        {
+            const float MaxSD = FMath::Max3(Supply[Idx], Demand[Idx], 1.0f);
+            const float P = Prices[Idx] * (1.0f + K * Elasticities[Idx] * (Demand[Idx] - Supply[Idx]) / MaxSD);
+            Prices[Idx] = FMath::Clamp(P, MinPrices[Idx], MaxPrices[Idx]);
+        }
+
+        FMemory::Memzero(Supply, Num * sizeof(float));
+        FMemory::Memzero(Demand, Num * sizeof(float));
+    }
+
+    int32 RunPricingPass(FArcSettlementMarketFragment& Market)
+    {
+        FArcMarketPriceArrays& Arrays = Market.PriceArrays;
+        UpdatePrices(Arrays, Market.K);
+
+        // Single walk over the view: mirror prices, clear counters, refresh dense stock.
+        int32 TotalStorage = 0;
+        for (TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& Pair : Market.PriceTable)
+        {
+            FArcResourceMarketData& Entry = Pair.Value;
+            Entry.SupplyCounter = 0.0f;
+            Entry.DemandCounter = 0.0f;
+
+            int32 ItemStock = 0;
+            for (const FArcMarketSupplySource& Source : Entry.SupplySources)
+            {
+                ItemStock += Source.Quantity;
+            }
+            TotalStorage += ItemStock;
+
+            if (Arrays.Prices.IsValidIndex(Entry.ResourceId))
+            {
+                Entry.Price = Arrays.Prices[Entry.ResourceId];
+                Arrays.Stock[Entry.ResourceId] = ItemStock;
+            }
+        }
+
+        return TotalStorage;
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UArcItemDefinition;
+struct FArcSettlementMarketFragment;
+struct FArcResourceMarketData;
+
+// ============================================================================
+// Dense Market Price Tables
+// ============================================================================
+
+/**
+ * Per-settlement market state in structure-of-arrays form, indexed by global resource id
+ * (ArcMarket::FResourceRegistry). Slots for resources the settlement has never traded stay zero.
+ * Runtime only; FArcSettlementMarketFragment::PriceTable carries the persistent copy.
+ */
+struct ARCECONOMY_API FArcMarketPriceArrays
+{
+    TArray<float> Prices;
+    TArray<float> SupplyCounters;
+    TArray<float> DemandCounters;
+
+    /** Sum of SupplySources quantities, refreshed by the market pricing pass. */
+    TArray<int32> Stock;
+
+    int32 Num() const
+    {
+        return Prices.Num();
+    }
+
+    void EnsureNum(int32 InNum)
+    {
+        if (Prices.Num() < InNum)
+        {
+            Prices.SetNumZeroed(InNum);
+            SupplyCounters.SetNumZeroed(InNum);
+            DemandCounters.SetNumZeroed(InNum);
+            Stock.SetNumZeroed(InNum);
+        }
+    }
+};
+
+namespace ArcMarket
+{
+    /**
+     * Process-wide item definition -> dense resource id map, with pricing bounds resolved once from
+     * FArcItemEconomyFragment. Ids are stable for the session and never saved.
+     * Registration is game thread only; reads are safe from parallel passes the game thread waits on.
+     */
+    class ARCECONOMY_API FResourceRegistry
+    {
+    public:
+        static FResourceRegistry& Get();
+
+        int32 FindOrAddResourceId(const UArcItemDefinition* ItemDef);
+        int32 FindResourceId(const UArcItemDefinition* ItemDef) const;
+
+        int32 Num() const
+        {
+            return BasePrices.Num();
+        }
+
+        TConstArrayView<float> GetBasePrices() const { return BasePrices; }
+        TConstArrayView<float> GetMinPrices() const { return MinPrices; }
+        TConstArrayView<float> GetMaxPrices() const { return MaxPrices; }
+        TConstArrayView<float> GetElasticities() const { return Elasticities; }
+
+    private:
+        TMap<FObjectKey, int32> IdByItem;
+        TArray<float> BasePrices;
+        TArray<float> MinPrices;
+        TArray<float> MaxPrices;
+        TArray<float> Elasticities;
+    };
+
+    /**
+     * Returns the PriceTable entry for ItemDef, creating it at the item's base price if missing,
+     * and makes sure it is bound to a slot in the dense arrays. Game thread only.
+     */
+    ARCECONOMY_API FArcResourceMarketData& FindOrAddEntry(FArcSettlementMarketFragment& Market, UArcItemDefinition* ItemDef);
+
+    /**
+     * Binds PriceTable entries that have no resource id yet (loaded or externally added). Checks every entry,
+     * since a load replaces the table without touching the runtime arrays. Game thread only.
+     */
+    ARCECONOMY_API void BindEntries(FArcSettlementMarketFragment& Market);
+
+    /** Counter/price writes. Keep the dense arrays and the PriceTable view in sync. */
+    ARCECONOMY_API void AddSupply(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Amount);
+    ARCECONOMY_API void AddDemand(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Amount);
+    ARCECONOMY_API void SetPrice(FArcSettlementMarketFragment& Market, FArcResourceMarketData& Entry, float Price);
+    ARCECONOMY_API void ResetCounters(FArcSettlementMarketFragment& Market);
+
+    /**
+     * One pricing step over the dense arrays: Price *= 1 + K * Elasticity * (Demand - Supply) / max(Supply, Demand, 1),
+     * clamped to the item's bounds, then counters reset. Touches no UObjects; safe to run per settlement in parallel.
+     */
+    ARCECONOMY_API void UpdatePrices(FArcMarketPriceArrays& Arrays, float K);
+
+    /**
+     * Runs UpdatePrices and refreshes the PriceTable view (prices, cleared counters) and dense stock from
+     * SupplySources. Returns total stock across all resources. Safe to run per settlement in parallel.
+     */
+    ARCECONOMY_API int32 RunPricingPass(FArcSettlementMarketFragment& Market);
+}
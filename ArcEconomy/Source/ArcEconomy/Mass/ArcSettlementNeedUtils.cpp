@@ -6,6 +6,7 @@
 #include "Data/ArcSettlementNeedTypes.h"
 #include "Data/ArcSettlementNeedDataAsset.h"
 #include "Fragments/ArcNeedFragment.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
 #include "Items/ArcItemDefinition.h"
 #include "Items/Fragments/ArcItemFragment_Tags.h"
 
@@ -26,6 +27,10 @@ void UpdateNeedsFromMarket(
 
     const float StorageCap = FMath::Max(1.0f, static_cast<float>(Market.TotalStorageCap));
 
+    UWorld* World = EntityManager.GetWorld();
+    UArcNeedScheduleSubsystem* NeedScheduler = World ? World->GetSubsystem<UArcNeedScheduleSubsystem>() : nullptr;
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+
     for (const TPair<TObjectPtr<UScriptStruct>, TObjectPtr<UArcSettlementNeedDataAsset>>& ConfigPair : NeedsConfig->NeedConfigs)
     {
         UScriptStruct* NeedStruct = ConfigPair.Key;
@@ -52,11 +57,18 @@ void UpdateNeedsFromMarket(
                 continue;
             }
 
-            // Sum supply quantity from all sources for this item
+            // Supply quantity from all sources for this item, summed by the market pricing pass
             int32 ItemSupply = 0;
-            for (const FArcMarketSupplySource& Source : MarketPair.Value.SupplySources)
+            if (Market.PriceArrays.Stock.IsValidIndex(MarketPair.Value.ResourceId))
             {
-                ItemSupply += Source.Quantity;
+                ItemSupply = Market.PriceArrays.Stock[MarketPair.Value.ResourceId];
+            }
+            else
+            {
+                for (const FArcMarketSupplySource& Source : MarketPair.Value.SupplySources)
+                {
+                    ItemSupply += Source.Quantity;
+                }
             }
 
             if (ItemSupply <= 0)
@@ -85,7 +97,11 @@ void UpdateNeedsFromMarket(
         if (NeedView.IsValid())
         {
             FArcNeedFragment& NeedFragment = NeedView.Get<FArcNeedFragment>();
-            NeedFragment.CurrentValue = NeedValue;
+            NeedFragment.SetValue(NeedValue, Now);
+            if (NeedScheduler)
+            {
+                NeedScheduler->ScheduleNeed(SettlementEntity, NeedStruct, NeedFragment, Now);
+            }
         }
     }
 }
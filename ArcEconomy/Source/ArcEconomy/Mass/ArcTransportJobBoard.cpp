@@ -0,0 +1,533 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "Mass/ArcTransportJobBoard.h"
+#include "Mass/ArcEconomyFragments.h"
+#include "Mass/ArcMassItemFragments.h"
+#include "ArcCraft/Mass/ArcCraftMassFragments.h"
+#include "ArcCraft/Recipe/ArcRecipeIngredient.h"
+#include "ArcCraft/Recipe/ArcRecipeDefinition.h"
+#include "Items/ArcItemDefinition.h"
+#include "Items/ArcItemSpec.h"
+#include "Items/Fragments/ArcItemFragment_Tags.h"
+#include "Core/ArcCoreAssetManager.h"
+#include "MassEntityManager.h"
+
+namespace ArcTransport
+{
+    namespace Private
+    {
+        void AppendRecipeDemands(const FArcBuildingWorkforceFragment& Workforce, TArray<FArcTransportDemandEntry>& OutEntries)
+        {
+            for (const FArcBuildingSlotData& Slot : Workforce.Slots)
+            {
+                if (Slot.HaltDuration <= 0.0f || !Slot.DesiredRecipe)
+                {
+                    continue;
+                }
+
+                const UArcRecipeDefinition* Recipe = Slot.DesiredRecipe;
+                const int32 IngredientCount = Recipe->GetIngredientCount();
+
+                for (int32 IngIdx = 0; IngIdx < IngredientCount; ++IngIdx)
+                {
+                    // Only ingredients with an active demand advertisement
+                    if (!Slot.DemandKnowledgeHandles.IsValidIndex(IngIdx) || !Slot.DemandKnowledgeHandles[IngIdx].IsValid())
+                    {
+                        continue;
+                    }
+
+                    FArcTransportDemandEntry Entry;
+
+                    const FArcRecipeIngredient_ItemDef* ItemDefIngredient = Recipe->GetIngredient<FArcRecipeIngredient_ItemDef>(IngIdx);
+                    if (ItemDefIngredient && ItemDefIngredient->ItemDefinitionId.IsValid())
+                    {
+                        Entry.ItemDefinition = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(ItemDefIngredient->ItemDefinitionId.AssetId);
+                    }
+                    else if (const FArcRecipeIngredient_Tags* TagIngredient = Recipe->GetIngredient<FArcRecipeIngredient_Tags>(IngIdx))
+                    {
+                        Entry.RequiredItemTags = TagIngredient->RequiredTags;
+                    }
+
+                    if (!Entry.ItemDefinition && Entry.RequiredItemTags.IsEmpty())
+                    {
+                        continue;
+                    }
+
+                    const FArcRecipeIngredient* BaseIngredient = Recipe->GetIngredientBase(IngIdx);
+                    Entry.Quantity = BaseIngredient ? BaseIngredient->Amount : 1;
+                    OutEntries.Add(MoveTemp(Entry));
+                }
+            }
+        }
+
+        int32 ComputeConsumptionDeficit(const FArcBuildingConsumptionEntry& Need, const FArcMassItemSpecArrayFragment& ItemArray)
+        {
+            int32 CurrentStock = 0;
+            for (const FArcItemSpec& Spec : ItemArray.Items)
+            {
+                if (Need.Item && Spec.ItemDefinition == Need.Item)
+                {
+                    CurrentStock += Spec.Amount;
+                }
+                else if (Need.ItemTag.IsValid() && Spec.ItemDefinition)
+                {
+                    const FArcItemFragment_Tags* TagsFrag = Spec.ItemDefinition->FindFragment<FArcItemFragment_Tags>();
+                    if (TagsFrag && TagsFrag->AssetTags.HasTag(Need.ItemTag))
+                    {
+                        CurrentStock += Spec.Amount;
+                    }
+                }
+            }
+            return Need.DesiredStockLevel - CurrentStock;
+        }
+
+        void AppendConsumptionDemands(const FArcBuildingFragment& Building, const FArcBuildingEconomyConfig& Config,
+            TArray<FArcTransportDemandEntry>& OutEntries)
+        {
+            for (int32 NeedIdx = 0; NeedIdx < Config.ConsumptionNeeds.Num(); ++NeedIdx)
+            {
+                // Only needs with active demand handles
+                if (!Building.ConsumptionDemandHandles.IsValidIndex(NeedIdx) || !Building.ConsumptionDemandHandles[NeedIdx].IsValid())
+                {
+                    continue;
+                }
+
+                const FArcBuildingConsumptionEntry& Need = Config.ConsumptionNeeds[NeedIdx];
+                if (!Need.Item && !Need.ItemTag.IsValid())
+                {
+                    continue;
+                }
+
+                FArcTransportDemandEntry Entry;
+                Entry.ItemDefinition = Need.Item;
+                if (!Need.Item)
+                {
+                    Entry.RequiredAssetTag = Need.ItemTag;
+                }
+                Entry.Quantity = Need.DesiredStockLevel;
+                Entry.ConsumptionNeedIndex = NeedIdx;
+                OutEntries.Add(MoveTemp(Entry));
+            }
+        }
+
+        bool HasAvailableSupply(const FArcResourceMarketData& ResData)
+        {
+            for (const FArcMarketSupplySource& Source : ResData.SupplySources)
+            {
+                if (Source.Quantity - Source.ReservedQuantity > 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** Picks the first market item that matches a tag-based demand and has unreserved supply. */
+        UArcItemDefinition* ResolveTaggedItem(const FArcSettlementMarketFragment& Market, const FArcTransportDemandEntry& Entry)
+        {
+            for (const TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& MarketPair : Market.PriceTable)
+            {
+                UArcItemDefinition* CandidateDef = MarketPair.Key;
+                if (!CandidateDef)
+                {
+                    continue;
+                }
+
+                const FArcItemFragment_Tags* TagsFrag = CandidateDef->FindFragment<FArcItemFragment_Tags>();
+                if (!TagsFrag)
+                {
+                    continue;
+                }
+
+                const bool bMatches = Entry.RequiredAssetTag.IsValid()
+                    ? TagsFrag->AssetTags.HasTag(Entry.RequiredAssetTag)
+                    : TagsFrag->ItemTags.HasAll(Entry.RequiredItemTags);
+
+                if (bMatches && HasAvailableSupply(MarketPair.Value))
+                {
+                    return CandidateDef;
+                }
+            }
+            return nullptr;
+        }
+
+        /** Kuhn-Munkres over a dense Rows x Cols cost matrix (Rows <= Cols). OutColForRow[Row] receives the column. */
+        void SolveHungarian(const TArray<double>& Cost, int32 Rows, int32 Cols, TArray<int32>& OutColForRow)
+        {
+            const double Inf = TNumericLimits<double>::Max();
+
+            // 1-based potentials; column 0 is the virtual source
+            TArray<double> U;
+            TArray<double> V;
+            TArray<int32> RowForCol;
+            TArray<int32> Way;
+            TArray<double> MinV;
+            TArray<bool> Used;
+            U.SetNumZeroed(Rows + 1);
+            V.SetNumZeroed(Cols + 1);
+            RowForCol.SetNumZeroed(Cols + 1);
+            Way.SetNumZeroed(Cols + 1);
+            MinV.SetNumUninitialized(Cols + 1);
+            Used.SetNumUninitialized(Cols + 1);
+
+            for (int32 Row = 1; Row <= Rows; ++Row)
+            {
+                RowForCol[0] = Row;
+                int32 Col0 = 0;
+                for (int32 Col = 0; Col <= Cols; ++Col)
+                {
+                    MinV[Col] = Inf;
+                    Used[Col] = false;
+                }
+
+                do
+                {
+                    Used[Col0] = true;
+                    const int32 Row0 = RowForCol[Col0];
+                    double Delta = Inf;
+                    int32 Col1 = 0;
+
+                    for (int32 Col = 1; Col <= Cols; ++Col)
+                    {
+                        if (Used[Col])
+                        {
+                            continue;
+                        }
+
+                        const double Current = Cost[(Row0 - 1) * Cols + (Col - 1)] - U[Row0] - V[Col];
+                        if (Current < MinV[Col])
+                        {
+                            MinV[Col] = Current;
+                            Way[Col] = Col0;
+                        }
+                        if (MinV[Col] < Delta)
+                        {
+                            Delta = MinV[Col];
+                            Col1 = Col;
+                        }
+                    }
+
+                    for (int32 Col = 0; Col <= Cols; ++Col)
+                    {
+                        if (Used[Col])
+                        {
+                            U[RowForCol[Col]] += Delta;
+                            V[Col] -= Delta;
+                        }
+                        else
+                        {
+                            MinV[Col] -= Delta;
+                        }
+                    }
+                    Col0 = Col1;
+                }
+                while (RowForCol[Col0] != 0);
+
+                do
+                {
+                    const int32 Col1 = Way[Col0];
+                    RowForCol[Col0] = RowForCol[Col1];
+                    Col0 = Col1;
+                }
+                while (Col0 != 0);
+            }
+
+            OutColForRow.Init(INDEX_NONE, Rows);
+            for (int32 Col = 1; Col <= Cols; ++Col)
+            {
+                if (RowForCol[Col] != 0)
+                {
+                    OutColForRow[RowForCol[Col] - 1] = Col - 1;
+                }
+            }
+        }
+
+        /** Greedy nearest-transporter assignment using a 2D uniform grid over transporter locations. */
+        void SolveGreedyGrid(TConstArrayView<FVector> TransporterLocations, TConstArrayView<FVector> JobLocations,
+            TArray<int32>& OutTransporterForJob)
+        {
+            constexpr double CellSize = 2000.0;
+
+            auto ToCell = [](const FVector& Location)
+            {
+                return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+            };
+
+            TMap<FIntPoint, TArray<int32>> Grid;
+            FIntPoint MinCell(TNumericLimits<int32>::Max());
+            FIntPoint MaxCell(TNumericLimits<int32>::Lowest());
+            for (int32 TIdx = 0; TIdx < TransporterLocations.Num(); ++TIdx)
+            {
+                const FIntPoint Cell = ToCell(TransporterLocations[TIdx]);
+                Grid.FindOrAdd(Cell).Add(TIdx);
+                MinCell = MinCell.ComponentMin(Cell);
+                MaxCell = MaxCell.ComponentMax(Cell);
+            }
+
+            int32 Remaining = TransporterLocations.Num();
+            for (int32 JobIdx = 0; JobIdx < JobLocations.Num() && Remaining > 0; ++JobIdx)
+            {
+                const FVector& JobLocation = JobLocations[JobIdx];
+                const FIntPoint Center = ToCell(JobLocation);
+                const int32 MaxRing = FMath::Max(
+                    FMath::Max(FMath::Abs(Center.X - MinCell.X), FMath::Abs(Center.X - MaxCell.X)),
+                    FMath::Max(FMath::Abs(Center.Y - MinCell.Y), FMath::Abs(Center.Y - MaxCell.Y)));
+
+                int32 BestTransporter = INDEX_NONE;
+                FIntPoint BestCell;
+                double BestDistSq = TNumericLimits<double>::Max();
+
+                for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+                {
+                    for (int32 DX = -Ring; DX <= Ring; ++DX)
+                    {
+                        for (int32 DY = -Ring; DY <= Ring; ++DY)
+                        {
+                            // Visit only the ring perimeter
+                            if (FMath::Abs(DX) != Ring && FMath::Abs(DY) != Ring)
+                            {
+                                continue;
+                            }
+
+                            const FIntPoint Cell(Center.X + DX, Center.Y + DY);
+                            const TArray<int32>* Bucket = Grid.Find(Cell);
+                            if (!Bucket)
+                            {
+                                continue;
+                            }
+
+                            for (const int32 TIdx : *Bucket)
+                            {
+                                const double DistSq = FVector::DistSquared(TransporterLocations[TIdx], JobLocation);
+                                if (DistSq < BestDistSq)
+                                {
+                                    BestDistSq = DistSq;
+                                    BestTransporter = TIdx;
+                                    BestCell = Cell;
+                                }
+                            }
+                        }
+                    }
+
+                    // Anything in outer rings is at least Ring * CellSize away
+                    if (BestTransporter != INDEX_NONE && BestDistSq <= FMath::Square(Ring * CellSize))
+                    {
+                        break;
+                    }
+                }
+
+                if (BestTransporter != INDEX_NONE)
+                {
+                    OutTransporterForJob[JobIdx] = BestTransporter;
+                    Grid[BestCell].RemoveSingleSwap(BestTransporter);
+                    --Remaining;
+                }
+            }
+        }
+    }
+
+    uint32 GetDemandSignature(const FArcBuildingWorkforceFragment& Workforce)
+    {
+        uint32 Signature = 0;
+        for (const FArcBuildingSlotData& Slot : Workforce.Slots)
+        {
+            Signature = HashCombineFast(Signature, PointerHash(Slot.DesiredRecipe.Get()));
+            Signature = HashCombineFast(Signature, GetTypeHash(Slot.HaltDuration > 0.0f));
+            for (const FArcKnowledgeHandle& Handle : Slot.DemandKnowledgeHandles)
+            {
+                Signature = HashCombineFast(Signature, GetTypeHash(Handle.IsValid()));
+            }
+        }
+        return Signature;
+    }
+
+    uint32 GetDemandSignature(const FArcBuildingFragment& Building)
+    {
+        uint32 Signature = 0;
+        for (const FArcKnowledgeHandle& Handle : Building.ConsumptionDemandHandles)
+        {
+            Signature = HashCombineFast(Signature, GetTypeHash(Handle.IsValid()));
+        }
+        return Signature;
+    }
+
+    void FlushDirtyBuildings(FMassEntityManager& EntityManager, FArcSettlementTransportBoard& Board)
+    {
+        if (Board.DirtyBuildings.IsEmpty())
+        {
+            return;
+        }
+
+        TRACE_CPUPROFILER_EVENT_SCOPE(ArcTransport_FlushDirtyBuildings);
+
+        for (const FMassEntityHandle& BuildingHandle : Board.DirtyBuildings)
+        {
+            Board.ProducerBuildings.RemoveSwap(BuildingHandle);
+            Board.ConsumerBuildings.RemoveSwap(BuildingHandle);
+            Board.Demands.Remove(BuildingHandle);
+
+            if (!EntityManager.IsEntityValid(BuildingHandle))
+            {
+                continue;
+            }
+
+            const FArcBuildingFragment* Building = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(BuildingHandle);
+            if (!Building)
+            {
+                continue;
+            }
+
+            FArcTransportBuildingDemands BuildingDemands;
+
+            const FArcBuildingWorkforceFragment* Workforce = EntityManager.GetFragmentDataPtr<FArcBuildingWorkforceFragment>(BuildingHandle);
+            const FArcCraftInputFragment* CraftInput = EntityManager.GetFragmentDataPtr<FArcCraftInputFragment>(BuildingHandle);
+            if (Workforce && CraftInput)
+            {
+                Board.ProducerBuildings.Add(BuildingHandle);
+                Private::AppendRecipeDemands(*Workforce, BuildingDemands.Entries);
+            }
+
+            const FArcBuildingEconomyConfig* Config = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(BuildingHandle);
+            const FArcMassItemSpecArrayFragment* ItemArray = EntityManager.GetFragmentDataPtr<FArcMassItemSpecArrayFragment>(BuildingHandle);
+            if (Config && ItemArray && !Config->ConsumptionNeeds.IsEmpty())
+            {
+                Board.ConsumerBuildings.Add(BuildingHandle);
+                Private::AppendConsumptionDemands(*Building, *Config, BuildingDemands.Entries);
+            }
+
+            if (BuildingDemands.Entries.Num() > 0)
+            {
+                Board.Demands.Add(BuildingHandle, MoveTemp(BuildingDemands));
+            }
+        }
+
+        Board.DirtyBuildings.Reset();
+    }
+
+    void BuildJobs(FMassEntityManager& EntityManager, const FArcSettlementTransportBoard& Board,
+        const FArcSettlementMarketFragment& Market, TArray<FJob>& OutJobs)
+    {
+        for (const TPair<FMassEntityHandle, FArcTransportBuildingDemands>& DemandPair : Board.Demands)
+        {
+            if (!EntityManager.IsEntityValid(DemandPair.Key))
+            {
+                continue;
+            }
+
+            // Consumption quantities track live stock, recipe quantities are fixed per ingredient
+            const FArcBuildingEconomyConfig* Config = EntityManager.GetSharedFragmentDataPtr<FArcBuildingEconomyConfig>(DemandPair.Key);
+            const FArcMassItemSpecArrayFragment* ItemArray = EntityManager.GetFragmentDataPtr<FArcMassItemSpecArrayFragment>(DemandPair.Key);
+
+            for (const FArcTransportDemandEntry& Entry : DemandPair.Value.Entries)
+            {
+                int32 Quantity = Entry.Quantity;
+                if (Entry.ConsumptionNeedIndex != INDEX_NONE)
+                {
+                    if (!Config || !ItemArray || !Config->ConsumptionNeeds.IsValidIndex(Entry.ConsumptionNeedIndex))
+                    {
+                        continue;
+                    }
+                    Quantity = Private::ComputeConsumptionDeficit(Config->ConsumptionNeeds[Entry.ConsumptionNeedIndex], *ItemArray);
+                    if (Quantity <= 0)
+                    {
+                        continue;
+                    }
+                }
+
+                UArcItemDefinition* ItemDef = Entry.ItemDefinition
+                    ? Entry.ItemDefinition.Get()
+                    : Private::ResolveTaggedItem(Market, Entry);
+                if (!ItemDef)
+                {
+                    continue;
+                }
+
+                const FArcResourceMarketData* ResData = Market.PriceTable.Find(ItemDef);
+                if (!ResData)
+                {
+                    continue;
+                }
+
+                for (const FArcMarketSupplySource& Source : ResData->SupplySources)
+                {
+                    const int32 Available = Source.Quantity - Source.ReservedQuantity;
+                    if (Available <= 0)
+                    {
+                        continue;
+                    }
+
+                    FJob& Job = OutJobs.AddDefaulted_GetRef();
+                    Job.DemandBuilding = DemandPair.Key;
+                    Job.ItemDefinition = ItemDef;
+                    Job.Quantity = FMath::Min(Quantity, Available);
+                    Job.SupplyBuilding = Source.BuildingHandle;
+                    if (EntityManager.IsEntityValid(Source.BuildingHandle))
+                    {
+                        if (const FArcBuildingFragment* SupplyBuilding = EntityManager.GetFragmentDataPtr<FArcBuildingFragment>(Source.BuildingHandle))
+                        {
+                            Job.SupplyLocation = SupplyBuilding->BuildingLocation;
+                        }
+                    }
+                    break; // one source per demand
+                }
+            }
+        }
+    }
+
+    void SolveAssignment(TConstArrayView<FVector> TransporterLocations, TConstArrayView<FVector> JobLocations,
+        TArray<int32>& OutTransporterForJob)
+    {
+        OutTransporterForJob.Init(INDEX_NONE, JobLocations.Num());
+
+        const int32 NumTransporters = TransporterLocations.Num();
+        const int32 NumJobs = JobLocations.Num();
+        if (NumTransporters == 0 || NumJobs == 0)
+        {
+            return;
+        }
+
+        if (static_cast<int64>(NumTransporters) * NumJobs > MaxExactMatchingCells)
+        {
+            Private::SolveGreedyGrid(TransporterLocations, JobLocations, OutTransporterForJob);
+            return;
+        }
+
+        // Rows must be the smaller side
+        const bool bJobsAreRows = NumJobs <= NumTransporters;
+        const int32 Rows = bJobsAreRows ? NumJobs : NumTransporters;
+        const int32 Cols = bJobsAreRows ? NumTransporters : NumJobs;
+
+        TArray<double> Cost;
+        Cost.SetNumUninitialized(Rows * Cols);
+        for (int32 Row = 0; Row < Rows; ++Row)
+        {
+            for (int32 Col = 0; Col < Cols; ++Col)
+            {
+                const int32 JobIdx = bJobsAreRows ? Row : Col;
+                const int32 TIdx = bJobsAreRows ? Col : Row;
+                Cost[Row * Cols + Col] = FVector::Dist(TransporterLocations[TIdx], JobLocations[JobIdx]);
+            }
+        }
+
+        TArray<int32> ColForRow;
+        Private::SolveHungarian(Cost, Rows, Cols, ColForRow);
+
+        for (int32 Row = 0; Row < Rows; ++Row)
+        {
+            const int32 Col = ColForRow[Row];
+            if (Col == INDEX_NONE)
+            {
+                continue;
+            }
+
+            if (bJobsAreRows)
+            {
+                OutTransporterForJob[Row] = Col;
+            }
+            else
+            {
+                OutTransporterForJob[Col] = Row;
+            }
+        }
+    }
+}
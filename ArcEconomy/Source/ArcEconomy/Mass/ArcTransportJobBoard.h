@@ -0,0 +1,131 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mass/EntityHandle.h"
+#include "GameplayTagContainer.h"
+#include "ArcTransportJobBoard.generated.h"
+
+class UArcItemDefinition;
+struct FMassEntityManager;
+struct FArcSettlementMarketFragment;
+struct FArcBuildingFragment;
+struct FArcBuildingWorkforceFragment;
+
+// ============================================================================
+// Transport Job Board
+// ============================================================================
+
+/**
+ * A single outstanding delivery request posted by a building.
+ * Either ItemDefinition is set, or the request is tag-based and resolved against the market at match time.
+ */
+USTRUCT()
+struct ARCECONOMY_API FArcTransportDemandEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UArcItemDefinition> ItemDefinition = nullptr;
+
+    /** Recipe tag ingredient: candidate item must have all of these in FArcItemFragment_Tags::ItemTags. */
+    UPROPERTY()
+    FGameplayTagContainer RequiredItemTags;
+
+    /** Consumption need: candidate item must have this tag in FArcItemFragment_Tags::AssetTags. */
+    UPROPERTY()
+    FGameplayTag RequiredAssetTag;
+
+    /** Requested amount. For consumption needs this is re-evaluated against current stock when jobs are built. */
+    UPROPERTY()
+    int32 Quantity = 0;
+
+    /** Index into FArcBuildingEconomyConfig::ConsumptionNeeds, INDEX_NONE for recipe ingredients. */
+    UPROPERTY()
+    int32 ConsumptionNeedIndex = INDEX_NONE;
+};
+
+USTRUCT()
+struct ARCECONOMY_API FArcTransportBuildingDemands
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FArcTransportDemandEntry> Entries;
+};
+
+/**
+ * Per-settlement index of transport-relevant buildings and their outstanding demands.
+ * Buildings are classified and their demands rebuilt only when marked dirty, so the
+ * transport manager never has to scan every building in the world when a signal fires.
+ */
+USTRUCT()
+struct ARCECONOMY_API FArcSettlementTransportBoard
+{
+    GENERATED_BODY()
+
+    /** Buildings with a recipe workforce (FArcBuildingWorkforceFragment + FArcCraftInputFragment). */
+    UPROPERTY()
+    TArray<FMassEntityHandle> ProducerBuildings;
+
+    /** Buildings whose economy config has ConsumptionNeeds. */
+    UPROPERTY()
+    TArray<FMassEntityHandle> ConsumerBuildings;
+
+    /** Outstanding demands keyed by building. Buildings without demand have no entry. */
+    UPROPERTY()
+    TMap<FMassEntityHandle, FArcTransportBuildingDemands> Demands;
+
+    /** Buildings whose classification or demand must be recomputed before the next match. */
+    TSet<FMassEntityHandle> DirtyBuildings;
+
+    void RemoveBuilding(FMassEntityHandle BuildingHandle)
+    {
+        ProducerBuildings.RemoveSwap(BuildingHandle);
+        ConsumerBuildings.RemoveSwap(BuildingHandle);
+        Demands.Remove(BuildingHandle);
+        DirtyBuildings.Remove(BuildingHandle);
+    }
+};
+
+namespace ArcTransport
+{
+    /** A resolved pick-up/delivery pair ready to be handed to a transporter. */
+    struct FJob
+    {
+        FMassEntityHandle DemandBuilding;
+        UArcItemDefinition* ItemDefinition = nullptr;
+        int32 Quantity = 0;
+        FMassEntityHandle SupplyBuilding;
+        FVector SupplyLocation = FVector::ZeroVector;
+    };
+
+    /**
+     * Reclassifies every dirty building of the board and rebuilds its demand entries from fragments.
+     * Must run on the game thread (resolves item definitions through the asset manager).
+     */
+    ARCECONOMY_API void FlushDirtyBuildings(FMassEntityManager& EntityManager, FArcSettlementTransportBoard& Board);
+
+    /**
+     * Hash of the demand-advertisement state that the board derives entries from.
+     * Demand/consumption processors compare it before and after a pass to decide whether to mark a building dirty.
+     */
+    ARCECONOMY_API uint32 GetDemandSignature(const FArcBuildingWorkforceFragment& Workforce);
+    ARCECONOMY_API uint32 GetDemandSignature(const FArcBuildingFragment& Building);
+
+    /** Resolves board demands against current market supply. One job per demand entry, first source with stock wins. */
+    ARCECONOMY_API void BuildJobs(FMassEntityManager& EntityManager, const FArcSettlementTransportBoard& Board,
+        const FArcSettlementMarketFragment& Market, TArray<FJob>& OutJobs);
+
+    /**
+     * Assigns transporters to jobs minimizing total transporter -> supply distance.
+     * Exact (Hungarian) for small problems, spatial-grid assisted greedy beyond MaxExactMatchingCells.
+     * OutTransporterForJob[JobIdx] is the transporter index or INDEX_NONE.
+     */
+    ARCECONOMY_API void SolveAssignment(TConstArrayView<FVector> TransporterLocations, TConstArrayView<FVector> JobLocations,
+        TArray<int32>& OutTransporterForJob);
+
+    /** Upper bound on Jobs * Transporters solved exactly. */
+    constexpr int32 MaxExactMatchingCells = 64 * 64;
+}
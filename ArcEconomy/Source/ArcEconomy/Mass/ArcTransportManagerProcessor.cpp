@@ -2,23 +2,16 @@
 
 #include "Mass/ArcTransportManagerProcessor.h"
 #include "Mass/ArcEconomyFragments.h"
+#include "Mass/ArcTransportJobBoard.h"
 #include "ArcEconomyTypes.h"
-#include "ArcCraft/Mass/ArcCraftMassFragments.h"
-#include "ArcCraft/Recipe/ArcRecipeIngredient.h"
-#include "ArcCraft/Recipe/ArcRecipeDefinition.h"
-#include "Items/ArcItemDefinition.h"
-#include "Items/Fragments/ArcItemFragment_Tags.h"
-#include "Core/ArcCoreAssetManager.h"
+#include "ArcSettlementSubsystem.h"
 #include "Mass/EntityFragments.h"
 #include "MassSignalSubsystem.h"
 #include "MassStateTreeTypes.h"
 #include "MassExecutionContext.h"
-#include "Mass/ArcMassItemFragments.h"
+#include "Async/ParallelFor.h"
 
 UArcTransportManagerProcessor::UArcTransportManagerProcessor()
-	: TransporterQuery{*this}
-	, BuildingQuery{*this}
-	, ConsumerBuildingQuery{*this}
 {
 	bAutoRegisterWithProcessingPhases = true;
 	bRequiresGameThreadExecution = true;
@@ -39,457 +32,162 @@ void UArcTransportManagerProcessor::ConfigureQueries(const TSharedRef<FMassEntit
 {
 	// EntityQuery (base class) matches the signaled settlement entities
 	EntityQuery.AddRequirement<FArcSettlementMarketFragment>(EMassFragmentAccess::ReadWrite);
-
-	TransporterQuery.AddRequirement<FArcTransporterFragment>(EMassFragmentAccess::ReadWrite);
-	TransporterQuery.AddRequirement<FArcEconomyNPCFragment>(EMassFragmentAccess::ReadOnly);
-	TransporterQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
-
-	BuildingQuery.AddRequirement<FArcBuildingFragment>(EMassFragmentAccess::ReadOnly);
-	BuildingQuery.AddRequirement<FArcBuildingWorkforceFragment>(EMassFragmentAccess::ReadOnly);
-	BuildingQuery.AddRequirement<FArcCraftInputFragment>(EMassFragmentAccess::ReadOnly);
-
-	ConsumerBuildingQuery.AddRequirement<FArcBuildingFragment>(EMassFragmentAccess::ReadOnly);
-	ConsumerBuildingQuery.AddSharedRequirement<FArcBuildingEconomyConfig>(EMassFragmentAccess::ReadOnly);
-	ConsumerBuildingQuery.AddRequirement<FArcMassItemSpecArrayFragment>(EMassFragmentAccess::ReadOnly);
+	// Buildings and transporters are reached through the settlement subsystem indexes
+	EntityQuery.AddSubsystemRequirement<UArcSettlementSubsystem>(EMassFragmentAccess::ReadWrite);
 }
 
 void UArcTransportManagerProcessor::SignalEntities(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcTransportManager);
 
-	struct FIdleTransporter
+	UArcSettlementSubsystem* SettlementSubsystem = Context.GetWorld()->GetSubsystem<UArcSettlementSubsystem>();
+	if (!SettlementSubsystem)
 	{
-		FMassEntityHandle Entity;
-		FVector Location;
-	};
+		return;
+	}
 
-	struct FTransportJob
+	struct FSettlementWork
 	{
-		FMassEntityHandle DemandBuilding;
-		UArcItemDefinition* ItemDefinition = nullptr;
-		int32 Quantity = 0;
-		FMassEntityHandle SupplyBuilding;
-		FVector SupplyLocation = FVector::ZeroVector;
+		FMassEntityHandle SettlementHandle;
+		FArcSettlementMarketFragment* Market = nullptr;
+		const FArcSettlementTransportBoard* Board = nullptr;
+		TArray<FMassEntityHandle> IdleTransporters;
+		TArray<FVector> IdleLocations;
+		TArray<ArcTransport::FJob> Jobs;
+		TArray<int32> TransporterForJob;
 	};
 
-	// Collect unique signaled settlement handles
-	TSet<FMassEntityHandle> SignaledSettlements;
-	EntityQuery.ForEachEntityChunk(Context, [&SignaledSettlements](FMassExecutionContext& Ctx)
+	// Collect unique signaled settlements together with their market
+	TArray<FSettlementWork> Work;
+	TSet<FMassEntityHandle> AddedSettlements;
+	EntityQuery.ForEachEntityChunk(Context, [&Work, &AddedSettlements](FMassExecutionContext& Ctx)
 	{
+		const TArrayView<FArcSettlementMarketFragment> Markets = Ctx.GetMutableFragmentView<FArcSettlementMarketFragment>();
 		const int32 NumEntities = Ctx.GetNumEntities();
 		for (int32 Idx = 0; Idx < NumEntities; ++Idx)
 		{
-			SignaledSettlements.Add(Ctx.GetEntity(Idx));
+			const FMassEntityHandle SettlementHandle = Ctx.GetEntity(Idx);
+			bool bAlreadyAdded = false;
+			AddedSettlements.Add(SettlementHandle, &bAlreadyAdded);
+			if (!bAlreadyAdded)
+			{
+				FSettlementWork& Item = Work.AddDefaulted_GetRef();
+				Item.SettlementHandle = SettlementHandle;
+				Item.Market = &Markets[Idx];
+			}
 		}
 	});
 
-	if (SignaledSettlements.IsEmpty())
+	// Gather idle transporters per settlement from the NPC index and refresh dirty buildings on the board.
+	// Both touch the asset manager / entity views and stay on the game thread.
+	for (int32 WorkIdx = Work.Num() - 1; WorkIdx >= 0; --WorkIdx)
 	{
-		return;
-	}
-
-	// For each settlement, collect idle transporters
-	// Clear the signal entity collection so TransporterQuery iterates all matching archetypes
-	// (the signaled collection only contains settlement entities which don't match TransporterQuery)
-	Context.ClearEntityCollection();
-
-	TMap<FMassEntityHandle, TArray<FIdleTransporter>> IdleTransportersBySettlement;
-	TransporterQuery.ForEachEntityChunk(Context, [&SignaledSettlements, &IdleTransportersBySettlement](FMassExecutionContext& Ctx)
-	{
-		const TConstArrayView<FArcTransporterFragment> Transporters = Ctx.GetFragmentView<FArcTransporterFragment>();
-		const TConstArrayView<FArcEconomyNPCFragment> NPCs = Ctx.GetFragmentView<FArcEconomyNPCFragment>();
-		const TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
-		const int32 NumEntities = Ctx.GetNumEntities();
+		FSettlementWork& Item = Work[WorkIdx];
 
-		for (int32 Idx = 0; Idx < NumEntities; ++Idx)
+		for (const FMassEntityHandle& NPCHandle : SettlementSubsystem->GetNPCsForSettlement(Item.SettlementHandle))
 		{
-			const FArcEconomyNPCFragment& NPC = NPCs[Idx];
-			if (NPC.Role != EArcEconomyNPCRole::Transporter)
+			if (!EntityManager.IsEntityValid(NPCHandle))
 			{
 				continue;
 			}
 
-			if (!SignaledSettlements.Contains(NPC.SettlementHandle))
+			const FArcEconomyNPCFragment* NPC = EntityManager.GetFragmentDataPtr<FArcEconomyNPCFragment>(NPCHandle);
+			const FArcTransporterFragment* Transporter = EntityManager.GetFragmentDataPtr<FArcTransporterFragment>(NPCHandle);
+			const FTransformFragment* Transform = EntityManager.GetFragmentDataPtr<FTransformFragment>(NPCHandle);
+			if (!NPC || !Transporter || !Transform)
 			{
 				continue;
 			}
 
-			const FArcTransporterFragment& Transporter = Transporters[Idx];
-			if (Transporter.TaskState != EArcTransporterTaskState::Idle)
+			if (NPC->Role != EArcEconomyNPCRole::Transporter || Transporter->TaskState != EArcTransporterTaskState::Idle)
 			{
 				continue;
 			}
 
-			FIdleTransporter IdleEntry;
-			IdleEntry.Entity = Ctx.GetEntity(Idx);
-			IdleEntry.Location = Transforms[Idx].GetTransform().GetLocation();
-			IdleTransportersBySettlement.FindOrAdd(NPC.SettlementHandle).Add(IdleEntry);
+			Item.IdleTransporters.Add(NPCHandle);
+			Item.IdleLocations.Add(Transform->GetTransform().GetLocation());
 		}
-	});
 
-	if (IdleTransportersBySettlement.IsEmpty())
-	{
-		return;
-	}
-
-	// For each settlement, collect fulfillable demand jobs from buildings
-	TMap<FMassEntityHandle, TArray<FTransportJob>> JobsBySettlement;
-	for (const FMassEntityHandle& SettlementHandle : SignaledSettlements)
-	{
-		if (!IdleTransportersBySettlement.Contains(SettlementHandle))
+		FArcSettlementTransportBoard* Board = SettlementSubsystem->FindTransportBoard(Item.SettlementHandle);
+		if (Item.IdleTransporters.IsEmpty() || !Board)
 		{
+			// Dirty buildings stay queued until a transporter is available to act on them
+			Work.RemoveAtSwap(WorkIdx);
 			continue;
 		}
 
-		if (!EntityManager.IsEntityValid(SettlementHandle))
+		ArcTransport::FlushDirtyBuildings(EntityManager, *Board);
+		if (Board->Demands.IsEmpty())
 		{
+			Work.RemoveAtSwap(WorkIdx);
 			continue;
 		}
 
-		const FMassEntityView SettlementView(EntityManager, SettlementHandle);
-		const FArcSettlementMarketFragment& Market = SettlementView.GetFragmentData<FArcSettlementMarketFragment>();
-
-		BuildingQuery.ForEachEntityChunk(Context, [&SettlementHandle, &Market, &JobsBySettlement, &EntityManager](FMassExecutionContext& Ctx)
-		{
-			const TConstArrayView<FArcBuildingFragment> Buildings = Ctx.GetFragmentView<FArcBuildingFragment>();
-			const TConstArrayView<FArcBuildingWorkforceFragment> Workforces = Ctx.GetFragmentView<FArcBuildingWorkforceFragment>();
-			const int32 NumEntities = Ctx.GetNumEntities();
-
-			for (int32 Idx = 0; Idx < NumEntities; ++Idx)
-			{
-				const FArcBuildingFragment& Building = Buildings[Idx];
-				if (Building.SettlementHandle != SettlementHandle)
-				{
-					continue;
-				}
-
-				const FArcBuildingWorkforceFragment& Workforce = Workforces[Idx];
-				const FMassEntityHandle BuildingEntity = Ctx.GetEntity(Idx);
-
-				for (const FArcBuildingSlotData& Slot : Workforce.Slots)
-				{
-					if (Slot.HaltDuration <= 0.0f || !Slot.DesiredRecipe)
-					{
-						continue;
-					}
-
-					UArcRecipeDefinition* Recipe = Slot.DesiredRecipe;
-					const int32 IngredientCount = Recipe->GetIngredientCount();
-
-					for (int32 IngIdx = 0; IngIdx < IngredientCount; ++IngIdx)
-					{
-						// Check if this ingredient slot has an active demand (knowledge handle is valid)
-						if (!Slot.DemandKnowledgeHandles.IsValidIndex(IngIdx) || !Slot.DemandKnowledgeHandles[IngIdx].IsValid())
-						{
-							continue;
-						}
-
-						// Resolve item definition from ingredient
-						UArcItemDefinition* ItemDef = nullptr;
-
-						const FArcRecipeIngredient_ItemDef* ItemDefIngredient = Recipe->GetIngredient<FArcRecipeIngredient_ItemDef>(IngIdx);
-						if (ItemDefIngredient && ItemDefIngredient->ItemDefinitionId.IsValid())
-						{
-							ItemDef = UArcCoreAssetManager::GetAsset<UArcItemDefinition>(ItemDefIngredient->ItemDefinitionId.AssetId);
-						}
-						else
-						{
-							// Tag-based ingredient: search the market for any item with matching tags
-							const FArcRecipeIngredient_Tags* TagIngredient = Recipe->GetIngredient<FArcRecipeIngredient_Tags>(IngIdx);
-							if (TagIngredient)
-							{
-								for (const TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& MarketPair : Market.PriceTable)
-								{
-									UArcItemDefinition* CandidateDef = MarketPair.Key;
-									if (!CandidateDef)
-									{
-										continue;
-									}
-
-									const FArcItemFragment_Tags* TagsFrag = CandidateDef->FindFragment<FArcItemFragment_Tags>();
-									if (TagsFrag && TagsFrag->ItemTags.HasAll(TagIngredient->RequiredTags))
-									{
-										// Check available supply
-										const FArcResourceMarketData& ResData = MarketPair.Value;
-										for (const FArcMarketSupplySource& Source : ResData.SupplySources)
-										{
-											const int32 Available = Source.Quantity - Source.ReservedQuantity;
-											if (Available > 0)
-											{
-												ItemDef = CandidateDef;
-												break;
-											}
-										}
-										if (ItemDef)
-										{
-											break;
-										}
-									}
-								}
-							}
-						}
-
-						if (!ItemDef)
-						{
-							continue;
-						}
-
-						// Check if there is supply available for this item
-						const FArcResourceMarketData* ResData = Market.PriceTable.Find(ItemDef);
-						if (!ResData)
-						{
-							continue;
-						}
-
-						for (const FArcMarketSupplySource& Source : ResData->SupplySources)
-						{
-							const int32 Available = Source.Quantity - Source.ReservedQuantity;
-							if (Available <= 0)
-							{
-								continue;
-							}
-
-							// Resolve supply building location
-							FVector SupplyLoc = FVector::ZeroVector;
-							if (EntityManager.IsEntityValid(Source.BuildingHandle))
-							{
-								const FMassEntityView SupplyView(EntityManager, Source.BuildingHandle);
-								const FArcBuildingFragment& SupplyBuilding = SupplyView.GetFragmentData<FArcBuildingFragment>();
-								SupplyLoc = SupplyBuilding.BuildingLocation;
-							}
+		Item.Board = Board;
+	}
 
-							const FArcRecipeIngredient* BaseIngredient = Recipe->GetIngredientBase(IngIdx);
-							const int32 NeededQuantity = BaseIngredient ? BaseIngredient->Amount : 1;
-							const int32 JobQuantity = FMath::Min(NeededQuantity, Available);
+	if (Work.IsEmpty())
+	{
+		return;
+	}
 
-							FTransportJob Job;
-							Job.DemandBuilding = BuildingEntity;
-							Job.ItemDefinition = ItemDef;
-							Job.Quantity = JobQuantity;
-							Job.SupplyBuilding = Source.BuildingHandle;
-							Job.SupplyLocation = SupplyLoc;
-							JobsBySettlement.FindOrAdd(SettlementHandle).Add(Job);
-							break; // one source per ingredient
-						}
-					}
-				}
-			}
-		});
+	// Resolve demands against market supply and solve the assignment, one settlement per task.
+	// Settlements share no data here; everything read is stable until the apply pass below.
+	ParallelFor(Work.Num(), [&Work, &EntityManager](int32 WorkIdx)
+	{
+		FSettlementWork& Item = Work[WorkIdx];
+		ArcTransport::BuildJobs(EntityManager, *Item.Board, *Item.Market, Item.Jobs);
 
-		// --- Consumption-based demand (consumer buildings without recipes) ---
-		ConsumerBuildingQuery.ForEachEntityChunk(Context, [&SettlementHandle, &Market, &JobsBySettlement, &EntityManager](FMassExecutionContext& Ctx)
+		TArray<FVector> JobLocations;
+		JobLocations.Reserve(Item.Jobs.Num());
+		for (const ArcTransport::FJob& Job : Item.Jobs)
 		{
-			const FArcBuildingEconomyConfig& EconomyConfig = Ctx.GetSharedFragment<FArcBuildingEconomyConfig>();
-			if (EconomyConfig.ConsumptionNeeds.IsEmpty())
-			{
-				return;
-			}
-
-			const TConstArrayView<FArcBuildingFragment> Buildings = Ctx.GetFragmentView<FArcBuildingFragment>();
-			const TConstArrayView<FArcMassItemSpecArrayFragment> ItemArrays = Ctx.GetFragmentView<FArcMassItemSpecArrayFragment>();
-			const int32 NumEntities = Ctx.GetNumEntities();
-
-			for (int32 Idx = 0; Idx < NumEntities; ++Idx)
-			{
-				const FArcBuildingFragment& Building = Buildings[Idx];
-				if (Building.SettlementHandle != SettlementHandle)
-				{
-					continue;
-				}
-
-				const FArcMassItemSpecArrayFragment& ItemArrayFrag = ItemArrays[Idx];
-				const FMassEntityHandle BuildingEntity = Ctx.GetEntity(Idx);
-
-				for (int32 NeedIdx = 0; NeedIdx < EconomyConfig.ConsumptionNeeds.Num(); ++NeedIdx)
-				{
-					// Only process needs with active demand handles
-					if (!Building.ConsumptionDemandHandles.IsValidIndex(NeedIdx) || !Building.ConsumptionDemandHandles[NeedIdx].IsValid())
-					{
-						continue;
-					}
-
-					const FArcBuildingConsumptionEntry& Need = EconomyConfig.ConsumptionNeeds[NeedIdx];
-
-					// Count current stock to compute deficit
-					int32 CurrentStock = 0;
-					for (const FArcItemSpec& Spec : ItemArrayFrag.Items)
-					{
-						if (Need.Item && Spec.ItemDefinition == Need.Item)
-						{
-							CurrentStock += Spec.Amount;
-						}
-						else if (Need.ItemTag.IsValid() && Spec.ItemDefinition)
-						{
-							const FArcItemFragment_Tags* TagsFrag = Spec.ItemDefinition->FindFragment<FArcItemFragment_Tags>();
-							if (TagsFrag && TagsFrag->AssetTags.HasTag(Need.ItemTag))
-							{
-								CurrentStock += Spec.Amount;
-							}
-						}
-					}
-
-					const int32 Deficit = Need.DesiredStockLevel - CurrentStock;
-					if (Deficit <= 0)
-					{
-						continue;
-					}
-
-					// Resolve item definition
-					UArcItemDefinition* ItemDef = Need.Item;
-
-					if (!ItemDef && Need.ItemTag.IsValid())
-					{
-						// Tag-based: search market for matching item with available supply
-						for (const TPair<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& MarketPair : Market.PriceTable)
-						{
-							UArcItemDefinition* CandidateDef = MarketPair.Key;
-							if (!CandidateDef)
-							{
-								continue;
-							}
-
-							const FArcItemFragment_Tags* TagsFrag = CandidateDef->FindFragment<FArcItemFragment_Tags>();
-							if (TagsFrag && TagsFrag->AssetTags.HasTag(Need.ItemTag))
-							{
-								const FArcResourceMarketData& ResData = MarketPair.Value;
-								for (const FArcMarketSupplySource& Source : ResData.SupplySources)
-								{
-									const int32 Available = Source.Quantity - Source.ReservedQuantity;
-									if (Available > 0)
-									{
-										ItemDef = CandidateDef;
-										break;
-									}
-								}
-								if (ItemDef)
-								{
-									break;
-								}
-							}
-						}
-					}
-
-					if (!ItemDef)
-					{
-						continue;
-					}
-
-					// Find supply source
-					const FArcResourceMarketData* ResData = Market.PriceTable.Find(ItemDef);
-					if (!ResData)
-					{
-						continue;
-					}
-
-					for (const FArcMarketSupplySource& Source : ResData->SupplySources)
-					{
-						const int32 Available = Source.Quantity - Source.ReservedQuantity;
-						if (Available <= 0)
-						{
-							continue;
-						}
-
-						FVector SupplyLoc = FVector::ZeroVector;
-						if (EntityManager.IsEntityValid(Source.BuildingHandle))
-						{
-							const FMassEntityView SupplyView(EntityManager, Source.BuildingHandle);
-							const FArcBuildingFragment& SupplyBuilding = SupplyView.GetFragmentData<FArcBuildingFragment>();
-							SupplyLoc = SupplyBuilding.BuildingLocation;
-						}
-
-						const int32 JobQuantity = FMath::Min(Deficit, Available);
+			JobLocations.Add(Job.SupplyLocation);
+		}
 
-						FTransportJob Job;
-						Job.DemandBuilding = BuildingEntity;
-						Job.ItemDefinition = ItemDef;
-						Job.Quantity = JobQuantity;
-						Job.SupplyBuilding = Source.BuildingHandle;
-						Job.SupplyLocation = SupplyLoc;
-						JobsBySettlement.FindOrAdd(SettlementHandle).Add(Job);
-						break; // one source per need
-					}
-				}
-			}
-		});
-	}
+		ArcTransport::SolveAssignment(Item.IdleLocations, JobLocations, Item.TransporterForJob);
+	});
 
-	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
 	TArray<FMassEntityHandle> AssignedTransporters;
 
-	// Match jobs to idle transporters by closest distance to supply building
-	for (TPair<FMassEntityHandle, TArray<FTransportJob>>& SettlementPair : JobsBySettlement)
+	for (FSettlementWork& Item : Work)
 	{
-		const FMassEntityHandle& SettlementHandle = SettlementPair.Key;
-		TArray<FTransportJob>& Jobs = SettlementPair.Value;
-		TArray<FIdleTransporter>* IdlePtr = IdleTransportersBySettlement.Find(SettlementHandle);
-		if (!IdlePtr || IdlePtr->IsEmpty())
-		{
-			continue;
-		}
-
-		TArray<FIdleTransporter>& IdleTransporters = *IdlePtr;
-
-		for (FTransportJob& Job : Jobs)
+		for (int32 JobIdx = 0; JobIdx < Item.Jobs.Num(); ++JobIdx)
 		{
-			if (IdleTransporters.IsEmpty())
-			{
-				break;
-			}
-
-			// Find closest idle transporter to the supply building
-			int32 BestIdx = INDEX_NONE;
-			double BestDistSq = TNumericLimits<double>::Max();
-
-			for (int32 TIdx = 0; TIdx < IdleTransporters.Num(); ++TIdx)
-			{
-				const double DistSq = FVector::DistSquared(IdleTransporters[TIdx].Location, Job.SupplyLocation);
-				if (DistSq < BestDistSq)
-				{
-					BestDistSq = DistSq;
-					BestIdx = TIdx;
-				}
-			}
-
-			if (BestIdx == INDEX_NONE)
+			const int32 TransporterIdx = Item.TransporterForJob[JobIdx];
+			if (TransporterIdx == INDEX_NONE)
 			{
 				continue;
 			}
 
-			const FMassEntityHandle TransporterEntity = IdleTransporters[BestIdx].Entity;
-			IdleTransporters.RemoveAtSwap(BestIdx);
+			const ArcTransport::FJob& Job = Item.Jobs[JobIdx];
+			const FMassEntityHandle TransporterEntity = Item.IdleTransporters[TransporterIdx];
 
 			// Write the job to the transporter fragment
-			if (!EntityManager.IsEntityValid(TransporterEntity))
+			FArcTransporterFragment* TransporterFrag = EntityManager.GetFragmentDataPtr<FArcTransporterFragment>(TransporterEntity);
+			if (!TransporterFrag)
 			{
 				continue;
 			}
 
-			FMassEntityView TransporterView(EntityManager, TransporterEntity);
-			FArcTransporterFragment& TransporterFrag = TransporterView.GetFragmentData<FArcTransporterFragment>();
-			TransporterFrag.TaskState = EArcTransporterTaskState::PickingUp;
-			TransporterFrag.SourceBuildingHandle = Job.SupplyBuilding;
-			TransporterFrag.DestinationBuildingHandle = Job.DemandBuilding;
-			TransporterFrag.TargetBuildingHandle = Job.SupplyBuilding;
-			TransporterFrag.TargetItemDefinition = Job.ItemDefinition;
-			TransporterFrag.TargetQuantity = Job.Quantity;
+			TransporterFrag->TaskState = EArcTransporterTaskState::PickingUp;
+			TransporterFrag->SourceBuildingHandle = Job.SupplyBuilding;
+			TransporterFrag->DestinationBuildingHandle = Job.DemandBuilding;
+			TransporterFrag->TargetBuildingHandle = Job.SupplyBuilding;
+			TransporterFrag->TargetItemDefinition = Job.ItemDefinition;
+			TransporterFrag->TargetQuantity = Job.Quantity;
 
 			AssignedTransporters.Add(TransporterEntity);
 
 			// Increment ReservedQuantity on the matched supply source
-			if (EntityManager.IsEntityValid(SettlementHandle))
+			if (FArcResourceMarketData* ResData = Item.Market->PriceTable.Find(Job.ItemDefinition))
 			{
-				FMassEntityView SettlementView(EntityManager, SettlementHandle);
-				FArcSettlementMarketFragment& Market = SettlementView.GetFragmentData<FArcSettlementMarketFragment>();
-				FArcResourceMarketData* ResData = Market.PriceTable.Find(Job.ItemDefinition);
-				if (ResData)
+				for (FArcMarketSupplySource& Source : ResData->SupplySources)
 				{
-					for (FArcMarketSupplySource& Source : ResData->SupplySources)
+					if (Source.BuildingHandle == Job.SupplyBuilding)
 					{
-						if (Source.BuildingHandle == Job.SupplyBuilding)
-						{
-							Source.ReservedQuantity += Job.Quantity;
-							break;
-						}
+						Source.ReservedQuantity += Job.Quantity;
+						break;
 					}
 				}
 			}
@@ -497,6 +195,7 @@ void UArcTransportManagerProcessor::SignalEntities(FMassEntityManager& EntityMan
 	}
 
 	// Signal assigned transporters so their StateTrees re-evaluate
+	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
 	if (SignalSubsystem && AssignedTransporters.Num() > 0)
 	{
 		SignalSubsystem->SignalEntities(UE::Mass::Signals::NewStateTreeTaskRequired, AssignedTransporters);
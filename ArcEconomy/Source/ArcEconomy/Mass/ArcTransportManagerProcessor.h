@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "MassSignalProcessorBase.h"
-#include "MassEntityQuery.h"
 #include "ArcTransportManagerProcessor.generated.h"
 
+/**
+ * Matches idle transporters to outstanding delivery demands of signaled settlements.
+ * Demands come from the per-settlement transport board in UArcSettlementSubsystem, which only
+ * rebuilds buildings marked dirty. Job resolution and min-cost matching run in parallel across settlements.
+ */
 UCLASS()
 class ARCECONOMY_API UArcTransportManagerProcessor : public UMassSignalProcessorBase
 {
@@ -19,9 +23,4 @@ protected:
 	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
 	virtual void SignalEntities(FMassEntityManager& EntityManager, FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals) override;
-
-private:
-	FMassEntityQuery TransporterQuery;
-	FMassEntityQuery BuildingQuery;
-	FMassEntityQuery ConsumerBuildingQuery;
 };
@@ -119,6 +119,7 @@ EStateTreeRunStatus FArcGovernorActivateRecipesTask::EnterState(FStateTreeExecut
 
             AssignedRecipes.Add(ChosenRecipe);
             Slot.DesiredRecipe = ChosenRecipe;
+            SettlementSub->MarkBuildingDirty(SettlementEntity, BuildingHandle);
         }
     }
 
@@ -343,11 +343,10 @@ void SArcIWMinimapTab::RefreshEntityData()
 		if (VisSub != nullptr && MassSub != nullptr)
 		{
 			FMassEntityManager& EntityManager = MassSub->GetMutableEntityManager();
-			const TMap<FIntVector, TArray<FMassEntityHandle>>& MeshCellEntities = VisSub->GetMeshCellEntities();
-
-			for (const TPair<FIntVector, TArray<FMassEntityHandle>>& CellPair : MeshCellEntities)
+			VisSub->FlushCellIndex();
+			VisSub->GetCellIndex().ForEachCell(EArcIWCellLayer::Mesh, [&](const FIntVector& Cell, TConstArrayView<FMassEntityHandle> CellEntities)
 			{
-				for (const FMassEntityHandle& EntityHandle : CellPair.Value)
+				for (const FMassEntityHandle& EntityHandle : CellEntities)
 				{
 					if (!EntityManager.IsEntityValid(EntityHandle))
 					{
@@ -386,7 +385,7 @@ void SArcIWMinimapTab::RefreshEntityData()
 					Entry.bHydrated = bHydrated;
 					CachedEntities.Add(Entry);
 				}
-			}
+			});
 		}
 	}
 
@@ -1192,38 +1192,43 @@ void FArcAIDebugger::DrawEntityDetailPanel()
 	if (ImGui::CollapsingHeader("Needs"))
 	{
 		bool bHasAnyNeeds = false;
+		const UWorld* NeedsWorld = Manager->GetWorld();
+		const double Now = NeedsWorld ? NeedsWorld->GetTimeSeconds() : 0.0;
 
 		if (const FArcHungerNeedFragment* Hunger = Manager->GetFragmentDataPtr<FArcHungerNeedFragment>(Entity))
 		{
 			bHasAnyNeeds = true;
-			float Ratio = Hunger->CurrentValue / 100.f;
+			const float Value = Hunger->GetValue(Now);
+			float Ratio = Value / 100.f;
 			ImGui::Text("Hunger");
 			ImGui::SameLine(150);
 			ImGui::ProgressBar(Ratio, ImVec2(200, 0));
 			ImGui::SameLine();
-			ImGui::Text("%.3f (Rate: %.4f)", Hunger->CurrentValue, Hunger->ChangeRate);
+			ImGui::Text("%.3f (Rate: %.4f)", Value, Hunger->ChangeRate);
 		}
 
 		if (const FArcThirstNeedFragment* Thirst = Manager->GetFragmentDataPtr<FArcThirstNeedFragment>(Entity))
 		{
 			bHasAnyNeeds = true;
-			float Ratio = Thirst->CurrentValue / 100.f;
+			const float Value = Thirst->GetValue(Now);
+			float Ratio = Value / 100.f;
 			ImGui::Text("Thirst");
 			ImGui::SameLine(150);
 			ImGui::ProgressBar(Ratio, ImVec2(200, 0));
 			ImGui::SameLine();
-			ImGui::Text("%.3f (Rate: %.4f)", Thirst->CurrentValue, Thirst->ChangeRate);
+			ImGui::Text("%.3f (Rate: %.4f)", Value, Thirst->ChangeRate);
 		}
 
 		if (const FArcFatigueNeedFragment* Fatigue = Manager->GetFragmentDataPtr<FArcFatigueNeedFragment>(Entity))
 		{
 			bHasAnyNeeds = true;
-			float Ratio = Fatigue->CurrentValue / 100.f;
+			const float Value = Fatigue->GetValue(Now);
+			float Ratio = Value / 100.f;
 			ImGui::Text("Fatigue");
 			ImGui::SameLine(150);
 			ImGui::ProgressBar(Ratio, ImVec2(200, 0));
 			ImGui::SameLine();
-			ImGui::Text("%.3f (Rate: %.4f)", Fatigue->CurrentValue, Fatigue->ChangeRate);
+			ImGui::Text("%.3f (Rate: %.4f)", Value, Fatigue->ChangeRate);
 		}
 
 		if (!bHasAnyNeeds)
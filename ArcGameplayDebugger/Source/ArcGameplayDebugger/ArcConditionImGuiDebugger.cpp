@@ -347,7 +347,7 @@ void FArcConditionImGuiDebugger::Draw()
 				}
 
 				const FArcConditionConfig* Config = ConfigsShared ? &ConfigsShared->Configs[Idx] : nullptr;
-				DrawConditionRow(ConditionTypeNamesAnsi[Idx], StatesFrag->States[Idx], Config,
+				DrawConditionRow(ConditionTypeNamesAnsi[Idx], StatesFrag->GetState(Idx), Config,
 					Arcx::GameplayDebugger::Conditions::GetGroupColor(Idx));
 			}
 		}
@@ -463,7 +463,7 @@ void FArcConditionImGuiDebugger::Draw()
 
 						FGameplayAttribute SatAttr = UArcConditionAttributeSet::GetSaturationAttributeByIndex(Idx);
 						float AttrSat = SatAttr.IsValid() ? ASC->GetNumericAttribute(SatAttr) : 0.f;
-						float FragSat = StatesFrag ? StatesFrag->States[Idx].Saturation : 0.f;
+						float FragSat = StatesFrag ? StatesFrag->Saturation[Idx] : 0.f;
 						bool bMatch = FMath::IsNearlyEqual(AttrSat, FragSat, 0.1f);
 						ImGui::Text("%-12s", ConditionTypeNamesAnsi[Idx]);
 						ImGui::SameLine(100.f);
@@ -787,6 +787,9 @@ void FArcEconomyDebugger::RefreshNeedsData()
 		{ FArcSettlementMoraleNeed::StaticStruct(),     TEXT("Morale") },
 	};
 
+	const UWorld* NeedsWorld = Manager->GetWorld();
+	const double Now = NeedsWorld ? NeedsWorld->GetTimeSeconds() : 0.0;
+
 	for (const FNeedCheck& Check : NeedChecks)
 	{
 		FStructView View = Manager->GetFragmentDataStruct(Entry.Entity, Check.Struct);
@@ -795,7 +798,7 @@ void FArcEconomyDebugger::RefreshNeedsData()
 			const FArcNeedFragment& Need = View.Get<FArcNeedFragment>();
 			FNeedEntry& NeedEntry = CachedNeeds.AddDefaulted_GetRef();
 			NeedEntry.Name = Check.Name;
-			NeedEntry.CurrentValue = Need.CurrentValue;
+			NeedEntry.CurrentValue = Need.GetValue(Now);
 			NeedEntry.ChangeRate = Need.ChangeRate;
 		}
 	}
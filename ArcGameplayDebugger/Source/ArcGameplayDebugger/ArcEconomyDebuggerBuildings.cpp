@@ -244,6 +244,16 @@ void FArcEconomyDebugger::DrawBuildingDetail()
 
 	FArcBuildingWorkforceFragment& Workforce = WorkforceView.Get<FArcBuildingWorkforceFragment>();
 
+	// Recipe edits bypass the governor, so flag the building for the transport board and demand graph here
+	UArcSettlementSubsystem* SettlementSub = Arcx::GameplayDebugger::Economy::GetSettlementSubsystem();
+	auto MarkBuildingDirty = [SettlementSub, BuildingFrag, &Building]()
+	{
+		if (SettlementSub && BuildingFrag)
+		{
+			SettlementSub->MarkBuildingDirty(BuildingFrag->SettlementHandle, Building.Entity);
+		}
+	};
+
 	ImGui::SeparatorText("Production Slots");
 
 	constexpr ImGuiTableFlags SlotTableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_SizingStretchProp;
@@ -276,6 +286,7 @@ void FArcEconomyDebugger::DrawBuildingDetail()
 					if (ImGui::Selectable("(none)", Slot.DesiredRecipe == nullptr))
 					{
 						Slot.DesiredRecipe = nullptr;
+						MarkBuildingDirty();
 					}
 
 					for (const TObjectPtr<UArcRecipeDefinition>& Recipe : EconConfig->AllowedRecipes)
@@ -289,6 +300,7 @@ void FArcEconomyDebugger::DrawBuildingDetail()
 						if (ImGui::Selectable(TCHAR_TO_ANSI(*RecipeName), bIsSelected))
 						{
 							Slot.DesiredRecipe = Recipe;
+							MarkBuildingDirty();
 						}
 					}
 					ImGui::EndCombo();
@@ -91,8 +91,6 @@ void FArcEconomyDebugger::RefreshDemandGraph()
 		return;
 	}
 
-	const TArray<FMassEntityHandle>& BuildingHandles = SettlementSub->GetBuildingsForSettlement(Settlement.Entity);
-
 	FStructView MarketView = Manager->GetFragmentDataStruct(
 		Settlement.Entity, FArcSettlementMarketFragment::StaticStruct());
 	if (!MarketView.IsValid())
@@ -101,7 +99,8 @@ void FArcEconomyDebugger::RefreshDemandGraph()
 	}
 
 	const FArcSettlementMarketFragment& Market = MarketView.Get<FArcSettlementMarketFragment>();
-	CachedDemandGraph.Rebuild(*Manager, Settlement.Entity, BuildingHandles, Market);
+	// Shares the settlement's persistent graph with the governor; only dirty buildings are re-read.
+	CachedDemandGraph = SettlementSub->UpdateDemandGraph(*Manager, Settlement.Entity, Market);
 
 	// Compute layered layout positions based on chain depth.
 	// Edges go Consumer→Producer, so we BFS from rightmost (leaf consumers
@@ -6,6 +6,7 @@
 #include "MassEntitySubsystem.h"
 #include "MassDebugger.h"
 #include "Mass/ArcEconomyFragments.h"
+#include "Mass/ArcMarketPriceTable.h"
 #include "ArcSettlementSubsystem.h"
 #include "ArcKnowledgeSubsystem.h"
 #include "ArcKnowledgeEntry.h"
@@ -234,11 +235,7 @@ void FArcEconomyDebugger::DrawMarketTab()
 				if (ImGui::Button("Reset All Supply/Demand Counters"))
 				{
 					FArcSettlementMarketFragment& ResetMarket = ResetMarketView.Get<FArcSettlementMarketFragment>();
-					for (TTuple<TObjectPtr<UArcItemDefinition>, FArcResourceMarketData>& Pair : ResetMarket.PriceTable)
-					{
-						Pair.Value.SupplyCounter = 0.0f;
-						Pair.Value.DemandCounter = 0.0f;
-					}
+					ArcMarket::ResetCounters(ResetMarket);
 				}
 			}
 		}
@@ -337,7 +334,11 @@ void FArcEconomyDebugger::DrawMarketTab()
 						continue;
 					}
 					FString PriceLabel = FString::Printf(TEXT("Price##%s"), *PriceEntry.ItemName);
-					ImGui::InputFloat(TCHAR_TO_ANSI(*PriceLabel), &MarketData->Price, 0.1f, 1.0f, "%.2f");
+					float EditedPrice = MarketData->Price;
+					if (ImGui::InputFloat(TCHAR_TO_ANSI(*PriceLabel), &EditedPrice, 0.1f, 1.0f, "%.2f"))
+					{
+						ArcMarket::SetPrice(PriceMarket, *MarketData, EditedPrice);
+					}
 				}
 
 				if (PriceMarket.PriceTable.IsEmpty())
@@ -249,6 +249,7 @@ void UArcGameplayDebuggerSubsystem::Tick(float DeltaTime)
 					ToggleDebuggerMenuItem("Entity Debugger", MassEntityDebugger);
 					ToggleDebuggerMenuItem("Entity Visualization", VisEntityDebugger);
 					ToggleDebuggerMenuItem("Physics Debugger", PhysicsDebugger);
+					ToggleDebuggerMenuItem("Processor Stats", ProcessorStatsDebugger);
 					ImGui::Separator();
 					ToggleDebuggerMenuItem("Spatial Hash Minimap", SpatialHashMinimapDebugger);
 					ToggleDebuggerMenuItem("Visualization Minimap", VisualizationMinimapDebugger);
@@ -285,6 +286,7 @@ void UArcGameplayDebuggerSubsystem::Tick(float DeltaTime)
 				DrawIfVisible(TQSDebugger);
 				DrawIfVisible(VisEntityDebugger);
 				DrawIfVisible(PhysicsDebugger);
+				DrawIfVisible(ProcessorStatsDebugger);
 				DrawIfVisible(KnowledgeDebugger);
 				DrawIfVisible(AreaDebugger);
 				DrawIfVisible(SpatialHashMinimapDebugger);
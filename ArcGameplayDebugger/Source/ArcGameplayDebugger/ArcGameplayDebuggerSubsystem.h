@@ -20,6 +20,7 @@
 #include "ArcPerceptionDebugger.h"
 #include "ArcMassEntityDebugger.h"
 #include "ArcMassPhysicsDebugger.h"
+#include "ArcMassProcessorStatsDebugger.h"
 #include "ArcPathDebugger.h"
 #include "ArcVisEntityDebugger.h"
 #include "ArcKnowledgeDebugger.h"
@@ -78,6 +79,8 @@ private:
 
 	FArcMassPhysicsDebugger PhysicsDebugger;
 
+	FArcMassProcessorStatsDebugger ProcessorStatsDebugger;
+
 	FArcAIDebugger AIDebugger;
 
 	FArcPlanFeasibilityDebugger PlanFeasibilityDebugger;
@@ -431,16 +431,12 @@ void FArcIWMinimapDebugger::DrawGrid()
 		}
 	}
 
-	// Build set of occupied cells for lookup
-	const TMap<FIntVector, TArray<FMassEntityHandle>>* MeshCellEntitiesPtr = nullptr;
-	const TMap<FIntVector, TArray<FMassEntityHandle>>* PhysicsCellEntitiesPtr = nullptr;
-	const TMap<FIntVector, TArray<FMassEntityHandle>>* ActorCellEntitiesPtr = nullptr;
+	// Occupied cell lookup
+	const FArcIWCellIndex* CellIndex = nullptr;
 	if (VisSub)
 	{
-		MeshCellEntitiesPtr = &VisSub->GetMeshCellEntities();
-		PhysicsCellEntitiesPtr = &VisSub->GetPhysicsCellEntities();
-		ActorCellEntitiesPtr = &VisSub->GetActorCellEntities();
-		OccupiedCellCount = MeshCellEntitiesPtr->Num();
+		CellIndex = &VisSub->GetCellIndex();
+		OccupiedCellCount = CellIndex->GetNumOccupiedCells(EArcIWCellLayer::Mesh);
 	}
 
 	const FIntVector MeshPlayerCell = VisSub ? VisSub->GetLastMeshPlayerCell() : FIntVector(TNumericLimits<int32>::Max());
@@ -456,7 +452,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, MeshCellSz, ScreenMin, ScreenMax)) continue;
-			if (MeshCellEntitiesPtr && MeshCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Mesh, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, MeshRemoveActiveFillColor);
 			}
@@ -473,7 +469,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, MeshCellSz, ScreenMin, ScreenMax)) continue;
-			if (MeshCellEntitiesPtr && MeshCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Mesh, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, MeshAddActiveFillColor);
 			}
@@ -490,7 +486,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, PhysicsCellSz, ScreenMin, ScreenMax)) continue;
-			if (PhysicsCellEntitiesPtr && PhysicsCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Physics, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, PhysicsRemoveActiveFillColor);
 			}
@@ -507,7 +503,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, PhysicsCellSz, ScreenMin, ScreenMax)) continue;
-			if (PhysicsCellEntitiesPtr && PhysicsCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Physics, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, PhysicsAddActiveFillColor);
 			}
@@ -524,7 +520,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, ActorCellSz, ScreenMin, ScreenMax)) continue;
-			if (ActorCellEntitiesPtr && ActorCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Actor, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, DehydrationActiveFillColor);
 			}
@@ -541,7 +537,7 @@ void FArcIWMinimapDebugger::DrawGrid()
 		{
 			ImVec2 ScreenMin, ScreenMax;
 			if (!CellToScreenRect(Cell, ActorCellSz, ScreenMin, ScreenMax)) continue;
-			if (ActorCellEntitiesPtr && ActorCellEntitiesPtr->Contains(Cell))
+			if (CellIndex && CellIndex->HasEntities(EArcIWCellLayer::Actor, Cell))
 			{
 				DrawList->AddRectFilled(ScreenMin, ScreenMax, ActorActiveFillColor);
 			}
@@ -609,12 +605,13 @@ void FArcIWMinimapDebugger::DrawEntities()
 	// This covers every loaded entity including ones not yet in any spatial grid.
 	for (TActorIterator<AArcIWMassISMPartitionActor> It(EntityWorld); It; ++It)
 	{
+		const FArcIWInstanceStore& InstanceStore = It->GetInstanceStore();
 		const TArray<FArcIWActorClassData>& ClassEntries = It->GetActorClassEntries();
 		for (const FArcIWActorClassData& Entry : ClassEntries)
 		{
-			for (const FTransform& InstanceTransform : Entry.InstanceTransforms)
+			for (int32 TransformIndex = 0; TransformIndex < Entry.NumInstances; ++TransformIndex)
 			{
-				const FVector& Position = InstanceTransform.GetLocation();
+				const FVector Position = InstanceStore.GetLocation(Entry.FirstStoreIndex + TransformIndex);
 				const ImVec2 ScreenPos = WorldToScreen(Position.X, Position.Y);
 
 				if (ScreenPos.x < CanvasPos.x - EntityRadius || ScreenPos.x > CanvasPos.x + CanvasSize.x + EntityRadius ||
@@ -7,6 +7,7 @@
 #include "MassEntitySubsystem.h"
 #include "Mass/EntityElementTypes.h"
 #include "ArcMassEntityDebuggerDrawComponent.h"
+#include "ArcMassStateTreeTickScheduler.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/Engine.h"
@@ -354,6 +355,14 @@ void FArcMassEntityDebugger::Draw()
 		}
 	}
 
+	// StateTree tick scheduling counters (last UArcMassStateTreeTickProcessor run)
+	if (const UArcMassStateTreeTickScheduler* TickScheduler = World ? World->GetSubsystem<UArcMassStateTreeTickScheduler>() : nullptr)
+	{
+		const FArcMassStateTreeTickStats& TickStats = TickScheduler->GetLastFrameStats();
+		ImGui::Text("StateTree ticks: ticked %d (parallel %d)  parked %d  woken %d  skipped %d  |  parked total %d",
+			TickStats.Ticked, TickStats.ParallelTicked, TickStats.Parked, TickStats.Woken, TickStats.Skipped, TickScheduler->GetNumParked());
+	}
+
 	ImGui::Separator();
 
 	// Split into two panes
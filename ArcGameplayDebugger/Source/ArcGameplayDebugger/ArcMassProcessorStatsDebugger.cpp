@@ -0,0 +1,170 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassProcessorStatsDebugger.h"
+
+#include "imgui.h"
+#include "HAL/IConsoleManager.h"
+
+void FArcMassProcessorStatsDebugger::Initialize()
+{
+	CachedSummaries.Reset();
+	SelectedSamples.Reset();
+	SelectedProcessor = NAME_None;
+	FilterBuf[0] = '\0';
+}
+
+void FArcMassProcessorStatsDebugger::Uninitialize()
+{
+	CachedSummaries.Reset();
+	SelectedSamples.Reset();
+}
+
+void FArcMassProcessorStatsDebugger::Draw()
+{
+	ImGui::SetNextWindowSize(ImVec2(900, 600), ImGuiCond_FirstUseEver);
+	if (!ImGui::Begin("Mass Processor Stats", &bShow))
+	{
+		ImGui::End();
+		return;
+	}
+
+	FArcMassProcessorStats& Stats = FArcMassProcessorStats::Get();
+
+	bool bRecording = Stats.IsRecording();
+	if (ImGui::Checkbox("Record", &bRecording))
+	{
+		Stats.SetRecording(bRecording);
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Reset"))
+	{
+		Stats.Reset();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Dump CSV"))
+	{
+		IConsoleManager::Get().ProcessUserConsoleInput(TEXT("arc.mass.DumpProcessorStats"), *GLog, nullptr);
+	}
+
+	Stats.GetSummaries(CachedSummaries);
+	CachedSummaries.Sort([](const FArcMassProcessorStatsSummary& A, const FArcMassProcessorStatsSummary& B)
+	{
+		return A.AvgWallTimeMs > B.AvgWallTimeMs;
+	});
+
+	float TotalWallTimeMs = 0.f;
+	for (const FArcMassProcessorStatsSummary& Summary : CachedSummaries)
+	{
+		TotalWallTimeMs += Summary.AvgWallTimeMs;
+	}
+	ImGui::SameLine();
+	ImGui::Text("Processors: %d  Avg total: %.3f ms", CachedSummaries.Num(), TotalWallTimeMs);
+
+	ImGui::InputText("Filter", FilterBuf, IM_ARRAYSIZE(FilterBuf));
+	ImGui::Separator();
+
+	const float TableHeight = ImGui::GetContentRegionAvail().y * 0.65f;
+	if (ImGui::BeginChild("ProcessorStatsTable", ImVec2(0, TableHeight), ImGuiChildFlags_Borders))
+	{
+		DrawSummaryTable();
+	}
+	ImGui::EndChild();
+
+	if (ImGui::BeginChild("ProcessorStatsHistory", ImVec2(0, 0), ImGuiChildFlags_Borders))
+	{
+		DrawSelectedHistory();
+	}
+	ImGui::EndChild();
+
+	ImGui::End();
+}
+
+void FArcMassProcessorStatsDebugger::DrawSummaryTable()
+{
+	const FString Filter = FString(ANSI_TO_TCHAR(FilterBuf)).ToLower();
+
+	const ImGuiTableFlags TableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+	if (!ImGui::BeginTable("ProcessorStats", 8, TableFlags))
+	{
+		return;
+	}
+
+	ImGui::TableSetupScrollFreeze(0, 1);
+	ImGui::TableSetupColumn("Processor", ImGuiTableColumnFlags_WidthStretch, 3.f);
+	ImGui::TableSetupColumn("Avg ms");
+	ImGui::TableSetupColumn("Max ms");
+	ImGui::TableSetupColumn("GT ms");
+	ImGui::TableSetupColumn("Worker ms");
+	ImGui::TableSetupColumn("Entities");
+	ImGui::TableSetupColumn("Chunks");
+	ImGui::TableSetupColumn("Parallel");
+	ImGui::TableHeadersRow();
+
+	for (const FArcMassProcessorStatsSummary& Summary : CachedSummaries)
+	{
+		const FString Name = Summary.Processor.ToString();
+		if (!Filter.IsEmpty() && !Name.ToLower().Contains(Filter))
+		{
+			continue;
+		}
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		if (ImGui::Selectable(TCHAR_TO_ANSI(*Name), SelectedProcessor == Summary.Processor, ImGuiSelectableFlags_SpanAllColumns))
+		{
+			SelectedProcessor = Summary.Processor;
+		}
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", Summary.AvgWallTimeMs);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", Summary.MaxWallTimeMs);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", Summary.AvgGameThreadMs);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", Summary.AvgWorkerMs);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.0f", Summary.AvgEntities);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.1f", Summary.AvgChunks);
+		ImGui::TableNextColumn();
+		ImGui::Text("%s", Summary.bParallelChunks ? "Yes" : "-");
+	}
+
+	ImGui::EndTable();
+}
+
+void FArcMassProcessorStatsDebugger::DrawSelectedHistory()
+{
+	if (SelectedProcessor.IsNone())
+	{
+		ImGui::TextDisabled("Select a processor to see its samples");
+		return;
+	}
+
+	FArcMassProcessorStats::Get().GetSamples(SelectedProcessor, SelectedSamples);
+	if (SelectedSamples.IsEmpty())
+	{
+		ImGui::TextDisabled("No samples for %s", TCHAR_TO_ANSI(*SelectedProcessor.ToString()));
+		return;
+	}
+
+	TArray<float> WallTimes;
+	TArray<float> Entities;
+	WallTimes.Reserve(SelectedSamples.Num());
+	Entities.Reserve(SelectedSamples.Num());
+	for (const FArcMassProcessorSample& Sample : SelectedSamples)
+	{
+		WallTimes.Add(Sample.WallTimeMs);
+		Entities.Add(static_cast<float>(Sample.NumEntities));
+	}
+
+	const FArcMassProcessorSample& Last = SelectedSamples.Last();
+	ImGui::TextColored(ImVec4(0.4f, 1.0f, 0.4f, 1.0f), "%s", TCHAR_TO_ANSI(*SelectedProcessor.ToString()));
+	ImGui::Text("Last: frame %llu  %.3f ms  (GT %.3f / worker %.3f)  %d entities in %d chunks%s",
+		Last.Frame, Last.WallTimeMs, Last.GameThreadMs, Last.WorkerMs, Last.NumEntities, Last.NumChunks,
+		Last.bParallelChunks ? "  [parallel]" : "");
+
+	const float PlotWidth = ImGui::GetContentRegionAvail().x;
+	ImGui::PlotLines("##WallTime", WallTimes.GetData(), WallTimes.Num(), 0, "Wall ms", 0.f, FLT_MAX, ImVec2(PlotWidth, 80.f));
+	ImGui::PlotLines("##Entities", Entities.GetData(), Entities.Num(), 0, "Entities", 0.f, FLT_MAX, ImVec2(PlotWidth, 60.f));
+}
@@ -0,0 +1,24 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
+
+class FArcMassProcessorStatsDebugger
+{
+public:
+	void Initialize();
+	void Uninitialize();
+	void Draw();
+
+	bool bShow = false;
+
+private:
+	void DrawSummaryTable();
+	void DrawSelectedHistory();
+
+	TArray<FArcMassProcessorStatsSummary> CachedSummaries;
+	TArray<FArcMassProcessorSample> SelectedSamples;
+	FName SelectedProcessor;
+	char FilterBuf[256] = {};
+};
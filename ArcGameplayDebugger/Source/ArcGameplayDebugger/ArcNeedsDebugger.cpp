@@ -286,6 +286,9 @@ void FArcNeedsDebugger::DrawDetailPanel()
 				{ "Fatigue", FArcFatigueNeedFragment::StaticStruct(), Entry.NeedInfo.bHasFatigue },
 			};
 
+			const UWorld* NeedsWorld = Manager->GetWorld();
+			const double Now = NeedsWorld ? NeedsWorld->GetTimeSeconds() : 0.0;
+
 			for (const FNeedRow& Row : Rows)
 			{
 				if (!Row.bPresent)
@@ -300,6 +303,7 @@ void FArcNeedsDebugger::DrawDetailPanel()
 				}
 
 				const FArcNeedFragment& Frag = FragView.Get<FArcNeedFragment>();
+				const float NeedValue = Frag.GetValue(Now);
 
 				ImGui::TableNextRow();
 
@@ -308,10 +312,10 @@ void FArcNeedsDebugger::DrawDetailPanel()
 
 				ImGui::TableSetColumnIndex(1);
 				{
-					float NormalizedVal = FMath::Clamp(Frag.CurrentValue / 100.f, 0.f, 1.f);
-					ImVec4 BarColor = Arcx::GameplayDebugger::Needs::GetNeedValueColor(Frag.CurrentValue);
+					float NormalizedVal = FMath::Clamp(NeedValue / 100.f, 0.f, 1.f);
+					ImVec4 BarColor = Arcx::GameplayDebugger::Needs::GetNeedValueColor(NeedValue);
 					ImGui::PushStyleColor(ImGuiCol_PlotHistogram, BarColor);
-					FString BarLabel = FString::Printf(TEXT("%.1f"), Frag.CurrentValue);
+					FString BarLabel = FString::Printf(TEXT("%.1f"), NeedValue);
 					ImGui::ProgressBar(NormalizedVal, ImVec2(-1.f, 0.f), TCHAR_TO_ANSI(*BarLabel));
 					ImGui::PopStyleColor();
 				}
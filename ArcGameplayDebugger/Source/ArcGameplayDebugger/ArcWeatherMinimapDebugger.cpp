@@ -342,6 +342,7 @@ void FArcWeatherMinimapDebugger::HandleInput()
 					NewCell.BaseClimate = WeatherSub->DefaultClimate;
 					NewCell.HumidityThreshold = WeatherSub->DefaultHumidityThreshold;
 					NewCell.FreezeThreshold = WeatherSub->DefaultFreezeThreshold;
+					WeatherSub->MarkClimateDirty();
 					bHasSelectedCell = true;
 					SelectedCellCoords = CellCoords;
 				}
@@ -739,10 +740,16 @@ void FArcWeatherMinimapDebugger::DrawSelectedCellPanel()
 	ImGui::Text("Thr:");
 	ImGui::SameLine();
 	ImGui::SetNextItemWidth(80.f);
-	ImGui::DragFloat("Rain##thr", &Cell->HumidityThreshold, 0.5f, 0.f, 100.f, "%.1f%%");
+	if (ImGui::DragFloat("Rain##thr", &Cell->HumidityThreshold, 0.5f, 0.f, 100.f, "%.1f%%"))
+	{
+		WeatherSub->MarkClimateDirty();
+	}
 	ImGui::SameLine();
 	ImGui::SetNextItemWidth(80.f);
-	ImGui::DragFloat("Freeze##thr", &Cell->FreezeThreshold, 0.5f, -50.f, 50.f, "%.1f C");
+	if (ImGui::DragFloat("Freeze##thr", &Cell->FreezeThreshold, 0.5f, -50.f, 50.f, "%.1f C"))
+	{
+		WeatherSub->MarkClimateDirty();
+	}
 
 	// Action buttons
 	ImGui::SameLine();
@@ -754,6 +761,7 @@ void FArcWeatherMinimapDebugger::DrawSelectedCellPanel()
 	if (ImGui::SmallButton("Delete Cell"))
 	{
 		WeatherSub->GetMutableGrid().Remove(SelectedCellCoords);
+		WeatherSub->MarkClimateDirty();
 		bHasSelectedCell = false;
 	}
 
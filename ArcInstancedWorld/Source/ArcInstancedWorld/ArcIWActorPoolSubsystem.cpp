@@ -1,9 +1,99 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcIWActorPoolSubsystem.h"
+#include "ArcInstancedWorld/ArcInstancedWorld.h"
+#include "ArcInstancedWorld/ArcIWSettings.h"
 #include "ArcInstancedWorld/Components/ArcIWEntityComponent.h"
 #include "Engine/World.h"
 
+void UArcIWActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Configured low watermarks are filled by Tick; registering the classes here makes them eligible
+	// before the first hydration asks for them.
+	for (const FArcIWActorPoolClassConfig& ClassConfig : UArcIWSettings::Get()->ActorPoolClasses)
+	{
+		if (ClassConfig.LowWatermark > 0)
+		{
+			if (UClass* ActorClass = ClassConfig.ActorClass.LoadSynchronous())
+			{
+				FindOrAddClassPool(ActorClass);
+			}
+		}
+	}
+}
+
+void UArcIWActorPoolSubsystem::Deinitialize()
+{
+	for (const TPair<TSubclassOf<AActor>, FClassPool>& Pair : ClassPools)
+	{
+		const FArcIWActorPoolStats& Stats = Pair.Value.Stats;
+		if (Stats.Hits + Stats.Misses > 0)
+		{
+			UE_LOG(LogArcIW, Log, TEXT("Actor pool %s: %.1f%% hits (%lld hits, %lld misses), %lld prewarmed, %lld trimmed, peak %d in use"),
+				*GetNameSafe(Pair.Key.Get()), Stats.GetHitRate() * 100.0, Stats.Hits, Stats.Misses, Stats.Prewarmed, Stats.Trimmed, Stats.PeakInUse);
+		}
+	}
+	ClassPools.Empty();
+
+	Super::Deinitialize();
+}
+
+void UArcIWActorPoolSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World || !World->HasBegunPlay())
+	{
+		return;
+	}
+
+	const double BudgetSeconds = UArcIWSettings::Get()->PoolSpawnFrameBudgetMs * 0.001;
+	if (BudgetSeconds <= 0.0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcIWActorPoolRefill);
+
+	// Budget is checked after each spawn, so at least one actor is spawned per frame while any pool is short.
+	const double StartTime = FPlatformTime::Seconds();
+	const double WorldTime = World->GetTimeSeconds();
+	for (TPair<TSubclassOf<AActor>, FClassPool>& Pair : ClassPools)
+	{
+		FClassPool& Pool = Pair.Value;
+
+		// The predicted entities never hydrated (the player turned away), so stop holding actors for them.
+		if (Pool.PrewarmTarget > 0 && WorldTime >= Pool.PrewarmExpireTime)
+		{
+			Pool.PrewarmTarget = 0;
+		}
+
+		while (Pool.FreeActors.Num() < Pool.GetRefillTarget())
+		{
+			AActor* Actor = SpawnPooledActor(Pair.Key, FTransform::Identity);
+			if (!Actor)
+			{
+				break;
+			}
+
+			DeactivateActor(Actor);
+			Pool.FreeActors.Add(Actor);
+			++Pool.Stats.Prewarmed;
+
+			if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				return;
+			}
+		}
+	}
+}
+
+TStatId UArcIWActorPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArcIWActorPoolSubsystem, STATGROUP_Tickables);
+}
+
 AActor* UArcIWActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform, FMassEntityHandle EntityHandle)
 {
 	if (!ActorClass)
@@ -11,27 +101,30 @@ AActor* UArcIWActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, c
 		return nullptr;
 	}
 
+	FClassPool& Pool = FindOrAddClassPool(ActorClass);
 	AActor* Actor = nullptr;
 
 	// Try to reuse a pooled actor
-	TArray<TObjectPtr<AActor>>* Pool = PooledActors.Find(ActorClass);
-	if (Pool && Pool->Num() > 0)
+	while (!Actor && Pool.FreeActors.Num() > 0)
 	{
-		Actor = Pool->Pop();
+		Actor = Pool.FreeActors.Pop(EAllowShrinking::No);
+		if (!IsValid(Actor))
+		{
+			Actor = nullptr;
+		}
+	}
+
+	if (Actor)
+	{
+		++Pool.Stats.Hits;
 		ActivateActor(Actor, Transform);
 	}
 	else
 	{
-		// Spawn new actor
-		UWorld* World = GetWorld();
-		if (!World)
-		{
-			return nullptr;
-		}
-
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		Actor = World->SpawnActor<AActor>(ActorClass, Transform, SpawnParams);
+		// Pool miss: spawn on this frame. Misses mean the watermarks or prewarm margin are too small.
+		++Pool.Stats.Misses;
+		UE_LOG(LogArcIW, Verbose, TEXT("Actor pool miss for %s, spawning synchronously"), *GetNameSafe(ActorClass.Get()));
+		Actor = SpawnPooledActor(ActorClass, Transform);
 	}
 
 	if (!Actor)
@@ -39,6 +132,10 @@ AActor* UArcIWActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, c
 		return nullptr;
 	}
 
+	Pool.PrewarmTarget = FMath::Max(0, Pool.PrewarmTarget - 1);
+	++Pool.Stats.InUse;
+	Pool.Stats.PeakInUse = FMath::Max(Pool.Stats.PeakInUse, Pool.Stats.InUse);
+
 	// Ensure entity component exists and set the handle
 	UArcIWEntityComponent* EntityComp = EnsureEntityComponent(Actor);
 	EntityComp->SetEntityHandle(EntityHandle);
@@ -60,10 +157,18 @@ void UArcIWActorPoolSubsystem::ReleaseActor(AActor* Actor)
 		EntityComp->ClearEntityHandle();
 	}
 
-	DeactivateActor(Actor);
+	FClassPool& Pool = FindOrAddClassPool(Actor->GetClass());
+	Pool.Stats.InUse = FMath::Max(0, Pool.Stats.InUse - 1);
 
-	TSubclassOf<AActor> ActorClass = Actor->GetClass();
-	PooledActors.FindOrAdd(ActorClass).Add(Actor);
+	if (Pool.FreeActors.Num() >= Pool.HighWatermark)
+	{
+		++Pool.Stats.Trimmed;
+		Actor->Destroy();
+		return;
+	}
+
+	DeactivateActor(Actor);
+	Pool.FreeActors.Add(Actor);
 }
 
 void UArcIWActorPoolSubsystem::WarmPool(TSubclassOf<AActor> ActorClass, int32 Count)
@@ -73,27 +178,99 @@ void UArcIWActorPoolSubsystem::WarmPool(TSubclassOf<AActor> ActorClass, int32 Co
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	FClassPool& Pool = FindOrAddClassPool(ActorClass);
+	Pool.FreeActors.Reserve(Pool.FreeActors.Num() + Count);
+
+	for (int32 Idx = 0; Idx < Count; ++Idx)
+	{
+		AActor* Actor = SpawnPooledActor(ActorClass, FTransform::Identity);
+		if (Actor)
+		{
+			DeactivateActor(Actor);
+			Pool.FreeActors.Add(Actor);
+		}
+	}
+}
+
+void UArcIWActorPoolSubsystem::RequestPrewarm(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!ActorClass || Count <= 0)
 	{
 		return;
 	}
 
-	TArray<TObjectPtr<AActor>>& Pool = PooledActors.FindOrAdd(ActorClass);
-	Pool.Reserve(Pool.Num() + Count);
+	FClassPool& Pool = FindOrAddClassPool(ActorClass);
+	Pool.PrewarmTarget = FMath::Min(Pool.HighWatermark, Pool.PrewarmTarget + Count);
 
-	for (int32 Idx = 0; Idx < Count; ++Idx)
+	const UWorld* World = GetWorld();
+	Pool.PrewarmExpireTime = (World ? World->GetTimeSeconds() : 0.0) + UArcIWSettings::Get()->PoolPrewarmWindowSeconds;
+}
+
+const FArcIWActorPoolStats* UArcIWActorPoolSubsystem::FindStats(TSubclassOf<AActor> ActorClass) const
+{
+	const FClassPool* Pool = ClassPools.Find(ActorClass);
+	return Pool ? &Pool->Stats : nullptr;
+}
+
+FArcIWActorPoolStats UArcIWActorPoolSubsystem::GetTotalStats() const
+{
+	FArcIWActorPoolStats Total;
+	for (const TPair<TSubclassOf<AActor>, FClassPool>& Pair : ClassPools)
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		AActor* Actor = World->SpawnActor<AActor>(ActorClass, FTransform::Identity, SpawnParams);
-		if (Actor)
+		const FArcIWActorPoolStats& Stats = Pair.Value.Stats;
+		Total.Hits += Stats.Hits;
+		Total.Misses += Stats.Misses;
+		Total.Prewarmed += Stats.Prewarmed;
+		Total.Trimmed += Stats.Trimmed;
+		Total.InUse += Stats.InUse;
+		Total.PeakInUse += Stats.PeakInUse;
+	}
+	return Total;
+}
+
+UArcIWActorPoolSubsystem::FClassPool& UArcIWActorPoolSubsystem::FindOrAddClassPool(TSubclassOf<AActor> ActorClass)
+{
+	if (FClassPool* Existing = ClassPools.Find(ActorClass))
+	{
+		return *Existing;
+	}
+
+	const UArcIWSettings* Settings = UArcIWSettings::Get();
+	FClassPool& Pool = ClassPools.Add(ActorClass);
+	Pool.LowWatermark = Settings->DefaultPoolLowWatermark;
+	Pool.HighWatermark = Settings->DefaultPoolHighWatermark;
+
+	const TSoftClassPtr<AActor> SoftClass(ActorClass.Get());
+	for (const FArcIWActorPoolClassConfig& ClassConfig : Settings->ActorPoolClasses)
+	{
+		if (ClassConfig.ActorClass == SoftClass)
 		{
-			EnsureEntityComponent(Actor);
-			DeactivateActor(Actor);
-			Pool.Add(Actor);
+			Pool.LowWatermark = ClassConfig.LowWatermark;
+			Pool.HighWatermark = ClassConfig.HighWatermark;
+			break;
 		}
 	}
+	Pool.HighWatermark = FMath::Max(Pool.HighWatermark, Pool.LowWatermark);
+
+	return Pool;
+}
+
+AActor* UArcIWActorPoolSubsystem::SpawnPooledActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Actor = World->SpawnActor<AActor>(ActorClass, Transform, SpawnParams);
+	if (Actor)
+	{
+		EnsureEntityComponent(Actor);
+	}
+	return Actor;
 }
 
 UArcIWEntityComponent* UArcIWActorPoolSubsystem::EnsureEntityComponent(AActor* Actor)
@@ -9,17 +9,54 @@
 
 class UArcIWEntityComponent;
 
+/** Pool counters for one actor class. */
+struct FArcIWActorPoolStats
+{
+	/** Acquires served from the pool. */
+	int64 Hits = 0;
+
+	/** Acquires that had to spawn on the calling frame. */
+	int64 Misses = 0;
+
+	/** Actors spawned into the pool by the background refill. */
+	int64 Prewarmed = 0;
+
+	/** Released actors destroyed because the pool was at its high watermark. */
+	int64 Trimmed = 0;
+
+	int32 InUse = 0;
+	int32 PeakInUse = 0;
+
+	double GetHitRate() const
+	{
+		const int64 Total = Hits + Misses;
+		return Total > 0 ? static_cast<double>(Hits) / static_cast<double>(Total) : 1.0;
+	}
+};
+
 /**
  * Actor pool for ArcInstancedWorld hydrated actors.
  * Actors are reused across entity activations to avoid spawn/destroy overhead.
  * Each pooled actor is guaranteed to have a UArcIWEntityComponent.
+ *
+ * Each class keeps between a low and a high watermark of free actors (UArcIWSettings::ActorPoolClasses).
+ * Refills happen in Tick under UArcIWSettings::PoolSpawnFrameBudgetMs, targeting the larger of the low
+ * watermark and the predicted demand reported by cell tracking (RequestPrewarm), so hydration near the
+ * player pops a pooled actor instead of spawning.
  */
 UCLASS()
-class ARCINSTANCEDWORLD_API UArcIWActorPoolSubsystem : public UWorldSubsystem
+class ARCINSTANCEDWORLD_API UArcIWActorPoolSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
+	//~ UTickableWorldSubsystem
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End of UTickableWorldSubsystem
+
 	/**
 	 * Acquire an actor from the pool or spawn a new one.
 	 * The returned actor will have a UArcIWEntityComponent with the entity handle set.
@@ -34,22 +71,57 @@ public:
 	/**
 	 * Release an actor back to the pool.
 	 * Clears the entity link, hides the actor, and disables collision/ticking.
+	 * Destroys it instead if the class is already at its high watermark.
 	 *
 	 * @param Actor  The actor to release.
 	 */
 	void ReleaseActor(AActor* Actor);
 
 	/**
-	 * Pre-warm the pool by spawning actors ahead of time.
+	 * Pre-warm the pool by spawning actors immediately.
 	 *
 	 * @param ActorClass  Class to pre-spawn.
 	 * @param Count  Number of actors to add to the pool.
 	 */
 	void WarmPool(TSubclassOf<AActor> ActorClass, int32 Count);
 
+	/**
+	 * Report that Count entities of ActorClass are about to need actors. The pool is refilled towards
+	 * that many free actors over the next frames, within the spawn budget and the high watermark.
+	 * Demand not acquired within UArcIWSettings::PoolPrewarmWindowSeconds is forgotten.
+	 */
+	void RequestPrewarm(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** Counters for a class, or null if it was never pooled. */
+	const FArcIWActorPoolStats* FindStats(TSubclassOf<AActor> ActorClass) const;
+
+	/** Counters summed over every class. */
+	FArcIWActorPoolStats GetTotalStats() const;
+
 private:
-	/** Pooled actors grouped by class. */
-	TMap<TSubclassOf<AActor>, TArray<TObjectPtr<AActor>>> PooledActors;
+	struct FClassPool
+	{
+		TArray<TObjectPtr<AActor>> FreeActors;
+		int32 LowWatermark = 0;
+		int32 HighWatermark = 0;
+
+		/** Free actors predicted to be needed soon; consumed by acquires. */
+		int32 PrewarmTarget = 0;
+
+		/** World time after which the rest of PrewarmTarget is dropped. Extended by each RequestPrewarm. */
+		double PrewarmExpireTime = 0.0;
+
+		FArcIWActorPoolStats Stats;
+
+		int32 GetRefillTarget() const { return FMath::Min(HighWatermark, FMath::Max(LowWatermark, PrewarmTarget)); }
+	};
+
+	/** Pooled actors grouped by class. Watermarks are resolved from settings on first use. */
+	TMap<TSubclassOf<AActor>, FClassPool> ClassPools;
+
+	FClassPool& FindOrAddClassPool(TSubclassOf<AActor> ActorClass);
+
+	AActor* SpawnPooledActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform);
 
 	/** Ensure the actor has a UArcIWEntityComponent. Returns the component. */
 	UArcIWEntityComponent* EnsureEntityComponent(AActor* Actor);
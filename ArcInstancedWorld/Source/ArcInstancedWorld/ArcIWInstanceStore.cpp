@@ -0,0 +1,204 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcIWInstanceStore.h"
+#include "ArcInstancedWorld/ArcInstancedWorld.h"
+#include "ArcInstancedWorld/ArcIWTypes.h"
+#include "Serialization/CustomVersion.h"
+
+const FGuid FArcIWCustomVersion::GUID(0x6A1F3C2E, 0x4B7D49A8, 0x9E21C5D3, 0x7F08B64A);
+
+FCustomVersionRegistration GRegisterArcIWCustomVersion(FArcIWCustomVersion::GUID, FArcIWCustomVersion::LatestVersion, TEXT("ArcIWVer"));
+
+namespace ArcIW::Private
+{
+	constexpr int32 RotationComponentBits = 20;
+	constexpr uint32 RotationComponentMax = (1u << RotationComponentBits) - 1;
+	constexpr double Sqrt2 = 1.4142135623730951;
+}
+
+// ---------------------------------------------------------------------------
+// FArcIWPackedTransform
+// ---------------------------------------------------------------------------
+
+FArcIWPackedTransform FArcIWPackedTransform::Pack(const FTransform& Transform, const FVector& Origin)
+{
+	using namespace ArcIW::Private;
+
+	FArcIWPackedTransform Packed;
+	Packed.Position = FVector3f(Transform.GetLocation() - Origin);
+
+	const FVector Scale = Transform.GetScale3D();
+	Packed.Scale[0] = FFloat16(static_cast<float>(Scale.X));
+	Packed.Scale[1] = FFloat16(static_cast<float>(Scale.Y));
+	Packed.Scale[2] = FFloat16(static_cast<float>(Scale.Z));
+
+	const FQuat Rotation = Transform.GetRotation().GetNormalized();
+	const double Components[4] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+
+	int32 LargestIndex = 0;
+	for (int32 Idx = 1; Idx < 4; ++Idx)
+	{
+		if (FMath::Abs(Components[Idx]) > FMath::Abs(Components[LargestIndex]))
+		{
+			LargestIndex = Idx;
+		}
+	}
+
+	// q and -q are the same rotation; flip so the dropped component is positive and can be
+	// rebuilt as a square root. The other three then lie in [-1/sqrt(2), 1/sqrt(2)].
+	const double Sign = Components[LargestIndex] < 0.0 ? -1.0 : 1.0;
+
+	uint64 Bits = static_cast<uint64>(LargestIndex);
+	int32 Shift = 2;
+	for (int32 Idx = 0; Idx < 4; ++Idx)
+	{
+		if (Idx == LargestIndex)
+		{
+			continue;
+		}
+
+		const double Normalized = FMath::Clamp((Components[Idx] * Sign * Sqrt2 + 1.0) * 0.5, 0.0, 1.0);
+		const uint64 Quantized = static_cast<uint64>(FMath::RoundToInt64(Normalized * RotationComponentMax));
+		Bits |= Quantized << Shift;
+		Shift += RotationComponentBits;
+	}
+
+	Packed.RotationLow = static_cast<uint32>(Bits);
+	Packed.RotationHigh = static_cast<uint32>(Bits >> 32);
+	return Packed;
+}
+
+FTransform FArcIWPackedTransform::Unpack(const FVector& Origin) const
+{
+	using namespace ArcIW::Private;
+
+	const uint64 Bits = static_cast<uint64>(RotationLow) | (static_cast<uint64>(RotationHigh) << 32);
+	const int32 LargestIndex = static_cast<int32>(Bits & 0x3);
+
+	double Components[4];
+	double SumSquares = 0.0;
+	int32 Shift = 2;
+	for (int32 Idx = 0; Idx < 4; ++Idx)
+	{
+		if (Idx == LargestIndex)
+		{
+			continue;
+		}
+
+		const uint32 Quantized = static_cast<uint32>((Bits >> Shift) & RotationComponentMax);
+		const double Value = (static_cast<double>(Quantized) / RotationComponentMax * 2.0 - 1.0) / Sqrt2;
+		Components[Idx] = Value;
+		SumSquares += Value * Value;
+		Shift += RotationComponentBits;
+	}
+	Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0, 1.0 - SumSquares));
+
+	const FQuat Rotation(Components[0], Components[1], Components[2], Components[3]);
+	const FVector Scale3D(Scale[0].GetFloat(), Scale[1].GetFloat(), Scale[2].GetFloat());
+	return FTransform(Rotation.GetNormalized(), Origin + FVector(Position), Scale3D);
+}
+
+// ---------------------------------------------------------------------------
+// FArcIWInstanceStore
+// ---------------------------------------------------------------------------
+
+FArcIWInstanceStore::~FArcIWInstanceStore()
+{
+	ReleasePayload();
+}
+
+#if WITH_EDITORONLY_DATA
+void FArcIWInstanceStore::Build(TArray<FArcIWActorClassData>& Classes)
+{
+	ReleasePayload();
+
+	FBox Bounds(ForceInit);
+	int32 Total = 0;
+	for (const FArcIWActorClassData& ClassData : Classes)
+	{
+		for (const FTransform& Transform : ClassData.InstanceTransforms)
+		{
+			Bounds += Transform.GetLocation();
+		}
+		Total += ClassData.InstanceTransforms.Num();
+	}
+
+	// Centering on the bounds keeps packed positions within a cell's extent, where float is sub-millimetre.
+	Origin = Bounds.IsValid ? Bounds.GetCenter() : FVector::ZeroVector;
+	NumTransforms = Total;
+
+	BulkData.Lock(LOCK_READ_WRITE);
+	FArcIWPackedTransform* Dest = static_cast<FArcIWPackedTransform*>(BulkData.Realloc(GetPayloadSize()));
+
+	int32 StoreIndex = 0;
+	for (FArcIWActorClassData& ClassData : Classes)
+	{
+		ClassData.FirstStoreIndex = StoreIndex;
+		ClassData.NumInstances = ClassData.InstanceTransforms.Num();
+		for (const FTransform& Transform : ClassData.InstanceTransforms)
+		{
+			Dest[StoreIndex++] = FArcIWPackedTransform::Pack(Transform, Origin);
+		}
+	}
+
+	BulkData.Unlock();
+	AcquirePayload();
+}
+#endif
+
+void FArcIWInstanceStore::Serialize(FArchive& Ar, UObject* Owner)
+{
+	Ar << Origin;
+	Ar << NumTransforms;
+
+	// Bulk data can't be serialized while locked.
+	ReleasePayload();
+
+	if (Ar.IsSaving())
+	{
+		// Cooked payloads go to a sidecar file that is mapped instead of read.
+		BulkData.ClearBulkDataFlags(BULKDATA_ForceInlinePayload | BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload);
+		BulkData.SetBulkDataFlags(Ar.IsCooking()
+			? (BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMappedPayload)
+			: BULKDATA_ForceInlinePayload);
+	}
+
+	BulkData.Serialize(Ar, Owner);
+
+	AcquirePayload();
+}
+
+void FArcIWInstanceStore::Reset()
+{
+	ReleasePayload();
+	BulkData.RemoveBulkData();
+	Origin = FVector::ZeroVector;
+	NumTransforms = 0;
+}
+
+void FArcIWInstanceStore::AcquirePayload()
+{
+	if (Transforms || NumTransforms == 0)
+	{
+		return;
+	}
+
+	if (BulkData.GetBulkDataSize() != GetPayloadSize())
+	{
+		UE_LOG(LogArcIW, Error, TEXT("FArcIWInstanceStore: payload is %lld bytes, expected %lld for %d transforms"),
+			BulkData.GetBulkDataSize(), GetPayloadSize(), NumTransforms);
+		NumTransforms = 0;
+		return;
+	}
+
+	Transforms = static_cast<const FArcIWPackedTransform*>(BulkData.LockReadOnly());
+}
+
+void FArcIWInstanceStore::ReleasePayload()
+{
+	if (Transforms)
+	{
+		BulkData.Unlock();
+		Transforms = nullptr;
+	}
+}
@@ -0,0 +1,102 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/Float16.h"
+#include "Serialization/BulkData.h"
+
+struct FArcIWActorClassData;
+
+/** Custom serialization version for ArcInstancedWorld partition actors. */
+struct ARCINSTANCEDWORLD_API FArcIWCustomVersion
+{
+	enum Type
+	{
+		BeforeCustomVersionWasAdded = 0,
+
+		/** Partition actors serialize a packed FArcIWInstanceStore after their properties. */
+		PackedInstanceStore,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+};
+
+/**
+ * Quantized instance transform (28 bytes vs 96 for FTransform).
+ * Position is relative to the owning store's origin, rotation is smallest-three packed
+ * into 62 bits, scale is half precision.
+ */
+struct ARCINSTANCEDWORLD_API FArcIWPackedTransform
+{
+	FVector3f Position = FVector3f::ZeroVector;
+	uint32 RotationLow = 0;
+	uint32 RotationHigh = 0;
+	FFloat16 Scale[3];
+	uint16 Padding = 0;
+
+	static FArcIWPackedTransform Pack(const FTransform& Transform, const FVector& Origin);
+	FTransform Unpack(const FVector& Origin) const;
+};
+
+static_assert(sizeof(FArcIWPackedTransform) == 28, "FArcIWPackedTransform is serialized as raw bytes");
+
+/**
+ * Contiguous quantized transforms for every instance of a partition actor, classes back to back
+ * (FArcIWActorClassData::FirstStoreIndex / NumInstances give each class its range).
+ * Serialized as bulk data: cooked builds put the payload in a memory-mapped sidecar so streaming
+ * a partition in neither copies nor deserializes it per instance.
+ * Read-only after load; safe to read from worker threads.
+ */
+class ARCINSTANCEDWORLD_API FArcIWInstanceStore
+{
+public:
+	FArcIWInstanceStore() = default;
+	~FArcIWInstanceStore();
+
+	FArcIWInstanceStore(const FArcIWInstanceStore&) = delete;
+	FArcIWInstanceStore& operator=(const FArcIWInstanceStore&) = delete;
+
+#if WITH_EDITORONLY_DATA
+	/** Pack the authoring transforms of Classes and assign their FirstStoreIndex / NumInstances. */
+	void Build(TArray<FArcIWActorClassData>& Classes);
+#endif
+
+	void Serialize(FArchive& Ar, UObject* Owner);
+	void Reset();
+
+	int32 Num() const { return NumTransforms; }
+	bool IsValidIndex(int32 StoreIndex) const { return StoreIndex >= 0 && StoreIndex < NumTransforms; }
+
+	FTransform GetTransform(int32 StoreIndex) const
+	{
+		check(IsValidIndex(StoreIndex));
+		return Transforms[StoreIndex].Unpack(Origin);
+	}
+
+	/** Location only — skips rotation decoding. */
+	FVector GetLocation(int32 StoreIndex) const
+	{
+		check(IsValidIndex(StoreIndex));
+		return Origin + FVector(Transforms[StoreIndex].Position);
+	}
+
+	TConstArrayView<FArcIWPackedTransform> GetPackedTransforms() const { return MakeArrayView(Transforms, NumTransforms); }
+	const FVector& GetOrigin() const { return Origin; }
+
+	/** Bytes held by the payload, mapped or resident. */
+	int64 GetPayloadSize() const { return static_cast<int64>(NumTransforms) * sizeof(FArcIWPackedTransform); }
+
+private:
+	/** Lock the bulk payload and cache the pointer. Maps it when the platform and cook allow. */
+	void AcquirePayload();
+	void ReleasePayload();
+
+	FByteBulkData BulkData;
+	const FArcIWPackedTransform* Transforms = nullptr;
+	FVector Origin = FVector::ZeroVector;
+	int32 NumTransforms = 0;
+};
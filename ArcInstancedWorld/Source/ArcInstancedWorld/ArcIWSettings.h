@@ -8,6 +8,24 @@
 
 class UTransformProviderData;
 
+/** Pool retention policy for one hydrated actor class. */
+USTRUCT()
+struct FArcIWActorPoolClassConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	TSoftClassPtr<AActor> ActorClass;
+
+	/** The pool is refilled in the background to keep at least this many free actors. */
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 LowWatermark = 0;
+
+	/** Released actors beyond this many free ones are destroyed. */
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 HighWatermark = 32;
+};
+
 /**
  * Project-wide settings for ArcInstancedWorld.
  * Accessible in editor via Project Settings > Game > ArcInstancedWorld.
@@ -93,4 +111,38 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|MassISM", meta = (EditCondition = "bUseMassISM", ClampMin = "0"))
 	float ActorDehydrationRadius = 8000.f;
 
+	/** Per-frame game thread budget (ms) for creating entities of streamed-in partitions.
+	 *  Spawn data is prepared on a background task, then entities are created over several
+	 *  frames, nearest to the streaming sources first. 0 spawns each partition synchronously in BeginPlay. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Spawning", meta = (ClampMin = "0"))
+	float SpawnFrameBudgetMs = 2.f;
+
+	/** Entities created per BatchCreateEntities slice. The frame budget is checked between slices. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Spawning", meta = (ClampMin = "1"))
+	int32 SpawnSliceSize = 256;
+
+	/** Per-class actor pool watermarks. Classes not listed use the defaults below. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling")
+	TArray<FArcIWActorPoolClassConfig> ActorPoolClasses;
+
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling", meta = (ClampMin = "0"))
+	int32 DefaultPoolLowWatermark = 0;
+
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling", meta = (ClampMin = "0"))
+	int32 DefaultPoolHighWatermark = 32;
+
+	/** Per-frame game thread budget (ms) for spawning actors into the pool ahead of demand. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling", meta = (ClampMin = "0"))
+	float PoolSpawnFrameBudgetMs = 1.f;
+
+	/** Distance (cm) beyond ActorHydrationRadius at which approaching entities pre-warm the pool for their class.
+	 *  Sized so the pool has refilled by the time the entity crosses the hydration radius. 0 disables prediction. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling", meta = (ClampMin = "0"))
+	float PoolPrewarmMargin = 3000.f;
+
+	/** Seconds a prewarm request stays valid. Demand that hasn't been acquired by then is dropped
+	 *  so the pool stops refilling towards it. */
+	UPROPERTY(EditAnywhere, config, Category = "ArcInstancedWorld|Pooling", meta = (ClampMin = "0"))
+	float PoolPrewarmWindowSeconds = 5.f;
+
 };
@@ -0,0 +1,139 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcIWSpawnSchedulerSubsystem.h"
+#include "ArcInstancedWorld/ArcInstancedWorld.h"
+#include "ArcInstancedWorld/ArcIWSettings.h"
+#include "ArcInstancedWorld/Visualization/ArcIWMassISMPartitionActor.h"
+#include "GameFramework/PlayerController.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+
+void UArcIWSpawnSchedulerSubsystem::Tick(float DeltaTime)
+{
+	if (PendingPartitions.IsEmpty())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcIWSpawnScheduler);
+
+	TArray<FVector> SourceLocations;
+	GatherStreamingSourceLocations(*GetWorld(), SourceLocations);
+
+	// Partitions whose background preparation has finished, nearest first.
+	TArray<TPair<double, AArcIWMassISMPartitionActor*>> ReadyPartitions;
+	for (int32 Idx = PendingPartitions.Num() - 1; Idx >= 0; --Idx)
+	{
+		AArcIWMassISMPartitionActor* Actor = PendingPartitions[Idx].Get();
+		if (!Actor || !Actor->IsSpawnPending())
+		{
+			PendingPartitions.RemoveAtSwap(Idx);
+			continue;
+		}
+
+		if (Actor->IsSpawnPrepared())
+		{
+			ReadyPartitions.Emplace(Actor->GetSpawnPriorityDistanceSq(SourceLocations), Actor);
+		}
+	}
+
+	if (ReadyPartitions.IsEmpty())
+	{
+		return;
+	}
+
+	ReadyPartitions.Sort([](const TPair<double, AArcIWMassISMPartitionActor*>& A, const TPair<double, AArcIWMassISMPartitionActor*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	const UArcIWSettings* Settings = UArcIWSettings::Get();
+	const double BudgetSeconds = Settings->SpawnFrameBudgetMs * 0.001;
+	const int32 SliceSize = FMath::Max(1, Settings->SpawnSliceSize);
+
+	// At least one slice is committed per frame so spawning always makes progress.
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumCommitted = 0;
+	bool bBudgetSpent = false;
+	for (const TPair<double, AArcIWMassISMPartitionActor*>& Ready : ReadyPartitions)
+	{
+		AArcIWMassISMPartitionActor* Actor = Ready.Value;
+		while (Actor->IsSpawnPending())
+		{
+			NumCommitted += Actor->CommitSpawnSlice(SliceSize);
+			if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				bBudgetSpent = true;
+				break;
+			}
+		}
+
+		if (bBudgetSpent)
+		{
+			break;
+		}
+	}
+
+	const double FrameSeconds = FPlatformTime::Seconds() - StartTime;
+	const double FrameMs = FrameSeconds * 1000.0;
+	Stats.TotalEntities += NumCommitted;
+	Stats.TotalCommitSeconds += FrameSeconds;
+	Stats.LastFrameMs = FrameMs;
+	Stats.WorstFrameMs = FMath::Max(Stats.WorstFrameMs, FrameMs);
+	++Stats.NumFrames;
+
+	PendingPartitions.RemoveAllSwap([](const TWeakObjectPtr<AArcIWMassISMPartitionActor>& Actor)
+	{
+		return !Actor.IsValid() || !Actor->IsSpawnPending();
+	});
+
+	if (PendingPartitions.IsEmpty())
+	{
+		UE_LOG(LogArcIW, Log, TEXT("Partition spawn queue drained: %lld entities over %d frames, %.1f entities/ms, worst frame %.2f ms"),
+			Stats.TotalEntities, Stats.NumFrames, Stats.GetEntitiesPerMs(), Stats.WorstFrameMs);
+	}
+}
+
+TStatId UArcIWSpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArcIWSpawnSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UArcIWSpawnSchedulerSubsystem::EnqueuePartition(AArcIWMassISMPartitionActor* Actor)
+{
+	if (Actor)
+	{
+		// A new load starts when the queue fills up again; the drain log reports that load only.
+		if (PendingPartitions.IsEmpty())
+		{
+			Stats = FArcIWSpawnStats();
+		}
+		PendingPartitions.AddUnique(Actor);
+	}
+}
+
+void UArcIWSpawnSchedulerSubsystem::DequeuePartition(AArcIWMassISMPartitionActor* Actor)
+{
+	PendingPartitions.RemoveSingleSwap(Actor);
+}
+
+void UArcIWSpawnSchedulerSubsystem::GatherStreamingSourceLocations(const UWorld& World, TArray<FVector>& OutLocations)
+{
+	if (const UWorldPartitionSubsystem* WorldPartitionSubsystem = World.GetSubsystem<UWorldPartitionSubsystem>())
+	{
+		for (const FWorldPartitionStreamingSource& Source : WorldPartitionSubsystem->GetStreamingSources())
+		{
+			OutLocations.Add(Source.Location);
+		}
+	}
+
+	if (OutLocations.IsEmpty())
+	{
+		if (APlayerController* PlayerController = World.GetFirstPlayerController())
+		{
+			FVector CameraLocation;
+			FRotator CameraRotation;
+			PlayerController->GetPlayerViewPoint(CameraLocation, CameraRotation);
+			OutLocations.Add(CameraLocation);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ArcIWSpawnSchedulerSubsystem.generated.h"
+
+class AArcIWMassISMPartitionActor;
+
+/** Cost of committing partition entities on the game thread, for the current load (reset when the queue starts filling). */
+struct FArcIWSpawnStats
+{
+	/** Entities created through the scheduler during this load. */
+	int64 TotalEntities = 0;
+
+	/** Game thread time spent creating them. */
+	double TotalCommitSeconds = 0.0;
+
+	/** Most expensive single frame of entity creation (ms). */
+	double WorstFrameMs = 0.0;
+
+	/** Cost of the most recent frame that created entities (ms). */
+	double LastFrameMs = 0.0;
+
+	/** Frames in which at least one slice was committed. */
+	int32 NumFrames = 0;
+
+	double GetEntitiesPerMs() const
+	{
+		return TotalCommitSeconds > 0.0 ? static_cast<double>(TotalEntities) / (TotalCommitSeconds * 1000.0) : 0.0;
+	}
+};
+
+/**
+ * Tickable world subsystem that commits the staged entity spawns of streamed-in partition actors.
+ * Each frame it creates entity slices for partitions whose background preparation has finished,
+ * nearest to the streaming sources first, until UArcIWSettings::SpawnFrameBudgetMs is spent.
+ */
+UCLASS()
+class ARCINSTANCEDWORLD_API UArcIWSpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void EnqueuePartition(AArcIWMassISMPartitionActor* Actor);
+	void DequeuePartition(AArcIWMassISMPartitionActor* Actor);
+
+	int32 GetNumPendingPartitions() const { return PendingPartitions.Num(); }
+	const FArcIWSpawnStats& GetStats() const { return Stats; }
+
+	/** World Partition streaming source locations, falling back to the first player's view point. */
+	static void GatherStreamingSourceLocations(const UWorld& World, TArray<FVector>& OutLocations);
+
+private:
+	/** Partition actors with entities left to create. */
+	TArray<TWeakObjectPtr<AArcIWMassISMPartitionActor>> PendingPartitions;
+
+	FArcIWSpawnStats Stats;
+};
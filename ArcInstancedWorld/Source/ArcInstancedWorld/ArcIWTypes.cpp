@@ -0,0 +1,195 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcIWTypes.h"
+
+namespace ArcIW::Private
+{
+	void WriteVarUInt(TArray<uint8>& Out, uint32 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	bool ReadVarUInt(TConstArrayView<uint8> Data, int32& InOutOffset, uint32& OutValue)
+	{
+		OutValue = 0;
+		for (int32 Shift = 0; Shift < 35; Shift += 7)
+		{
+			if (!Data.IsValidIndex(InOutOffset))
+			{
+				return false;
+			}
+			const uint8 Byte = Data[InOutOffset++];
+			OutValue |= static_cast<uint32>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// FArcIWRemovalBitset
+// ---------------------------------------------------------------------------
+
+void FArcIWRemovalBitset::Add(int32 Index)
+{
+	if (Index < 0)
+	{
+		return;
+	}
+
+	const int32 WordIndex = Index >> 5;
+	if (WordIndex >= Words.Num())
+	{
+		Words.SetNumZeroed(WordIndex + 1);
+	}
+
+	const uint32 Mask = 1u << (Index & 31);
+	if ((Words[WordIndex] & Mask) == 0)
+	{
+		Words[WordIndex] |= Mask;
+		++NumSet;
+	}
+}
+
+void FArcIWRemovalBitset::Remove(int32 Index)
+{
+	const int32 WordIndex = Index >> 5;
+	if (Index < 0 || !Words.IsValidIndex(WordIndex))
+	{
+		return;
+	}
+
+	const uint32 Mask = 1u << (Index & 31);
+	if ((Words[WordIndex] & Mask) != 0)
+	{
+		Words[WordIndex] &= ~Mask;
+		--NumSet;
+	}
+}
+
+void FArcIWRemovalBitset::Reset()
+{
+	Words.Reset();
+	NumSet = 0;
+}
+
+// Layout: NumWords, then groups of (ZeroWords, FullWords, LiteralWords, literal words...) until
+// NumWords are covered. Counts are LEB128 varints, literal words little-endian uint32.
+void FArcIWRemovalBitset::Encode(TArray<uint8>& Out) const
+{
+	using namespace ArcIW::Private;
+
+	// Trailing zero words carry nothing.
+	int32 NumWords = Words.Num();
+	while (NumWords > 0 && Words[NumWords - 1] == 0)
+	{
+		--NumWords;
+	}
+
+	WriteVarUInt(Out, static_cast<uint32>(NumWords));
+
+	int32 WordIndex = 0;
+	while (WordIndex < NumWords)
+	{
+		int32 ZeroRun = 0;
+		while (WordIndex + ZeroRun < NumWords && Words[WordIndex + ZeroRun] == 0)
+		{
+			++ZeroRun;
+		}
+		WordIndex += ZeroRun;
+
+		int32 FullRun = 0;
+		while (WordIndex + FullRun < NumWords && Words[WordIndex + FullRun] == MAX_uint32)
+		{
+			++FullRun;
+		}
+		WordIndex += FullRun;
+
+		int32 LiteralRun = 0;
+		while (WordIndex + LiteralRun < NumWords
+			&& Words[WordIndex + LiteralRun] != 0
+			&& Words[WordIndex + LiteralRun] != MAX_uint32)
+		{
+			++LiteralRun;
+		}
+
+		WriteVarUInt(Out, static_cast<uint32>(ZeroRun));
+		WriteVarUInt(Out, static_cast<uint32>(FullRun));
+		WriteVarUInt(Out, static_cast<uint32>(LiteralRun));
+		for (int32 Idx = 0; Idx < LiteralRun; ++Idx)
+		{
+			const uint32 Word = Words[WordIndex + Idx];
+			Out.Add(static_cast<uint8>(Word));
+			Out.Add(static_cast<uint8>(Word >> 8));
+			Out.Add(static_cast<uint8>(Word >> 16));
+			Out.Add(static_cast<uint8>(Word >> 24));
+		}
+		WordIndex += LiteralRun;
+	}
+}
+
+bool FArcIWRemovalBitset::Decode(TConstArrayView<uint8> Data, int32& InOutOffset, int32 MaxIndices)
+{
+	using namespace ArcIW::Private;
+
+	Reset();
+
+	// Bounded before reserving: a corrupt count must not turn into a huge allocation.
+	uint32 NumWords = 0;
+	if (!ReadVarUInt(Data, InOutOffset, NumWords)
+		|| NumWords > static_cast<uint32>(FMath::DivideAndRoundUp(FMath::Max(MaxIndices, 0), 32)))
+	{
+		return false;
+	}
+
+	Words.Reserve(NumWords);
+	while (static_cast<uint32>(Words.Num()) < NumWords)
+	{
+		uint32 ZeroRun = 0;
+		uint32 FullRun = 0;
+		uint32 LiteralRun = 0;
+		if (!ReadVarUInt(Data, InOutOffset, ZeroRun)
+			|| !ReadVarUInt(Data, InOutOffset, FullRun)
+			|| !ReadVarUInt(Data, InOutOffset, LiteralRun))
+		{
+			Reset();
+			return false;
+		}
+
+		const uint64 GroupWords = static_cast<uint64>(ZeroRun) + FullRun + LiteralRun;
+		if (GroupWords == 0 || Words.Num() + GroupWords > NumWords
+			|| InOutOffset + static_cast<int64>(LiteralRun) * 4 > Data.Num())
+		{
+			Reset();
+			return false;
+		}
+
+		Words.AddZeroed(ZeroRun);
+		for (uint32 Idx = 0; Idx < FullRun; ++Idx)
+		{
+			Words.Add(MAX_uint32);
+		}
+		NumSet += static_cast<int32>(FullRun) * 32;
+
+		for (uint32 Idx = 0; Idx < LiteralRun; ++Idx)
+		{
+			const uint32 Word = static_cast<uint32>(Data[InOutOffset])
+				| (static_cast<uint32>(Data[InOutOffset + 1]) << 8)
+				| (static_cast<uint32>(Data[InOutOffset + 2]) << 16)
+				| (static_cast<uint32>(Data[InOutOffset + 3]) << 24);
+			InOutOffset += 4;
+			Words.Add(Word);
+			NumSet += FMath::CountBits(Word);
+		}
+	}
+
+	return true;
+}
@@ -69,9 +69,20 @@ struct ARCINSTANCEDWORLD_API FArcIWActorClassData
 	UPROPERTY(VisibleAnywhere)
 	TArray<FArcIWMeshEntry> MeshDescriptors;
 
-	/** World transforms of all instances. */
+#if WITH_EDITORONLY_DATA
+	/** World transforms of all instances. Authoring data — runtime reads the partition
+	 *  actor's FArcIWInstanceStore, rebuilt from this on save and on BeginPlay in editor builds. */
 	UPROPERTY(VisibleAnywhere)
 	TArray<FTransform> InstanceTransforms;
+#endif
+
+	/** First slot of this class in the owning partition actor's instance store. */
+	UPROPERTY()
+	int32 FirstStoreIndex = 0;
+
+	/** Number of instances of this class. Valid TransformIndex values are [0, NumInstances). */
+	UPROPERTY(VisibleAnywhere)
+	int32 NumInstances = 0;
 
 	/** Optional Mass entity config from the actor's component. Merged into the entity template. */
 	UPROPERTY(VisibleAnywhere)
@@ -107,6 +118,58 @@ struct ARCINSTANCEDWORLD_API FArcIWActorClassData
 	TWeakObjectPtr<UPCGComponent> SourcePCGComponent;
 };
 
+/** Set of instance indices stored as a dense bitset, one bit per instance.
+ *  Persisted run-length encoded so sparse and clear-cut removals both stay small. */
+USTRUCT()
+struct ARCINSTANCEDWORLD_API FArcIWRemovalBitset
+{
+	GENERATED_BODY()
+
+	bool Contains(int32 Index) const
+	{
+		const int32 WordIndex = Index >> 5;
+		return Index >= 0 && Words.IsValidIndex(WordIndex) && (Words[WordIndex] & (1u << (Index & 31))) != 0;
+	}
+
+	void Add(int32 Index);
+	void Remove(int32 Index);
+	void Reset();
+
+	/** Number of indices in the set. */
+	int32 Num() const { return NumSet; }
+	bool IsEmpty() const { return NumSet == 0; }
+
+	/** Calls Func(int32 Index) for every index in the set, ascending. */
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+		{
+			uint32 Word = Words[WordIndex];
+			while (Word != 0)
+			{
+				const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros(Word));
+				Func((WordIndex << 5) + Bit);
+				Word &= Word - 1;
+			}
+		}
+	}
+
+	/** Append the run-length encoded form to Out. */
+	void Encode(TArray<uint8>& Out) const;
+
+	/** Replace contents from Encode() output starting at InOutOffset. Returns false on malformed data,
+	 *  including data that covers more than MaxIndices indices. */
+	bool Decode(TConstArrayView<uint8> Data, int32& InOutOffset, int32 MaxIndices);
+
+private:
+	UPROPERTY(SaveGame)
+	TArray<uint32> Words;
+
+	UPROPERTY(SaveGame)
+	int32 NumSet = 0;
+};
+
 /** Tracks which instances of a single actor class have been removed at runtime.
  *  Parallel to FArcIWActorClassData — same array index means same class. */
 USTRUCT()
@@ -114,9 +177,9 @@ struct ARCINSTANCEDWORLD_API FArcIWClassRemovals
 {
 	GENERATED_BODY()
 
-	/** Indices into InstanceTransforms that have been removed. */
+	/** Transform indices of this class that have been removed. */
 	UPROPERTY(SaveGame)
-	TSet<int32> RemovedInstances;
+	FArcIWRemovalBitset RemovedInstances;
 };
 
 /** Queued respawn entry. Sorted ascending by RespawnAtUtc (append-only — chronological removals). */
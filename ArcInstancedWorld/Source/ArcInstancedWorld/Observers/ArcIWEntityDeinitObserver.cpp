@@ -99,9 +99,7 @@ void UArcIWEntityDeinitObserver::Execute(FMassEntityManager& EntityManager, FMas
 				Instance.bIsActorRepresentation = false;
 
 				// Unregister from subsystem grid
-				Subsystem->UnregisterMeshEntity(Entity, Instance.MeshGridCoords);
-				Subsystem->UnregisterPhysicsEntity(Entity, Instance.PhysicsGridCoords);
-				Subsystem->UnregisterActorEntity(Entity, Instance.ActorGridCoords);
+				Subsystem->UnregisterEntity(Entity);
 			}
 
 			if (PhysicsEntities.Num() > 0)
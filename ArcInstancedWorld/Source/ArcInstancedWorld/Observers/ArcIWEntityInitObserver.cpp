@@ -72,9 +72,7 @@ void UArcIWEntityInitObserver::Execute(FMassEntityManager& EntityManager, FMassE
 				Instance.ActorGridCoords = Subsystem->WorldToActorCell(Position);
 
 				// Register in the grid
-				Subsystem->RegisterMeshEntity(Entity, Position);
-				Subsystem->RegisterPhysicsEntity(Entity, Position);
-				Subsystem->RegisterActorEntity(Entity, Position);
+				Subsystem->RegisterEntity(Entity, Position);
 
 				const bool bIsMassISM = Cast<AArcIWMassISMPartitionActor>(Instance.PartitionActor.Get()) != nullptr;
 				const bool bSkipHydration = bIsMassISM && UArcIWSettings::Get()->bDisableActorHydration;
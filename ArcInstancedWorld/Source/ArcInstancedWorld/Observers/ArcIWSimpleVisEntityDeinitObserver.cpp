@@ -95,9 +95,7 @@ void UArcIWSimpleVisEntityDeinitObserver::Execute(FMassEntityManager& EntityMana
 				Instance.bIsActorRepresentation = false;
 
 				// Unregister from subsystem grid
-				Subsystem->UnregisterMeshEntity(Entity, Instance.MeshGridCoords);
-				Subsystem->UnregisterPhysicsEntity(Entity, Instance.PhysicsGridCoords);
-				Subsystem->UnregisterActorEntity(Entity, Instance.ActorGridCoords);
+				Subsystem->UnregisterEntity(Entity);
 			}
 
 			if (PhysicsEntities.Num() > 0)
@@ -155,9 +153,7 @@ void UArcIWSimpleVisEntityDeinitObserver::Execute(FMassEntityManager& EntityMana
 				}
 				Instance.bIsActorRepresentation = false;
 
-				Subsystem->UnregisterMeshEntity(Entity, Instance.MeshGridCoords);
-				Subsystem->UnregisterPhysicsEntity(Entity, Instance.PhysicsGridCoords);
-				Subsystem->UnregisterActorEntity(Entity, Instance.ActorGridCoords);
+				Subsystem->UnregisterEntity(Entity);
 			}
 
 			if (PhysicsEntities.Num() > 0)
@@ -78,9 +78,7 @@ void UArcIWSimpleVisEntityInitObserver::Execute(FMassEntityManager& EntityManage
 				Instance.MeshGridCoords = Subsystem->WorldToMeshCell(Position);
 				Instance.PhysicsGridCoords = Subsystem->WorldToPhysicsCell(Position);
 				Instance.ActorGridCoords = Subsystem->WorldToActorCell(Position);
-				Subsystem->RegisterMeshEntity(Entity, Position);
-				Subsystem->RegisterPhysicsEntity(Entity, Position);
-				Subsystem->RegisterActorEntity(Entity, Position);
+				Subsystem->RegisterEntity(Entity, Position);
 
 				const bool bIsMassISM = Cast<AArcIWMassISMPartitionActor>(Instance.PartitionActor.Get()) != nullptr;
 				const bool bSkipHydration = bIsMassISM && UArcIWSettings::Get()->bDisableActorHydration;
@@ -145,9 +143,7 @@ void UArcIWSimpleVisEntityInitObserver::Execute(FMassEntityManager& EntityManage
 				Instance.MeshGridCoords = Subsystem->WorldToMeshCell(Position);
 				Instance.PhysicsGridCoords = Subsystem->WorldToPhysicsCell(Position);
 				Instance.ActorGridCoords = Subsystem->WorldToActorCell(Position);
-				Subsystem->RegisterMeshEntity(Entity, Position);
-				Subsystem->RegisterPhysicsEntity(Entity, Position);
-				Subsystem->RegisterActorEntity(Entity, Position);
+				Subsystem->RegisterEntity(Entity, Position);
 
 				const bool bIsMassISM = Cast<AArcIWMassISMPartitionActor>(Instance.PartitionActor.Get()) != nullptr;
 				const bool bSkipHydration = bIsMassISM && UArcIWSettings::Get()->bDisableActorHydration;
@@ -2,6 +2,7 @@
 
 #include "ArcInstancedWorld/Processors/ArcIWPlayerCellTrackingProcessor.h"
 
+#include "ArcInstancedWorld/ArcIWActorPoolSubsystem.h"
 #include "ArcInstancedWorld/ArcIWTypes.h"
 #include "ArcInstancedWorld/Visualization/ArcIWVisualizationSubsystem.h"
 #include "MassCommonFragments.h"
@@ -88,266 +89,57 @@ void UArcIWPlayerCellTrackingProcessor::Execute(FMassEntityManager& EntityManage
 		return;
 	}
 
-	// Process each source position
-	for (const FVector& SourceLocation : SourcePositions)
+	// All sources are diffed together: a cell activates when it enters the radius of any source and
+	// deactivates only once it has left the radius of every source.
+	FArcIWCellTransitions Transitions;
+	if (!Subsystem->UpdateSources(SourcePositions, Transitions))
 	{
-		const FIntVector NewMeshCell = Subsystem->WorldToMeshCell(SourceLocation);
-		const FIntVector OldMeshCell = Subsystem->GetLastMeshPlayerCell();
-		const FIntVector NewPhysicsCell = Subsystem->WorldToPhysicsCell(SourceLocation);
-		const FIntVector OldPhysicsCell = Subsystem->GetLastPhysicsPlayerCell();
-		const FIntVector NewActorCell = Subsystem->WorldToActorCell(SourceLocation);
-		const FIntVector OldActorCell = Subsystem->GetLastActorPlayerCell();
-
-		const bool bMeshCellChanged = (NewMeshCell != OldMeshCell);
-		const bool bPhysicsCellChanged = (NewPhysicsCell != OldPhysicsCell);
-		const bool bActorCellChanged = (NewActorCell != OldActorCell);
-
-		if (!bMeshCellChanged && !bPhysicsCellChanged && !bActorCellChanged)
-		{
-			continue;
-		}
-
-		const bool bIsFirstMeshUpdate = (OldMeshCell.X == TNumericLimits<int32>::Max());
-		const bool bIsFirstPhysicsUpdate = (OldPhysicsCell.X == TNumericLimits<int32>::Max());
-		const bool bIsFirstActorUpdate = (OldActorCell.X == TNumericLimits<int32>::Max());
+		return;
+	}
 
-		// --- Actor hydration radius ---
-		if (Subsystem->HasActorGrid() && bActorCellChanged)
+	auto SignalIfAny = [SignalSubsystem](FName SignalName, const TArray<FMassEntityHandle>& Entities)
+	{
+		if (Entities.Num() > 0)
 		{
-			const int32 ActorHydrationRadiusCells = Subsystem->GetActorHydrationRadiusCells();
-
-			TArray<FIntVector> NewActorCells;
-			UArcIWVisualizationSubsystem::GetCellsInRadius(NewActorCell, ActorHydrationRadiusCells, NewActorCells);
-
-			TSet<FIntVector> OldActorCellSet;
-			if (!bIsFirstActorUpdate)
-			{
-				TArray<FIntVector> OldActorCells;
-				UArcIWVisualizationSubsystem::GetCellsInRadius(OldActorCell, ActorHydrationRadiusCells, OldActorCells);
-				OldActorCellSet.Reserve(OldActorCells.Num());
-				for (const FIntVector& Cell : OldActorCells)
-				{
-					OldActorCellSet.Add(Cell);
-				}
-			}
-
-			TSet<FIntVector> NewActorCellSet;
-			NewActorCellSet.Reserve(NewActorCells.Num());
-			for (const FIntVector& Cell : NewActorCells)
-			{
-				NewActorCellSet.Add(Cell);
-			}
-
-			TArray<FMassEntityHandle> ActorActivatedEntities;
-			for (const FIntVector& Cell : NewActorCells)
-			{
-				if (!OldActorCellSet.Contains(Cell))
-				{
-					const TArray<FMassEntityHandle>* Entities = Subsystem->GetActorEntitiesInCell(Cell);
-					if (Entities)
-					{
-						ActorActivatedEntities.Append(*Entities);
-					}
-				}
-			}
-
-			TArray<FMassEntityHandle> ActorDeactivatedEntities;
-			if (!bIsFirstActorUpdate)
-			{
-				for (const FIntVector& Cell : OldActorCellSet)
-				{
-					if (!NewActorCellSet.Contains(Cell))
-					{
-						const TArray<FMassEntityHandle>* Entities = Subsystem->GetActorEntitiesInCell(Cell);
-						if (Entities)
-						{
-							ActorDeactivatedEntities.Append(*Entities);
-						}
-					}
-				}
-			}
-
-			if (ActorActivatedEntities.Num() > 0)
-			{
-				SignalSubsystem->SignalEntities(UE::ArcIW::Signals::ActorCellActivated, ActorActivatedEntities);
-			}
-			if (ActorDeactivatedEntities.Num() > 0)
-			{
-				SignalSubsystem->SignalEntities(UE::ArcIW::Signals::ActorCellDeactivated, ActorDeactivatedEntities);
-			}
+			SignalSubsystem->SignalEntities(SignalName, Entities);
 		}
-
-		// --- MassISM Mesh radius (hysteresis) ---
-		if (bMeshCellChanged)
-		{
-			TArray<FIntVector> NewMeshAddCells;
-			UArcIWVisualizationSubsystem::GetCellsInRadius(NewMeshCell, Subsystem->GetMeshAddRadiusCells(), NewMeshAddCells);
-
-			TSet<FIntVector> OldMeshAddCellSet;
-			if (!bIsFirstMeshUpdate)
-			{
-				TArray<FIntVector> OldMeshAddCells;
-				UArcIWVisualizationSubsystem::GetCellsInRadius(OldMeshCell, Subsystem->GetMeshAddRadiusCells(), OldMeshAddCells);
-				OldMeshAddCellSet.Reserve(OldMeshAddCells.Num());
-				for (const FIntVector& Cell : OldMeshAddCells)
-				{
-					OldMeshAddCellSet.Add(Cell);
-				}
-			}
-
-			TArray<FMassEntityHandle> MeshActivatedEntities;
-			for (const FIntVector& Cell : NewMeshAddCells)
-			{
-				if (!OldMeshAddCellSet.Contains(Cell))
-				{
-					const TArray<FMassEntityHandle>* Entities = Subsystem->GetMeshEntitiesInCell(Cell);
-					if (Entities)
-					{
-						MeshActivatedEntities.Append(*Entities);
-					}
-				}
-			}
-
-			if (MeshActivatedEntities.Num() > 0)
-			{
-				SignalSubsystem->SignalEntities(UE::ArcIW::Signals::MeshCellActivated, MeshActivatedEntities);
-			}
-
-			TArray<FIntVector> NewMeshRemoveCells;
-			UArcIWVisualizationSubsystem::GetCellsInRadius(NewMeshCell, Subsystem->GetMeshRemoveRadiusCells(), NewMeshRemoveCells);
-
-			TSet<FIntVector> OldMeshRemoveCellSet;
-			if (!bIsFirstMeshUpdate)
-			{
-				TArray<FIntVector> OldMeshRemoveCells;
-				UArcIWVisualizationSubsystem::GetCellsInRadius(OldMeshCell, Subsystem->GetMeshRemoveRadiusCells(), OldMeshRemoveCells);
-				OldMeshRemoveCellSet.Reserve(OldMeshRemoveCells.Num());
-				for (const FIntVector& Cell : OldMeshRemoveCells)
-				{
-					OldMeshRemoveCellSet.Add(Cell);
-				}
-			}
-
-			TSet<FIntVector> NewMeshRemoveCellSet;
-			NewMeshRemoveCellSet.Reserve(NewMeshRemoveCells.Num());
-			for (const FIntVector& Cell : NewMeshRemoveCells)
-			{
-				NewMeshRemoveCellSet.Add(Cell);
-			}
-
-			TArray<FMassEntityHandle> MeshDeactivatedEntities;
-			if (!bIsFirstMeshUpdate)
-			{
-				for (const FIntVector& Cell : OldMeshRemoveCellSet)
-				{
-					if (!NewMeshRemoveCellSet.Contains(Cell))
-					{
-						const TArray<FMassEntityHandle>* Entities = Subsystem->GetMeshEntitiesInCell(Cell);
-						if (Entities)
-						{
-							MeshDeactivatedEntities.Append(*Entities);
-						}
-					}
-				}
-			}
-
-			if (MeshDeactivatedEntities.Num() > 0)
-			{
-				SignalSubsystem->SignalEntities(UE::ArcIW::Signals::MeshCellDeactivated, MeshDeactivatedEntities);
-			}
-		}
-
-		// --- MassISM Physics radius (hysteresis) ---
-		if (bPhysicsCellChanged)
+	};
+
+	constexpr int32 Mesh = static_cast<int32>(EArcIWCellLayer::Mesh);
+	constexpr int32 Physics = static_cast<int32>(EArcIWCellLayer::Physics);
+	constexpr int32 Actor = static_cast<int32>(EArcIWCellLayer::Actor);
+
+	SignalIfAny(UE::ArcIW::Signals::ActorCellActivated, Transitions.Activated[Actor]);
+	SignalIfAny(UE::ArcIW::Signals::ActorCellDeactivated, Transitions.Deactivated[Actor]);
+	SignalIfAny(UE::ArcIW::Signals::MeshCellActivated, Transitions.Activated[Mesh]);
+	SignalIfAny(UE::ArcIW::Signals::MeshCellDeactivated, Transitions.Deactivated[Mesh]);
+	SignalIfAny(UE::ArcMass::Signals::PhysicsBodyRequested, Transitions.Activated[Physics]);
+	SignalIfAny(UE::ArcMass::Signals::PhysicsBodyReleased, Transitions.Deactivated[Physics]);
+
+	// Entities entering the prewarm band will cross the hydration radius within a few frames; tell the
+	// actor pool how many of each class to have ready so hydration doesn't spawn on that frame.
+	if (Transitions.Approaching.Num() > 0)
+	{
+		if (UArcIWActorPoolSubsystem* Pool = World->GetSubsystem<UArcIWActorPoolSubsystem>())
 		{
-			TArray<FIntVector> NewPhysicsAddCells;
-			UArcIWVisualizationSubsystem::GetCellsInRadius(NewPhysicsCell, Subsystem->GetPhysicsAddRadiusCells(), NewPhysicsAddCells);
-
-			TSet<FIntVector> OldPhysicsAddCellSet;
-			if (!bIsFirstPhysicsUpdate)
+			TMap<TSubclassOf<AActor>, int32> DemandByClass;
+			for (const FMassEntityHandle Entity : Transitions.Approaching)
 			{
-				TArray<FIntVector> OldPhysicsAddCells;
-				UArcIWVisualizationSubsystem::GetCellsInRadius(OldPhysicsCell, Subsystem->GetPhysicsAddRadiusCells(), OldPhysicsAddCells);
-				OldPhysicsAddCellSet.Reserve(OldPhysicsAddCells.Num());
-				for (const FIntVector& Cell : OldPhysicsAddCells)
+				if (!EntityManager.IsEntityValid(Entity))
 				{
-					OldPhysicsAddCellSet.Add(Cell);
+					continue;
 				}
-			}
-
-			TArray<FMassEntityHandle> PhysicsActivatedEntities;
-			for (const FIntVector& Cell : NewPhysicsAddCells)
-			{
-				if (!OldPhysicsAddCellSet.Contains(Cell))
+				const FArcIWVisConfigFragment* Config = EntityManager.GetConstSharedFragmentDataPtr<FArcIWVisConfigFragment>(Entity);
+				if (Config && Config->ActorClass)
 				{
-					const TArray<FMassEntityHandle>* Entities = Subsystem->GetPhysicsEntitiesInCell(Cell);
-					if (Entities)
-					{
-						PhysicsActivatedEntities.Append(*Entities);
-					}
+					++DemandByClass.FindOrAdd(Config->ActorClass);
 				}
 			}
 
-			if (PhysicsActivatedEntities.Num() > 0)
+			for (const TPair<TSubclassOf<AActor>, int32>& Demand : DemandByClass)
 			{
-				SignalSubsystem->SignalEntities(UE::ArcMass::Signals::PhysicsBodyRequested, PhysicsActivatedEntities);
+				Pool->RequestPrewarm(Demand.Key, Demand.Value);
 			}
-
-			TArray<FIntVector> NewPhysicsRemoveCells;
-			UArcIWVisualizationSubsystem::GetCellsInRadius(NewPhysicsCell, Subsystem->GetPhysicsRemoveRadiusCells(), NewPhysicsRemoveCells);
-
-			TSet<FIntVector> OldPhysicsRemoveCellSet;
-			if (!bIsFirstPhysicsUpdate)
-			{
-				TArray<FIntVector> OldPhysicsRemoveCells;
-				UArcIWVisualizationSubsystem::GetCellsInRadius(OldPhysicsCell, Subsystem->GetPhysicsRemoveRadiusCells(), OldPhysicsRemoveCells);
-				OldPhysicsRemoveCellSet.Reserve(OldPhysicsRemoveCells.Num());
-				for (const FIntVector& Cell : OldPhysicsRemoveCells)
-				{
-					OldPhysicsRemoveCellSet.Add(Cell);
-				}
-			}
-
-			TSet<FIntVector> NewPhysicsRemoveCellSet;
-			NewPhysicsRemoveCellSet.Reserve(NewPhysicsRemoveCells.Num());
-			for (const FIntVector& Cell : NewPhysicsRemoveCells)
-			{
-				NewPhysicsRemoveCellSet.Add(Cell);
-			}
-
-			TArray<FMassEntityHandle> PhysicsDeactivatedEntities;
-			if (!bIsFirstPhysicsUpdate)
-			{
-				for (const FIntVector& Cell : OldPhysicsRemoveCellSet)
-				{
-					if (!NewPhysicsRemoveCellSet.Contains(Cell))
-					{
-						const TArray<FMassEntityHandle>* Entities = Subsystem->GetPhysicsEntitiesInCell(Cell);
-						if (Entities)
-						{
-							PhysicsDeactivatedEntities.Append(*Entities);
-						}
-					}
-				}
-			}
-
-			if (PhysicsDeactivatedEntities.Num() > 0)
-			{
-				SignalSubsystem->SignalEntities(UE::ArcMass::Signals::PhysicsBodyReleased, PhysicsDeactivatedEntities);
-			}
-		}
-
-		if (bMeshCellChanged)
-		{
-			Subsystem->UpdateMeshPlayerCell(NewMeshCell);
-		}
-		if (bPhysicsCellChanged)
-		{
-			Subsystem->UpdatePhysicsPlayerCell(NewPhysicsCell);
-		}
-		if (bActorCellChanged)
-		{
-			Subsystem->UpdateActorPlayerCell(NewActorCell);
 		}
 	}
 }
@@ -0,0 +1,323 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcIWCellIndex.h"
+#include "Algo/Sort.h"
+
+namespace ArcIW::Private
+{
+	/** Visit the values of [Lo, Hi] that fall outside [ExLo, ExHi]. */
+	template<typename FuncType>
+	void ForEachOutsideRange(int32 Lo, int32 Hi, int32 ExLo, int32 ExHi, FuncType&& Func)
+	{
+		for (int32 Value = Lo; Value <= FMath::Min(Hi, ExLo - 1); ++Value)
+		{
+			Func(Value);
+		}
+		for (int32 Value = FMath::Max(Lo, ExHi + 1); Value <= Hi; ++Value)
+		{
+			Func(Value);
+		}
+	}
+
+	/**
+	 * Visit the cells of the cube around NewCenter that are not in the cube around OldCenter (same radius).
+	 * Split into an X slab, then a Y slab over the shared X range, then a Z slab over the shared X/Y range.
+	 */
+	template<typename FuncType>
+	void ForEachCubeDifference(const FIntVector& NewCenter, const FIntVector* OldCenter, int32 Radius, FuncType&& Func)
+	{
+		const FIntVector NewMin = NewCenter - FIntVector(Radius);
+		const FIntVector NewMax = NewCenter + FIntVector(Radius);
+
+		if (!OldCenter)
+		{
+			for (int32 X = NewMin.X; X <= NewMax.X; ++X)
+			{
+				for (int32 Y = NewMin.Y; Y <= NewMax.Y; ++Y)
+				{
+					for (int32 Z = NewMin.Z; Z <= NewMax.Z; ++Z)
+					{
+						Func(FIntVector(X, Y, Z));
+					}
+				}
+			}
+			return;
+		}
+
+		const FIntVector OldMin = *OldCenter - FIntVector(Radius);
+		const FIntVector OldMax = *OldCenter + FIntVector(Radius);
+		const FIntVector SharedMin(FMath::Max(NewMin.X, OldMin.X), FMath::Max(NewMin.Y, OldMin.Y), FMath::Max(NewMin.Z, OldMin.Z));
+		const FIntVector SharedMax(FMath::Min(NewMax.X, OldMax.X), FMath::Min(NewMax.Y, OldMax.Y), FMath::Min(NewMax.Z, OldMax.Z));
+
+		ForEachOutsideRange(NewMin.X, NewMax.X, OldMin.X, OldMax.X, [&](int32 X)
+		{
+			for (int32 Y = NewMin.Y; Y <= NewMax.Y; ++Y)
+			{
+				for (int32 Z = NewMin.Z; Z <= NewMax.Z; ++Z)
+				{
+					Func(FIntVector(X, Y, Z));
+				}
+			}
+		});
+
+		for (int32 X = SharedMin.X; X <= SharedMax.X; ++X)
+		{
+			ForEachOutsideRange(NewMin.Y, NewMax.Y, OldMin.Y, OldMax.Y, [&](int32 Y)
+			{
+				for (int32 Z = NewMin.Z; Z <= NewMax.Z; ++Z)
+				{
+					Func(FIntVector(X, Y, Z));
+				}
+			});
+
+			for (int32 Y = SharedMin.Y; Y <= SharedMax.Y; ++Y)
+			{
+				ForEachOutsideRange(NewMin.Z, NewMax.Z, OldMin.Z, OldMax.Z, [&](int32 Z)
+				{
+					Func(FIntVector(X, Y, Z));
+				});
+			}
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Registration
+// ---------------------------------------------------------------------------
+
+void FArcIWCellIndex::Add(FMassEntityHandle Entity, EArcIWCellLayer Layer, const FIntVector& Cell)
+{
+	FEntityRecord& Record = EntityRecords.FindOrAdd(Entity);
+	const int32 LayerIndex = static_cast<int32>(Layer);
+	const uint8 LayerBit = GetLayerBit(Layer);
+
+	if (Record.LayerMask & LayerBit)
+	{
+		if (Record.Cells[LayerIndex] == Cell)
+		{
+			return;
+		}
+
+		const FArcIWCellKey OldKey{Record.Cells[LayerIndex], Layer};
+		++PendingRemovals.FindOrAdd(FEntry{OldKey, Entity});
+		AdjustLiveCount(OldKey, -1);
+	}
+
+	const FArcIWCellKey Key{Cell, Layer};
+	Record.Cells[LayerIndex] = Cell;
+	Record.LayerMask |= LayerBit;
+	PendingAdds.Add(FEntry{Key, Entity});
+	AdjustLiveCount(Key, 1);
+}
+
+void FArcIWCellIndex::Remove(FMassEntityHandle Entity, EArcIWCellLayer Layer)
+{
+	FEntityRecord* Record = EntityRecords.Find(Entity);
+	const uint8 LayerBit = GetLayerBit(Layer);
+	if (!Record || (Record->LayerMask & LayerBit) == 0)
+	{
+		return;
+	}
+
+	const FArcIWCellKey Key{Record->Cells[static_cast<int32>(Layer)], Layer};
+	++PendingRemovals.FindOrAdd(FEntry{Key, Entity});
+	AdjustLiveCount(Key, -1);
+
+	Record->LayerMask &= ~LayerBit;
+	if (Record->LayerMask == 0)
+	{
+		EntityRecords.Remove(Entity);
+	}
+}
+
+void FArcIWCellIndex::RemoveAll(FMassEntityHandle Entity)
+{
+	const FEntityRecord* Record = EntityRecords.Find(Entity);
+	if (!Record)
+	{
+		return;
+	}
+
+	for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+	{
+		const EArcIWCellLayer Layer = static_cast<EArcIWCellLayer>(LayerIndex);
+		if (Record->LayerMask & GetLayerBit(Layer))
+		{
+			const FArcIWCellKey Key{Record->Cells[LayerIndex], Layer};
+			++PendingRemovals.FindOrAdd(FEntry{Key, Entity});
+			AdjustLiveCount(Key, -1);
+		}
+	}
+
+	EntityRecords.Remove(Entity);
+}
+
+uint8 FArcIWCellIndex::GetLayerMask(FMassEntityHandle Entity) const
+{
+	const FEntityRecord* Record = EntityRecords.Find(Entity);
+	return Record ? Record->LayerMask : 0;
+}
+
+void FArcIWCellIndex::AdjustLiveCount(const FArcIWCellKey& Key, int32 Delta)
+{
+	FCellRange& Range = CellRanges.FindOrAdd(Key);
+	const bool bWasOccupied = Range.LiveCount > 0;
+	Range.LiveCount += Delta;
+	const bool bIsOccupied = Range.LiveCount > 0;
+
+	if (bWasOccupied != bIsOccupied)
+	{
+		NumOccupiedCells[static_cast<int32>(Key.Layer)] += bIsOccupied ? 1 : -1;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Queries
+// ---------------------------------------------------------------------------
+
+bool FArcIWCellIndex::HasEntities(EArcIWCellLayer Layer, const FIntVector& Cell) const
+{
+	const FCellRange* Range = CellRanges.Find(FArcIWCellKey{Cell, Layer});
+	return Range && Range->LiveCount > 0;
+}
+
+TConstArrayView<FMassEntityHandle> FArcIWCellIndex::GetEntities(EArcIWCellLayer Layer, const FIntVector& Cell) const
+{
+	checkf(!IsDirty(), TEXT("FArcIWCellIndex must be flushed before reading entity ranges"));
+
+	const FCellRange* Range = CellRanges.Find(FArcIWCellKey{Cell, Layer});
+	if (!Range || Range->Num == 0)
+	{
+		return TConstArrayView<FMassEntityHandle>();
+	}
+	return TConstArrayView<FMassEntityHandle>(SortedEntities.GetData() + Range->Start, Range->Num);
+}
+
+// ---------------------------------------------------------------------------
+// Flush
+// ---------------------------------------------------------------------------
+
+void FArcIWCellIndex::Flush()
+{
+	if (!IsDirty())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcIWCellIndex_Flush);
+
+	// Only the buffered adds need sorting; the existing storage is already ordered, so a single merge pass
+	// produces the new layout.
+	Algo::Sort(PendingAdds, [](const FEntry& A, const FEntry& B) { return A.Key < B.Key; });
+
+	const int32 NumExisting = SortedKeys.Num();
+	TArray<FArcIWCellKey> MergedKeys;
+	TArray<FMassEntityHandle> MergedEntities;
+	MergedKeys.Reserve(NumExisting + PendingAdds.Num());
+	MergedEntities.Reserve(NumExisting + PendingAdds.Num());
+
+	auto Emit = [this, &MergedKeys, &MergedEntities](const FArcIWCellKey& Key, FMassEntityHandle Entity)
+	{
+		if (!PendingRemovals.IsEmpty())
+		{
+			if (int32* Count = PendingRemovals.Find(FEntry{Key, Entity}))
+			{
+				if (--(*Count) == 0)
+				{
+					PendingRemovals.Remove(FEntry{Key, Entity});
+				}
+				return;
+			}
+		}
+		MergedKeys.Add(Key);
+		MergedEntities.Add(Entity);
+	};
+
+	int32 ExistingIdx = 0;
+	int32 PendingIdx = 0;
+	while (ExistingIdx < NumExisting || PendingIdx < PendingAdds.Num())
+	{
+		const bool bTakeExisting = PendingIdx >= PendingAdds.Num()
+			|| (ExistingIdx < NumExisting && !(PendingAdds[PendingIdx].Key < SortedKeys[ExistingIdx]));
+		if (bTakeExisting)
+		{
+			Emit(SortedKeys[ExistingIdx], SortedEntities[ExistingIdx]);
+			++ExistingIdx;
+		}
+		else
+		{
+			Emit(PendingAdds[PendingIdx].Key, PendingAdds[PendingIdx].Entity);
+			++PendingIdx;
+		}
+	}
+
+	ensureMsgf(PendingRemovals.IsEmpty(), TEXT("FArcIWCellIndex: %d removals did not match a stored entry"), PendingRemovals.Num());
+	PendingRemovals.Reset();
+	PendingAdds.Reset();
+
+	SortedKeys = MoveTemp(MergedKeys);
+	SortedEntities = MoveTemp(MergedEntities);
+
+	// Rebuild ranges; cells that emptied since the last flush are dropped here.
+	CellRanges.Reset();
+	int32 RunStart = 0;
+	for (int32 Idx = 1; Idx <= SortedKeys.Num(); ++Idx)
+	{
+		if (Idx == SortedKeys.Num() || !(SortedKeys[Idx] == SortedKeys[RunStart]))
+		{
+			const int32 RunNum = Idx - RunStart;
+			CellRanges.Add(SortedKeys[RunStart], FCellRange{RunStart, RunNum, RunNum});
+			RunStart = Idx;
+		}
+	}
+}
+
+void FArcIWCellIndex::Reset()
+{
+	SortedKeys.Empty();
+	SortedEntities.Empty();
+	CellRanges.Empty();
+	EntityRecords.Empty();
+	PendingAdds.Empty();
+	PendingRemovals.Empty();
+	FMemory::Memzero(NumOccupiedCells);
+}
+
+// ---------------------------------------------------------------------------
+// Ring Differences
+// ---------------------------------------------------------------------------
+
+bool FArcIWCellIndex::IsWithinRadiusOfAny(TConstArrayView<FIntVector> Centers, const FIntVector& Cell, int32 RadiusCells)
+{
+	for (const FIntVector& Center : Centers)
+	{
+		const FIntVector Delta = Cell - Center;
+		if (FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z)) <= RadiusCells)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FArcIWCellIndex::GetEnteredCells(TConstArrayView<FIntVector> OldCenters, TConstArrayView<FIntVector> NewCenters, int32 RadiusCells, TArray<FIntVector>& OutCells)
+{
+	OutCells.Reset();
+
+	// A cell entered the union iff, for the first new cube containing it, it is outside that source's old cube
+	// (checked by the cube difference) and outside every old cube. Attributing it to the first containing
+	// source keeps the output free of duplicates without a set.
+	for (int32 SourceIdx = 0; SourceIdx < NewCenters.Num(); ++SourceIdx)
+	{
+		const FIntVector* OldCenter = OldCenters.IsValidIndex(SourceIdx) ? &OldCenters[SourceIdx] : nullptr;
+		const TConstArrayView<FIntVector> EarlierNewCenters = NewCenters.Left(SourceIdx);
+
+		ArcIW::Private::ForEachCubeDifference(NewCenters[SourceIdx], OldCenter, RadiusCells, [&](const FIntVector& Cell)
+		{
+			if (!IsWithinRadiusOfAny(OldCenters, Cell, RadiusCells) && !IsWithinRadiusOfAny(EarlierNewCenters, Cell, RadiusCells))
+			{
+				OutCells.Add(Cell);
+			}
+		});
+	}
+}
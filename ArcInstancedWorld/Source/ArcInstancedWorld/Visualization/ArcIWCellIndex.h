@@ -0,0 +1,151 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mass/EntityHandle.h"
+
+/** Grid domains an entity can be registered on. Each layer has its own cell size. */
+enum class EArcIWCellLayer : uint8
+{
+	Mesh,
+	Physics,
+	Actor,
+
+	Num
+};
+
+/** A cell on a specific layer. */
+struct FArcIWCellKey
+{
+	FIntVector Cell = FIntVector::ZeroValue;
+	EArcIWCellLayer Layer = EArcIWCellLayer::Mesh;
+
+	bool operator==(const FArcIWCellKey& Other) const
+	{
+		return Layer == Other.Layer && Cell == Other.Cell;
+	}
+
+	bool operator<(const FArcIWCellKey& Other) const
+	{
+		if (Layer != Other.Layer) { return Layer < Other.Layer; }
+		if (Cell.X != Other.Cell.X) { return Cell.X < Other.Cell.X; }
+		if (Cell.Y != Other.Cell.Y) { return Cell.Y < Other.Cell.Y; }
+		return Cell.Z < Other.Cell.Z;
+	}
+
+	friend uint32 GetTypeHash(const FArcIWCellKey& Key)
+	{
+		return HashCombineFast(GetTypeHash(Key.Cell), static_cast<uint32>(Key.Layer));
+	}
+};
+
+/**
+ * Single cell table for every visualization layer.
+ *
+ * Entities are stored sorted by (layer, cell), so each cell's entities are one contiguous range.
+ * Adds and removes are buffered and merged into the sorted storage by Flush(); occupancy queries
+ * (HasEntities, GetNumOccupiedCells) are exact at all times, entity ranges only after a flush.
+ * A per-entity record holds the layer mask and current cell per layer, so callers can unregister
+ * without knowing where the entity was placed.
+ *
+ * Reads of a flushed index are safe from worker threads.
+ */
+class ARCINSTANCEDWORLD_API FArcIWCellIndex
+{
+public:
+	static constexpr int32 NumLayers = static_cast<int32>(EArcIWCellLayer::Num);
+
+	static uint8 GetLayerBit(EArcIWCellLayer Layer) { return static_cast<uint8>(1u << static_cast<uint8>(Layer)); }
+
+	/** Place Entity in Cell on Layer, moving it if it is already on that layer. */
+	void Add(FMassEntityHandle Entity, EArcIWCellLayer Layer, const FIntVector& Cell);
+
+	/** Remove Entity from Layer. No-op if it is not registered there. */
+	void Remove(FMassEntityHandle Entity, EArcIWCellLayer Layer);
+
+	/** Remove Entity from every layer in its mask. */
+	void RemoveAll(FMassEntityHandle Entity);
+
+	/** Layers Entity is registered on (GetLayerBit). */
+	uint8 GetLayerMask(FMassEntityHandle Entity) const;
+
+	bool HasEntities(EArcIWCellLayer Layer, const FIntVector& Cell) const;
+	int32 GetNumOccupiedCells(EArcIWCellLayer Layer) const { return NumOccupiedCells[static_cast<int32>(Layer)]; }
+
+	/** Entities in a cell. Only valid on a flushed index. */
+	TConstArrayView<FMassEntityHandle> GetEntities(EArcIWCellLayer Layer, const FIntVector& Cell) const;
+
+	/** Invoke Func(const FIntVector& Cell, TConstArrayView<FMassEntityHandle> Entities) for each occupied cell of Layer. Only valid on a flushed index. */
+	template<typename FuncType>
+	void ForEachCell(EArcIWCellLayer Layer, FuncType&& Func) const
+	{
+		checkf(!IsDirty(), TEXT("FArcIWCellIndex must be flushed before iterating entity ranges"));
+		for (const TPair<FArcIWCellKey, FCellRange>& Pair : CellRanges)
+		{
+			if (Pair.Key.Layer == Layer && Pair.Value.Num > 0)
+			{
+				Func(Pair.Key.Cell, TConstArrayView<FMassEntityHandle>(SortedEntities.GetData() + Pair.Value.Start, Pair.Value.Num));
+			}
+		}
+	}
+
+	bool IsDirty() const { return !PendingAdds.IsEmpty() || !PendingRemovals.IsEmpty(); }
+
+	/** Merge buffered adds and removes into the sorted storage and rebuild the cell ranges. */
+	void Flush();
+
+	void Reset();
+
+	/**
+	 * Cells within RadiusCells (Chebyshev) of any of NewCenters that were not within RadiusCells of any of OldCenters.
+	 * Only the box differences between each source's old and new cube are visited, so the cost is proportional
+	 * to the ring that moved rather than the full radius. Pass the centers swapped to get the cells that left.
+	 */
+	static void GetEnteredCells(TConstArrayView<FIntVector> OldCenters, TConstArrayView<FIntVector> NewCenters, int32 RadiusCells, TArray<FIntVector>& OutCells);
+
+	/** True if Cell is within RadiusCells (Chebyshev) of any of Centers. */
+	static bool IsWithinRadiusOfAny(TConstArrayView<FIntVector> Centers, const FIntVector& Cell, int32 RadiusCells);
+
+private:
+	struct FEntry
+	{
+		FArcIWCellKey Key;
+		FMassEntityHandle Entity;
+
+		bool operator==(const FEntry& Other) const { return Key == Other.Key && Entity == Other.Entity; }
+		friend uint32 GetTypeHash(const FEntry& Entry) { return HashCombineFast(GetTypeHash(Entry.Key), GetTypeHash(Entry.Entity)); }
+	};
+
+	struct FCellRange
+	{
+		/** Range in SortedKeys / SortedEntities as of the last flush. */
+		int32 Start = 0;
+		int32 Num = 0;
+
+		/** Entities in the cell including buffered changes. */
+		int32 LiveCount = 0;
+	};
+
+	struct FEntityRecord
+	{
+		FIntVector Cells[NumLayers];
+		uint8 LayerMask = 0;
+	};
+
+	void AdjustLiveCount(const FArcIWCellKey& Key, int32 Delta);
+
+	/** Sorted by key; parallel arrays so a cell's entities are a plain handle view. */
+	TArray<FArcIWCellKey> SortedKeys;
+	TArray<FMassEntityHandle> SortedEntities;
+
+	TMap<FArcIWCellKey, FCellRange> CellRanges;
+	TMap<FMassEntityHandle, FEntityRecord> EntityRecords;
+
+	TArray<FEntry> PendingAdds;
+
+	/** Entries to drop on the next flush, with multiplicity. */
+	TMap<FEntry, int32> PendingRemovals;
+
+	int32 NumOccupiedCells[NumLayers] = {};
+};
@@ -5,6 +5,7 @@
 
 #include "ArcInstancedWorld/ArcIWActorPoolSubsystem.h"
 #include "ArcInstancedWorld/ArcIWRespawnSubsystem.h"
+#include "ArcInstancedWorld/ArcIWSpawnSchedulerSubsystem.h"
 #include "PCGComponent.h"
 #include "ArcInstancedWorld/ArcIWSettings.h"
 #include "MassEntitySubsystem.h"
@@ -41,6 +42,9 @@
 #include "MassExecutionContext.h"
 #include "MassCommands.h"
 #include "Misc/ArchiveMD5.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectSaveContext.h"
 
 // Physics entity link, Chaos user data, and ArcMass physics body fragment
 #include "MassEntityView.h"
@@ -60,6 +64,9 @@
 #include "ArcMass/Persistence/ArcMassFragmentSerializer.h"
 #include "ArcMass/Lifecycle/ArcMassLifecycle.h"
 #include "MassEntityUtils.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Tasks/Task.h"
 
 // WorldPartition for GetGridCellSize
 #include "ArcIWVisualizationSubsystem.h"
@@ -160,6 +167,33 @@ void AArcIWMassISMPartitionActor::PostRegisterAllComponents()
 #endif
 }
 
+void AArcIWMassISMPartitionActor::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FArcIWCustomVersion::GUID);
+	if (Ar.CustomVer(FArcIWCustomVersion::GUID) >= FArcIWCustomVersion::PackedInstanceStore)
+	{
+		InstanceStore.Serialize(Ar, this);
+	}
+}
+
+#if WITH_EDITOR
+void AArcIWMassISMPartitionActor::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	RebuildInstanceStore();
+}
+#endif
+
+#if WITH_EDITORONLY_DATA
+void AArcIWMassISMPartitionActor::RebuildInstanceStore()
+{
+	InstanceStore.Build(ActorClassEntries);
+}
+#endif
+
 void AArcIWMassISMPartitionActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -168,6 +202,11 @@ void AArcIWMassISMPartitionActor::BeginPlay()
 	DestroyEditorPreviewISMCs();
 #endif
 
+#if WITH_EDITORONLY_DATA
+	// Authoring transforms may have changed since the last save; cooked builds load the store as-is.
+	RebuildInstanceStore();
+#endif
+
 	InitializeISMState();
 	LoadRemovals();
 	PurgeExpiredRemovals();
@@ -187,9 +226,22 @@ void AArcIWMassISMPartitionActor::EndPlay(const EEndPlayReason::Type EndPlayReas
 		{
 			RespawnSubsystem->UnregisterPartitionActor(this);
 		}
+
+		if (UArcIWSpawnSchedulerSubsystem* Scheduler = World->GetSubsystem<UArcIWSpawnSchedulerSubsystem>())
+		{
+			Scheduler->DequeuePartition(this);
+		}
 	}
 
-	SaveEntityData();
+	// Entities not committed yet are dropped rather than created on this frame. The stored entity data
+	// still holds them, so it is only overwritten once every entity of the load exists.
+	const bool bSpawnDropped = SpawnPlan.IsValid();
+	CancelPendingSpawn();
+
+	if (!bSpawnDropped)
+	{
+		SaveEntityData();
+	}
 	SaveRemovals();
 	DespawnEntities();
 	DestroyISMHolderEntities();
@@ -300,6 +352,12 @@ void AArcIWMassISMPartitionActor::DestroyISMHolderEntities()
 // Persistence -- save/load ClassRemovals
 // ---------------------------------------------------------------------------
 
+namespace ArcIW::Private
+{
+	/** 'AIWR' — marks the binary removals blob. Older saves are JSON and start with '{'. */
+	constexpr uint32 RemovalsBlobMagic = 0x52574941;
+}
+
 void AArcIWMassISMPartitionActor::SaveRemovals()
 {
 	bool bHasData = PendingRespawns.Num() > 0;
@@ -324,43 +382,8 @@ void AArcIWMassISMPartitionActor::SaveRemovals()
 
 	UWorld* World = GetWorld();
 
-	FArcJsonSaveArchive Archive;
-
-	// Serialize ClassRemovals
-	Archive.BeginArray(FName(TEXT("ClassRemovals")), ClassRemovals.Num());
-	for (int32 Idx = 0; Idx < ClassRemovals.Num(); ++Idx)
-	{
-		Archive.BeginArrayElement(Idx);
-
-		const TSet<int32>& RemovedSet = ClassRemovals[Idx].RemovedInstances;
-		Archive.BeginArray(FName(TEXT("RemovedInstances")), RemovedSet.Num());
-		int32 ElemIdx = 0;
-		for (int32 RemovedIdx : RemovedSet)
-		{
-			Archive.BeginArrayElement(ElemIdx);
-			Archive.WriteProperty(FName(TEXT("Index")), RemovedIdx);
-			Archive.EndArrayElement();
-			++ElemIdx;
-		}
-		Archive.EndArray();
-
-		Archive.EndArrayElement();
-	}
-	Archive.EndArray();
-
-	// Serialize PendingRespawns
-	Archive.BeginArray(FName(TEXT("PendingRespawns")), PendingRespawns.Num());
-	for (int32 Idx = 0; Idx < PendingRespawns.Num(); ++Idx)
-	{
-		Archive.BeginArrayElement(Idx);
-		Archive.WriteProperty(FName(TEXT("RespawnAtUtc")), PendingRespawns[Idx].RespawnAtUtc);
-		Archive.WriteProperty(FName(TEXT("ClassIndex")), PendingRespawns[Idx].ClassIndex);
-		Archive.WriteProperty(FName(TEXT("TransformIndex")), PendingRespawns[Idx].TransformIndex);
-		Archive.EndArrayElement();
-	}
-	Archive.EndArray();
-
-	TArray<uint8> Data = Archive.Finalize();
+	TArray<uint8> Data;
+	EncodeRemovals(ClassRemovals, PendingRespawns, Data);
 
 	FString StorageKey = FString::Printf(TEXT("worlds/%s/partitions/%s/removals"),
 		*World->GetName(), *GetName());
@@ -385,21 +408,117 @@ void AArcIWMassISMPartitionActor::LoadRemovals()
 		return;
 	}
 
+	if (!DecodeRemovals(Result.Data, ActorClassEntries, ClassRemovals, PendingRespawns))
+	{
+		UE_LOG(LogArcIW, Warning, TEXT("LoadRemovals: malformed removals data in %s, rejected parts are ignored"), *GetName());
+	}
+}
+
+void AArcIWMassISMPartitionActor::EncodeRemovals(const TArray<FArcIWClassRemovals>& Removals, TArray<FArcIWPendingRespawn>& Respawns, TArray<uint8>& OutData)
+{
+	// Single binary blob: magic, per-class run-length encoded bitsets, then pending respawns.
+	FMemoryWriter Writer(OutData);
+
+	uint32 Magic = ArcIW::Private::RemovalsBlobMagic;
+	Writer << Magic;
+
+	int32 ClassCount = Removals.Num();
+	Writer << ClassCount;
+
+	TArray<uint8> Encoded;
+	for (const FArcIWClassRemovals& Entry : Removals)
+	{
+		Encoded.Reset();
+		Entry.RemovedInstances.Encode(Encoded);
+		Writer << Encoded;
+	}
+
+	int32 PendingCount = Respawns.Num();
+	Writer << PendingCount;
+	for (FArcIWPendingRespawn& Entry : Respawns)
+	{
+		Writer << Entry.RespawnAtUtc;
+		Writer << Entry.ClassIndex;
+		Writer << Entry.TransformIndex;
+	}
+}
+
+bool AArcIWMassISMPartitionActor::DecodeRemovals(const TArray<uint8>& Data, const TArray<FArcIWActorClassData>& Classes,
+	TArray<FArcIWClassRemovals>& OutRemovals, TArray<FArcIWPendingRespawn>& OutRespawns)
+{
+	OutRemovals.SetNum(Classes.Num());
+
+	FMemoryReader Reader(Data);
+	// Length prefixes read from a corrupt blob must not exceed the blob itself.
+	Reader.ArMaxSerializeSize = Data.Num();
+
+	uint32 Magic = 0;
+	Reader << Magic;
+	if (Magic != ArcIW::Private::RemovalsBlobMagic)
+	{
+		DecodeLegacyRemovals(Data, Classes, OutRemovals, OutRespawns);
+		return true;
+	}
+
+	bool bValid = true;
+
+	int32 ClassCount = 0;
+	Reader << ClassCount;
+
+	TArray<uint8> Encoded;
+	for (int32 Idx = 0; Idx < ClassCount && !Reader.IsError(); ++Idx)
+	{
+		Reader << Encoded;
+		if (Reader.IsError() || !OutRemovals.IsValidIndex(Idx))
+		{
+			continue;
+		}
+
+		int32 Offset = 0;
+		if (!OutRemovals[Idx].RemovedInstances.Decode(Encoded, Offset, Classes[Idx].NumInstances))
+		{
+			UE_LOG(LogArcIW, Warning, TEXT("DecodeRemovals: malformed removal bitset for class %d"), Idx);
+			bValid = false;
+		}
+	}
+
+	// Each respawn entry is 16 bytes.
+	int32 PendingCount = 0;
+	Reader << PendingCount;
+	if (Reader.IsError() || PendingCount < 0 || PendingCount > (Data.Num() - Reader.Tell()) / 16)
+	{
+		return false;
+	}
+
+	OutRespawns.Reserve(OutRespawns.Num() + PendingCount);
+	for (int32 Idx = 0; Idx < PendingCount && !Reader.IsError(); ++Idx)
+	{
+		FArcIWPendingRespawn Entry;
+		Reader << Entry.RespawnAtUtc;
+		Reader << Entry.ClassIndex;
+		Reader << Entry.TransformIndex;
+		OutRespawns.Add(Entry);
+	}
+
+	return bValid && !Reader.IsError();
+}
+
+void AArcIWMassISMPartitionActor::DecodeLegacyRemovals(const TArray<uint8>& Data, const TArray<FArcIWActorClassData>& Classes,
+	TArray<FArcIWClassRemovals>& OutRemovals, TArray<FArcIWPendingRespawn>& OutRespawns)
+{
 	FArcJsonLoadArchive Archive;
-	if (!Archive.InitializeFromData(Result.Data))
+	if (!Archive.InitializeFromData(Data))
 	{
 		return;
 	}
 
-	ClassRemovals.SetNum(ActorClassEntries.Num());
-
 	int32 ClassCount = 0;
 	if (!Archive.BeginArray(FName(TEXT("ClassRemovals")), ClassCount))
 	{
 		return;
 	}
 
-	const int32 NumToRead = FMath::Min(ClassCount, ClassRemovals.Num());
+	const int32 NumToRead = FMath::Min(ClassCount, OutRemovals.Num());
 	for (int32 Idx = 0; Idx < NumToRead; ++Idx)
 	{
 		Archive.BeginArrayElement(Idx);
@@ -412,9 +531,9 @@ void AArcIWMassISMPartitionActor::LoadRemovals()
 				Archive.BeginArrayElement(R);
 				int32 RemovedIdx = INDEX_NONE;
 				Archive.ReadProperty(FName(TEXT("Index")), RemovedIdx);
-				if (RemovedIdx != INDEX_NONE)
+				if (RemovedIdx >= 0 && RemovedIdx < Classes[Idx].NumInstances)
 				{
-					ClassRemovals[Idx].RemovedInstances.Add(RemovedIdx);
+					OutRemovals[Idx].RemovedInstances.Add(RemovedIdx);
 				}
 				Archive.EndArrayElement();
 			}
@@ -429,7 +548,7 @@ void AArcIWMassISMPartitionActor::LoadRemovals()
 	int32 PendingCount = 0;
 	if (Archive.BeginArray(FName(TEXT("PendingRespawns")), PendingCount))
 	{
-		PendingRespawns.Reserve(PendingCount);
+		OutRespawns.Reserve(OutRespawns.Num() + PendingCount);
 		for (int32 Idx = 0; Idx < PendingCount; ++Idx)
 		{
 			Archive.BeginArrayElement(Idx);
@@ -437,7 +556,7 @@ void AArcIWMassISMPartitionActor::LoadRemovals()
 			Archive.ReadProperty(FName(TEXT("RespawnAtUtc")), Entry.RespawnAtUtc);
 			Archive.ReadProperty(FName(TEXT("ClassIndex")), Entry.ClassIndex);
 			Archive.ReadProperty(FName(TEXT("TransformIndex")), Entry.TransformIndex);
-			PendingRespawns.Add(Entry);
+			OutRespawns.Add(Entry);
 			Archive.EndArrayElement();
 		}
 		Archive.EndArray();
@@ -574,6 +693,9 @@ int32 AArcIWMassISMPartitionActor::ComputeMeshSlotBase(int32 ClassIndex) const
 // Entity Spawning (Phase B -- mirrors ISM version)
 // ---------------------------------------------------------------------------
 
+FArcIWSpawnPlan::FArcIWSpawnPlan() = default;
+FArcIWSpawnPlan::~FArcIWSpawnPlan() = default;
+
 void AArcIWMassISMPartitionActor::SpawnEntities()
 {
 	UWorld* World = GetWorld();
@@ -582,14 +704,11 @@ void AArcIWMassISMPartitionActor::SpawnEntities()
 		return;
 	}
 
-	UMassEntitySubsystem* EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>();
-	if (!EntitySubsystem)
+	if (!World->GetSubsystem<UMassEntitySubsystem>())
 	{
 		return;
 	}
 
-	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
-
 	// Ensure ClassRemovals is parallel to ActorClassEntries.
 	// May already be populated from persistence load; resize if needed (new classes get empty sets).
 	ClassRemovals.SetNum(ActorClassEntries.Num());
@@ -598,7 +717,7 @@ void AArcIWMassISMPartitionActor::SpawnEntities()
 	int32 TotalEntities = 0;
 	for (int32 Idx = 0; Idx < ActorClassEntries.Num(); ++Idx)
 	{
-		TotalEntities += ActorClassEntries[Idx].InstanceTransforms.Num() - ClassRemovals[Idx].RemovedInstances.Num();
+		TotalEntities += ActorClassEntries[Idx].NumInstances - ClassRemovals[Idx].RemovedInstances.Num();
 	}
 
 	SpawnedEntities.Reserve(TotalEntities);
@@ -611,235 +730,466 @@ void AArcIWMassISMPartitionActor::SpawnEntities()
 		ClassMeshSlotBases[ClassIndex] = ComputeMeshSlotBase(ClassIndex);
 	}
 
-	// Hold the CreationContext from the first BatchCreateEntities alive across all
-	// classes — subsequent calls reuse the active context. Observers fire only when
-	// this ref drops, after persisted data is loaded.
-	TSharedPtr<FMassObserverManager::FCreationContext> CreationContext;
+	TArray<FVector> SourceLocations;
+	UArcIWSpawnSchedulerSubsystem::GatherStreamingSourceLocations(*World, SourceLocations);
 
-	for (int32 ClassIndex = 0; ClassIndex < ActorClassEntries.Num(); ++ClassIndex)
+	// Persisted entity data is fetched by the backend's own queue and parsed with the plan.
+	TFuture<FArcPersistenceLoadResult> PersistedFuture;
+	if (IArcPersistenceBackend* Backend = GetPersistenceBackend())
 	{
-		const FArcIWActorClassData& ClassData = ActorClassEntries[ClassIndex];
-		const TSet<int32>& RemovedSet = ClassRemovals[ClassIndex].RemovedInstances;
+		FString StorageKey = FString::Printf(TEXT("worlds/%s/partitions/%s/entitydata"),
+			*World->GetName(), *GetName());
+		PersistedFuture = Backend->LoadEntry(StorageKey);
+	}
+
+	SpawnPlan = MakeShared<FArcIWSpawnPlan>();
+	SpawnPlan->ClassArchetypes.SetNum(ActorClassEntries.Num());
+	SpawnPlan->ClassSharedValues.SetNumZeroed(ActorClassEntries.Num());
 
-		// Build list of transform indices to spawn (skip removed).
-		TArray<int32> TransformIndicesToSpawn;
-		TransformIndicesToSpawn.Reserve(ClassData.InstanceTransforms.Num());
-		for (int32 i = 0; i < ClassData.InstanceTransforms.Num(); ++i)
+	UArcIWSpawnSchedulerSubsystem* Scheduler = World->GetSubsystem<UArcIWSpawnSchedulerSubsystem>();
+	if (!Scheduler || UArcIWSettings::Get()->SpawnFrameBudgetMs <= 0.f)
+	{
+		TArray<uint8> PersistedData;
+		if (PersistedFuture.IsValid())
 		{
-			if (!RemovedSet.Contains(i))
+			FArcPersistenceLoadResult Result = PersistedFuture.Get();
+			if (Result.bSuccess)
 			{
-				TransformIndicesToSpawn.Add(i);
+				PersistedData = MoveTemp(Result.Data);
 			}
 		}
 
-		const int32 InstanceCount = TransformIndicesToSpawn.Num();
-		if (InstanceCount == 0)
-		{
-			continue;
-		}
+		BuildSpawnPlan(*SpawnPlan, ActorClassEntries, InstanceStore, ClassRemovals, ClassMeshSlotBases, SourceLocations, GetActorGuid(), PersistedData);
 
-		// Get or build entity template via visualization subsystem cache.
-		// On dedicated servers the subsystem is null, so we build a minimal template inline.
-		FMassArchetypeHandle Archetype;
-		const FMassArchetypeSharedFragmentValues* SharedValuesPtr = nullptr;
+		// No task waits on the event here; trigger it so it is not destroyed pending.
+		SpawnPlan->SignalLoaded();
+		FinishPendingSpawn();
+		return;
+	}
 
-		UArcIWVisualizationSubsystem* VisSubsystem = World->GetSubsystem<UArcIWVisualizationSubsystem>();
-		if (VisSubsystem)
+	// The preparation task is only scheduled once the load has finished, so no worker blocks on the backend.
+	if (PersistedFuture.IsValid())
+	{
+		PersistedFuture.Then([Plan = SpawnPlan](TFuture<FArcPersistenceLoadResult> Loaded)
 		{
-			const UArcIWVisualizationSubsystem::FCachedEntityTemplate& Cached =
-				VisSubsystem->EnsureEntityTemplate(ClassData, *World);
-			Archetype = Cached.EntityTemplate->GetArchetype();
-			SharedValuesPtr = &Cached.EntityTemplate->GetSharedFragmentValues();
-		}
+			FArcPersistenceLoadResult Result = Loaded.Get();
+			if (Result.bSuccess)
+			{
+				Plan->LoadedData = MoveTemp(Result.Data);
+			}
+			Plan->SignalLoaded();
+		});
+	}
+	else
+	{
+		SpawnPlan->SignalLoaded();
+	}
 
-		// Dedicated server fallback — no vis subsystem, build gameplay-only template
-		if (!VisSubsystem)
+	// ActorClassEntries and InstanceStore are immutable at runtime and EndPlay waits on the task,
+	// so the worker may read them in place. Removals are snapshotted: gameplay can mark instances removed meanwhile.
+	SpawnPlan->PrepareTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Plan = SpawnPlan.Get(),
+		Classes = &ActorClassEntries,
+		Store = &InstanceStore,
+		Removals = ClassRemovals,
+		MeshSlotBases = MoveTemp(ClassMeshSlotBases),
+		SourceLocations = MoveTemp(SourceLocations),
+		PartitionGuid = GetActorGuid()]()
 		{
-			FMassEntityTemplateData TemplateData;
-
-			if (ClassData.AdditionalEntityConfig != nullptr)
+			if (Plan->bCancelled)
 			{
-				FMassEntityTemplateBuildContext BuildContext(TemplateData);
-				const FMassEntityConfig& Config = ClassData.AdditionalEntityConfig->GetConfig();
-				BuildContext.BuildFromTraits(Config.GetTraits(), *World);
+				return;
 			}
 
-			const bool bIsSingleMesh = (ClassData.MeshDescriptors.Num() == 1);
-			if (bIsSingleMesh && ClassData.MeshDescriptors[0].IsSkinned())
+			TRACE_CPUPROFILER_EVENT_SCOPE(ArcIWPrepareSpawnPlan);
+
+			BuildSpawnPlan(*Plan, *Classes, *Store, Removals, MeshSlotBases, SourceLocations, PartitionGuid, Plan->LoadedData);
+			Plan->LoadedData.Empty();
+		},
+		UE::Tasks::Prerequisites(SpawnPlan->LoadedEvent));
+
+	Scheduler->EnqueuePartition(this);
+}
+
+FArcIWPreparedSpawnEntry AArcIWMassISMPartitionActor::MakePreparedEntry(
+	const FArcIWActorClassData& ClassData,
+	const FArcIWInstanceStore& Store,
+	int32 ClassIndex,
+	int32 TransformIndex,
+	int32 MeshSlotBase,
+	const FGuid& PartitionGuid)
+{
+	FArcIWPreparedSpawnEntry Entry;
+	Entry.Transform = Store.GetTransform(ClassData.FirstStoreIndex + TransformIndex);
+	Entry.PersistenceGuid = MakeDeterministicGuid(PartitionGuid, ClassIndex, TransformIndex);
+	Entry.ClassIndex = ClassIndex;
+	Entry.TransformIndex = TransformIndex;
+	Entry.MeshSlotBase = MeshSlotBase;
+	Entry.bSingleMesh = (ClassData.MeshDescriptors.Num() == 1);
+	return Entry;
+}
+
+void AArcIWMassISMPartitionActor::BuildSpawnPlan(
+	FArcIWSpawnPlan& Plan,
+	const TArray<FArcIWActorClassData>& Classes,
+	const FArcIWInstanceStore& Store,
+	const TArray<FArcIWClassRemovals>& Removals,
+	TConstArrayView<int32> MeshSlotBases,
+	TConstArrayView<FVector> SourceLocations,
+	const FGuid& PartitionGuid,
+	const TArray<uint8>& PersistedData)
+{
+	// Index persisted elements by (ClassIndex, TransformIndex) so slices can seek straight to them.
+	TMap<FIntPoint, int32> PersistedElementByKey;
+	if (PersistedData.Num() > 0)
+	{
+		TUniquePtr<FArcJsonLoadArchive> Archive = MakeUnique<FArcJsonLoadArchive>();
+		int32 EntityCount = 0;
+		if (Archive->InitializeFromData(PersistedData) && Archive->BeginArray(FName(TEXT("entities")), EntityCount))
+		{
+			PersistedElementByKey.Reserve(EntityCount);
+			for (int32 Idx = 0; Idx < EntityCount; ++Idx)
 			{
-				TemplateData.AddTag<FArcIWSimpleVisSkinnedTag>();
+				if (!Archive->BeginArrayElement(Idx))
+				{
+					continue;
+				}
+
+				int32 ClassIndex = INDEX_NONE;
+				int32 TransformIndex = INDEX_NONE;
+				Archive->ReadProperty(FName(TEXT("ClassIndex")), ClassIndex);
+				Archive->ReadProperty(FName(TEXT("TransformIndex")), TransformIndex);
+				PersistedElementByKey.Add(FIntPoint(ClassIndex, TransformIndex), Idx);
+
+				Archive->EndArrayElement();
 			}
-			else if (bIsSingleMesh)
+			Archive->EndArray();
+
+			Plan.PersistedArchive = MoveTemp(Archive);
+		}
+	}
+
+	int32 TotalEntities = 0;
+	for (const FArcIWActorClassData& ClassData : Classes)
+	{
+		TotalEntities += ClassData.NumInstances;
+	}
+	Plan.Entries.Reserve(TotalEntities);
+
+	for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+	{
+		const FArcIWActorClassData& ClassData = Classes[ClassIndex];
+		const FArcIWRemovalBitset& RemovedSet = Removals[ClassIndex].RemovedInstances;
+
+		for (int32 TransformIndex = 0; TransformIndex < ClassData.NumInstances; ++TransformIndex)
+		{
+			if (RemovedSet.Contains(TransformIndex))
 			{
-				TemplateData.AddTag<FArcIWSimpleVisEntityTag>();
+				continue;
 			}
-			else
+
+			FArcIWPreparedSpawnEntry& Entry = Plan.Entries.Add_GetRef(
+				MakePreparedEntry(ClassData, Store, ClassIndex, TransformIndex, MeshSlotBases[ClassIndex], PartitionGuid));
+
+			if (const int32* PersistedIdx = PersistedElementByKey.Find(FIntPoint(ClassIndex, TransformIndex)))
 			{
-				TemplateData.AddTag<FArcIWEntityTag>();
+				Entry.PersistedElementIndex = *PersistedIdx;
 			}
 
-			TemplateData.AddFragment<FArcIWInstanceFragment>();
-			TemplateData.AddFragment<FTransformFragment>();
-			TemplateData.AddFragment<FArcMassPhysicsBodyFragment>();
+			const FVector Location = Entry.Transform.GetLocation();
+			Plan.Bounds += Location;
 
-			FArcIWVisConfigFragment ConfigFragment;
-			ConfigFragment.ActorClass = ClassData.ActorClass;
-			ConfigFragment.MeshDescriptors = ClassData.MeshDescriptors;
-			TemplateData.AddConstSharedFragment(FConstSharedStruct::Make(ConfigFragment));
-
-			if (ClassData.CollisionBodySetup)
+			if (SourceLocations.Num() > 0)
 			{
-				FArcMassPhysicsBodyConfigFragment PhysicsConfig;
-				PhysicsConfig.BodySetup = ClassData.CollisionBodySetup;
-				PhysicsConfig.BodyTemplate = ClassData.BodyTemplate;
-				PhysicsConfig.BodyType = ClassData.PhysicsBodyType;
-				TemplateData.AddConstSharedFragment(FConstSharedStruct::Make(PhysicsConfig));
+				double MinDistanceSq = TNumericLimits<double>::Max();
+				for (const FVector& Source : SourceLocations)
+				{
+					MinDistanceSq = FMath::Min(MinDistanceSq, FVector::DistSquared(Source, Location));
+				}
+				Entry.PriorityDistanceSq = MinDistanceSq;
 			}
+		}
+	}
 
-			FGuid ClassGuid = FGuid::NewDeterministicGuid(ClassData.ActorClass->GetPathName());
-			FMassEntityTemplateID TemplateID = FMassEntityTemplateIDFactory::Make(ClassGuid);
+	if (SourceLocations.Num() > 0)
+	{
+		Algo::SortBy(Plan.Entries, &FArcIWPreparedSpawnEntry::PriorityDistanceSq);
+	}
+}
 
-			UMassSpawnerSubsystem* SpawnerSubsystem = World->GetSubsystem<UMassSpawnerSubsystem>();
-			check(SpawnerSubsystem);
-			FMassEntityTemplateRegistry& TemplateRegistry = SpawnerSubsystem->GetMutableTemplateRegistryInstance();
-			const TSharedRef<FMassEntityTemplate>& RegisteredTemplate = TemplateRegistry.FindOrAddTemplate(TemplateID, MoveTemp(TemplateData));
-			Archetype = RegisteredTemplate->GetArchetype();
-			SharedValuesPtr = &RegisteredTemplate->GetSharedFragmentValues();
-		}
+bool AArcIWMassISMPartitionActor::ResolveClassTemplate(int32 ClassIndex, UWorld& World,
+	FMassArchetypeHandle& OutArchetype, const FMassArchetypeSharedFragmentValues*& OutSharedValues) const
+{
+	const FArcIWActorClassData& ClassData = ActorClassEntries[ClassIndex];
 
-		const FMassArchetypeSharedFragmentValues& SharedValues = *SharedValuesPtr;
-		TArray<FMassEntityHandle> ClassEntities;
-		TSharedRef<FMassObserverManager::FCreationContext> ClassCreationContext =
-			EntityManager.BatchCreateEntities(Archetype, SharedValues, InstanceCount, ClassEntities);
-		if (!CreationContext.IsValid())
-		{
-			CreationContext = ClassCreationContext;
-		}
+	// Get or build entity template via visualization subsystem cache.
+	// On dedicated servers the subsystem is null, so we build a minimal template inline.
+	UArcIWVisualizationSubsystem* VisSubsystem = World.GetSubsystem<UArcIWVisualizationSubsystem>();
+	if (VisSubsystem)
+	{
+		const UArcIWVisualizationSubsystem::FCachedEntityTemplate& Cached =
+			VisSubsystem->EnsureEntityTemplate(ClassData, World);
+		OutArchetype = Cached.EntityTemplate->GetArchetype();
+		OutSharedValues = &Cached.EntityTemplate->GetSharedFragmentValues();
+		return true;
+	}
+
+	// Dedicated server fallback — no vis subsystem, build gameplay-only template
+	FMassEntityTemplateData TemplateData;
+
+	if (ClassData.AdditionalEntityConfig != nullptr)
+	{
+		FMassEntityTemplateBuildContext BuildContext(TemplateData);
+		const FMassEntityConfig& Config = ClassData.AdditionalEntityConfig->GetConfig();
+		BuildContext.BuildFromTraits(Config.GetTraits(), World);
+	}
+
+	const bool bIsSingleMesh = (ClassData.MeshDescriptors.Num() == 1);
+	if (bIsSingleMesh && ClassData.MeshDescriptors[0].IsSkinned())
+	{
+		TemplateData.AddTag<FArcIWSimpleVisSkinnedTag>();
+	}
+	else if (bIsSingleMesh)
+	{
+		TemplateData.AddTag<FArcIWSimpleVisEntityTag>();
+	}
+	else
+	{
+		TemplateData.AddTag<FArcIWEntityTag>();
+	}
+
+	TemplateData.AddFragment<FArcIWInstanceFragment>();
+	TemplateData.AddFragment<FTransformFragment>();
+	TemplateData.AddFragment<FArcMassPhysicsBodyFragment>();
+
+	FArcIWVisConfigFragment ConfigFragment;
+	ConfigFragment.ActorClass = ClassData.ActorClass;
+	ConfigFragment.MeshDescriptors = ClassData.MeshDescriptors;
+	TemplateData.AddConstSharedFragment(FConstSharedStruct::Make(ConfigFragment));
+
+	if (ClassData.CollisionBodySetup)
+	{
+		FArcMassPhysicsBodyConfigFragment PhysicsConfig;
+		PhysicsConfig.BodySetup = ClassData.CollisionBodySetup;
+		PhysicsConfig.BodyTemplate = ClassData.BodyTemplate;
+		PhysicsConfig.BodyType = ClassData.PhysicsBodyType;
+		TemplateData.AddConstSharedFragment(FConstSharedStruct::Make(PhysicsConfig));
+	}
+
+	FGuid ClassGuid = FGuid::NewDeterministicGuid(ClassData.ActorClass->GetPathName());
+	FMassEntityTemplateID TemplateID = FMassEntityTemplateIDFactory::Make(ClassGuid);
+
+	UMassSpawnerSubsystem* SpawnerSubsystem = World.GetSubsystem<UMassSpawnerSubsystem>();
+	check(SpawnerSubsystem);
+	FMassEntityTemplateRegistry& TemplateRegistry = SpawnerSubsystem->GetMutableTemplateRegistryInstance();
+	const TSharedRef<FMassEntityTemplate>& RegisteredTemplate = TemplateRegistry.FindOrAddTemplate(TemplateID, MoveTemp(TemplateData));
+	OutArchetype = RegisteredTemplate->GetArchetype();
+	OutSharedValues = &RegisteredTemplate->GetSharedFragmentValues();
+	return true;
+}
+
+double AArcIWMassISMPartitionActor::GetSpawnPriorityDistanceSq(TConstArrayView<FVector> SourceLocations) const
+{
+	if (!SpawnPlan.IsValid() || !SpawnPlan->Bounds.IsValid || SourceLocations.IsEmpty())
+	{
+		return 0.0;
+	}
+
+	double MinDistanceSq = TNumericLimits<double>::Max();
+	for (const FVector& Source : SourceLocations)
+	{
+		MinDistanceSq = FMath::Min(MinDistanceSq, SpawnPlan->Bounds.ComputeSquaredDistanceToPoint(Source));
+	}
+	return MinDistanceSq;
+}
+
+int32 AArcIWMassISMPartitionActor::CommitSpawnSlice(int32 MaxEntities)
+{
+	if (!IsSpawnPrepared())
+	{
+		return 0;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcIWCommitSpawnSlice);
+
+	UWorld* World = GetWorld();
+	UMassEntitySubsystem* EntitySubsystem = World ? World->GetSubsystem<UMassEntitySubsystem>() : nullptr;
+	if (!EntitySubsystem)
+	{
+		SpawnPlan.Reset();
+		return 0;
+	}
+
+	FMassEntityManager& EntityManager = EntitySubsystem->GetMutableEntityManager();
+	FArcIWSpawnPlan& Plan = *SpawnPlan;
 
-		const int32 BaseIndex = SpawnedEntities.Num();
-		const int32 ClassMeshSlotBase = ClassMeshSlotBases[ClassIndex];
+	const int32 SliceBegin = Plan.NextEntry;
+	const int32 SliceEnd = SliceBegin + FMath::Min(MaxEntities, Plan.NumRemaining());
+	Plan.NextEntry = SliceEnd;
 
-		for (int32 i = 0; i < InstanceCount; ++i)
+	// Skip instances removed or restored since the plan was prepared.
+	TArray<const FArcIWPreparedSpawnEntry*> SliceEntries;
+	SliceEntries.Reserve(SliceEnd - SliceBegin);
+	for (int32 Idx = SliceBegin; Idx < SliceEnd; ++Idx)
+	{
+		const FArcIWPreparedSpawnEntry& Entry = Plan.Entries[Idx];
+		if (ClassRemovals[Entry.ClassIndex].RemovedInstances.Contains(Entry.TransformIndex)
+			|| EntityLookupByIndex.Contains(FIntPoint(Entry.ClassIndex, Entry.TransformIndex)))
 		{
-			const int32 OriginalTransformIndex = TransformIndicesToSpawn[i];
+			continue;
+		}
+		SliceEntries.Add(&Entry);
+	}
 
-			FTransformFragment& TransformFragment = EntityManager.GetFragmentDataChecked<FTransformFragment>(ClassEntities[i]);
-			TransformFragment.SetTransform(ClassData.InstanceTransforms[OriginalTransformIndex]);
+	// BatchCreateEntities takes one archetype per call — group the slice by class.
+	Algo::StableSortBy(SliceEntries, [](const FArcIWPreparedSpawnEntry* Entry) { return Entry->ClassIndex; });
 
-			FArcIWInstanceFragment& InstanceFragment = EntityManager.GetFragmentDataChecked<FArcIWInstanceFragment>(ClassEntities[i]);
-			InstanceFragment.InstanceIndex = BaseIndex + i;
-			InstanceFragment.MeshSlotBase = ClassMeshSlotBase;
-			InstanceFragment.PartitionActor = this;
-			InstanceFragment.ClassIndex = ClassIndex;
-			InstanceFragment.TransformIndex = OriginalTransformIndex;
+	int32 NumCreated = 0;
+	{
+		// Hold the CreationContext from the first BatchCreateEntities alive across all
+		// classes — subsequent calls reuse the active context. Observers fire only when
+		// this ref drops, after persisted data is loaded.
+		TSharedPtr<FMassObserverManager::FCreationContext> CreationContext;
+		TArray<TPair<FMassEntityHandle, const FArcIWPreparedSpawnEntry*>> PersistedEntities;
 
-			if (ActorClassEntries[ClassIndex].MeshDescriptors.Num() == 1)
+		int32 RunBegin = 0;
+		while (RunBegin < SliceEntries.Num())
+		{
+			const int32 ClassIndex = SliceEntries[RunBegin]->ClassIndex;
+			int32 RunEnd = RunBegin + 1;
+			while (RunEnd < SliceEntries.Num() && SliceEntries[RunEnd]->ClassIndex == ClassIndex)
 			{
-				InstanceFragment.ISMInstanceIds.SetNum(1);
-				InstanceFragment.ISMInstanceIds[0] = INDEX_NONE;
+				++RunEnd;
 			}
 
-			const FIntPoint EntityKey(ClassIndex, OriginalTransformIndex);
-			EntityLookupByIndex.Add(EntityKey, ClassEntities[i]);
+			if (!Plan.ClassSharedValues[ClassIndex])
+			{
+				ResolveClassTemplate(ClassIndex, *World, Plan.ClassArchetypes[ClassIndex], Plan.ClassSharedValues[ClassIndex]);
+			}
 
-			// Assign deterministic GUID if entity has persistence fragment
-			FArcMassPersistenceFragment* PersistFrag = EntityManager.GetFragmentDataPtr<FArcMassPersistenceFragment>(ClassEntities[i]);
-			if (PersistFrag)
+			const int32 InstanceCount = RunEnd - RunBegin;
+			TArray<FMassEntityHandle> ClassEntities;
+			TSharedRef<FMassObserverManager::FCreationContext> ClassCreationContext =
+				EntityManager.BatchCreateEntities(Plan.ClassArchetypes[ClassIndex], *Plan.ClassSharedValues[ClassIndex], InstanceCount, ClassEntities);
+			if (!CreationContext.IsValid())
 			{
-				PersistFrag->PersistenceGuid = MakeDeterministicGuid(GetActorGuid(), ClassIndex, OriginalTransformIndex);
+				CreationContext = ClassCreationContext;
 			}
-		}
 
-		SpawnedEntities.Append(ClassEntities);
-	}
+			const int32 BaseIndex = SpawnedEntities.Num();
 
-	// -----------------------------------------------------------------------
-	// Apply persisted entity data before releasing CreationContext.
-	// Observers have not fired yet — transforms and fragments will be correct
-	// when init observers run.
-	// -----------------------------------------------------------------------
-	IArcPersistenceBackend* Backend = GetPersistenceBackend();
-	if (Backend)
-	{
-		FString StorageKey = FString::Printf(TEXT("worlds/%s/partitions/%s/entitydata"),
-			*World->GetName(), *GetName());
+			for (int32 i = 0; i < InstanceCount; ++i)
+			{
+				const FArcIWPreparedSpawnEntry& Entry = *SliceEntries[RunBegin + i];
 
-		TFuture<FArcPersistenceLoadResult> Future = Backend->LoadEntry(StorageKey);
-		FArcPersistenceLoadResult Result = Future.Get();
+				FTransformFragment& TransformFragment = EntityManager.GetFragmentDataChecked<FTransformFragment>(ClassEntities[i]);
+				TransformFragment.SetTransform(Entry.Transform);
 
-		if (Result.bSuccess && Result.Data.Num() > 0)
-		{
-			FArcJsonLoadArchive Archive;
-			if (Archive.InitializeFromData(Result.Data))
-			{
-				int32 EntityCount = 0;
-				if (Archive.BeginArray(FName(TEXT("entities")), EntityCount))
-				{
-					for (int32 Idx = 0; Idx < EntityCount; ++Idx)
-					{
-						if (!Archive.BeginArrayElement(Idx))
-						{
-							continue;
-						}
+				FArcIWInstanceFragment& InstanceFragment = EntityManager.GetFragmentDataChecked<FArcIWInstanceFragment>(ClassEntities[i]);
+				InstanceFragment.InstanceIndex = BaseIndex + i;
+				InstanceFragment.MeshSlotBase = Entry.MeshSlotBase;
+				InstanceFragment.PartitionActor = this;
+				InstanceFragment.ClassIndex = ClassIndex;
+				InstanceFragment.TransformIndex = Entry.TransformIndex;
 
-						int32 ClassIndex = INDEX_NONE;
-						int32 TransformIndex = INDEX_NONE;
-						Archive.ReadProperty(FName(TEXT("ClassIndex")), ClassIndex);
-						Archive.ReadProperty(FName(TEXT("TransformIndex")), TransformIndex);
+				if (Entry.bSingleMesh)
+				{
+					InstanceFragment.ISMInstanceIds.SetNum(1);
+					InstanceFragment.ISMInstanceIds[0] = INDEX_NONE;
+				}
 
-						bool bSkipEntity = false;
-						if (ClassRemovals.IsValidIndex(ClassIndex) && ClassRemovals[ClassIndex].RemovedInstances.Contains(TransformIndex))
-						{
-							bSkipEntity = true;
-						}
+				EntityLookupByIndex.Add(FIntPoint(ClassIndex, Entry.TransformIndex), ClassEntities[i]);
 
-						const FIntPoint EntityKey(ClassIndex, TransformIndex);
-						const FMassEntityHandle* EntityHandle = bSkipEntity ? nullptr : EntityLookupByIndex.Find(EntityKey);
-						if (!EntityHandle || !EntityManager.IsEntityValid(*EntityHandle))
-						{
-							bSkipEntity = true;
-						}
+				// Assign deterministic GUID if entity has persistence fragment
+				FArcMassPersistenceFragment* PersistFrag = EntityManager.GetFragmentDataPtr<FArcMassPersistenceFragment>(ClassEntities[i]);
+				if (PersistFrag)
+				{
+					PersistFrag->PersistenceGuid = Entry.PersistenceGuid;
+				}
 
-						if (bSkipEntity)
-						{
-							int32 FragCount = 0;
-							if (Archive.BeginArray(FName(TEXT("fragments")), FragCount))
-							{
-								for (int32 F = 0; F < FragCount; ++F)
-								{
-									Archive.BeginArrayElement(F);
-									Archive.EndArrayElement();
-								}
-								Archive.EndArray();
-							}
-							Archive.EndArrayElement();
-							continue;
-						}
+				if (Entry.PersistedElementIndex != INDEX_NONE)
+				{
+					PersistedEntities.Emplace(ClassEntities[i], &Entry);
+				}
+			}
 
-						FArcMassFragmentSerializer::LoadEntityFragments(EntityManager, *EntityHandle, Archive, World);
+			SpawnedEntities.Append(ClassEntities);
+			NumCreated += InstanceCount;
+			RunBegin = RunEnd;
+		}
 
-						FArcLifecycleFragment* LifecycleFrag = EntityManager.GetFragmentDataPtr<FArcLifecycleFragment>(*EntityHandle);
-						const FArcLifecycleConfigFragment* Config =
-							EntityManager.GetConstSharedFragmentDataPtr<FArcLifecycleConfigFragment>(*EntityHandle);
-						if (LifecycleFrag && Config && !Config->IsValidPhase(LifecycleFrag->CurrentPhase))
-						{
-							UE_LOG(LogMass, Warning, TEXT("LoadEntityData: Phase %d out of range for entity (%d,%d), clamping to InitialPhase %d"),
-								LifecycleFrag->CurrentPhase, ClassIndex, TransformIndex, Config->InitialPhase);
-							LifecycleFrag->CurrentPhase = Config->InitialPhase;
-							LifecycleFrag->PreviousPhase = Config->InitialPhase;
-							LifecycleFrag->PhaseTimeElapsed = 0.f;
-						}
+		// -------------------------------------------------------------------
+		// Apply persisted entity data before releasing CreationContext.
+		// Observers have not fired yet — transforms and fragments will be correct
+		// when init observers run.
+		// -------------------------------------------------------------------
+		int32 PersistedCount = 0;
+		if (PersistedEntities.Num() > 0 && Plan.PersistedArchive->BeginArray(FName(TEXT("entities")), PersistedCount))
+		{
+			FArcJsonLoadArchive& Archive = *Plan.PersistedArchive;
+			for (const TPair<FMassEntityHandle, const FArcIWPreparedSpawnEntry*>& Persisted : PersistedEntities)
+			{
+				const FMassEntityHandle EntityHandle = Persisted.Key;
+				const FArcIWPreparedSpawnEntry& Entry = *Persisted.Value;
+				if (!Archive.BeginArrayElement(Entry.PersistedElementIndex))
+				{
+					continue;
+				}
 
-						Archive.EndArrayElement();
-					}
+				FArcMassFragmentSerializer::LoadEntityFragments(EntityManager, EntityHandle, Archive, World);
 
-					Archive.EndArray();
+				FArcLifecycleFragment* LifecycleFrag = EntityManager.GetFragmentDataPtr<FArcLifecycleFragment>(EntityHandle);
+				const FArcLifecycleConfigFragment* Config =
+					EntityManager.GetConstSharedFragmentDataPtr<FArcLifecycleConfigFragment>(EntityHandle);
+				if (LifecycleFrag && Config && !Config->IsValidPhase(LifecycleFrag->CurrentPhase))
+				{
+					UE_LOG(LogMass, Warning, TEXT("LoadEntityData: Phase %d out of range for entity (%d,%d), clamping to InitialPhase %d"),
+						LifecycleFrag->CurrentPhase, Entry.ClassIndex, Entry.TransformIndex, Config->InitialPhase);
+					LifecycleFrag->CurrentPhase = Config->InitialPhase;
+					LifecycleFrag->PreviousPhase = Config->InitialPhase;
+					LifecycleFrag->PhaseTimeElapsed = 0.f;
 				}
+
+				Archive.EndArrayElement();
 			}
+			Archive.EndArray();
 		}
+
+		// CreationContext drops here — observers fire with correct persisted data
 	}
 
-	// CreationContext drops here — observers fire with correct persisted data
+	if (Plan.NumRemaining() <= 0)
+	{
+		SpawnPlan.Reset();
+	}
+
+	return NumCreated;
+}
+
+void AArcIWMassISMPartitionActor::FinishPendingSpawn()
+{
+	if (!SpawnPlan.IsValid())
+	{
+		return;
+	}
+
+	SpawnPlan->PrepareTask.Wait();
+	CommitSpawnSlice(MAX_int32);
+}
+
+void AArcIWMassISMPartitionActor::CancelPendingSpawn()
+{
+	if (!SpawnPlan.IsValid())
+	{
+		return;
+	}
+
+	// Releases a task still waiting for the load; one already past its cancel check is waited for,
+	// since it reads ActorClassEntries and InstanceStore in place.
+	SpawnPlan->bCancelled = true;
+	SpawnPlan->SignalLoaded();
+	SpawnPlan->PrepareTask.Wait();
+	SpawnPlan.Reset();
 }
 
 void AArcIWMassISMPartitionActor::DespawnEntities()
@@ -887,10 +1237,10 @@ void AArcIWMassISMPartitionActor::MarkInstanceRemoved(int32 ClassIndex, int32 Tr
 	}
 
 	const FArcIWActorClassData& ClassData = ActorClassEntries[ClassIndex];
-	if (TransformIndex < 0 || TransformIndex >= ClassData.InstanceTransforms.Num())
+	if (TransformIndex < 0 || TransformIndex >= ClassData.NumInstances)
 	{
 		UE_LOG(LogArcIW, Warning, TEXT("MarkInstanceRemoved: invalid TransformIndex %d for class %d (max %d)"),
-			TransformIndex, ClassIndex, ClassData.InstanceTransforms.Num() - 1);
+			TransformIndex, ClassIndex, ClassData.NumInstances - 1);
 		return;
 	}
 
@@ -982,12 +1332,20 @@ void AArcIWMassISMPartitionActor::RestoreInstance(int32 ClassIndex, int32 Transf
 	}
 
 	const FArcIWActorClassData& ClassData = ActorClassEntries[ClassIndex];
-	if (TransformIndex < 0 || TransformIndex >= ClassData.InstanceTransforms.Num())
+	if (TransformIndex < 0 || TransformIndex >= ClassData.NumInstances)
 	{
 		UE_LOG(LogArcIW, Warning, TEXT("RestoreInstance: invalid TransformIndex %d for class %d"), TransformIndex, ClassIndex);
 		return;
 	}
 
+	// A staged spawn still in flight creates the instance together with the rest of its plan.
+	if (SpawnPlan.IsValid())
+	{
+		SpawnPlan->PrepareTask.Wait();
+		SpawnPlan->Entries.Add(MakePreparedEntry(ClassData, InstanceStore, ClassIndex, TransformIndex, ComputeMeshSlotBase(ClassIndex), GetActorGuid()));
+		return;
+	}
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -1033,7 +1391,7 @@ void AArcIWMassISMPartitionActor::RestoreInstance(int32 ClassIndex, int32 Transf
 	int32 InstanceIndex = SpawnedEntities.Num();
 
 	FTransformFragment& TransformFragment = EntityManager.GetFragmentDataChecked<FTransformFragment>(NewEntity);
-	TransformFragment.SetTransform(ClassData.InstanceTransforms[TransformIndex]);
+	TransformFragment.SetTransform(GetInstanceTransform(ClassIndex, TransformIndex));
 
 	FArcIWInstanceFragment& InstanceFragment = EntityManager.GetFragmentDataChecked<FArcIWInstanceFragment>(NewEntity);
 	InstanceFragment.InstanceIndex = InstanceIndex;
@@ -2640,6 +2998,7 @@ void AArcIWMassISMPartitionActor::AddActorInstance(
 	}
 
 	FoundEntry->InstanceTransforms.Add(WorldTransform);
+	FoundEntry->NumInstances = FoundEntry->InstanceTransforms.Num();
 
 	Modify();
 }
@@ -2677,6 +3036,8 @@ int32 AArcIWMassISMPartitionActor::RemoveActorInstances(
 		}
 	}
 
+	ClassData.NumInstances = ClassData.InstanceTransforms.Num();
+
 	// If no transforms remain, remove the entire class entry.
 	if (ClassData.InstanceTransforms.IsEmpty())
 	{
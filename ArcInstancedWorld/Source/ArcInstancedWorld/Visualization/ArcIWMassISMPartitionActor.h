@@ -9,10 +9,13 @@
 #include "MassEntityTypes.h"
 #include "MassEntityManager.h"
 #include "ArcInstancedWorld/ArcIWTypes.h"
+#include "ArcInstancedWorld/ArcIWInstanceStore.h"
 #include "ArcMass/Physics/ArcMassPhysicsBody.h"
 #include "Mass/EntityHandle.h"
+#include "Tasks/Task.h"
 #include "ArcIWMassISMPartitionActor.generated.h"
 
+class FArcJsonLoadArchive;
 class IArcPersistenceBackend;
 class UBodySetup;
 class UMassEntityConfigAsset;
@@ -35,6 +38,75 @@ struct FArcIWMeshActivationRequest
 	bool bHasOverrideMats = false;
 };
 
+/** Initial values for one entity, computed off the game thread by the spawn preparation task. */
+struct FArcIWPreparedSpawnEntry
+{
+	FTransform Transform;
+	FGuid PersistenceGuid;
+	int32 ClassIndex = INDEX_NONE;
+	int32 TransformIndex = INDEX_NONE;
+	int32 MeshSlotBase = 0;
+
+	/** Element of the persisted "entities" array to apply before observers run, or INDEX_NONE. */
+	int32 PersistedElementIndex = INDEX_NONE;
+
+	/** Squared distance to the nearest streaming source when the plan was built. */
+	double PriorityDistanceSq = 0.0;
+
+	bool bSingleMesh = false;
+};
+
+/**
+ * Staged spawn state of one partition actor. Built on a background task from ActorClassEntries
+ * and a snapshot of ClassRemovals, then committed on the game thread in slices by
+ * UArcIWSpawnSchedulerSubsystem.
+ */
+struct FArcIWSpawnPlan
+{
+	FArcIWSpawnPlan();
+	~FArcIWSpawnPlan();
+
+	/** Entities to create, nearest to the streaming sources first. */
+	TArray<FArcIWPreparedSpawnEntry> Entries;
+
+	/** Next entry in Entries to commit. */
+	int32 NextEntry = 0;
+
+	/** World bounds of all entries, used to order partitions against each other. */
+	FBox Bounds = FBox(ForceInit);
+
+	/** Parsed persisted entity data. Null when nothing was saved for this partition. */
+	TUniquePtr<FArcJsonLoadArchive> PersistedArchive;
+
+	/** Per-class entity template, resolved on the game thread when the class is first committed. */
+	TArray<FMassArchetypeHandle> ClassArchetypes;
+	TArray<const FMassArchetypeSharedFragmentValues*> ClassSharedValues;
+
+	/** Background preparation. Entries must not be touched until it completes. */
+	UE::Tasks::FTask PrepareTask;
+
+	/** Raw persisted entity data, handed over by the backend load's continuation. */
+	TArray<uint8> LoadedData;
+
+	/** PrepareTask's prerequisite, triggered once LoadedData is set or the plan is cancelled. */
+	UE::Tasks::FTaskEvent LoadedEvent{ TEXT("ArcIWSpawnPlanLoaded") };
+	std::atomic<bool> bLoadSignalled{ false };
+
+	/** Set when the partition streams out first. PrepareTask then skips building the plan. */
+	std::atomic<bool> bCancelled{ false };
+
+	int32 NumRemaining() const { return Entries.Num() - NextEntry; }
+
+	/** Triggers LoadedEvent once, from either the load continuation or a cancel. */
+	void SignalLoaded()
+	{
+		if (!bLoadSignalled.exchange(true))
+		{
+			LoadedEvent.Trigger();
+		}
+	}
+};
+
 /**
  * Partition actor that uses Mass MeshEngine for ISM rendering and standalone
  * FBodyInstance for physics (no ISM components at runtime).
@@ -61,6 +133,10 @@ public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void PostRegisterAllComponents() override;
+	virtual void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+#endif
 
 #if WITH_EDITOR
 	/**
@@ -113,15 +189,46 @@ public:
 	/** Returns the stored per-class data entries. */
 	const TArray<FArcIWActorClassData>& GetActorClassEntries() const { return ActorClassEntries; }
 
+	/** Write class removals and pending respawns as the persisted removals blob. */
+	static void EncodeRemovals(const TArray<FArcIWClassRemovals>& Removals, TArray<FArcIWPendingRespawn>& Respawns, TArray<uint8>& OutData);
+
+	/** Read a removals blob, or the older JSON format, into one removal set per entry of Classes.
+	 *  Bitsets that are malformed or cover more indices than their class has instances are left empty.
+	 *  Returns false if any part of the data was rejected. */
+	static bool DecodeRemovals(const TArray<uint8>& Data, const TArray<FArcIWActorClassData>& Classes,
+		TArray<FArcIWClassRemovals>& OutRemovals, TArray<FArcIWPendingRespawn>& OutRespawns);
+
+	/** Packed transforms of every instance, all classes back to back. */
+	const FArcIWInstanceStore& GetInstanceStore() const { return InstanceStore; }
+
+	/** Original world transform of an instance, decoded from the instance store. */
+	FTransform GetInstanceTransform(int32 ClassIndex, int32 TransformIndex) const
+	{
+		return InstanceStore.GetTransform(ActorClassEntries[ClassIndex].FirstStoreIndex + TransformIndex);
+	}
+
 	/** Returns all Mass entities spawned by this partition actor. */
 	const TArray<FMassEntityHandle>& GetSpawnedEntities() const { return SpawnedEntities; }
 
+	/** True while the staged spawn still has entities to create. */
+	bool IsSpawnPending() const { return SpawnPlan.IsValid(); }
+
+	/** True once the background preparation of the pending spawn has finished. */
+	bool IsSpawnPrepared() const { return SpawnPlan.IsValid() && SpawnPlan->PrepareTask.IsCompleted(); }
+
+	/** Squared distance from the pending spawn's bounds to the nearest source location. 0 when there are no sources. */
+	double GetSpawnPriorityDistanceSq(TConstArrayView<FVector> SourceLocations) const;
+
+	/** Create up to MaxEntities pending entities and apply their persisted data.
+	 *  Returns the number of entities created. Game thread only; requires IsSpawnPrepared(). */
+	int32 CommitSpawnSlice(int32 MaxEntities);
+
 	FName GetGridName() const { return GridName; }
 
 	/** Record an instance as removed and destroy its Mass entity.
 	 *  Gameplay code calls this — do NOT call during DespawnEntities (stream-out).
 	 *  @param ClassIndex Index into ActorClassEntries.
-	 *  @param TransformIndex Index into ActorClassEntries[ClassIndex].InstanceTransforms. */
+	 *  @param TransformIndex Instance index within the class, [0, NumInstances). */
 	void MarkInstanceRemoved(int32 ClassIndex, int32 TransformIndex);
 
 	/** Spawn entities for all expired pending respawns. Called by UArcIWRespawnSubsystem. */
@@ -256,7 +363,38 @@ public:
 	//~
 
 private:
+	/** Prepare the spawn plan (on a background task unless SpawnFrameBudgetMs is 0) and queue it for commit. */
 	void SpawnEntities();
+
+	/** Wait for preparation and create every remaining pending entity. Used by the synchronous spawn path. */
+	void FinishPendingSpawn();
+
+	/** Drop the staged spawn without creating its remaining entities. Used on stream-out. */
+	void CancelPendingSpawn();
+
+	/** Fill Plan from class data and a removal snapshot. Touches no UObjects; runs on a worker thread. */
+	static void BuildSpawnPlan(
+		FArcIWSpawnPlan& Plan,
+		const TArray<FArcIWActorClassData>& Classes,
+		const FArcIWInstanceStore& Store,
+		const TArray<FArcIWClassRemovals>& Removals,
+		TConstArrayView<int32> MeshSlotBases,
+		TConstArrayView<FVector> SourceLocations,
+		const FGuid& PartitionGuid,
+		const TArray<uint8>& PersistedData);
+
+	static FArcIWPreparedSpawnEntry MakePreparedEntry(
+		const FArcIWActorClassData& ClassData,
+		const FArcIWInstanceStore& Store,
+		int32 ClassIndex,
+		int32 TransformIndex,
+		int32 MeshSlotBase,
+		const FGuid& PartitionGuid);
+
+	/** Get or build the entity template for a class. On dedicated servers builds a gameplay-only template. */
+	bool ResolveClassTemplate(int32 ClassIndex, UWorld& World,
+		FMassArchetypeHandle& OutArchetype, const FMassArchetypeSharedFragmentValues*& OutSharedValues) const;
+
 	void DespawnEntities();
 	void InitializeISMState();
 	void DestroyISMHolderEntities();
@@ -267,6 +405,15 @@ private:
 	/** Load ClassRemovals and PendingRespawns from persistence backend. Called before SpawnEntities(). */
 	void LoadRemovals();
 
+	/** Parse the pre-bitset JSON removals format written by older saves. */
+	static void DecodeLegacyRemovals(const TArray<uint8>& Data, const TArray<FArcIWActorClassData>& Classes,
+		TArray<FArcIWClassRemovals>& OutRemovals, TArray<FArcIWPendingRespawn>& OutRespawns);
+
+#if WITH_EDITORONLY_DATA
+	/** Repack InstanceStore from the authoring InstanceTransforms of every class. */
+	void RebuildInstanceStore();
+#endif
+
 	/** Remove expired entries from PendingRespawns and ClassRemovals. Called after LoadRemovals(), before SpawnEntities(). */
 	void PurgeExpiredRemovals();
 
@@ -288,6 +435,9 @@ private:
 	UPROPERTY(VisibleAnywhere, Category = "ArcIW")
 	TArray<FArcIWActorClassData> ActorClassEntries;
 
+	/** Quantized instance transforms. Serialized as bulk data after the tagged properties. */
+	FArcIWInstanceStore InstanceStore;
+
 	/** Per-class removal tracking. Parallel to ActorClassEntries — same length, same indices.
 	 *  Populated from persistence backend on stream-in, updated by MarkInstanceRemoved(). */
 	UPROPERTY()
@@ -311,6 +461,9 @@ private:
 	 *  used by IActorInstanceManagerInterface. */
 	TArray<FMassEntityHandle> SpawnedEntities;
 
+	/** Staged spawn in progress. Reset once every entry has been committed. */
+	TSharedPtr<FArcIWSpawnPlan> SpawnPlan;
+
 	/** Mass MeshEngine ISM holder entities -- one per mesh slot across all classes.
 	 *  Layout: [Class0.Mesh0, Class0.Mesh1, ..., Class1.Mesh0, ...].
 	 *  Each holds FMassRenderStateFragment + FMassRenderISMFragment for rendering. */
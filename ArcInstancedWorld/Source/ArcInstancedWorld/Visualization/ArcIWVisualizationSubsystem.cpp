@@ -23,6 +23,7 @@
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
 
 // ---------------------------------------------------------------------------
 // Template Cache Helpers
@@ -79,30 +80,26 @@ void UArcIWVisualizationSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 
 	const UArcIWSettings* Settings = UArcIWSettings::Get();
 
-	// Mesh grid
-	MeshCellSize = Settings->MeshCellSize;
-	MeshAddRadius = Settings->MeshAddRadius;
-	MeshAddRadiusCells = FMath::CeilToInt32(MeshAddRadius / MeshCellSize);
-	MeshRemoveRadius = Settings->MeshRemoveRadius;
-	MeshRemoveRadiusCells = FMath::CeilToInt32(MeshRemoveRadius / MeshCellSize);
-	LastMeshPlayerCell = FIntVector(TNumericLimits<int32>::Max());
-
-	// Physics grid
-	PhysicsCellSize = Settings->PhysicsCellSize;
-	PhysicsAddRadius = Settings->PhysicsAddRadius;
-	PhysicsAddRadiusCells = FMath::CeilToInt32(PhysicsAddRadius / PhysicsCellSize);
-	PhysicsRemoveRadius = Settings->PhysicsRemoveRadius;
-	PhysicsRemoveRadiusCells = FMath::CeilToInt32(PhysicsRemoveRadius / PhysicsCellSize);
-	LastPhysicsPlayerCell = FIntVector(TNumericLimits<int32>::Max());
+	auto InitLayer = [this](EArcIWCellLayer Layer, float CellSize, float AddRadius, float RemoveRadius)
+	{
+		FCellLayerState& State = Layers[static_cast<int32>(Layer)];
+		State.CellSize = CellSize;
+		State.AddRadius = AddRadius;
+		State.AddRadiusCells = FMath::CeilToInt32(AddRadius / CellSize);
+		State.RemoveRadius = RemoveRadius;
+		State.RemoveRadiusCells = FMath::CeilToInt32(RemoveRadius / CellSize);
+		State.SourceCells.Reset();
+	};
+
+	InitLayer(EArcIWCellLayer::Mesh, Settings->MeshCellSize, Settings->MeshAddRadius, Settings->MeshRemoveRadius);
+	InitLayer(EArcIWCellLayer::Physics, Settings->PhysicsCellSize, Settings->PhysicsAddRadius, Settings->PhysicsRemoveRadius);
 
 	// Actor grid (conditional)
 	bActorGridEnabled = !Settings->bDisableActorHydration;
-	ActorCellSize = Settings->ActorCellSize;
-	ActorHydrationRadius = Settings->ActorHydrationRadius;
-	ActorHydrationRadiusCells = FMath::CeilToInt32(ActorHydrationRadius / ActorCellSize);
-	ActorDehydrationRadius = Settings->ActorDehydrationRadius;
-	ActorDehydrationRadiusCells = FMath::CeilToInt32(ActorDehydrationRadius / ActorCellSize);
-	LastActorPlayerCell = FIntVector(TNumericLimits<int32>::Max());
+	InitLayer(EArcIWCellLayer::Actor, Settings->ActorCellSize, Settings->ActorHydrationRadius, Settings->ActorDehydrationRadius);
+	PoolPrewarmRadiusCells = Settings->PoolPrewarmMargin > 0.f
+		? FMath::CeilToInt32((Settings->ActorHydrationRadius + Settings->PoolPrewarmMargin) / Settings->ActorCellSize)
+		: 0;
 }
 
 void UArcIWVisualizationSubsystem::Deinitialize()
@@ -110,9 +107,7 @@ void UArcIWVisualizationSubsystem::Deinitialize()
 	ISMComponentLookup.Empty();
 	PartitionISMDataMap.Empty();
 	EntityToPartitionActor.Empty();
-	MeshCellEntities.Empty();
-	PhysicsCellEntities.Empty();
-	ActorCellEntities.Empty();
+	CellIndex.Reset();
 
 	Super::Deinitialize();
 }
@@ -134,92 +129,41 @@ FIntVector WorldToCell(const FVector& WorldPos, float InCellSize)
 	);
 }
 
-void RegisterEntity(TMap<FIntVector, TArray<FMassEntityHandle>>& CellMap, FMassEntityHandle Entity, const FVector& Position, float InCellSize)
-{
-	const FIntVector Cell = WorldToCell(Position, InCellSize);
-	CellMap.FindOrAdd(Cell).Add(Entity);
-}
+} // namespace UE::ArcIW::VisGrid
 
-void UnregisterEntity(TMap<FIntVector, TArray<FMassEntityHandle>>& CellMap, FMassEntityHandle Entity, const FIntVector& Cell)
+FIntVector UArcIWVisualizationSubsystem::WorldToCell(EArcIWCellLayer Layer, const FVector& WorldPos) const
 {
-	if (TArray<FMassEntityHandle>* Entities = CellMap.Find(Cell))
-	{
-		Entities->RemoveSwap(Entity);
-		if (Entities->IsEmpty())
-		{
-			CellMap.Remove(Cell);
-		}
-	}
+	return UE::ArcIW::VisGrid::WorldToCell(WorldPos, GetLayer(Layer).CellSize);
 }
 
-} // namespace UE::ArcIW::VisGrid
-
 FIntVector UArcIWVisualizationSubsystem::WorldToMeshCell(const FVector& WorldPos) const
 {
-	return UE::ArcIW::VisGrid::WorldToCell(WorldPos, MeshCellSize);
+	return WorldToCell(EArcIWCellLayer::Mesh, WorldPos);
 }
 
 FIntVector UArcIWVisualizationSubsystem::WorldToPhysicsCell(const FVector& WorldPos) const
 {
-	return UE::ArcIW::VisGrid::WorldToCell(WorldPos, PhysicsCellSize);
+	return WorldToCell(EArcIWCellLayer::Physics, WorldPos);
 }
 
 FIntVector UArcIWVisualizationSubsystem::WorldToActorCell(const FVector& WorldPos) const
 {
-	return UE::ArcIW::VisGrid::WorldToCell(WorldPos, ActorCellSize);
+	return WorldToCell(EArcIWCellLayer::Actor, WorldPos);
 }
 
-void UArcIWVisualizationSubsystem::RegisterMeshEntity(FMassEntityHandle Entity, const FVector& Position)
+void UArcIWVisualizationSubsystem::RegisterEntity(FMassEntityHandle Entity, const FVector& Position)
 {
-	UE::ArcIW::VisGrid::RegisterEntity(MeshCellEntities, Entity, Position, MeshCellSize);
-}
-
-void UArcIWVisualizationSubsystem::UnregisterMeshEntity(FMassEntityHandle Entity, const FIntVector& Cell)
-{
-	UE::ArcIW::VisGrid::UnregisterEntity(MeshCellEntities, Entity, Cell);
-}
-
-const TArray<FMassEntityHandle>* UArcIWVisualizationSubsystem::GetMeshEntitiesInCell(const FIntVector& Cell) const
-{
-	return MeshCellEntities.Find(Cell);
-}
-
-void UArcIWVisualizationSubsystem::RegisterPhysicsEntity(FMassEntityHandle Entity, const FVector& Position)
-{
-	UE::ArcIW::VisGrid::RegisterEntity(PhysicsCellEntities, Entity, Position, PhysicsCellSize);
-}
-
-void UArcIWVisualizationSubsystem::UnregisterPhysicsEntity(FMassEntityHandle Entity, const FIntVector& Cell)
-{
-	UE::ArcIW::VisGrid::UnregisterEntity(PhysicsCellEntities, Entity, Cell);
-}
-
-const TArray<FMassEntityHandle>* UArcIWVisualizationSubsystem::GetPhysicsEntitiesInCell(const FIntVector& Cell) const
-{
-	return PhysicsCellEntities.Find(Cell);
-}
-
-void UArcIWVisualizationSubsystem::RegisterActorEntity(FMassEntityHandle Entity, const FVector& Position)
-{
-	if (!bActorGridEnabled)
-	{
-		return;
-	}
-	UE::ArcIW::VisGrid::RegisterEntity(ActorCellEntities, Entity, Position, ActorCellSize);
-}
-
-void UArcIWVisualizationSubsystem::UnregisterActorEntity(FMassEntityHandle Entity, const FIntVector& Cell)
-{
-	if (!bActorGridEnabled)
+	CellIndex.Add(Entity, EArcIWCellLayer::Mesh, WorldToCell(EArcIWCellLayer::Mesh, Position));
+	CellIndex.Add(Entity, EArcIWCellLayer::Physics, WorldToCell(EArcIWCellLayer::Physics, Position));
+	if (bActorGridEnabled)
 	{
-		return;
+		CellIndex.Add(Entity, EArcIWCellLayer::Actor, WorldToCell(EArcIWCellLayer::Actor, Position));
 	}
-	UE::ArcIW::VisGrid::UnregisterEntity(ActorCellEntities, Entity, Cell);
 }
 
-const TArray<FMassEntityHandle>* UArcIWVisualizationSubsystem::GetActorEntitiesInCell(const FIntVector& Cell) const
+void UArcIWVisualizationSubsystem::UnregisterEntity(FMassEntityHandle Entity)
 {
-	return ActorCellEntities.Find(Cell);
+	CellIndex.RemoveAll(Entity);
 }
 
 // ---------------------------------------------------------------------------
@@ -424,85 +368,142 @@ void UArcIWVisualizationSubsystem::RemoveCompositeISMInstances(
 // Cell Tracking
 // ---------------------------------------------------------------------------
 
-void UArcIWVisualizationSubsystem::UpdateMeshPlayerCell(const FIntVector& NewCell)
+bool UArcIWVisualizationSubsystem::UpdateSources(TConstArrayView<FVector> SourceLocations, FArcIWCellTransitions& OutTransitions)
 {
-	LastMeshPlayerCell = NewCell;
+	TArray<FIntVector> NewSourceCells[FArcIWCellIndex::NumLayers];
+	bool bLayerChanged[FArcIWCellIndex::NumLayers] = {};
+	bool bAnyChanged = false;
+
+	for (int32 LayerIndex = 0; LayerIndex < FArcIWCellIndex::NumLayers; ++LayerIndex)
+	{
+		const EArcIWCellLayer Layer = static_cast<EArcIWCellLayer>(LayerIndex);
+		if (Layer == EArcIWCellLayer::Actor && !bActorGridEnabled)
+		{
+			continue;
+		}
+
+		// Sources sharing a cell contribute the same cube; keep one.
+		for (const FVector& Location : SourceLocations)
+		{
+			NewSourceCells[LayerIndex].AddUnique(WorldToCell(Layer, Location));
+		}
+
+		bLayerChanged[LayerIndex] = NewSourceCells[LayerIndex] != Layers[LayerIndex].SourceCells;
+		bAnyChanged |= bLayerChanged[LayerIndex];
+	}
+
+	if (!bAnyChanged)
+	{
+		return false;
+	}
+
+	CellIndex.Flush();
+
+	// One request per changed layer and direction. Activation is entering the add radius, deactivation is
+	// leaving the remove radius (hysteresis). Actor cells deactivate on leaving the hydration radius; the
+	// dehydration processor applies the wider radius per entity.
+	struct FTransitionRequest
+	{
+		EArcIWCellLayer Layer;
+		bool bActivation;
+		int32 RadiusCells;
+		TArray<FMassEntityHandle>* Output;
+	};
+
+	TArray<FTransitionRequest, TInlineAllocator<FArcIWCellIndex::NumLayers * 2 + 1>> Requests;
+	for (int32 LayerIndex = 0; LayerIndex < FArcIWCellIndex::NumLayers; ++LayerIndex)
+	{
+		if (!bLayerChanged[LayerIndex])
+		{
+			continue;
+		}
+
+		const EArcIWCellLayer Layer = static_cast<EArcIWCellLayer>(LayerIndex);
+		const FCellLayerState& State = Layers[LayerIndex];
+		const int32 DeactivationRadiusCells = Layer == EArcIWCellLayer::Actor ? State.AddRadiusCells : State.RemoveRadiusCells;
+		Requests.Add({Layer, true, State.AddRadiusCells, &OutTransitions.Activated[LayerIndex]});
+		Requests.Add({Layer, false, DeactivationRadiusCells, &OutTransitions.Deactivated[LayerIndex]});
+
+		if (Layer == EArcIWCellLayer::Actor && PoolPrewarmRadiusCells > State.AddRadiusCells)
+		{
+			Requests.Add({Layer, true, PoolPrewarmRadiusCells, &OutTransitions.Approaching});
+		}
+	}
+
+	ParallelFor(Requests.Num(), [this, &Requests, &NewSourceCells](int32 RequestIdx)
+	{
+		const FTransitionRequest& Request = Requests[RequestIdx];
+		const int32 LayerIndex = static_cast<int32>(Request.Layer);
+		const TConstArrayView<FIntVector> OldCells = Layers[LayerIndex].SourceCells;
+		const TConstArrayView<FIntVector> NewCells = NewSourceCells[LayerIndex];
+
+		TArray<FIntVector> Cells;
+		if (Request.bActivation)
+		{
+			FArcIWCellIndex::GetEnteredCells(OldCells, NewCells, Request.RadiusCells, Cells);
+		}
+		else
+		{
+			FArcIWCellIndex::GetEnteredCells(NewCells, OldCells, Request.RadiusCells, Cells);
+		}
+
+		for (const FIntVector& Cell : Cells)
+		{
+			const TConstArrayView<FMassEntityHandle> Entities = CellIndex.GetEntities(Request.Layer, Cell);
+			Request.Output->Append(Entities.GetData(), Entities.Num());
+		}
+	});
+
+	for (int32 LayerIndex = 0; LayerIndex < FArcIWCellIndex::NumLayers; ++LayerIndex)
+	{
+		if (bLayerChanged[LayerIndex])
+		{
+			Layers[LayerIndex].SourceCells = MoveTemp(NewSourceCells[LayerIndex]);
+		}
+	}
+
+	return true;
 }
 
-void UArcIWVisualizationSubsystem::UpdatePhysicsPlayerCell(const FIntVector& NewCell)
+FIntVector UArcIWVisualizationSubsystem::GetPrimarySourceCell(EArcIWCellLayer Layer) const
 {
-	LastPhysicsPlayerCell = NewCell;
+	const TArray<FIntVector>& SourceCells = GetLayer(Layer).SourceCells;
+	return SourceCells.IsEmpty() ? FIntVector(TNumericLimits<int32>::Max()) : SourceCells[0];
 }
 
-void UArcIWVisualizationSubsystem::UpdateActorPlayerCell(const FIntVector& NewCell)
+bool UArcIWVisualizationSubsystem::IsWithinSourceRadius(EArcIWCellLayer Layer, const FIntVector& Cell, int32 RadiusCells) const
 {
-	LastActorPlayerCell = NewCell;
+	return FArcIWCellIndex::IsWithinRadiusOfAny(GetLayer(Layer).SourceCells, Cell, RadiusCells);
 }
 
 bool UArcIWVisualizationSubsystem::IsMeshCell(const FIntVector& MeshCell) const
 {
-	if (LastMeshPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = MeshCell - LastMeshPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= MeshAddRadiusCells;
+	return IsWithinSourceRadius(EArcIWCellLayer::Mesh, MeshCell, GetMeshAddRadiusCells());
 }
 
 bool UArcIWVisualizationSubsystem::IsWithinMeshRemoveRadius(const FIntVector& MeshCell) const
 {
-	if (LastMeshPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = MeshCell - LastMeshPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= MeshRemoveRadiusCells;
+	return IsWithinSourceRadius(EArcIWCellLayer::Mesh, MeshCell, GetMeshRemoveRadiusCells());
 }
 
 bool UArcIWVisualizationSubsystem::IsPhysicsCell(const FIntVector& PhysicsCell) const
 {
-	if (LastPhysicsPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = PhysicsCell - LastPhysicsPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= PhysicsAddRadiusCells;
+	return IsWithinSourceRadius(EArcIWCellLayer::Physics, PhysicsCell, GetPhysicsAddRadiusCells());
 }
 
 bool UArcIWVisualizationSubsystem::IsWithinPhysicsRemoveRadius(const FIntVector& PhysicsCell) const
 {
-	if (LastPhysicsPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = PhysicsCell - LastPhysicsPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= PhysicsRemoveRadiusCells;
+	return IsWithinSourceRadius(EArcIWCellLayer::Physics, PhysicsCell, GetPhysicsRemoveRadiusCells());
 }
 
 bool UArcIWVisualizationSubsystem::IsActorCell(const FIntVector& ActorCell) const
 {
-	if (!bActorGridEnabled || LastActorPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = ActorCell - LastActorPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= ActorHydrationRadiusCells;
+	return bActorGridEnabled && IsWithinSourceRadius(EArcIWCellLayer::Actor, ActorCell, GetActorHydrationRadiusCells());
 }
 
 bool UArcIWVisualizationSubsystem::IsWithinDehydrationRadius(const FIntVector& ActorCell) const
 {
-	if (!bActorGridEnabled || LastActorPlayerCell.X == TNumericLimits<int32>::Max())
-	{
-		return false;
-	}
-	FIntVector Delta = ActorCell - LastActorPlayerCell;
-	int32 MaxDist = FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z));
-	return MaxDist <= ActorDehydrationRadiusCells;
+	return bActorGridEnabled && IsWithinSourceRadius(EArcIWCellLayer::Actor, ActorCell, GetActorDehydrationRadiusCells());
 }
 
 void UArcIWVisualizationSubsystem::GetCellsInRadius(const FIntVector& Center, int32 RadiusCells, TArray<FIntVector>& OutCells)
@@ -9,12 +9,23 @@
 #include "MassArchetypeTypes.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "ArcInstancedWorld/Visualization/ArcIWCellIndex.h"
 #include "ArcIWVisualizationSubsystem.generated.h"
 
 struct FArcIWMeshEntry;
 struct FArcIWActorClassData;
 struct FMassEntityTemplateData;
 
+/** Entities whose cells entered a layer's add radius or left its remove radius in one source update. */
+struct FArcIWCellTransitions
+{
+	TArray<FMassEntityHandle> Activated[FArcIWCellIndex::NumLayers];
+	TArray<FMassEntityHandle> Deactivated[FArcIWCellIndex::NumLayers];
+
+	/** Entities that entered the actor pool prewarm band (hydration radius + UArcIWSettings::PoolPrewarmMargin). */
+	TArray<FMassEntityHandle> Approaching;
+};
+
 // ---------------------------------------------------------------------------
 // UArcIWVisualizationSubsystem
 // ---------------------------------------------------------------------------
@@ -41,17 +52,21 @@ public:
 	FIntVector WorldToPhysicsCell(const FVector& WorldPos) const;
 	FIntVector WorldToActorCell(const FVector& WorldPos) const;
 
-	void RegisterMeshEntity(FMassEntityHandle Entity, const FVector& Position);
-	void UnregisterMeshEntity(FMassEntityHandle Entity, const FIntVector& Cell);
-	const TArray<FMassEntityHandle>* GetMeshEntitiesInCell(const FIntVector& Cell) const;
+	FIntVector WorldToCell(EArcIWCellLayer Layer, const FVector& WorldPos) const;
+
+	/** Register Entity on the mesh and physics layers, and the actor layer when actor hydration is enabled. */
+	void RegisterEntity(FMassEntityHandle Entity, const FVector& Position);
+	/** Remove Entity from every layer it was registered on. */
+	void UnregisterEntity(FMassEntityHandle Entity);
 
-	void RegisterPhysicsEntity(FMassEntityHandle Entity, const FVector& Position);
-	void UnregisterPhysicsEntity(FMassEntityHandle Entity, const FIntVector& Cell);
-	const TArray<FMassEntityHandle>* GetPhysicsEntitiesInCell(const FIntVector& Cell) const;
+	/** Entities in a cell. Valid after FlushCellIndex() until the next registration change. */
+	TConstArrayView<FMassEntityHandle> GetMeshEntitiesInCell(const FIntVector& Cell) const { return CellIndex.GetEntities(EArcIWCellLayer::Mesh, Cell); }
+	TConstArrayView<FMassEntityHandle> GetPhysicsEntitiesInCell(const FIntVector& Cell) const { return CellIndex.GetEntities(EArcIWCellLayer::Physics, Cell); }
+	TConstArrayView<FMassEntityHandle> GetActorEntitiesInCell(const FIntVector& Cell) const { return CellIndex.GetEntities(EArcIWCellLayer::Actor, Cell); }
 
-	void RegisterActorEntity(FMassEntityHandle Entity, const FVector& Position);
-	void UnregisterActorEntity(FMassEntityHandle Entity, const FIntVector& Cell);
-	const TArray<FMassEntityHandle>* GetActorEntitiesInCell(const FIntVector& Cell) const;
+	/** Merge buffered registrations so per-cell entity ranges can be read. */
+	void FlushCellIndex() { CellIndex.Flush(); }
+	const FArcIWCellIndex& GetCellIndex() const { return CellIndex; }
 
 	// --- Composite ISM Management ---
 
@@ -91,47 +106,54 @@ public:
 		FMassEntityManager& EntityManager);
 
 	// --- Cell Tracking ---
-	void UpdateMeshPlayerCell(const FIntVector& NewCell);
-	void UpdatePhysicsPlayerCell(const FIntVector& NewCell);
-	void UpdateActorPlayerCell(const FIntVector& NewCell);
-	FIntVector GetLastMeshPlayerCell() const { return LastMeshPlayerCell; }
-	FIntVector GetLastPhysicsPlayerCell() const { return LastPhysicsPlayerCell; }
-	FIntVector GetLastActorPlayerCell() const { return LastActorPlayerCell; }
+
+	/**
+	 * Move the streaming sources (split-screen players, server connections, source entities) to SourceLocations
+	 * and collect the entities of cells that entered a layer's add radius or left its remove radius around any
+	 * source. Only the ring differences between the old and new cubes are visited; per-layer, per-direction
+	 * requests are gathered in parallel against the flushed cell index.
+	 *
+	 * @return false if no source changed cell on any layer (OutTransitions is left empty).
+	 */
+	bool UpdateSources(TConstArrayView<FVector> SourceLocations, FArcIWCellTransitions& OutTransitions);
+
+	/** Source cells on a layer as of the last UpdateSources. Empty before the first update. */
+	TConstArrayView<FIntVector> GetSourceCells(EArcIWCellLayer Layer) const { return Layers[static_cast<int32>(Layer)].SourceCells; }
+
+	/** First source's cell, or FIntVector(MAX_int32) before the first update. Used by debug views. */
+	FIntVector GetLastMeshPlayerCell() const { return GetPrimarySourceCell(EArcIWCellLayer::Mesh); }
+	FIntVector GetLastPhysicsPlayerCell() const { return GetPrimarySourceCell(EArcIWCellLayer::Physics); }
+	FIntVector GetLastActorPlayerCell() const { return GetPrimarySourceCell(EArcIWCellLayer::Actor); }
 	bool HasActorGrid() const { return bActorGridEnabled; }
 	static void GetCellsInRadius(const FIntVector& Center, int32 RadiusCells, TArray<FIntVector>& OutCells);
 
 	// --- Mesh Grid Config ---
-	float GetMeshCellSize() const { return MeshCellSize; }
-	float GetMeshAddRadius() const { return MeshAddRadius; }
-	int32 GetMeshAddRadiusCells() const { return MeshAddRadiusCells; }
-	float GetMeshRemoveRadius() const { return MeshRemoveRadius; }
-	int32 GetMeshRemoveRadiusCells() const { return MeshRemoveRadiusCells; }
+	float GetMeshCellSize() const { return GetLayer(EArcIWCellLayer::Mesh).CellSize; }
+	float GetMeshAddRadius() const { return GetLayer(EArcIWCellLayer::Mesh).AddRadius; }
+	int32 GetMeshAddRadiusCells() const { return GetLayer(EArcIWCellLayer::Mesh).AddRadiusCells; }
+	float GetMeshRemoveRadius() const { return GetLayer(EArcIWCellLayer::Mesh).RemoveRadius; }
+	int32 GetMeshRemoveRadiusCells() const { return GetLayer(EArcIWCellLayer::Mesh).RemoveRadiusCells; }
 	bool IsMeshCell(const FIntVector& MeshCell) const;
 	bool IsWithinMeshRemoveRadius(const FIntVector& MeshCell) const;
 
 	// --- Physics Grid Config ---
-	float GetPhysicsCellSize() const { return PhysicsCellSize; }
-	float GetPhysicsAddRadius() const { return PhysicsAddRadius; }
-	int32 GetPhysicsAddRadiusCells() const { return PhysicsAddRadiusCells; }
-	float GetPhysicsRemoveRadius() const { return PhysicsRemoveRadius; }
-	int32 GetPhysicsRemoveRadiusCells() const { return PhysicsRemoveRadiusCells; }
+	float GetPhysicsCellSize() const { return GetLayer(EArcIWCellLayer::Physics).CellSize; }
+	float GetPhysicsAddRadius() const { return GetLayer(EArcIWCellLayer::Physics).AddRadius; }
+	int32 GetPhysicsAddRadiusCells() const { return GetLayer(EArcIWCellLayer::Physics).AddRadiusCells; }
+	float GetPhysicsRemoveRadius() const { return GetLayer(EArcIWCellLayer::Physics).RemoveRadius; }
+	int32 GetPhysicsRemoveRadiusCells() const { return GetLayer(EArcIWCellLayer::Physics).RemoveRadiusCells; }
 	bool IsPhysicsCell(const FIntVector& PhysicsCell) const;
 	bool IsWithinPhysicsRemoveRadius(const FIntVector& PhysicsCell) const;
 
 	// --- Actor Grid Config ---
-	float GetActorCellSize() const { return ActorCellSize; }
-	float GetActorHydrationRadius() const { return ActorHydrationRadius; }
-	int32 GetActorHydrationRadiusCells() const { return ActorHydrationRadiusCells; }
-	float GetActorDehydrationRadius() const { return ActorDehydrationRadius; }
-	int32 GetActorDehydrationRadiusCells() const { return ActorDehydrationRadiusCells; }
+	float GetActorCellSize() const { return GetLayer(EArcIWCellLayer::Actor).CellSize; }
+	float GetActorHydrationRadius() const { return GetLayer(EArcIWCellLayer::Actor).AddRadius; }
+	int32 GetActorHydrationRadiusCells() const { return GetLayer(EArcIWCellLayer::Actor).AddRadiusCells; }
+	float GetActorDehydrationRadius() const { return GetLayer(EArcIWCellLayer::Actor).RemoveRadius; }
+	int32 GetActorDehydrationRadiusCells() const { return GetLayer(EArcIWCellLayer::Actor).RemoveRadiusCells; }
 	bool IsActorCell(const FIntVector& ActorCell) const;
 	bool IsWithinDehydrationRadius(const FIntVector& ActorCell) const;
 
-	// --- Debug ---
-	const TMap<FIntVector, TArray<FMassEntityHandle>>& GetMeshCellEntities() const { return MeshCellEntities; }
-	const TMap<FIntVector, TArray<FMassEntityHandle>>& GetPhysicsCellEntities() const { return PhysicsCellEntities; }
-	const TMap<FIntVector, TArray<FMassEntityHandle>>& GetActorCellEntities() const { return ActorCellEntities; }
-
 	/** Register a partition actor as the ISM component owner for its entities. */
 	void RegisterPartitionActor(AActor* PartitionActor, const TArray<FMassEntityHandle>& OwnedEntities);
 	/** Unregister a partition actor. */
@@ -228,33 +250,28 @@ private:
 
 	FPartitionISMData* FindISMDataForEntity(FMassEntityHandle Entity);
 
-	// --- Data: Mesh Grid ---
-	TMap<FIntVector, TArray<FMassEntityHandle>> MeshCellEntities;
-	FIntVector LastMeshPlayerCell = FIntVector(TNumericLimits<int32>::Max());
-	float MeshCellSize = 10000.f;
-	float MeshAddRadius = 0.f;
-	int32 MeshAddRadiusCells = 0;
-	float MeshRemoveRadius = 0.f;
-	int32 MeshRemoveRadiusCells = 0;
-
-	// --- Data: Physics Grid ---
-	TMap<FIntVector, TArray<FMassEntityHandle>> PhysicsCellEntities;
-	FIntVector LastPhysicsPlayerCell = FIntVector(TNumericLimits<int32>::Max());
-	float PhysicsCellSize = 8000.f;
-	float PhysicsAddRadius = 0.f;
-	int32 PhysicsAddRadiusCells = 0;
-	float PhysicsRemoveRadius = 0.f;
-	int32 PhysicsRemoveRadiusCells = 0;
-
-	// --- Data: Actor Grid ---
+	/** Grid config and streaming source cells for one layer. For the actor layer add/remove are hydration/dehydration. */
+	struct FCellLayerState
+	{
+		float CellSize = 10000.f;
+		float AddRadius = 0.f;
+		int32 AddRadiusCells = 0;
+		float RemoveRadius = 0.f;
+		int32 RemoveRadiusCells = 0;
+		TArray<FIntVector> SourceCells;
+	};
+
+	const FCellLayerState& GetLayer(EArcIWCellLayer Layer) const { return Layers[static_cast<int32>(Layer)]; }
+	FIntVector GetPrimarySourceCell(EArcIWCellLayer Layer) const;
+	bool IsWithinSourceRadius(EArcIWCellLayer Layer, const FIntVector& Cell, int32 RadiusCells) const;
+
+	// --- Data: Domain Grids ---
+	FArcIWCellIndex CellIndex;
+	FCellLayerState Layers[FArcIWCellIndex::NumLayers];
 	bool bActorGridEnabled = false;
-	TMap<FIntVector, TArray<FMassEntityHandle>> ActorCellEntities;
-	FIntVector LastActorPlayerCell = FIntVector(TNumericLimits<int32>::Max());
-	float ActorCellSize = 5000.f;
-	float ActorHydrationRadius = 0.f;
-	int32 ActorHydrationRadiusCells = 0;
-	float ActorDehydrationRadius = 0.f;
-	int32 ActorDehydrationRadiusCells = 0;
+
+	/** Actor-layer radius at which approaching entities pre-warm the actor pool. 0 when disabled. */
+	int32 PoolPrewarmRadiusCells = 0;
 
 	/** Entity -> partition actor mapping. */
 	TMap<FMassEntityHandle, TWeakObjectPtr<AActor>> EntityToPartitionActor;
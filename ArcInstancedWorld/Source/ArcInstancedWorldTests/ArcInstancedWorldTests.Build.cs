@@ -0,0 +1,22 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ArcInstancedWorldTests : ModuleRules
+{
+	public ArcInstancedWorldTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"CQTest",
+			"ArcInstancedWorld",
+			"ArcPersistence",
+			"MassEntity"
+		});
+	}
+}
@@ -0,0 +1,132 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "ArcInstancedWorld/ArcIWInstanceStore.h"
+#include "Math/RandomStream.h"
+
+TEST_CLASS(ArcIWPackedTransformTest, "ArcInstancedWorld.InstanceStore.PackedTransform")
+{
+	// 20 bits per component over [-1/sqrt(2), 1/sqrt(2)] keeps the error well under this.
+	static constexpr double RotationTolerance = 1.e-4;
+
+	static int32 LargestIndex(const FArcIWPackedTransform& Packed)
+	{
+		return static_cast<int32>(Packed.RotationLow & 0x3);
+	}
+
+	static double RotationError(const FQuat& Expected, const FTransform& Unpacked)
+	{
+		// |dot| ignores the sign, so q and -q compare equal. Clamped so rounding past 1 can't yield NaN.
+		const double Dot = FMath::Abs(Unpacked.GetRotation() | Expected.GetNormalized());
+		return 2.0 * FMath::Acos(FMath::Min(Dot, 1.0));
+	}
+
+	TEST_METHOD(Identity_RoundTrips)
+	{
+		const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform::Identity, FVector::ZeroVector);
+		const FTransform Unpacked = Packed.Unpack(FVector::ZeroVector);
+
+		ASSERT_THAT(AreEqual(3, LargestIndex(Packed)));
+		ASSERT_THAT(IsNear(0.0, RotationError(FQuat::Identity, Unpacked), RotationTolerance));
+		ASSERT_THAT(IsTrue(Unpacked.GetLocation().Equals(FVector::ZeroVector)));
+		ASSERT_THAT(IsTrue(Unpacked.GetScale3D().Equals(FVector::OneVector)));
+	}
+
+	TEST_METHOD(NegatedQuaternion_PacksIdentically)
+	{
+		const FQuat Rotation = FQuat(FVector(1.0, 2.0, -0.5).GetSafeNormal(), 2.1);
+		const FQuat Negated(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+
+		const FArcIWPackedTransform A = FArcIWPackedTransform::Pack(FTransform(Rotation), FVector::ZeroVector);
+		const FArcIWPackedTransform B = FArcIWPackedTransform::Pack(FTransform(Negated), FVector::ZeroVector);
+
+		ASSERT_THAT(AreEqual(A.RotationLow, B.RotationLow));
+		ASSERT_THAT(AreEqual(A.RotationHigh, B.RotationHigh));
+		ASSERT_THAT(IsNear(0.0, RotationError(Rotation, A.Unpack(FVector::ZeroVector)), RotationTolerance));
+	}
+
+	TEST_METHOD(EachLargestComponent_RoundTrips)
+	{
+		// X, Y and Z dominate a near half-turn about their axis; W dominates a small rotation.
+		const FQuat Rotations[4] = {
+			FQuat(FVector::XAxisVector, UE_DOUBLE_PI * 0.9),
+			FQuat(FVector::YAxisVector, UE_DOUBLE_PI * 0.9),
+			FQuat(FVector::ZAxisVector, UE_DOUBLE_PI * 0.9),
+			FQuat(FVector(0.3, -0.4, 0.5).GetSafeNormal(), 0.2)
+		};
+
+		for (int32 Idx = 0; Idx < 4; ++Idx)
+		{
+			const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform(Rotations[Idx]), FVector::ZeroVector);
+			ASSERT_THAT(AreEqual(Idx, LargestIndex(Packed)));
+			ASSERT_THAT(IsNear(0.0, RotationError(Rotations[Idx], Packed.Unpack(FVector::ZeroVector)), RotationTolerance));
+		}
+	}
+
+	TEST_METHOD(NegativeLargestComponent_RoundTrips)
+	{
+		const FQuat Rotation = FQuat(0.1, 0.2, 0.3, -0.9).GetNormalized();
+		const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform(Rotation), FVector::ZeroVector);
+
+		ASSERT_THAT(AreEqual(3, LargestIndex(Packed)));
+		ASSERT_THAT(IsNear(0.0, RotationError(Rotation, Packed.Unpack(FVector::ZeroVector)), RotationTolerance));
+	}
+
+	TEST_METHOD(TiedComponents_RoundTripAtRangeLimit)
+	{
+		// Two equal components of 1/sqrt(2): the kept one sits exactly at the edge of the quantized range.
+		const FQuat Rotations[2] = {
+			FQuat(FVector::ZAxisVector, UE_DOUBLE_HALF_PI),
+			FQuat(FVector::XAxisVector, -UE_DOUBLE_HALF_PI)
+		};
+
+		for (const FQuat& Rotation : Rotations)
+		{
+			const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform(Rotation), FVector::ZeroVector);
+			ASSERT_THAT(IsNear(0.0, RotationError(Rotation, Packed.Unpack(FVector::ZeroVector)), RotationTolerance));
+		}
+	}
+
+	TEST_METHOD(RandomRotations_StayWithinTolerance)
+	{
+		FRandomStream Stream(1337);
+		for (int32 Iteration = 0; Iteration < 1000; ++Iteration)
+		{
+			const FQuat Rotation(FRotator(
+				Stream.FRandRange(-180.f, 180.f),
+				Stream.FRandRange(-180.f, 180.f),
+				Stream.FRandRange(-180.f, 180.f)));
+
+			const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform(Rotation), FVector::ZeroVector);
+			ASSERT_THAT(IsNear(0.0, RotationError(Rotation, Packed.Unpack(FVector::ZeroVector)), RotationTolerance));
+		}
+	}
+
+	TEST_METHOD(Scale_UsesHalfPrecision)
+	{
+		const FVector Exact(1.0, 2.5, -0.5);
+		const FArcIWPackedTransform ExactPacked = FArcIWPackedTransform::Pack(
+			FTransform(FQuat::Identity, FVector::ZeroVector, Exact), FVector::ZeroVector);
+		ASSERT_THAT(IsTrue(ExactPacked.Unpack(FVector::ZeroVector).GetScale3D().Equals(Exact, 0.0)));
+
+		// Half floats keep 11 significant bits: relative error up to 2^-11.
+		const FVector Inexact(1.1, 0.37, 12.3);
+		const FVector Unpacked = FArcIWPackedTransform::Pack(
+			FTransform(FQuat::Identity, FVector::ZeroVector, Inexact), FVector::ZeroVector).Unpack(FVector::ZeroVector).GetScale3D();
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			ASSERT_THAT(IsNear(Inexact[Axis], Unpacked[Axis], FMath::Abs(Inexact[Axis]) / 2048.0));
+		}
+	}
+
+	TEST_METHOD(Position_IsRelativeToOrigin)
+	{
+		// Far from the world origin a float location would lose the fractional part; the offset does not.
+		const FVector Origin(1.0e7, -2.0e7, 3.0e5);
+		const FVector Location = Origin + FVector(12.25, -3.5, 7.125);
+
+		const FArcIWPackedTransform Packed = FArcIWPackedTransform::Pack(FTransform(Location), Origin);
+		ASSERT_THAT(IsTrue(FVector(Packed.Position).Equals(FVector(12.25, -3.5, 7.125), 0.0)));
+		ASSERT_THAT(IsTrue(Packed.Unpack(Origin).GetLocation().Equals(Location, 0.0)));
+	}
+};
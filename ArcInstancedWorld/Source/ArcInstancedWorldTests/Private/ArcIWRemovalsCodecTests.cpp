@@ -0,0 +1,308 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "ArcInstancedWorld/ArcIWTypes.h"
+#include "ArcInstancedWorld/Visualization/ArcIWMassISMPartitionActor.h"
+#include "Serialization/ArcJsonSaveArchive.h"
+
+TEST_CLASS(ArcIWRemovalBitsetTest, "ArcInstancedWorld.Persistence.RemovalBitset")
+{
+	static TArray<int32> ToArray(const FArcIWRemovalBitset& Bitset)
+	{
+		TArray<int32> Indices;
+		Bitset.ForEach([&Indices](int32 Index) { Indices.Add(Index); });
+		return Indices;
+	}
+
+	static bool RoundTrip(const FArcIWRemovalBitset& Source, int32 MaxIndices, FArcIWRemovalBitset& OutDecoded)
+	{
+		TArray<uint8> Data;
+		Source.Encode(Data);
+
+		// A successful decode must consume exactly what Encode() wrote.
+		int32 Offset = 0;
+		return OutDecoded.Decode(Data, Offset, MaxIndices) && Offset == Data.Num();
+	}
+
+	TEST_METHOD(Empty_RoundTripsToEmpty)
+	{
+		FArcIWRemovalBitset Source;
+		TArray<uint8> Data;
+		Source.Encode(Data);
+		ASSERT_THAT(AreEqual(1, Data.Num()));
+
+		FArcIWRemovalBitset Decoded;
+		Decoded.Add(7);
+		ASSERT_THAT(IsTrue(RoundTrip(Source, 0, Decoded)));
+		ASSERT_THAT(IsTrue(Decoded.IsEmpty()));
+		ASSERT_THAT(IsFalse(Decoded.Contains(7)));
+	}
+
+	TEST_METHOD(AllSet_EncodesAsSingleFullRun)
+	{
+		constexpr int32 NumInstances = 256;
+		FArcIWRemovalBitset Source;
+		for (int32 Idx = 0; Idx < NumInstances; ++Idx)
+		{
+			Source.Add(Idx);
+		}
+
+		TArray<uint8> Data;
+		Source.Encode(Data);
+		// Word count, then one zero/full/literal run triple.
+		ASSERT_THAT(AreEqual(4, Data.Num()));
+
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsTrue(RoundTrip(Source, NumInstances, Decoded)));
+		ASSERT_THAT(AreEqual(NumInstances, Decoded.Num()));
+		ASSERT_THAT(IsTrue(Decoded.Contains(0)));
+		ASSERT_THAT(IsTrue(Decoded.Contains(NumInstances - 1)));
+		ASSERT_THAT(IsFalse(Decoded.Contains(NumInstances)));
+	}
+
+	TEST_METHOD(MixedRuns_RoundTripExactly)
+	{
+		FArcIWRemovalBitset Source;
+		Source.Add(3);
+		Source.Add(31);
+		for (int32 Idx = 64; Idx < 128; ++Idx)
+		{
+			Source.Add(Idx);
+		}
+		Source.Add(200);
+		Source.Add(1000);
+
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsTrue(RoundTrip(Source, 1001, Decoded)));
+		ASSERT_THAT(AreEqual(Source.Num(), Decoded.Num()));
+
+		const TArray<int32> Expected = ToArray(Source);
+		const TArray<int32> Actual = ToArray(Decoded);
+		ASSERT_THAT(AreEqual(Expected.Num(), Actual.Num()));
+		for (int32 Idx = 0; Idx < Expected.Num(); ++Idx)
+		{
+			ASSERT_THAT(AreEqual(Expected[Idx], Actual[Idx]));
+		}
+	}
+
+	TEST_METHOD(TrailingZeroWords_AreNotEncoded)
+	{
+		FArcIWRemovalBitset Trimmed;
+		Trimmed.Add(5);
+
+		FArcIWRemovalBitset Source;
+		Source.Add(5);
+		Source.Add(900);
+		Source.Remove(900);
+
+		TArray<uint8> Expected;
+		Trimmed.Encode(Expected);
+		TArray<uint8> Actual;
+		Source.Encode(Actual);
+		ASSERT_THAT(IsTrue(Expected == Actual));
+
+		// Only the words up to the last set bit count against the bound.
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsTrue(RoundTrip(Source, 6, Decoded)));
+		ASSERT_THAT(AreEqual(1, Decoded.Num()));
+		ASSERT_THAT(IsTrue(Decoded.Contains(5)));
+	}
+
+	TEST_METHOD(ConsecutiveBitsets_DecodeFromOffset)
+	{
+		FArcIWRemovalBitset First;
+		First.Add(1);
+		FArcIWRemovalBitset Second;
+		Second.Add(40);
+		Second.Add(41);
+
+		TArray<uint8> Data;
+		First.Encode(Data);
+		Second.Encode(Data);
+
+		int32 Offset = 0;
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsTrue(Decoded.Decode(Data, Offset, 64)));
+		ASSERT_THAT(IsTrue(Decoded.Contains(1)));
+		ASSERT_THAT(IsTrue(Decoded.Decode(Data, Offset, 64)));
+		ASSERT_THAT(AreEqual(2, Decoded.Num()));
+		ASSERT_THAT(IsTrue(Decoded.Contains(40)));
+		ASSERT_THAT(IsFalse(Decoded.Contains(1)));
+		ASSERT_THAT(AreEqual(Data.Num(), Offset));
+	}
+
+	TEST_METHOD(WordCountAboveMaxIndices_IsRejected)
+	{
+		FArcIWRemovalBitset Source;
+		Source.Add(1000);
+
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsFalse(RoundTrip(Source, 64, Decoded)));
+		ASSERT_THAT(IsTrue(Decoded.IsEmpty()));
+	}
+
+	TEST_METHOD(HugeWordCount_IsRejectedWithoutAllocating)
+	{
+		// Varint 0xFFFFFFFF followed by nothing.
+		const TArray<uint8> Data = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F };
+
+		int32 Offset = 0;
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsFalse(Decoded.Decode(Data, Offset, 1024)));
+		ASSERT_THAT(IsTrue(Decoded.IsEmpty()));
+	}
+
+	TEST_METHOD(TruncatedData_IsRejected)
+	{
+		FArcIWRemovalBitset Source;
+		Source.Add(3);
+		Source.Add(70);
+
+		TArray<uint8> Data;
+		Source.Encode(Data);
+		Data.Pop();
+
+		int32 Offset = 0;
+		FArcIWRemovalBitset Decoded;
+		ASSERT_THAT(IsFalse(Decoded.Decode(Data, Offset, 128)));
+		ASSERT_THAT(IsTrue(Decoded.IsEmpty()));
+	}
+};
+
+TEST_CLASS(ArcIWRemovalsBlobTest, "ArcInstancedWorld.Persistence.RemovalsBlob")
+{
+	TArray<FArcIWActorClassData> Classes;
+
+	BEFORE_EACH()
+	{
+		Classes.SetNum(2);
+		Classes[0].NumInstances = 100;
+		Classes[1].NumInstances = 40;
+	}
+
+	TEST_METHOD(EncodeDecode_RoundTripsRemovalsAndRespawns)
+	{
+		TArray<FArcIWClassRemovals> Removals;
+		Removals.SetNum(2);
+		Removals[0].RemovedInstances.Add(0);
+		Removals[0].RemovedInstances.Add(99);
+		Removals[1].RemovedInstances.Add(17);
+
+		TArray<FArcIWPendingRespawn> Respawns;
+		FArcIWPendingRespawn& Respawn = Respawns.AddDefaulted_GetRef();
+		Respawn.RespawnAtUtc = 1700000000;
+		Respawn.ClassIndex = 1;
+		Respawn.TransformIndex = 17;
+
+		TArray<uint8> Data;
+		AArcIWMassISMPartitionActor::EncodeRemovals(Removals, Respawns, Data);
+
+		TArray<FArcIWClassRemovals> DecodedRemovals;
+		TArray<FArcIWPendingRespawn> DecodedRespawns;
+		ASSERT_THAT(IsTrue(AArcIWMassISMPartitionActor::DecodeRemovals(Data, Classes, DecodedRemovals, DecodedRespawns)));
+
+		ASSERT_THAT(AreEqual(2, DecodedRemovals.Num()));
+		ASSERT_THAT(AreEqual(2, DecodedRemovals[0].RemovedInstances.Num()));
+		ASSERT_THAT(IsTrue(DecodedRemovals[0].RemovedInstances.Contains(0)));
+		ASSERT_THAT(IsTrue(DecodedRemovals[0].RemovedInstances.Contains(99)));
+		ASSERT_THAT(AreEqual(1, DecodedRemovals[1].RemovedInstances.Num()));
+		ASSERT_THAT(IsTrue(DecodedRemovals[1].RemovedInstances.Contains(17)));
+
+		ASSERT_THAT(AreEqual(1, DecodedRespawns.Num()));
+		ASSERT_THAT(AreEqual(static_cast<int64>(1700000000), DecodedRespawns[0].RespawnAtUtc));
+		ASSERT_THAT(AreEqual(1, DecodedRespawns[0].ClassIndex));
+		ASSERT_THAT(AreEqual(17, DecodedRespawns[0].TransformIndex));
+	}
+
+	TEST_METHOD(BitsetLargerThanClass_IsRejectedAndOthersKept)
+	{
+		TArray<FArcIWClassRemovals> Removals;
+		Removals.SetNum(2);
+		Removals[0].RemovedInstances.Add(12);
+		Removals[1].RemovedInstances.Add(500);
+
+		TArray<FArcIWPendingRespawn> Respawns;
+		TArray<uint8> Data;
+		AArcIWMassISMPartitionActor::EncodeRemovals(Removals, Respawns, Data);
+
+		TArray<FArcIWClassRemovals> DecodedRemovals;
+		TArray<FArcIWPendingRespawn> DecodedRespawns;
+		ASSERT_THAT(IsFalse(AArcIWMassISMPartitionActor::DecodeRemovals(Data, Classes, DecodedRemovals, DecodedRespawns)));
+		ASSERT_THAT(AreEqual(2, DecodedRemovals.Num()));
+		ASSERT_THAT(IsTrue(DecodedRemovals[0].RemovedInstances.Contains(12)));
+		ASSERT_THAT(IsTrue(DecodedRemovals[1].RemovedInstances.IsEmpty()));
+	}
+
+	TEST_METHOD(TruncatedBlob_IsRejected)
+	{
+		TArray<FArcIWClassRemovals> Removals;
+		Removals.SetNum(2);
+		Removals[0].RemovedInstances.Add(4);
+
+		TArray<FArcIWPendingRespawn> Respawns;
+		FArcIWPendingRespawn& Respawn = Respawns.AddDefaulted_GetRef();
+		Respawn.ClassIndex = 0;
+		Respawn.TransformIndex = 4;
+
+		TArray<uint8> Data;
+		AArcIWMassISMPartitionActor::EncodeRemovals(Removals, Respawns, Data);
+		Data.SetNum(Data.Num() - 4);
+
+		TArray<FArcIWClassRemovals> DecodedRemovals;
+		TArray<FArcIWPendingRespawn> DecodedRespawns;
+		ASSERT_THAT(IsFalse(AArcIWMassISMPartitionActor::DecodeRemovals(Data, Classes, DecodedRemovals, DecodedRespawns)));
+		ASSERT_THAT(IsTrue(DecodedRespawns.IsEmpty()));
+	}
+
+	TEST_METHOD(LegacyJson_FallsBackAndDropsOutOfRangeIndices)
+	{
+		FArcJsonSaveArchive Archive;
+		Archive.BeginArray(FName(TEXT("ClassRemovals")), 2);
+		{
+			Archive.BeginArrayElement(0);
+			Archive.BeginArray(FName(TEXT("RemovedInstances")), 3);
+			const int32 Indices[3] = { 2, 100, -5 };
+			for (int32 R = 0; R < 3; ++R)
+			{
+				Archive.BeginArrayElement(R);
+				Archive.WriteProperty(FName(TEXT("Index")), Indices[R]);
+				Archive.EndArrayElement();
+			}
+			Archive.EndArray();
+			Archive.EndArrayElement();
+
+			Archive.BeginArrayElement(1);
+			Archive.BeginArray(FName(TEXT("RemovedInstances")), 1);
+			Archive.BeginArrayElement(0);
+			Archive.WriteProperty(FName(TEXT("Index")), 39);
+			Archive.EndArrayElement();
+			Archive.EndArray();
+			Archive.EndArrayElement();
+		}
+		Archive.EndArray();
+
+		Archive.BeginArray(FName(TEXT("PendingRespawns")), 1);
+		Archive.BeginArrayElement(0);
+		Archive.WriteProperty(FName(TEXT("RespawnAtUtc")), static_cast<int64>(42));
+		Archive.WriteProperty(FName(TEXT("ClassIndex")), 0);
+		Archive.WriteProperty(FName(TEXT("TransformIndex")), 2);
+		Archive.EndArrayElement();
+		Archive.EndArray();
+
+		const TArray<uint8> Data = Archive.Finalize();
+
+		TArray<FArcIWClassRemovals> DecodedRemovals;
+		TArray<FArcIWPendingRespawn> DecodedRespawns;
+		ASSERT_THAT(IsTrue(AArcIWMassISMPartitionActor::DecodeRemovals(Data, Classes, DecodedRemovals, DecodedRespawns)));
+
+		ASSERT_THAT(AreEqual(2, DecodedRemovals.Num()));
+		ASSERT_THAT(AreEqual(1, DecodedRemovals[0].RemovedInstances.Num()));
+		ASSERT_THAT(IsTrue(DecodedRemovals[0].RemovedInstances.Contains(2)));
+		ASSERT_THAT(AreEqual(1, DecodedRemovals[1].RemovedInstances.Num()));
+		ASSERT_THAT(IsTrue(DecodedRemovals[1].RemovedInstances.Contains(39)));
+
+		ASSERT_THAT(AreEqual(1, DecodedRespawns.Num()));
+		ASSERT_THAT(AreEqual(static_cast<int64>(42), DecodedRespawns[0].RespawnAtUtc));
+		ASSERT_THAT(AreEqual(2, DecodedRespawns[0].TransformIndex));
+	}
+};
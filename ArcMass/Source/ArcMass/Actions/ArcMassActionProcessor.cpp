@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassActionProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMassAction.h"
 #include "ArcMassActionAsset.h"
@@ -40,10 +41,11 @@ void UArcMassDeathActionProcessor::SignalEntities(FMassEntityManager& EntityMana
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassDeathActions);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const FName SignalName = UE::ArcMass::Signals::LifecycleDead;
 
-	EntityQuery.ForEachEntityChunk(Context, [&EntityManager, World, SignalName](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context, [&EntityManager, World, SignalName](FMassExecutionContext& Ctx)
 	{
 		// --- Pass 1: Execute ---
 		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateSparseEntityIterator(); EntityIt; ++EntityIt)
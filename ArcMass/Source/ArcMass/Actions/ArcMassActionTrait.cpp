@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassActionTrait.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMassActionAsset.h"
 #include "ArcMassActionFragment.h"
@@ -46,7 +47,9 @@ void UArcMassActionInitObserver::ConfigureQueries(const TSharedRef<FMassEntityMa
 
 void UArcMassActionInitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	ObserverQuery.ForEachEntityChunk(Context, [&EntityManager](FMassExecutionContext& Ctx)
+	FArcMassProcessorStatsScope Stats(*this);
+
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [&EntityManager](FMassExecutionContext& Ctx)
 	{
 		const FArcMassActionConfigFragment& Config = Ctx.GetConstSharedFragment<FArcMassActionConfigFragment>();
 		TMap<FName, FArcMassActionTraitEntry> ActionMap = Config.ActionMap;
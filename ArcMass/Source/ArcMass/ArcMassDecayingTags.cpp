@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassDecayingTags.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMass/Spatial/ArcMassInfluenceMapping.h"
 #include "DrawDebugHelpers.h"
@@ -10,7 +11,6 @@
 #include "MassEntityTemplateRegistry.h"
 #include "MassEntityUtils.h"
 #include "MassExecutionContext.h"
-#include "MassSignalSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassDecayingTags)
 
@@ -54,40 +54,133 @@ bool FArcMassDecayingTagFragment::HasTag(const FGameplayTag& Tag) const
 	return FindEntry(Tag) != nullptr;
 }
 
-float FArcMassDecayingTagFragment::GetRemainingTime(const FGameplayTag& Tag) const
+float FArcMassDecayingTagFragment::GetRemainingTime(const FGameplayTag& Tag, double Now) const
 {
 	if (const FArcMassDecayingTagEntry* Entry = FindEntry(Tag))
 	{
-		return Entry->RemainingTime;
+		return Entry->GetRemainingTime(Now);
 	}
 	return 0.f;
 }
 
-void FArcMassDecayingTagFragment::AddOrResetTag(const FGameplayTag& Tag, float Duration)
+void FArcMassDecayingTagFragment::AddOrResetTag(const FGameplayTag& Tag, float Duration, double Now, uint64 ExpiryTick)
 {
-	if (FArcMassDecayingTagEntry* Existing = FindEntry(Tag))
+	FArcMassDecayingTagEntry* Entry = FindEntry(Tag);
+	if (!Entry)
 	{
-		Existing->RemainingTime = Duration;
-		Existing->InitialDuration = Duration;
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->Tag = Tag;
 	}
-	else
+
+	Entry->ExpireTime = Now + Duration;
+	Entry->InitialDuration = Duration;
+	Entry->ExpiryTick = ExpiryTick;
+}
+
+bool FArcMassDecayingTagFragment::RemoveIfExpiring(const FGameplayTag& Tag, uint64 ExpiryTick)
+{
+	for (int32 i = 0; i < Entries.Num(); ++i)
 	{
-		Entries.Add({ Tag, Duration, Duration });
+		if (Entries[i].Tag == Tag)
+		{
+			if (Entries[i].ExpiryTick != ExpiryTick)
+			{
+				return false;
+			}
+			Entries.RemoveAtSwap(i);
+			return true;
+		}
 	}
+	return false;
 }
 
-int32 FArcMassDecayingTagFragment::RemoveExpiredEntries()
+// ---------------------------------------------------------------------------
+// FArcMassDecayingTagTimerWheel
+// ---------------------------------------------------------------------------
+
+void FArcMassDecayingTagTimerWheel::Reset(uint64 StartTick)
 {
-	int32 Removed = 0;
-	for (int32 i = Entries.Num() - 1; i >= 0; --i)
+	for (int32 Level = 0; Level < NumLevels; ++Level)
 	{
-		if (Entries[i].RemainingTime <= 0.f)
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
 		{
-			Entries.RemoveAtSwap(i);
-			++Removed;
+			Slots[Level][Slot].Reset();
+		}
+	}
+	Overflow.Reset();
+	CurrentTick = StartTick;
+	NumTimers = 0;
+	bStarted = true;
+}
+
+void FArcMassDecayingTagTimerWheel::Schedule(const FArcMassDecayingTagTimer& Timer)
+{
+	FArcMassDecayingTagTimer Clamped = Timer;
+	Clamped.ExpiryTick = FMath::Max(Timer.ExpiryTick, CurrentTick + 1);
+	Place(Clamped);
+	++NumTimers;
+}
+
+void FArcMassDecayingTagTimerWheel::Place(const FArcMassDecayingTagTimer& Timer)
+{
+	// A timer goes to the lowest level whose span covers its distance, in the slot selected by the
+	// matching bits of its expiry tick. It reaches level 0 by the time its block starts.
+	const uint64 Delta = Timer.ExpiryTick - CurrentTick;
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const int32 Shift = SlotBits * Level;
+		if (Delta < (uint64(1) << (Shift + SlotBits)))
+		{
+			Slots[Level][(Timer.ExpiryTick >> Shift) & (NumSlots - 1)].Add(Timer);
+			return;
 		}
 	}
-	return Removed;
+	Overflow.Add(Timer);
+}
+
+void FArcMassDecayingTagTimerWheel::Cascade(int32 Level)
+{
+	TArray<FArcMassDecayingTagTimer>& Source = Level < NumLevels
+		? Slots[Level][(CurrentTick >> (SlotBits * Level)) & (NumSlots - 1)]
+		: Overflow;
+
+	TArray<FArcMassDecayingTagTimer> Timers = MoveTemp(Source);
+	Source.Reset();
+	for (const FArcMassDecayingTagTimer& Timer : Timers)
+	{
+		Place(Timer);
+	}
+}
+
+void FArcMassDecayingTagTimerWheel::Advance(uint64 NewTick, TArray<FArcMassDecayingTagTimer>& OutExpired)
+{
+	if (!bStarted)
+	{
+		Reset(NewTick);
+		return;
+	}
+
+	while (CurrentTick < NewTick)
+	{
+		++CurrentTick;
+
+		// Pull the next block of each higher level down as the level below it wraps. Highest first,
+		// so timers cascade through several levels in one step.
+		int32 WrappedLevels = 0;
+		while (WrappedLevels < NumLevels && (CurrentTick & ((uint64(1) << (SlotBits * (WrappedLevels + 1))) - 1)) == 0)
+		{
+			++WrappedLevels;
+		}
+		for (int32 Level = WrappedLevels; Level >= 1; --Level)
+		{
+			Cascade(Level);
+		}
+
+		TArray<FArcMassDecayingTagTimer>& Due = Slots[0][CurrentTick & (NumSlots - 1)];
+		NumTimers -= Due.Num();
+		OutExpired.Append(Due);
+		Due.Reset();
+	}
 }
 
 // ---------------------------------------------------------------------------
@@ -101,10 +194,24 @@ void UArcMassDecayingTagSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 
 void UArcMassDecayingTagSubsystem::Deinitialize()
 {
-	PendingRequests.Empty();
+	FArcMassDecayingTagRequest Discarded;
+	while (PendingRequests.Dequeue(Discarded))
+	{
+	}
+	TimerWheel.Reset(0);
 	Super::Deinitialize();
 }
 
+uint64 UArcMassDecayingTagSubsystem::TimeToExpiryTick(double Time) const
+{
+	return static_cast<uint64>(FMath::Max(0.0, FMath::CeilToDouble(Time / TickResolution)));
+}
+
+uint64 UArcMassDecayingTagSubsystem::TimeToCurrentTick(double Time) const
+{
+	return static_cast<uint64>(FMath::Max(0.0, FMath::FloorToDouble(Time / TickResolution)));
+}
+
 void UArcMassDecayingTagSubsystem::RequestAddDecayingTag(const FMassEntityHandle& Entity, FGameplayTag Tag, float Duration)
 {
 	RequestAddDecayingTag(Entity, Tag, Duration, INDEX_NONE, INDEX_NONE, 0.f);
@@ -118,13 +225,7 @@ void UArcMassDecayingTagSubsystem::RequestAddDecayingTag(const FMassEntityHandle
 		return;
 	}
 
-	PendingRequests.Add({ Entity, Tag, Duration, InfluenceGridIndex, InfluenceChannel, InfluenceStrength });
-
-	UWorld* World = GetWorld();
-	if (UMassSignalSubsystem* SignalSubsystem = World ? World->GetSubsystem<UMassSignalSubsystem>() : nullptr)
-	{
-		SignalSubsystem->SignalEntity(UE::ArcMass::Signals::DecayingTagAdded, Entity);
-	}
+	PendingRequests.Enqueue(FArcMassDecayingTagRequest{ Entity, Tag, Duration, InfluenceGridIndex, InfluenceChannel, InfluenceStrength });
 }
 
 bool UArcMassDecayingTagSubsystem::EntityHasDecayingTag(const UObject* WorldContextObject, const FMassEntityHandle& Entity, FGameplayTag Tag)
@@ -170,7 +271,7 @@ float UArcMassDecayingTagSubsystem::GetDecayingTagRemainingTime(const UObject* W
 	}
 
 	const FArcMassDecayingTagFragment* Fragment = EntityManager.GetFragmentDataPtr<FArcMassDecayingTagFragment>(Entity);
-	return Fragment ? Fragment->GetRemainingTime(Tag) : 0.f;
+	return Fragment ? Fragment->GetRemainingTime(Tag, World->GetTimeSeconds()) : 0.f;
 }
 
 TArray<FGameplayTag> UArcMassDecayingTagSubsystem::GetAllDecayingTags(const UObject* WorldContextObject, const FMassEntityHandle& Entity)
@@ -207,97 +308,6 @@ TArray<FGameplayTag> UArcMassDecayingTagSubsystem::GetAllDecayingTags(const UObj
 	return Result;
 }
 
-// ---------------------------------------------------------------------------
-// UArcMassDecayingTagSignalProcessor
-// ---------------------------------------------------------------------------
-
-UArcMassDecayingTagSignalProcessor::UArcMassDecayingTagSignalProcessor()
-{
-	bAutoRegisterWithProcessingPhases = true;
-	bRequiresGameThreadExecution = true;
-}
-
-void UArcMassDecayingTagSignalProcessor::InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager)
-{
-	Super::InitializeInternal(Owner, EntityManager);
-
-	UMassSignalSubsystem* SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
-	SubscribeToSignal(*SignalSubsystem, UE::ArcMass::Signals::DecayingTagAdded);
-}
-
-void UArcMassDecayingTagSignalProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
-{
-	EntityQuery.AddRequirement<FArcMassDecayingTagFragment>(EMassFragmentAccess::ReadWrite);
-	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
-}
-
-void UArcMassDecayingTagSignalProcessor::SignalEntities(FMassEntityManager& EntityManager,
-	FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals)
-{
-	UWorld* World = EntityManager.GetWorld();
-	UArcMassDecayingTagSubsystem* Subsystem = World ? World->GetSubsystem<UArcMassDecayingTagSubsystem>() : nullptr;
-	if (!Subsystem)
-	{
-		return;
-	}
-
-	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassDecayingTagSignal);
-
-	// Drain pending requests
-	TArray<FArcMassDecayingTagRequest> Requests = MoveTemp(Subsystem->GetPendingRequests());
-	Subsystem->GetPendingRequests().Reset();
-
-	if (Requests.IsEmpty())
-	{
-		return;
-	}
-
-	// Build lookup: Entity -> indices into Requests array
-	TMap<FMassEntityHandle, TArray<int32>> RequestsByEntity;
-	for (int32 i = 0; i < Requests.Num(); ++i)
-	{
-		RequestsByEntity.FindOrAdd(Requests[i].Entity).Add(i);
-	}
-
-	// Resolve influence subsystem once (may be null)
-	UArcInfluenceMappingSubsystem* InfluenceSubsystem = World->GetSubsystem<UArcInfluenceMappingSubsystem>();
-
-	EntityQuery.ForEachEntityChunk(Context,
-		[&Requests, &RequestsByEntity, InfluenceSubsystem](FMassExecutionContext& Ctx)
-		{
-			TArrayView<FArcMassDecayingTagFragment> DecayFragments =
-				Ctx.GetMutableFragmentView<FArcMassDecayingTagFragment>();
-			const TConstArrayView<FTransformFragment> Transforms =
-				Ctx.GetFragmentView<FTransformFragment>();
-
-			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
-			{
-				const FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
-				const TArray<int32>* Indices = RequestsByEntity.Find(Entity);
-				if (!Indices)
-				{
-					continue;
-				}
-
-				FArcMassDecayingTagFragment& Fragment = DecayFragments[EntityIt];
-
-				for (const int32 ReqIdx : *Indices)
-				{
-					const FArcMassDecayingTagRequest& Req = Requests[ReqIdx];
-					Fragment.AddOrResetTag(Req.Tag, Req.Duration);
-
-					// Bridge to influence grid if requested
-					if (Req.InfluenceGridIndex != INDEX_NONE && InfluenceSubsystem)
-					{
-						const FVector EntityPos = Transforms[EntityIt].GetTransform().GetLocation();
-						InfluenceSubsystem->AddInfluence(Req.InfluenceGridIndex, EntityPos,
-							Req.InfluenceChannel, Req.InfluenceStrength, Entity);
-					}
-				}
-			}
-		});
-}
-
 // ---------------------------------------------------------------------------
 // UArcMassDecayingTagDecayProcessor
 // ---------------------------------------------------------------------------
@@ -310,6 +320,7 @@ UArcMassDecayingTagDecayProcessor::UArcMassDecayingTagDecayProcessor()
 {
 	ProcessingPhase = EMassProcessingPhase::PrePhysics;
 	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	bRequiresGameThreadExecution = true;
 
 	ExecutionOrder.ExecuteAfter.Add(UE::Mass::ProcessorGroupNames::SyncWorldToMass);
 }
@@ -317,6 +328,7 @@ UArcMassDecayingTagDecayProcessor::UArcMassDecayingTagDecayProcessor()
 void UArcMassDecayingTagDecayProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	EntityQuery.AddRequirement<FArcMassDecayingTagFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
 
 #if WITH_GAMEPLAY_DEBUGGER
 	DebugQuery.AddRequirement<FArcMassDecayingTagFragment>(EMassFragmentAccess::ReadOnly);
@@ -326,49 +338,86 @@ void UArcMassDecayingTagDecayProcessor::ConfigureQueries(const TSharedRef<FMassE
 
 void UArcMassDecayingTagDecayProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	const float DeltaTime = Context.GetDeltaTimeSeconds();
-	if (DeltaTime <= 0.f)
+	UWorld* World = EntityManager.GetWorld();
+	UArcMassDecayingTagSubsystem* Subsystem = World ? World->GetSubsystem<UArcMassDecayingTagSubsystem>() : nullptr;
+	if (!Subsystem)
 	{
 		return;
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassDecayingTagDecay);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	// Phase 1: Tick decay on all entities with the fragment
-	EntityQuery.ForEachEntityChunk(Context, [DeltaTime](FMassExecutionContext& Ctx)
+	const double Now = World->GetTimeSeconds();
+	FArcMassDecayingTagTimerWheel& TimerWheel = Subsystem->GetTimerWheel();
+
+	// Phase 1: Expire due timers. Only the wheel slots that came due are touched; removal is batched into
+	// one deferred command.
+	TArray<FArcMassDecayingTagTimer> Expired;
+	TimerWheel.Advance(Subsystem->TimeToCurrentTick(Now), Expired);
+
+	if (Expired.Num() > 0)
 	{
-		TArrayView<FArcMassDecayingTagFragment> DecayFragments =
-			Ctx.GetMutableFragmentView<FArcMassDecayingTagFragment>();
+		EntityManager.Defer().PushCommand<FMassDeferredCommand<EMassCommandOperationType::None>>(
+			[Expired = MoveTemp(Expired)](FMassEntityManager& Mgr)
+			{
+				for (const FArcMassDecayingTagTimer& Timer : Expired)
+				{
+					if (!Mgr.IsEntityValid(Timer.Entity))
+					{
+						continue;
+					}
 
-		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
-		{
-			FArcMassDecayingTagFragment& Fragment = DecayFragments[EntityIt];
+					if (FArcMassDecayingTagFragment* Fragment = Mgr.GetFragmentDataPtr<FArcMassDecayingTagFragment>(Timer.Entity))
+					{
+						Fragment->RemoveIfExpiring(Timer.Tag, Timer.ExpiryTick);
+					}
+				}
+			});
+	}
+
+	// Phase 2: Apply requests queued since the last tick and schedule their expiry
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassDecayingTagApplyRequests);
+
+		UArcInfluenceMappingSubsystem* InfluenceSubsystem = World->GetSubsystem<UArcInfluenceMappingSubsystem>();
 
-			if (Fragment.Entries.IsEmpty())
+		FArcMassDecayingTagRequest Req;
+		while (Subsystem->DequeueRequest(Req))
+		{
+			if (!EntityManager.IsEntityValid(Req.Entity))
 			{
 				continue;
 			}
 
-			for (FArcMassDecayingTagEntry& Entry : Fragment.Entries)
+			FArcMassDecayingTagFragment* Fragment = EntityManager.GetFragmentDataPtr<FArcMassDecayingTagFragment>(Req.Entity);
+			if (!Fragment)
 			{
-				Entry.RemainingTime -= DeltaTime;
+				continue;
 			}
 
-			Fragment.RemoveExpiredEntries();
+			// Resetting a tag leaves its old timer in the wheel; it no longer matches the entry and is skipped.
+			const uint64 ExpiryTick = Subsystem->TimeToExpiryTick(Now + Req.Duration);
+			Fragment->AddOrResetTag(Req.Tag, Req.Duration, Now, ExpiryTick);
+			TimerWheel.Schedule({ Req.Entity, Req.Tag, ExpiryTick });
+
+			// Bridge to influence grid if requested
+			if (Req.InfluenceGridIndex != INDEX_NONE && InfluenceSubsystem)
+			{
+				if (const FTransformFragment* Transform = EntityManager.GetFragmentDataPtr<FTransformFragment>(Req.Entity))
+				{
+					InfluenceSubsystem->AddInfluence(Req.InfluenceGridIndex, Transform->GetTransform().GetLocation(),
+						Req.InfluenceChannel, Req.InfluenceStrength, Req.Entity);
+				}
+			}
 		}
-	});
+	}
 
-	// Phase 2: Debug draw (requires transform for world position)
+	// Phase 3: Debug draw (requires transform for world position)
 #if WITH_GAMEPLAY_DEBUGGER
 	if (CVarArcDebugDrawDecayingTags.GetValueOnAnyThread())
 	{
-		UWorld* World = EntityManager.GetWorld();
-		if (!World)
-		{
-			return;
-		}
-
-		DebugQuery.ForEachEntityChunk(Context, [World](FMassExecutionContext& Ctx)
+		Stats.ForEachEntityChunk(DebugQuery, Context, [World, Now](FMassExecutionContext& Ctx)
 		{
 			const TConstArrayView<FArcMassDecayingTagFragment> DecayFragments =
 				Ctx.GetFragmentView<FArcMassDecayingTagFragment>();
@@ -391,7 +440,7 @@ void UArcMassDecayingTagDecayProcessor::Execute(FMassEntityManager& EntityManage
 				{
 					if (Entry.InitialDuration > 0.f)
 					{
-						MaxRatio = FMath::Max(MaxRatio, Entry.RemainingTime / Entry.InitialDuration);
+						MaxRatio = FMath::Max(MaxRatio, Entry.GetRemainingTime(Now) / Entry.InitialDuration);
 					}
 				}
 
@@ -403,7 +452,7 @@ void UArcMassDecayingTagDecayProcessor::Execute(FMassEntityManager& EntityManage
 				for (const FArcMassDecayingTagEntry& Entry : Fragment.Entries)
 				{
 					const FString TagText = FString::Printf(TEXT("[%s] %.1fs"),
-						*Entry.Tag.ToString(), Entry.RemainingTime);
+						*Entry.Tag.ToString(), Entry.GetRemainingTime(Now));
 					DrawDebugString(World, TextPos, TagText, nullptr, FColor::White, -1.f, true, 0.8f);
 					TextPos.Z += 20.f;
 				}
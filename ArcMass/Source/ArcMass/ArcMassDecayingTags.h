@@ -3,26 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/MpscQueue.h"
 #include "GameplayTagContainer.h"
 #include "Mass/EntityHandle.h"
 #include "MassEntityTraitBase.h"
 #include "MassEntityTypes.h"
 #include "MassEntityConcepts.h"
 #include "MassProcessor.h"
-#include "MassSignalProcessorBase.h"
 #include "Subsystems/WorldSubsystem.h"
 
 #include "ArcMassDecayingTags.generated.h"
 
-// ---------------------------------------------------------------------------
-// Signal namespace
-// ---------------------------------------------------------------------------
-
-namespace UE::ArcMass::Signals
-{
-	const FName DecayingTagAdded = FName(TEXT("DecayingTagAdded"));
-}
-
 // ---------------------------------------------------------------------------
 // Pending request (non-USTRUCT, internal queue item)
 // ---------------------------------------------------------------------------
@@ -51,12 +42,18 @@ struct ARCMASS_API FArcMassDecayingTagEntry
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DecayingTags")
 	FGameplayTag Tag;
 
+	/** World time (seconds) at which the tag expires. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DecayingTags")
-	float RemainingTime = 0.f;
+	double ExpireTime = 0.0;
 
 	/** Original duration when the tag was added/reset. Useful for computing normalized decay ratio. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DecayingTags")
 	float InitialDuration = 0.f;
+
+	/** Timer wheel tick this entry is scheduled for. Wheel timers for older ticks are stale and ignored. */
+	uint64 ExpiryTick = 0;
+
+	float GetRemainingTime(double Now) const { return FMath::Max(0.f, static_cast<float>(ExpireTime - Now)); }
 };
 
 // ---------------------------------------------------------------------------
@@ -73,14 +70,15 @@ struct ARCMASS_API FArcMassDecayingTagFragment : public FMassFragment
 	FArcMassDecayingTagEntry* FindEntry(const FGameplayTag& Tag);
 	const FArcMassDecayingTagEntry* FindEntry(const FGameplayTag& Tag) const;
 
+	/** True while the entry exists. Entries are removed at most one wheel tick after ExpireTime. */
 	bool HasTag(const FGameplayTag& Tag) const;
-	float GetRemainingTime(const FGameplayTag& Tag) const;
+	float GetRemainingTime(const FGameplayTag& Tag, double Now) const;
 
 	/** Add a new tag or reset the timer if it already exists. */
-	void AddOrResetTag(const FGameplayTag& Tag, float Duration);
+	void AddOrResetTag(const FGameplayTag& Tag, float Duration, double Now, uint64 ExpiryTick);
 
-	/** Remove entries whose RemainingTime <= 0. Returns number removed. */
-	int32 RemoveExpiredEntries();
+	/** Remove the entry for Tag if it is still scheduled for ExpiryTick. Returns true if removed. */
+	bool RemoveIfExpiring(const FGameplayTag& Tag, uint64 ExpiryTick);
 };
 
 template<>
@@ -92,10 +90,63 @@ struct TMassFragmentTraits<FArcMassDecayingTagFragment> final
 	};
 };
 
+// ---------------------------------------------------------------------------
+// Timer wheel — global expiry schedule for all decaying tags
+// ---------------------------------------------------------------------------
+
+struct FArcMassDecayingTagTimer
+{
+	FMassEntityHandle Entity;
+	FGameplayTag Tag;
+	uint64 ExpiryTick = 0;
+};
+
+/**
+ * Hierarchical timing wheel over fixed-length ticks. Level 0 has one slot per tick; each higher level
+ * spans NumSlots times the level below and is cascaded down when that level wraps. Scheduling is O(1)
+ * and advancing only touches the slots that come due, so cost scales with expiring tags, not live ones.
+ */
+class ARCMASS_API FArcMassDecayingTagTimerWheel
+{
+public:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 NumLevels = 4;
+
+	/** Drop all timers and restart at StartTick. */
+	void Reset(uint64 StartTick);
+
+	/** Schedule a timer. Timers already due fire on the next Advance. */
+	void Schedule(const FArcMassDecayingTagTimer& Timer);
+
+	/** Advance to NewTick, appending every timer with ExpiryTick <= NewTick to OutExpired. */
+	void Advance(uint64 NewTick, TArray<FArcMassDecayingTagTimer>& OutExpired);
+
+	uint64 GetCurrentTick() const { return CurrentTick; }
+	int32 Num() const { return NumTimers; }
+
+private:
+	void Place(const FArcMassDecayingTagTimer& Timer);
+	void Cascade(int32 Level);
+
+	TArray<FArcMassDecayingTagTimer> Slots[NumLevels][NumSlots];
+
+	/** Timers beyond the top level's span; re-placed each time the top level cascades. */
+	TArray<FArcMassDecayingTagTimer> Overflow;
+
+	uint64 CurrentTick = 0;
+	int32 NumTimers = 0;
+	bool bStarted = false;
+};
+
 // ---------------------------------------------------------------------------
 // Subsystem — request queue + query API
 // ---------------------------------------------------------------------------
 
+/**
+ * Owns the decaying tag request queue and the timer wheel. Requests may be issued from any thread; they
+ * are applied to fragments and scheduled by UArcMassDecayingTagDecayProcessor on the next Mass tick.
+ */
 UCLASS()
 class ARCMASS_API UArcMassDecayingTagSubsystem : public UWorldSubsystem
 {
@@ -105,7 +156,7 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
-	// -- Mutation API (enqueues request + raises signal) ---------------------
+	// -- Mutation API (lock-free enqueue, safe from worker threads) ---------
 
 	/** Request adding (or resetting) a decaying gameplay tag on an entity. */
 	UFUNCTION(BlueprintCallable, Category = "ArcMass|DecayingTags")
@@ -129,35 +180,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ArcMass|DecayingTags", meta = (WorldContext = "WorldContextObject"))
 	static TArray<FGameplayTag> GetAllDecayingTags(const UObject* WorldContextObject, const FMassEntityHandle& Entity);
 
-	// -- Internal (used by signal processor) --------------------------------
+	// -- Internal (used by decay processor) ---------------------------------
 
-	TArray<FArcMassDecayingTagRequest>& GetPendingRequests() { return PendingRequests; }
+	/** Pop one pending request. Single consumer: only the decay processor may call this. */
+	bool DequeueRequest(FArcMassDecayingTagRequest& OutRequest) { return PendingRequests.Dequeue(OutRequest); }
 
-private:
-	TArray<FArcMassDecayingTagRequest> PendingRequests;
-};
+	FArcMassDecayingTagTimerWheel& GetTimerWheel() { return TimerWheel; }
 
-// ---------------------------------------------------------------------------
-// Signal processor — handles add/reset requests
-// ---------------------------------------------------------------------------
+	/** Wheel tick containing world time Time, rounded up so tags never expire early. */
+	uint64 TimeToExpiryTick(double Time) const;
 
-UCLASS()
-class ARCMASS_API UArcMassDecayingTagSignalProcessor : public UMassSignalProcessorBase
-{
-	GENERATED_BODY()
+	/** Last wheel tick fully elapsed at world time Time. */
+	uint64 TimeToCurrentTick(double Time) const;
 
-public:
-	UArcMassDecayingTagSignalProcessor();
+private:
+	TMpscQueue<FArcMassDecayingTagRequest> PendingRequests;
 
-protected:
-	virtual void InitializeInternal(UObject& Owner, const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
-	virtual void SignalEntities(FMassEntityManager& EntityManager, FMassExecutionContext& Context,
-		FMassSignalNameLookup& EntitySignals) override;
+	FArcMassDecayingTagTimerWheel TimerWheel;
+
+	/** Length of one wheel tick in seconds. Tags expire at most this late. */
+	double TickResolution = 0.05;
 };
 
 // ---------------------------------------------------------------------------
-// Decay processor — ticks down timers, removes expired entries
+// Decay processor — applies requests, expires due timers
 // ---------------------------------------------------------------------------
 
 UCLASS()
@@ -173,6 +219,7 @@ protected:
 	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
 
 private:
+	/** Not iterated; declares access for the per-request fragment reads in Execute. */
 	FMassEntityQuery EntityQuery;
 
 #if WITH_GAMEPLAY_DEBUGGER
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcCompositeVisualizationProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcCompositeVisualization.h"
 #include "ArcMass/Visualization/ArcMassEntityVisualization.h"
@@ -45,8 +46,9 @@ void UArcCompositeVisEntityInitObserver::Execute(FMassEntityManager& EntityManag
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcCompositeVisEntityInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem, World](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcCompositeVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcCompositeVisRepFragment>();
@@ -147,8 +149,9 @@ void UArcCompositeVisActivateProcessor::SignalEntities(FMassEntityManager& Entit
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcCompositeVisActivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, VisSubsystem, CompositeSubsystem, World](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcCompositeVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcCompositeVisRepFragment>();
@@ -261,8 +264,9 @@ void UArcCompositeVisDeactivateProcessor::SignalEntities(FMassEntityManager& Ent
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcCompositeVisDeactivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, VisSubsystem, CompositeSubsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcCompositeVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcCompositeVisRepFragment>();
@@ -362,8 +366,9 @@ void UArcCompositeVisEntityDeinitObserver::Execute(FMassEntityManager& EntityMan
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcCompositeVisEntityDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, VisSubsystem, CompositeSubsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcCompositeVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcCompositeVisRepFragment>();
@@ -0,0 +1,35 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ArcMassInstrumentationSettings.generated.h"
+
+class UMassProcessor;
+
+/** Cost recording and chunk parallelism of processors using FArcMassProcessorStatsScope. */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "ArcMass Instrumentation"))
+class ARCMASS_API UArcMassInstrumentationSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FName GetCategoryName() const override { return FName("ArcMass"); }
+	virtual FName GetSectionName() const override { return FName("Instrumentation"); }
+
+	/** Record processor samples from startup. Can be toggled at runtime with arc.mass.ProcessorStats. */
+	UPROPERTY(config, EditAnywhere, Category = "Recording")
+	bool bRecordProcessorStats = false;
+
+	/** Samples kept per processor. The oldest sample is overwritten once full. */
+	UPROPERTY(config, EditAnywhere, Category = "Recording", meta = (ClampMin = "1", ClampMax = "4096"))
+	int32 SamplesPerProcessor = 240;
+
+	/**
+	 * Processors whose chunk loops run through ParallelForEachEntityChunk instead of ForEachEntityChunk.
+	 * Only for measuring scaling: a listed processor must be safe to run its chunks concurrently.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Parallel")
+	TArray<TSoftClassPtr<UMassProcessor>> ParallelChunkProcessors;
+};
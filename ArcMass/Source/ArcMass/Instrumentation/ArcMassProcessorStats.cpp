@@ -0,0 +1,241 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassProcessorStats.h"
+
+#include "ArcMassInstrumentationSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "MassProcessor.h"
+
+namespace UE::ArcMass::Instrumentation
+{
+	static FAutoConsoleCommand CVarProcessorStats(TEXT("arc.mass.ProcessorStats")
+		, TEXT("Start (1) or stop (0) recording Arc Mass processor stats. Toggles without an argument.")
+		, FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FArcMassProcessorStats& Stats = FArcMassProcessorStats::Get();
+			const bool bRecording = Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !Stats.IsRecording();
+			Stats.SetRecording(bRecording);
+			UE_LOG(LogConsoleResponse, Display, TEXT("Arc Mass processor stats recording %s."), bRecording ? TEXT("started") : TEXT("stopped"));
+		}));
+
+	static FAutoConsoleCommand CVarDumpProcessorStats(TEXT("arc.mass.DumpProcessorStats")
+		, TEXT("Write recorded Arc Mass processor samples to CSV. Optional argument: output file. Defaults to Profiling/ArcMass.")
+		, FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Filename = Args.Num() > 0
+				? Args[0]
+				: FPaths::ProfilingDir() / TEXT("ArcMass") / FString::Printf(TEXT("ProcessorStats-%s.csv"), *FDateTime::Now().ToString());
+
+			if (FArcMassProcessorStats::Get().DumpToCsv(Filename))
+			{
+				UE_LOG(LogConsoleResponse, Display, TEXT("Arc Mass processor stats written to %s"), *FPaths::ConvertRelativePathToFull(Filename));
+			}
+			else
+			{
+				UE_LOG(LogConsoleResponse, Warning, TEXT("Failed to write Arc Mass processor stats to %s"), *Filename);
+			}
+		}));
+
+	static FAutoConsoleCommand CVarResetProcessorStats(TEXT("arc.mass.ResetProcessorStats")
+		, TEXT("Discard recorded Arc Mass processor samples.")
+		, FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FArcMassProcessorStats::Get().Reset();
+		}));
+}
+
+// ----------------------------------------------------------------------------
+// FArcMassProcessorStats
+// ----------------------------------------------------------------------------
+
+FArcMassProcessorStats& FArcMassProcessorStats::Get()
+{
+	static FArcMassProcessorStats Instance;
+	return Instance;
+}
+
+FArcMassProcessorStats::FArcMassProcessorStats()
+{
+	const UArcMassInstrumentationSettings* Settings = GetDefault<UArcMassInstrumentationSettings>();
+	Capacity = FMath::Max(1, Settings->SamplesPerProcessor);
+	bRecording = Settings->bRecordProcessorStats;
+
+	// Native class paths end in the class name, so nothing has to be loaded to match them.
+	for (const TSoftClassPtr<UMassProcessor>& ProcessorClass : Settings->ParallelChunkProcessors)
+	{
+		const FString AssetName = ProcessorClass.ToSoftObjectPath().GetAssetName();
+		if (!AssetName.IsEmpty())
+		{
+			ParallelChunkProcessors.Add(FName(*AssetName));
+		}
+	}
+}
+
+bool FArcMassProcessorStats::IsParallelChunkEnabled(const UClass* ProcessorClass) const
+{
+	return ProcessorClass && ParallelChunkProcessors.Contains(ProcessorClass->GetFName());
+}
+
+void FArcMassProcessorStats::Record(FName Processor, const FArcMassProcessorSample& Sample)
+{
+	FScopeLock ScopeLock(&Lock);
+	Buffers.FindOrAdd(Processor).Add(Sample, Capacity);
+}
+
+void FArcMassProcessorStats::GetSummaries(TArray<FArcMassProcessorStatsSummary>& OutSummaries) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	OutSummaries.Reset(Buffers.Num());
+	for (const TPair<FName, FRingBuffer>& Pair : Buffers)
+	{
+		const TArray<FArcMassProcessorSample>& Samples = Pair.Value.Samples;
+		if (Samples.IsEmpty())
+		{
+			continue;
+		}
+
+		FArcMassProcessorStatsSummary& Summary = OutSummaries.AddDefaulted_GetRef();
+		Summary.Processor = Pair.Key;
+		Summary.NumSamples = Samples.Num();
+
+		for (const FArcMassProcessorSample& Sample : Samples)
+		{
+			Summary.AvgWallTimeMs += Sample.WallTimeMs;
+			Summary.MaxWallTimeMs = FMath::Max(Summary.MaxWallTimeMs, Sample.WallTimeMs);
+			Summary.AvgGameThreadMs += Sample.GameThreadMs;
+			Summary.AvgWorkerMs += Sample.WorkerMs;
+			Summary.AvgEntities += Sample.NumEntities;
+			Summary.AvgChunks += Sample.NumChunks;
+			Summary.bParallelChunks |= Sample.bParallelChunks;
+		}
+
+		const float InvNum = 1.f / Samples.Num();
+		Summary.AvgWallTimeMs *= InvNum;
+		Summary.AvgGameThreadMs *= InvNum;
+		Summary.AvgWorkerMs *= InvNum;
+		Summary.AvgEntities *= InvNum;
+		Summary.AvgChunks *= InvNum;
+	}
+}
+
+void FArcMassProcessorStats::GetSamples(FName Processor, TArray<FArcMassProcessorSample>& OutSamples) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	OutSamples.Reset();
+	if (const FRingBuffer* Buffer = Buffers.Find(Processor))
+	{
+		Buffer->CopyOrdered(OutSamples);
+	}
+}
+
+void FArcMassProcessorStats::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Buffers.Empty();
+}
+
+bool FArcMassProcessorStats::DumpToCsv(const FString& Filename) const
+{
+	TStringBuilder<16384> Csv;
+	Csv << TEXT("Processor,Frame,WallTimeMs,GameThreadMs,WorkerMs,Entities,Chunks,ParallelChunks\n");
+
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		TArray<FArcMassProcessorSample> Samples;
+		for (const TPair<FName, FRingBuffer>& Pair : Buffers)
+		{
+			Pair.Value.CopyOrdered(Samples);
+			for (const FArcMassProcessorSample& Sample : Samples)
+			{
+				Csv.Appendf(TEXT("%s,%llu,%.4f,%.4f,%.4f,%d,%d,%d\n")
+					, *Pair.Key.ToString()
+					, Sample.Frame
+					, Sample.WallTimeMs
+					, Sample.GameThreadMs
+					, Sample.WorkerMs
+					, Sample.NumEntities
+					, Sample.NumChunks
+					, Sample.bParallelChunks ? 1 : 0);
+			}
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(Csv.ToView(), *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+void FArcMassProcessorStats::FRingBuffer::Add(const FArcMassProcessorSample& Sample, int32 InCapacity)
+{
+	if (Samples.Num() < InCapacity)
+	{
+		Samples.Add(Sample);
+		return;
+	}
+
+	Samples[Head] = Sample;
+	Head = (Head + 1) % Samples.Num();
+}
+
+void FArcMassProcessorStats::FRingBuffer::CopyOrdered(TArray<FArcMassProcessorSample>& OutSamples) const
+{
+	OutSamples.Reset(Samples.Num());
+	OutSamples.Append(Samples.GetData() + Head, Samples.Num() - Head);
+	OutSamples.Append(Samples.GetData(), Head);
+}
+
+// ----------------------------------------------------------------------------
+// FArcMassProcessorStatsScope
+// ----------------------------------------------------------------------------
+
+FArcMassProcessorStatsScope::FArcMassProcessorStatsScope(const UMassProcessor& InProcessor)
+{
+	FArcMassProcessorStats& Stats = FArcMassProcessorStats::Get();
+	Processor = InProcessor.GetClass()->GetFName();
+	bRecording = Stats.IsRecording();
+	bParallelChunks = Stats.IsParallelChunkEnabled(InProcessor.GetClass());
+
+	if (bRecording)
+	{
+		StartTime = FPlatformTime::Seconds();
+	}
+}
+
+FArcMassProcessorStatsScope::~FArcMassProcessorStatsScope()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	FArcMassProcessorSample Sample;
+	Sample.Frame = GFrameCounter;
+	Sample.WallTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Sample.GameThreadMs = GameThreadMicroseconds.load() / 1000.f;
+	Sample.WorkerMs = WorkerMicroseconds.load() / 1000.f;
+	Sample.NumEntities = NumEntities.load();
+	Sample.NumChunks = NumChunks.load();
+	Sample.bParallelChunks = bParallelChunks || bAlwaysParallelChunks;
+
+	FArcMassProcessorStats::Get().Record(Processor, Sample);
+}
+
+void FArcMassProcessorStatsScope::AddChunk(int32 InNumEntities, double Seconds)
+{
+	NumEntities.fetch_add(InNumEntities, std::memory_order_relaxed);
+	NumChunks.fetch_add(1, std::memory_order_relaxed);
+
+	const int64 Microseconds = static_cast<int64>(Seconds * 1000000.0);
+	if (IsInGameThread())
+	{
+		GameThreadMicroseconds.fetch_add(Microseconds, std::memory_order_relaxed);
+	}
+	else
+	{
+		WorkerMicroseconds.fetch_add(Microseconds, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,190 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "MassEntityQuery.h"
+#include "MassExecutionContext.h"
+#include <atomic>
+
+class UMassProcessor;
+
+/** One Execute of an instrumented processor. */
+struct FArcMassProcessorSample
+{
+	uint64 Frame = 0;
+
+	/** Time from the start to the end of the scope. */
+	float WallTimeMs = 0.f;
+
+	/** Chunk time spent on the game thread. */
+	float GameThreadMs = 0.f;
+
+	/** Chunk time spent on worker threads. With parallel chunks this may exceed WallTimeMs. */
+	float WorkerMs = 0.f;
+
+	int32 NumEntities = 0;
+	int32 NumChunks = 0;
+
+	/** Chunks ran through ParallelForEachEntityChunk. */
+	bool bParallelChunks = false;
+};
+
+/** Averages over the samples held for one processor. */
+struct FArcMassProcessorStatsSummary
+{
+	FName Processor;
+	int32 NumSamples = 0;
+	float AvgWallTimeMs = 0.f;
+	float MaxWallTimeMs = 0.f;
+	float AvgGameThreadMs = 0.f;
+	float AvgWorkerMs = 0.f;
+	float AvgEntities = 0.f;
+	float AvgChunks = 0.f;
+	bool bParallelChunks = false;
+};
+
+/**
+ * Ring buffers of FArcMassProcessorSample, one per processor class.
+ *
+ * Recording is off unless UArcMassInstrumentationSettings::bRecordProcessorStats or arc.mass.ProcessorStats
+ * enables it. arc.mass.DumpProcessorStats writes every held sample to CSV.
+ */
+class ARCMASS_API FArcMassProcessorStats
+{
+public:
+	static FArcMassProcessorStats& Get();
+
+	bool IsRecording() const { return bRecording; }
+	void SetRecording(bool bInRecording) { bRecording = bInRecording; }
+
+	/** True if ProcessorClass is listed in UArcMassInstrumentationSettings::ParallelChunkProcessors. */
+	bool IsParallelChunkEnabled(const UClass* ProcessorClass) const;
+
+	/** Thread-safe. */
+	void Record(FName Processor, const FArcMassProcessorSample& Sample);
+
+	void GetSummaries(TArray<FArcMassProcessorStatsSummary>& OutSummaries) const;
+
+	/** Held samples of Processor, oldest first. */
+	void GetSamples(FName Processor, TArray<FArcMassProcessorSample>& OutSamples) const;
+
+	void Reset();
+
+	/** Writes one row per held sample. Returns false if the file could not be written. */
+	bool DumpToCsv(const FString& Filename) const;
+
+private:
+	FArcMassProcessorStats();
+
+	struct FRingBuffer
+	{
+		TArray<FArcMassProcessorSample> Samples;
+
+		/** Next slot to write once Samples is full. */
+		int32 Head = 0;
+
+		void Add(const FArcMassProcessorSample& Sample, int32 Capacity);
+		void CopyOrdered(TArray<FArcMassProcessorSample>& OutSamples) const;
+	};
+
+	mutable FCriticalSection Lock;
+	TMap<FName, FRingBuffer> Buffers;
+	int32 Capacity = 240;
+	std::atomic<bool> bRecording = false;
+
+	/** Class names of UArcMassInstrumentationSettings::ParallelChunkProcessors, read once at startup. */
+	TSet<FName> ParallelChunkProcessors;
+};
+
+/**
+ * Measures one Execute of a processor into FArcMassProcessorStats.
+ *
+ * Chunk loops run through ForEachEntityChunk to be counted and to honour the processor's parallel chunk opt-in:
+ *
+ *	FArcMassProcessorStatsScope Stats(*this);
+ *	Stats.ForEachEntityChunk(EntityQuery, Context, [](FMassExecutionContext& Ctx) { ... });
+ *
+ * Loops that are always parallel use ParallelForEachEntityChunk instead.
+ */
+class ARCMASS_API FArcMassProcessorStatsScope
+{
+public:
+	explicit FArcMassProcessorStatsScope(const UMassProcessor& Processor);
+	~FArcMassProcessorStatsScope();
+
+	FArcMassProcessorStatsScope(const FArcMassProcessorStatsScope&) = delete;
+	FArcMassProcessorStatsScope& operator=(const FArcMassProcessorStatsScope&) = delete;
+
+	bool IsParallelChunks() const { return bParallelChunks; }
+
+	template<typename TFunc>
+	void ForEachEntityChunk(FMassEntityQuery& Query, FMassExecutionContext& Context, TFunc&& Func)
+	{
+		if (!bRecording)
+		{
+			if (bParallelChunks)
+			{
+				Query.ParallelForEachEntityChunk(Context, Forward<TFunc>(Func));
+			}
+			else
+			{
+				Query.ForEachEntityChunk(Context, Forward<TFunc>(Func));
+			}
+			return;
+		}
+
+		auto Measured = [this, &Func](FMassExecutionContext& Ctx)
+		{
+			const double ChunkStart = FPlatformTime::Seconds();
+			Func(Ctx);
+			AddChunk(Ctx.GetNumEntities(), FPlatformTime::Seconds() - ChunkStart);
+		};
+
+		if (bParallelChunks)
+		{
+			Query.ParallelForEachEntityChunk(Context, Measured);
+		}
+		else
+		{
+			Query.ForEachEntityChunk(Context, Measured);
+		}
+	}
+
+	/** For chunk loops that are always parallel, regardless of the opt-in. Func must be safe to run concurrently. */
+	template<typename TFunc>
+	void ParallelForEachEntityChunk(FMassEntityQuery& Query, FMassExecutionContext& Context, TFunc&& Func)
+	{
+		bAlwaysParallelChunks = true;
+		if (!bRecording)
+		{
+			Query.ParallelForEachEntityChunk(Context, Forward<TFunc>(Func));
+			return;
+		}
+
+		Query.ParallelForEachEntityChunk(Context, [this, &Func](FMassExecutionContext& Ctx)
+		{
+			const double ChunkStart = FPlatformTime::Seconds();
+			Func(Ctx);
+			AddChunk(Ctx.GetNumEntities(), FPlatformTime::Seconds() - ChunkStart);
+		});
+	}
+
+private:
+	/** Thread-safe. */
+	void AddChunk(int32 NumEntities, double Seconds);
+
+	FName Processor;
+	double StartTime = 0.0;
+	bool bRecording = false;
+	bool bParallelChunks = false;
+
+	/** Set once a loop ran through ParallelForEachEntityChunk. */
+	bool bAlwaysParallelChunks = false;
+
+	std::atomic<int32> NumEntities = 0;
+	std::atomic<int32> NumChunks = 0;
+	std::atomic<int64> GameThreadMicroseconds = 0;
+	std::atomic<int64> WorkerMicroseconds = 0;
+};
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassLifecycle.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "InstancedActorsTypes.h"
 #include "InstancedActorsData.h"
@@ -180,8 +181,9 @@ void UArcLifecycleInitObserver::ConfigureQueries(const TSharedRef<FMassEntityMan
 void UArcLifecycleInitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcLifecycleInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcLifecycleFragment>();
 		const FArcLifecycleConfigFragment& Config = Ctx.GetConstSharedFragment<FArcLifecycleConfigFragment>();
@@ -232,11 +234,12 @@ void UArcLifecycleTickProcessor::Execute(FMassEntityManager& EntityManager, FMas
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcLifecycleTick);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> PhaseChangedEntities;
 	TArray<FMassEntityHandle> DeadEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[DeltaTime, &PhaseChangedEntities, &DeadEntities](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcLifecycleFragment>();
@@ -326,6 +329,7 @@ void UArcLifecycleForceTransitionProcessor::SignalEntities(FMassEntityManager& E
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcLifecycleForceTransition);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	// Drain pending requests
 	TArray<FArcLifecycleForceTransitionRequest> Requests = MoveTemp(Subsystem->GetPendingRequests());
@@ -348,7 +352,7 @@ void UArcLifecycleForceTransitionProcessor::SignalEntities(FMassEntityManager& E
 	TArray<FMassEntityHandle> PhaseChangedEntities;
 	TArray<FMassEntityHandle> DeadEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&Requests, &RequestByEntity, &PhaseChangedEntities, &DeadEntities](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcLifecycleFragment>();
@@ -429,6 +433,7 @@ void UArcLifecycleInstancedActorsBridgeProcessor::SignalEntities(FMassEntityMana
 	FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcLifecycleInstancedActorsBridge);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	// Collect delta indices per IAD so we can call ApplyInstanceDeltas after chunk iteration.
 	// SetInstanceCurrentLifecyclePhase only writes to the delta list — it does NOT call
@@ -436,7 +441,7 @@ void UArcLifecycleInstancedActorsBridgeProcessor::SignalEntities(FMassEntityMana
 	// would never fire on server/standalone without this explicit call.
 	TMap<UInstancedActorsData*, TArray<int32>> PendingApplyDeltas;
 
-	EntityQuery.ForEachEntityChunk(Context, [&PendingApplyDeltas](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context, [&PendingApplyDeltas](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FArcLifecycleFragment> LifecycleFragments = Ctx.GetFragmentView<FArcLifecycleFragment>();
 		const TConstArrayView<FInstancedActorsFragment> IAFragments = Ctx.GetFragmentView<FInstancedActorsFragment>();
@@ -512,8 +517,9 @@ void UArcLifecycleActorNotifyProcessor::SignalEntities(FMassEntityManager& Entit
 	FMassExecutionContext& Context, FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcLifecycleActorNotify);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context, [](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FArcLifecycleFragment> LifecycleFragments = Ctx.GetFragmentView<FArcLifecycleFragment>();
 		const TArrayView<FMassActorFragment> ActorFragments = Ctx.GetMutableFragmentView<FMassActorFragment>();
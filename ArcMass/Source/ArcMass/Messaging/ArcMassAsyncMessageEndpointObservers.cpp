@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassAsyncMessageEndpointObservers.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassAsyncMessageEndpointFragment.h"
 #include "AsyncMessageBindingEndpoint.h"
 #include "MassExecutionContext.h"
@@ -25,8 +26,9 @@ void UArcMassAsyncMessageEndpointAddObserver::ConfigureQueries(const TSharedRef<
 void UArcMassAsyncMessageEndpointAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassAsyncMessageEndpointAdd);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMassAsyncMessageEndpointFragment> EndpointList =
@@ -63,8 +65,9 @@ void UArcMassAsyncMessageEndpointRemoveObserver::ConfigureQueries(const TSharedR
 void UArcMassAsyncMessageEndpointRemoveObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassAsyncMessageEndpointRemove);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMassAsyncMessageEndpointFragment> EndpointList =
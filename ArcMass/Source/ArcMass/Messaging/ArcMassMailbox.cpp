@@ -0,0 +1,295 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassMailbox.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
+
+#include "Algo/BinarySearch.h"
+#include "MassArchetypeData.h"
+#include "MassCommonTypes.h"
+#include "MassEntityManager.h"
+#include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassMailbox)
+
+namespace UE::ArcMass::Mailbox
+{
+	std::atomic<int32> GNextThreadBufferIndex{0};
+}
+
+// ---------------------------------------------------------------------------
+// UArcMassMailboxTrait
+// ---------------------------------------------------------------------------
+
+void UArcMassMailboxTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.AddTag<FArcMassMailboxTag>();
+}
+
+// ---------------------------------------------------------------------------
+// UArcMassMailboxSubsystem
+// ---------------------------------------------------------------------------
+
+void UArcMassMailboxSubsystem::Deinitialize()
+{
+	for (FThreadBuffer& Buffer : ThreadBuffers)
+	{
+		Buffer.Messages[0].Empty();
+		Buffer.Messages[1].Empty();
+	}
+	GatheredMessages.Empty();
+	SortedKeys.Empty();
+	SortedMessages.Empty();
+	ArchetypeAcceptsMail.Empty();
+	ChunkSerials.Empty();
+	FirstMessageByTarget.Empty();
+
+	Super::Deinitialize();
+}
+
+int32 UArcMassMailboxSubsystem::GetThreadBufferIndex()
+{
+	// Assigned once per thread and shared by every world's mailbox.
+	static thread_local int32 ThreadBufferIndex = INDEX_NONE;
+	if (ThreadBufferIndex == INDEX_NONE)
+	{
+		ThreadBufferIndex = UE::ArcMass::Mailbox::GNextThreadBufferIndex.fetch_add(1, std::memory_order_relaxed) % MaxThreadBuffers;
+	}
+	return ThreadBufferIndex;
+}
+
+uint32 UArcMassMailboxSubsystem::GetTypeKey(const FGameplayTag& Type)
+{
+	// Only needs to group messages of one type within a frame, so the unstable name index is enough.
+	return Type.GetTagName().GetComparisonIndex().ToUnstableInt();
+}
+
+void UArcMassMailboxSubsystem::SendMessage(const FArcMassMailboxMessage& Message)
+{
+	FThreadBuffer& Buffer = ThreadBuffers[GetThreadBufferIndex()];
+
+	// Uncontended unless more than MaxThreadBuffers threads send. The sort never takes the flag, it only
+	// waits for it to clear, so a sender is never blocked by the game thread.
+	bool bExpected = false;
+	while (!Buffer.bWriting.compare_exchange_weak(bExpected, true))
+	{
+		bExpected = false;
+		FPlatformProcess::Yield();
+	}
+
+	// Read after raising bWriting: if the sort already flipped WriteIndex we append to the new half,
+	// otherwise the sort sees bWriting and waits for this append to finish.
+	Buffer.Messages[WriteIndex.load()].Add(Message);
+
+	Buffer.bWriting.store(false, std::memory_order_release);
+}
+
+bool UArcMassMailboxSubsystem::ResolveEntity(const FMassEntityManager& EntityManager, const FMassEntityHandle& Entity,
+	UPTRINT& OutArchetype, int32& OutAbsoluteIndex, int32& OutNumEntitiesPerChunk)
+{
+	if (!EntityManager.IsEntityActive(Entity))
+	{
+		return false;
+	}
+
+	const FMassArchetypeHandle ArchetypeHandle = EntityManager.GetArchetypeForEntity(Entity);
+	const FMassArchetypeData* ArchetypeData = FMassArchetypeHelper::ArchetypeDataFromHandle(ArchetypeHandle);
+	if (!ArchetypeData)
+	{
+		return false;
+	}
+
+	OutArchetype = reinterpret_cast<UPTRINT>(ArchetypeData);
+	OutAbsoluteIndex = ArchetypeData->GetInternalIndexForEntityChecked(Entity.Index);
+	OutNumEntitiesPerChunk = ArchetypeData->GetNumEntitiesPerChunk();
+	return true;
+}
+
+bool UArcMassMailboxSubsystem::SortPendingMessages(FMassEntityManager& EntityManager)
+{
+	check(IsInGameThread());
+
+	const int32 ReadIndex = WriteIndex.load();
+	WriteIndex.store(ReadIndex ^ 1);
+
+	GatheredMessages.Reset();
+	for (FThreadBuffer& Buffer : ThreadBuffers)
+	{
+		while (Buffer.bWriting.load())
+		{
+			FPlatformProcess::Yield();
+		}
+
+		TArray<FArcMassMailboxMessage>& Messages = Buffer.Messages[ReadIndex];
+		GatheredMessages.Append(Messages);
+		Messages.Reset();
+	}
+
+	SortedKeys.Reset();
+	SortedMessages.Reset();
+	ArchetypeAcceptsMail.Reset();
+	ChunkSerials.Reset();
+	FirstMessageByTarget.Reset();
+
+	if (GatheredMessages.IsEmpty())
+	{
+		return false;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassMailboxSort);
+
+	SortedKeys.Reserve(GatheredMessages.Num());
+	for (int32 MessageIdx = 0; MessageIdx < GatheredMessages.Num(); ++MessageIdx)
+	{
+		const FArcMassMailboxMessage& Message = GatheredMessages[MessageIdx];
+
+		UPTRINT Archetype = 0;
+		int32 AbsoluteIndex = 0;
+		int32 NumEntitiesPerChunk = 0;
+		if (!ResolveEntity(EntityManager, Message.Target, Archetype, AbsoluteIndex, NumEntitiesPerChunk))
+		{
+			continue;
+		}
+
+		bool* bAccepts = ArchetypeAcceptsMail.Find(Archetype);
+		if (!bAccepts)
+		{
+			const FMassArchetypeHandle ArchetypeHandle = EntityManager.GetArchetypeForEntity(Message.Target);
+			bAccepts = &ArchetypeAcceptsMail.Add(Archetype, EntityManager.GetArchetypeComposition(ArchetypeHandle).Contains<FArcMassMailboxTag>());
+		}
+		if (!*bAccepts)
+		{
+			continue;
+		}
+
+		FSortKey& Key = SortedKeys.AddDefaulted_GetRef();
+		Key.TypeKey = GetTypeKey(Message.Type);
+		Key.Archetype = Archetype;
+		Key.AbsoluteIndex = AbsoluteIndex;
+		Key.SourceIndex = MessageIdx;
+	}
+
+	SortedKeys.Sort();
+
+	SortedMessages.SetNumUninitialized(SortedKeys.Num());
+	FirstMessageByTarget.Reserve(SortedKeys.Num());
+	for (int32 KeyIdx = 0; KeyIdx < SortedKeys.Num(); ++KeyIdx)
+	{
+		const FArcMassMailboxMessage& Message = GatheredMessages[SortedKeys[KeyIdx].SourceIndex];
+		SortedMessages[KeyIdx] = Message;
+		FirstMessageByTarget.FindOrAdd(MakeTuple(SortedKeys[KeyIdx].TypeKey, Message.Target), KeyIdx);
+	}
+
+	return !SortedKeys.IsEmpty();
+}
+
+void UArcMassMailboxSubsystem::RecordChunkSerial(FMassExecutionContext& Context)
+{
+	const TConstArrayView<FMassEntityHandle> Entities = Context.GetEntities();
+	if (Entities.IsEmpty())
+	{
+		return;
+	}
+
+	UPTRINT Archetype = 0;
+	int32 AbsoluteIndex = 0;
+	int32 NumEntitiesPerChunk = 0;
+	if (!ResolveEntity(Context.GetEntityManagerChecked(), Entities[0], Archetype, AbsoluteIndex, NumEntitiesPerChunk) || NumEntitiesPerChunk <= 0)
+	{
+		return;
+	}
+
+	ChunkSerials.Add(FChunkKey{Archetype, AbsoluteIndex - AbsoluteIndex % NumEntitiesPerChunk}, Context.GetChunkSerialModificationNumber());
+}
+
+UArcMassMailboxSubsystem::FChunkRange UArcMassMailboxSubsystem::FindChunkRange(FMassExecutionContext& Context, uint32 TypeKey) const
+{
+	FChunkRange Range;
+
+	const TConstArrayView<FMassEntityHandle> Entities = Context.GetEntities();
+	if (SortedKeys.IsEmpty() || Entities.IsEmpty())
+	{
+		return Range;
+	}
+
+	UPTRINT Archetype = 0;
+	int32 AbsoluteIndex = 0;
+	int32 NumEntitiesPerChunk = 0;
+	if (!ResolveEntity(Context.GetEntityManagerChecked(), Entities[0], Archetype, AbsoluteIndex, NumEntitiesPerChunk) || NumEntitiesPerChunk <= 0)
+	{
+		return Range;
+	}
+
+	Range.FirstIndex = AbsoluteIndex - AbsoluteIndex % NumEntitiesPerChunk;
+
+	// A chunk missing from the map was created after the sort.
+	const int32* SerialAtSort = ChunkSerials.Find(FChunkKey{Archetype, Range.FirstIndex});
+	Range.bUnchanged = SerialAtSort && *SerialAtSort == Context.GetChunkSerialModificationNumber();
+
+	// Every key of this type and chunk falls in [First, End).
+	FSortKey First;
+	First.TypeKey = TypeKey;
+	First.Archetype = Archetype;
+	First.AbsoluteIndex = Range.FirstIndex;
+	First.SourceIndex = MIN_int32;
+
+	FSortKey End = First;
+	End.AbsoluteIndex = First.AbsoluteIndex + NumEntitiesPerChunk;
+
+	Range.Start = Algo::LowerBound(SortedKeys, First);
+	Range.End = FMath::Max(Range.Start, Algo::LowerBound(SortedKeys, End));
+	return Range;
+}
+
+TConstArrayView<FArcMassMailboxMessage> UArcMassMailboxSubsystem::GetChunkMessages(FMassExecutionContext& Context, const FGameplayTag& Type) const
+{
+	const FChunkRange Range = FindChunkRange(Context, GetTypeKey(Type));
+	if (Range.Start >= Range.End)
+	{
+		return {};
+	}
+
+	return TConstArrayView<FArcMassMailboxMessage>(SortedMessages.GetData() + Range.Start, Range.End - Range.Start);
+}
+
+// ---------------------------------------------------------------------------
+// UArcMassMailboxSortProcessor
+// ---------------------------------------------------------------------------
+
+UArcMassMailboxSortProcessor::UArcMassMailboxSortProcessor()
+	: EntityQuery(*this)
+{
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	bRequiresGameThreadExecution = true;
+	QueryBasedPruning = EMassQueryBasedPruning::Never;
+
+	ExecutionOrder.ExecuteAfter.Add(UE::Mass::ProcessorGroupNames::SyncWorldToMass);
+}
+
+void UArcMassMailboxSortProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddTagRequirement<FArcMassMailboxTag>(EMassFragmentPresence::All);
+}
+
+void UArcMassMailboxSortProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	FArcMassProcessorStatsScope Stats(*this);
+
+	UWorld* World = EntityManager.GetWorld();
+	UArcMassMailboxSubsystem* Mailbox = World ? World->GetSubsystem<UArcMassMailboxSubsystem>() : nullptr;
+	if (!Mailbox)
+	{
+		return;
+	}
+
+	if (!Mailbox->SortPendingMessages(EntityManager))
+	{
+		return;
+	}
+
+	Stats.ForEachEntityChunk(EntityQuery, Context, [Mailbox](FMassExecutionContext& Ctx)
+	{
+		Mailbox->RecordChunkSerial(Ctx);
+	});
+}
@@ -0,0 +1,314 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "MassEntityHandle.h"
+#include "MassEntityTraitBase.h"
+#include "MassEntityTypes.h"
+#include "MassExecutionContext.h"
+#include "MassProcessor.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include <atomic>
+
+#include "ArcMassMailbox.generated.h"
+
+// ---------------------------------------------------------------------------
+// Message
+// ---------------------------------------------------------------------------
+
+/**
+ * Fixed-size gameplay message addressed to one Mass entity.
+ * Plain data only, so sending never allocates per message once the mailbox buffers are warm.
+ */
+USTRUCT(BlueprintType)
+struct ARCMASS_API FArcMassMailboxMessage
+{
+	GENERATED_BODY()
+
+	/** Message type. Consumers fetch messages per type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	FGameplayTag Type;
+
+	/** Entity the message is delivered to. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	FMassEntityHandle Target;
+
+	/** Optional entity that caused the message. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	FMassEntityHandle Instigator;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	float Magnitude = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mailbox")
+	int32 Param = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Tag & trait
+// ---------------------------------------------------------------------------
+
+/** Marks entities that receive mailbox messages. Messages to entities without it are dropped when sorted. */
+USTRUCT()
+struct ARCMASS_API FArcMassMailboxTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Opts an entity into the mailbox messaging path.
+ * Unlike UArcMassAsyncMessageEndpointTrait this adds no per-entity data; messages live in
+ * UArcMassMailboxSubsystem and are read per chunk.
+ */
+UCLASS(BlueprintType, EditInlineNew, CollapseCategories, meta = (DisplayName = "Arc Mailbox", Category = "Mass"))
+class ARCMASS_API UArcMassMailboxTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
+
+// ---------------------------------------------------------------------------
+// Subsystem
+// ---------------------------------------------------------------------------
+
+/**
+ * Per-entity message delivery without per-entity endpoints.
+ *
+ * SendMessage may be called from any thread, including parallel Mass chunk lambdas. Each thread appends
+ * to its own buffer. Once per frame UArcMassMailboxSortProcessor swaps the buffers and sorts everything
+ * sent since the last swap by (type, archetype, chunk, index in chunk). Processors that run after it
+ * read the messages for the chunk they are iterating as one contiguous span, in the same order as the
+ * chunk's entities. Messages are visible for one frame. All buffers are reset, not freed, so the path
+ * does not allocate once it has reached its peak message count.
+ *
+ * Entities can change archetype between the sort and a consumer. The sort records every mailbox chunk's
+ * serial modification number; ForEachChunkMessage matches a chunk whose number changed by entity handle
+ * instead, so moved entities still receive their messages in their new chunk.
+ */
+UCLASS()
+class ARCMASS_API UArcMassMailboxSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Queue a message for delivery next time messages are sorted. Thread safe. */
+	void SendMessage(const FArcMassMailboxMessage& Message);
+
+	UFUNCTION(BlueprintCallable, Category = "ArcMass|Mailbox")
+	void SendMailboxMessage(const FArcMassMailboxMessage& Message) { SendMessage(Message); }
+
+	/**
+	 * Sorted messages of Type addressed to the chunk Context is iterating, as it was at sort time. Messages
+	 * keep chunk order, but the span can hold messages for entities outside Context's subset of the chunk
+	 * or for entities that have since moved; use ForEachChunkMessage to get them matched to entities.
+	 */
+	TConstArrayView<FArcMassMailboxMessage> GetChunkMessages(FMassExecutionContext& Context, const FGameplayTag& Type) const;
+
+	/**
+	 * Calls Func(EntityIndex, Message) for every message of Type sent to an entity in Context.
+	 * EntityIndex indexes Context's fragment views. Messages for the same entity arrive in send order per thread.
+	 */
+	template<typename TFunc>
+	void ForEachChunkMessage(FMassExecutionContext& Context, const FGameplayTag& Type, TFunc&& Func) const;
+
+	/** Messages delivered by the last sort. */
+	int32 GetNumSortedMessages() const { return SortedMessages.Num(); }
+
+	// -- Internal (used by sort processor) ----------------------------------
+
+	/** Swap the thread buffers and sort what they held. Returns true if any message was delivered. Game thread only. */
+	bool SortPendingMessages(FMassEntityManager& EntityManager);
+
+	/** Remember the serial modification number of the chunk Context is iterating. Called after the sort. */
+	void RecordChunkSerial(FMassExecutionContext& Context);
+
+private:
+	struct FSortKey
+	{
+		uint32 TypeKey = 0;
+		int32 AbsoluteIndex = 0;
+		UPTRINT Archetype = 0;
+		int32 SourceIndex = 0;
+
+		bool operator<(const FSortKey& Other) const
+		{
+			if (TypeKey != Other.TypeKey)
+			{
+				return TypeKey < Other.TypeKey;
+			}
+			if (Archetype != Other.Archetype)
+			{
+				return Archetype < Other.Archetype;
+			}
+			if (AbsoluteIndex != Other.AbsoluteIndex)
+			{
+				return AbsoluteIndex < Other.AbsoluteIndex;
+			}
+			return SourceIndex < Other.SourceIndex;
+		}
+	};
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FThreadBuffer
+	{
+		/** Set while a sender appends. The sort waits for it to clear before reading. */
+		std::atomic<bool> bWriting{false};
+
+		/** Double buffer indexed by WriteIndex. */
+		TArray<FArcMassMailboxMessage> Messages[2];
+	};
+
+	/** Threads beyond this count share buffers and briefly contend on bWriting. */
+	static constexpr int32 MaxThreadBuffers = 64;
+
+	static int32 GetThreadBufferIndex();
+
+	static uint32 GetTypeKey(const FGameplayTag& Type);
+
+	/** Locate Entity's chunk. Returns false if it is not active. */
+	static bool ResolveEntity(const FMassEntityManager& EntityManager, const FMassEntityHandle& Entity, UPTRINT& OutArchetype, int32& OutAbsoluteIndex, int32& OutNumEntitiesPerChunk);
+
+	/** One chunk: its archetype and the absolute index of its first entity slot. */
+	struct FChunkKey
+	{
+		UPTRINT Archetype = 0;
+		int32 FirstIndex = 0;
+
+		bool operator==(const FChunkKey& Other) const
+		{
+			return Archetype == Other.Archetype && FirstIndex == Other.FirstIndex;
+		}
+
+		friend uint32 GetTypeHash(const FChunkKey& Key)
+		{
+			return HashCombine(::GetTypeHash(Key.Archetype), ::GetTypeHash(Key.FirstIndex));
+		}
+	};
+
+	/** Sorted range of one type's messages for the chunk a context iterates. */
+	struct FChunkRange
+	{
+		int32 Start = 0;
+		int32 End = 0;
+		int32 FirstIndex = 0;
+
+		/** False if entities entered or left the chunk since the sort, so positions no longer match. */
+		bool bUnchanged = false;
+	};
+
+	FChunkRange FindChunkRange(FMassExecutionContext& Context, uint32 TypeKey) const;
+
+	FThreadBuffer ThreadBuffers[MaxThreadBuffers];
+
+	/** Which half of each FThreadBuffer senders append to. */
+	std::atomic<int32> WriteIndex{0};
+
+	/** Messages copied out of the thread buffers during the sort. */
+	TArray<FArcMassMailboxMessage> GatheredMessages;
+
+	/** Keys of SortedMessages, same order. Searched per chunk. */
+	TArray<FSortKey> SortedKeys;
+
+	TArray<FArcMassMailboxMessage> SortedMessages;
+
+	/** Whether an archetype has FArcMassMailboxTag, rebuilt every sort. */
+	TMap<UPTRINT, bool> ArchetypeAcceptsMail;
+
+	/** Serial modification number of every mailbox chunk at sort time. Only filled when messages were sorted. */
+	TMap<FChunkKey, int32> ChunkSerials;
+
+	/** First sorted message per (type key, target). One target's messages of one type are contiguous. */
+	TMap<TPair<uint32, FMassEntityHandle>, int32> FirstMessageByTarget;
+};
+
+template<typename TFunc>
+void UArcMassMailboxSubsystem::ForEachChunkMessage(FMassExecutionContext& Context, const FGameplayTag& Type, TFunc&& Func) const
+{
+	if (SortedKeys.IsEmpty())
+	{
+		return;
+	}
+
+	const uint32 TypeKey = GetTypeKey(Type);
+	const FChunkRange Range = FindChunkRange(Context, TypeKey);
+	const TConstArrayView<FMassEntityHandle> Entities = Context.GetEntities();
+
+	if (!Range.bUnchanged)
+	{
+		// Chunk contents changed since the sort; look each entity's messages up by handle.
+		for (int32 EntityIndex = 0; EntityIndex < Entities.Num(); ++EntityIndex)
+		{
+			const int32* First = FirstMessageByTarget.Find(MakeTuple(TypeKey, Entities[EntityIndex]));
+			if (!First)
+			{
+				continue;
+			}
+
+			for (int32 MessageIdx = *First; MessageIdx < SortedMessages.Num()
+				&& SortedKeys[MessageIdx].TypeKey == TypeKey
+				&& SortedMessages[MessageIdx].Target == Entities[EntityIndex]; ++MessageIdx)
+			{
+				Func(EntityIndex, SortedMessages[MessageIdx]);
+			}
+		}
+		return;
+	}
+
+	// Both lists are in chunk order, so one merge pass matches them. Context's entities are a subsequence
+	// of the chunk, so Entities[Probe] sits at chunk offset Probe or later and the target of a message at
+	// offset N can only be among the first N + 1 entities.
+	int32 EntityIndex = 0;
+	for (int32 MessageIdx = Range.Start; MessageIdx < Range.End; ++MessageIdx)
+	{
+		const FArcMassMailboxMessage& Message = SortedMessages[MessageIdx];
+		const int32 ProbeEnd = FMath::Min(Entities.Num(), SortedKeys[MessageIdx].AbsoluteIndex - Range.FirstIndex + 1);
+
+		int32 Probe = EntityIndex;
+		while (Probe < ProbeEnd && Entities[Probe] != Message.Target)
+		{
+			++Probe;
+		}
+		if (Probe == ProbeEnd)
+		{
+			// Outside this subset of the chunk.
+			continue;
+		}
+
+		EntityIndex = Probe;
+		Func(EntityIndex, Message);
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Sort processor
+// ---------------------------------------------------------------------------
+
+/**
+ * Sorts mailbox messages once per frame at the start of PrePhysics.
+ * Processors that consume messages should add this processor to ExecuteAfter.
+ */
+UCLASS()
+class ARCMASS_API UArcMassMailboxSortProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UArcMassMailboxSortProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	/** Every mailbox chunk, to record its serial modification number after the sort. */
+	FMassEntityQuery EntityQuery;
+};
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMobileVisPhysicsTransformPushProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMobileVisualization.h"
 #include "ArcMass/Physics/ArcMassPhysicsBody.h"
 #include "ArcMass/Physics/ArcMassPhysicsSimulation.h"
@@ -33,8 +34,9 @@ void UArcMobileVisPhysicsTransformPushProcessor::Execute(
 	FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisPhysicsTransformPush);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
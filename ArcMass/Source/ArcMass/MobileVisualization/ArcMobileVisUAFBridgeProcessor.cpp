@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMobileVisUAFBridgeProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMobileVisualization.h"
 #include "ArcMobileVisUAFTrait.h"
 #include "MassActorSubsystem.h"
@@ -39,8 +40,9 @@ void UArcMobileVisUAFBridgeProcessor::Execute(
 	FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisUAFBridge);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
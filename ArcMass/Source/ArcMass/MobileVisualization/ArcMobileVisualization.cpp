@@ -6,6 +6,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Components/InstancedSkinnedMeshComponent.h"
+#include "Algo/Sort.h"
 
 // ---------------------------------------------------------------------------
 // UArcMobileVisSubsystem
@@ -26,6 +27,7 @@ void UArcMobileVisSubsystem::Deinitialize()
 			Pair.Value.ManagerActor->Destroy();
 		}
 	}
+	// Pending instance changes die with the manager actors.
 	RegionManagers.Empty();
 	EntityCells.Empty();
 	SourceCellPositions.Empty();
@@ -33,6 +35,16 @@ void UArcMobileVisSubsystem::Deinitialize()
 	Super::Deinitialize();
 }
 
+void UArcMobileVisSubsystem::Tick(float DeltaTime)
+{
+	FlushInstanceBatches();
+}
+
+TStatId UArcMobileVisSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArcMobileVisSubsystem, STATGROUP_Tickables);
+}
+
 // ---------------------------------------------------------------------------
 // Cell size / region configuration
 // ---------------------------------------------------------------------------
@@ -265,7 +277,7 @@ UArcMobileVisSubsystem::FRegionManager& UArcMobileVisSubsystem::GetOrCreateRegio
 // ISM component management
 // ---------------------------------------------------------------------------
 
-UInstancedStaticMeshComponent* UArcMobileVisSubsystem::GetOrCreateISMComponent(
+UArcMobileVisSubsystem::FISMBucket* UArcMobileVisSubsystem::GetOrCreateISMBucket(
 	FRegionManager& Manager,
 	UStaticMesh* Mesh,
 	const TArray<TObjectPtr<UMaterialInterface>>& Materials,
@@ -277,9 +289,9 @@ UInstancedStaticMeshComponent* UArcMobileVisSubsystem::GetOrCreateISMComponent(
 	}
 
 	const FObjectKey Key(Mesh);
-	if (TObjectPtr<UInstancedStaticMeshComponent>* Existing = Manager.ISMComponents.Find(Key))
+	if (FISMBucket* Existing = Manager.ISMBuckets.Find(Key))
 	{
-		return *Existing;
+		return Existing->Component ? Existing : nullptr;
 	}
 
 	UInstancedStaticMeshComponent* NewISMC = NewObject<UInstancedStaticMeshComponent>(Manager.ManagerActor);
@@ -299,10 +311,39 @@ UInstancedStaticMeshComponent* UArcMobileVisSubsystem::GetOrCreateISMComponent(
 	NewISMC->RegisterComponent();
 	Manager.ManagerActor->AddInstanceComponent(NewISMC);
 
-	Manager.ISMComponents.Add(Key, NewISMC);
-	Manager.InstanceOwners.FindOrAdd(Key);
+	FISMBucket& Bucket = Manager.ISMBuckets.Add(Key);
+	Bucket.Component = NewISMC;
 
-	return NewISMC;
+	return &Bucket;
+}
+
+UArcMobileVisSubsystem::FISMBucket* UArcMobileVisSubsystem::FindISMBucket(
+	const FIntVector& RegionCoord,
+	TSubclassOf<AActor> ManagerClass,
+	UStaticMesh* Mesh)
+{
+	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
+	FRegionManager* Manager = RegionManagers.Find(Key);
+	if (!Manager)
+	{
+		return nullptr;
+	}
+
+	FISMBucket* Bucket = Manager->ISMBuckets.Find(FObjectKey(Mesh));
+	return (Bucket && Bucket->Component) ? Bucket : nullptr;
+}
+
+void UArcMobileVisSubsystem::QueueISMTransform(FISMBucket& Bucket, int32 InstanceIndex, const FTransform& Transform)
+{
+	const int32 NumCreated = Bucket.GetNumInstances() - Bucket.PendingAdds.Num();
+	if (InstanceIndex >= NumCreated)
+	{
+		Bucket.PendingAdds[InstanceIndex - NumCreated] = Transform;
+		return;
+	}
+
+	Bucket.PendingUpdateIndices.Add(InstanceIndex);
+	Bucket.PendingUpdateTransforms.Add(Transform);
 }
 
 // ---------------------------------------------------------------------------
@@ -319,23 +360,27 @@ int32 UArcMobileVisSubsystem::AddISMInstance(
 	FMassEntityHandle OwnerEntity)
 {
 	FRegionManager& Manager = GetOrCreateRegionManager(RegionCoord, ManagerClass);
-	UInstancedStaticMeshComponent* ISMC = GetOrCreateISMComponent(Manager, Mesh, Materials, bCastShadows);
-	if (!ISMC)
+	FISMBucket* Bucket = GetOrCreateISMBucket(Manager, Mesh, Materials, bCastShadows);
+	if (!Bucket)
 	{
 		return INDEX_NONE;
 	}
 
-	const int32 NewIndex = ISMC->AddInstance(Transform, true);
-
-	// Track which entity owns which instance index
-	const FObjectKey Key(Mesh);
-	TArray<FMassEntityHandle>& Owners = Manager.InstanceOwners.FindOrAdd(Key);
-	if (Owners.Num() <= NewIndex)
+	// Reuse a hidden slot if there is one; otherwise reserve the next index past the pending adds.
+	int32 NewIndex;
+	if (Bucket->FreeInstances.Num() > 0)
+	{
+		NewIndex = Bucket->FreeInstances.Pop(EAllowShrinking::No);
+		QueueISMTransform(*Bucket, NewIndex, Transform);
+	}
+	else
 	{
-		Owners.SetNum(NewIndex + 1);
+		NewIndex = Bucket->InstanceOwners.Num();
+		Bucket->InstanceOwners.AddDefaulted();
+		Bucket->PendingAdds.Add(Transform);
 	}
-	Owners[NewIndex] = OwnerEntity;
 
+	Bucket->InstanceOwners[NewIndex] = OwnerEntity;
 	return NewIndex;
 }
 
@@ -343,100 +388,137 @@ void UArcMobileVisSubsystem::RemoveISMInstance(
 	const FIntVector& RegionCoord,
 	TSubclassOf<AActor> ManagerClass,
 	UStaticMesh* Mesh,
-	int32 InstanceId,
-	FMassEntityManager& EntityManager)
+	int32 InstanceId)
 {
 	if (!Mesh || InstanceId == INDEX_NONE)
 	{
 		return;
 	}
 
-	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
-	FRegionManager* Manager = RegionManagers.Find(Key);
-	if (!Manager)
+	FISMBucket* Bucket = FindISMBucket(RegionCoord, ManagerClass, Mesh);
+	if (!Bucket || !Bucket->InstanceOwners.IsValidIndex(InstanceId) || !Bucket->InstanceOwners[InstanceId].IsValid())
+	{
+		return;
+	}
+
+	// Hide instead of removing: other entities' indices stay valid and the slot is reused by the next add.
+	// Zero scale at the manager's location keeps the component bounds from growing.
+	const FTransform HiddenTransform(FQuat::Identity, Bucket->Component->GetComponentLocation(), FVector::ZeroVector);
+	QueueISMTransform(*Bucket, InstanceId, HiddenTransform);
+
+	Bucket->InstanceOwners[InstanceId] = FMassEntityHandle();
+	Bucket->FreeInstances.Add(InstanceId);
+}
+
+void UArcMobileVisSubsystem::UpdateISMTransform(
+	const FIntVector& RegionCoord,
+	TSubclassOf<AActor> ManagerClass,
+	UStaticMesh* Mesh,
+	int32 InstanceId,
+	const FTransform& NewTransform)
+{
+	if (!Mesh || InstanceId == INDEX_NONE)
 	{
 		return;
 	}
 
-	const FObjectKey MeshKey(Mesh);
-	TObjectPtr<UInstancedStaticMeshComponent>* Found = Manager->ISMComponents.Find(MeshKey);
-	if (!Found || !*Found)
+	FISMBucket* Bucket = FindISMBucket(RegionCoord, ManagerClass, Mesh);
+	if (!Bucket || !Bucket->InstanceOwners.IsValidIndex(InstanceId))
 	{
 		return;
 	}
 
-	UInstancedStaticMeshComponent* ISMC = *Found;
-	const int32 InstanceCount = ISMC->GetInstanceCount();
-	if (InstanceId >= InstanceCount)
+	QueueISMTransform(*Bucket, InstanceId, NewTransform);
+}
+
+void UArcMobileVisSubsystem::FlushISMBucket(FISMBucket& Bucket)
+{
+	UInstancedStaticMeshComponent* ISMC = Bucket.Component;
+	if (!IsValid(ISMC))
 	{
 		return;
 	}
 
-	TArray<FMassEntityHandle>* Owners = Manager->InstanceOwners.Find(MeshKey);
+	bool bNeedsRenderUpdate = false;
 
-	// RemoveInstance swaps the last instance into the removed slot.
-	// We need to update the swapped entity's stored ISMInstanceId.
-	const int32 LastIndex = InstanceCount - 1;
-	if (Owners && InstanceId != LastIndex && LastIndex >= 0)
+	if (Bucket.PendingAdds.Num() > 0)
 	{
-		const FMassEntityHandle SwappedEntity = (*Owners)[LastIndex];
-		if (EntityManager.IsEntityValid(SwappedEntity))
+		ISMC->AddInstances(Bucket.PendingAdds, false, true, false);
+		Bucket.PendingAdds.Reset();
+	}
+
+	if (Bucket.PendingUpdateIndices.Num() > 0)
+	{
+		// Order by instance index, keeping request order for duplicates so the last write wins, then
+		// upload each contiguous run of indices with a single batch update.
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Bucket.PendingUpdateIndices.Num());
+		for (int32 Idx = 0; Idx < Order.Num(); ++Idx)
 		{
-			FArcMobileVisRepFragment* SwappedRep = EntityManager.GetFragmentDataPtr<FArcMobileVisRepFragment>(SwappedEntity);
-			if (SwappedRep && SwappedRep->ISMInstanceId == LastIndex)
+			Order[Idx] = Idx;
+		}
+		Algo::StableSort(Order, [&Bucket](int32 A, int32 B)
+		{
+			return Bucket.PendingUpdateIndices[A] < Bucket.PendingUpdateIndices[B];
+		});
+
+		TArray<FTransform> Run;
+		int32 RunStart = INDEX_NONE;
+		for (int32 OrderIdx = 0; OrderIdx < Order.Num(); ++OrderIdx)
+		{
+			const int32 InstanceIndex = Bucket.PendingUpdateIndices[Order[OrderIdx]];
+			const bool bSupersededByNext = OrderIdx + 1 < Order.Num() && Bucket.PendingUpdateIndices[Order[OrderIdx + 1]] == InstanceIndex;
+			if (bSupersededByNext)
 			{
-				SwappedRep->ISMInstanceId = InstanceId;
+				continue;
 			}
-		}
 
-		// Update owner tracking
-		(*Owners)[InstanceId] = SwappedEntity;
-	}
+			if (Run.Num() > 0 && InstanceIndex != RunStart + Run.Num())
+			{
+				ISMC->BatchUpdateInstancesTransforms(RunStart, Run, true, false, true);
+				Run.Reset();
+			}
+			if (Run.Num() == 0)
+			{
+				RunStart = InstanceIndex;
+			}
+			Run.Add(Bucket.PendingUpdateTransforms[Order[OrderIdx]]);
+		}
+		if (Run.Num() > 0)
+		{
+			ISMC->BatchUpdateInstancesTransforms(RunStart, Run, true, false, true);
+		}
 
-	// Shrink owner array
-	if (Owners && Owners->Num() > 0)
-	{
-		Owners->RemoveAt(LastIndex);
+		Bucket.PendingUpdateIndices.Reset();
+		Bucket.PendingUpdateTransforms.Reset();
+		bNeedsRenderUpdate = true;
 	}
 
-	ISMC->RemoveInstance(InstanceId);
-}
-
-void UArcMobileVisSubsystem::UpdateISMTransform(
-	const FIntVector& RegionCoord,
-	TSubclassOf<AActor> ManagerClass,
-	UStaticMesh* Mesh,
-	int32 InstanceId,
-	const FTransform& NewTransform)
-{
-	if (!Mesh || InstanceId == INDEX_NONE)
+	// Free slots at the tail can be dropped without moving any live instance.
+	TArray<int32> TrailingFree;
+	while (Bucket.InstanceOwners.Num() > 0 && !Bucket.InstanceOwners.Last().IsValid())
 	{
-		return;
+		const int32 LastIndex = Bucket.InstanceOwners.Num() - 1;
+		TrailingFree.Add(LastIndex);
+		Bucket.FreeInstances.RemoveSingleSwap(LastIndex, EAllowShrinking::No);
+		Bucket.InstanceOwners.RemoveAt(LastIndex, EAllowShrinking::No);
 	}
-
-	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
-	FRegionManager* Manager = RegionManagers.Find(Key);
-	if (!Manager)
+	if (TrailingFree.Num() > 0)
 	{
-		return;
+		ISMC->RemoveInstances(TrailingFree);
 	}
 
-	const FObjectKey MeshKey(Mesh);
-	TObjectPtr<UInstancedStaticMeshComponent>* Found = Manager->ISMComponents.Find(MeshKey);
-	if (!Found || !*Found)
+	if (bNeedsRenderUpdate)
 	{
-		return;
+		ISMC->MarkRenderStateDirty();
 	}
-
-	UInstancedStaticMeshComponent* ISMC = *Found;
-	ISMC->UpdateInstanceTransform(InstanceId, NewTransform, true, true, true);
 }
 
 // ---------------------------------------------------------------------------
 // ISKM component management
 // ---------------------------------------------------------------------------
 
-UInstancedSkinnedMeshComponent* UArcMobileVisSubsystem::GetOrCreateISKMComponent(
+UArcMobileVisSubsystem::FISKMBucket* UArcMobileVisSubsystem::GetOrCreateISKMBucket(
 	FRegionManager& Manager,
 	USkinnedAsset* Asset,
 	UTransformProviderData* Provider,
@@ -449,9 +531,9 @@ UInstancedSkinnedMeshComponent* UArcMobileVisSubsystem::GetOrCreateISKMComponent
 	}
 
 	const FObjectKey Key(Asset);
-	if (TObjectPtr<UInstancedSkinnedMeshComponent>* Existing = Manager.ISKMComponents.Find(Key))
+	if (FISKMBucket* Existing = Manager.ISKMBuckets.Find(Key))
 	{
-		return *Existing;
+		return Existing->Component ? Existing : nullptr;
 	}
 
 	UInstancedSkinnedMeshComponent* NewISKMC = NewObject<UInstancedSkinnedMeshComponent>(Manager.ManagerActor);
@@ -476,9 +558,26 @@ UInstancedSkinnedMeshComponent* UArcMobileVisSubsystem::GetOrCreateISKMComponent
 	NewISKMC->RegisterComponent();
 	Manager.ManagerActor->AddInstanceComponent(NewISKMC);
 
-	Manager.ISKMComponents.Add(Key, NewISKMC);
+	FISKMBucket& Bucket = Manager.ISKMBuckets.Add(Key);
+	Bucket.Component = NewISKMC;
 
-	return NewISKMC;
+	return &Bucket;
+}
+
+UArcMobileVisSubsystem::FISKMBucket* UArcMobileVisSubsystem::FindISKMBucket(
+	const FIntVector& RegionCoord,
+	TSubclassOf<AActor> ManagerClass,
+	USkinnedAsset* Asset)
+{
+	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
+	FRegionManager* Manager = RegionManagers.Find(Key);
+	if (!Manager)
+	{
+		return nullptr;
+	}
+
+	FISKMBucket* Bucket = Manager->ISKMBuckets.Find(FObjectKey(Asset));
+	return (Bucket && Bucket->Component) ? Bucket : nullptr;
 }
 
 // ---------------------------------------------------------------------------
@@ -497,16 +596,28 @@ FPrimitiveInstanceId UArcMobileVisSubsystem::AddISKMInstance(
 	FMassEntityHandle OwnerEntity)
 {
 	FRegionManager& Manager = GetOrCreateRegionManager(RegionCoord, ManagerClass);
-	UInstancedSkinnedMeshComponent* ISKMC = GetOrCreateISKMComponent(Manager, Asset, Provider, Materials, bCastShadows);
-	if (!ISKMC)
+	FISKMBucket* Bucket = GetOrCreateISKMBucket(Manager, Asset, Provider, Materials, bCastShadows);
+	if (!Bucket)
 	{
 		return FPrimitiveInstanceId();
 	}
 
-	const FPrimitiveInstanceId NewId = ISKMC->AddInstance(Transform, AnimationIndex, true);
+	// ISKM instance data is already buffered by the component until the end of the frame, so the only
+	// saving left is skipping the add/remove churn by reusing a hidden instance.
+	FPrimitiveInstanceId NewId;
+	TArray<FPrimitiveInstanceId>* FreeIds = Bucket->FreeInstances.Find(AnimationIndex);
+	if (FreeIds && FreeIds->Num() > 0)
+	{
+		NewId = FreeIds->Pop(EAllowShrinking::No);
+		--Bucket->NumFreeInstances;
+		Bucket->Component->SetInstanceTransform(NewId, Transform, true, true);
+	}
+	else
+	{
+		NewId = Bucket->Component->AddInstance(Transform, AnimationIndex, true);
+	}
 
-	const FObjectKey Key(Asset);
-	Manager.ISKMInstanceOwners.FindOrAdd(Key).Add(NewId.GetAsIndex(), OwnerEntity);
+	Bucket->Instances.Add(NewId.GetAsIndex(), {OwnerEntity, AnimationIndex});
 
 	return NewId;
 }
@@ -515,36 +626,30 @@ void UArcMobileVisSubsystem::RemoveISKMInstance(
 	const FIntVector& RegionCoord,
 	TSubclassOf<AActor> ManagerClass,
 	USkinnedAsset* Asset,
-	FPrimitiveInstanceId InstanceId,
-	FMassEntityManager& EntityManager)
+	FPrimitiveInstanceId InstanceId)
 {
 	if (!Asset || !InstanceId.IsValid())
 	{
 		return;
 	}
 
-	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
-	FRegionManager* Manager = RegionManagers.Find(Key);
-	if (!Manager)
+	FISKMBucket* Bucket = FindISKMBucket(RegionCoord, ManagerClass, Asset);
+	if (!Bucket)
 	{
 		return;
 	}
 
-	const FObjectKey AssetKey(Asset);
-	TObjectPtr<UInstancedSkinnedMeshComponent>* Found = Manager->ISKMComponents.Find(AssetKey);
-	if (!Found || !*Found)
+	FISKMBucket::FInstance Instance;
+	if (!Bucket->Instances.RemoveAndCopyValue(InstanceId.GetAsIndex(), Instance))
 	{
 		return;
 	}
 
-	UInstancedSkinnedMeshComponent* ISKMC = *Found;
-	ISKMC->RemoveInstance(InstanceId);
+	const FTransform HiddenTransform(FQuat::Identity, Bucket->Component->GetComponentLocation(), FVector::ZeroVector);
+	Bucket->Component->SetInstanceTransform(InstanceId, HiddenTransform, true, true);
 
-	TMap<int32, FMassEntityHandle>* Owners = Manager->ISKMInstanceOwners.Find(AssetKey);
-	if (Owners)
-	{
-		Owners->Remove(InstanceId.GetAsIndex());
-	}
+	Bucket->FreeInstances.FindOrAdd(Instance.AnimationIndex).Add(InstanceId);
+	++Bucket->NumFreeInstances;
 }
 
 void UArcMobileVisSubsystem::UpdateISKMTransform(
@@ -560,20 +665,63 @@ void UArcMobileVisSubsystem::UpdateISKMTransform(
 		return;
 	}
 
-	const FRegionKey Key{RegionCoord, ManagerClass.Get()};
-	FRegionManager* Manager = RegionManagers.Find(Key);
-	if (!Manager)
+	FISKMBucket* Bucket = FindISKMBucket(RegionCoord, ManagerClass, Asset);
+	if (!Bucket)
 	{
 		return;
 	}
 
-	const FObjectKey AssetKey(Asset);
-	TObjectPtr<UInstancedSkinnedMeshComponent>* Found = Manager->ISKMComponents.Find(AssetKey);
-	if (!Found || !*Found)
+	Bucket->Component->SetInstanceTransform(InstanceId, NewTransform, true);
+}
+
+void UArcMobileVisSubsystem::FlushISKMBucket(FISKMBucket& Bucket)
+{
+	if (Bucket.NumFreeInstances <= MaxFreeISKMInstances || !IsValid(Bucket.Component))
 	{
 		return;
 	}
 
-	UInstancedSkinnedMeshComponent* ISKMC = *Found;
-	ISKMC->SetInstanceTransform(InstanceId, NewTransform, true);
+	TArray<FPrimitiveInstanceId> ToRemove;
+	ToRemove.Reserve(Bucket.NumFreeInstances - MaxFreeISKMInstances);
+	for (auto It = Bucket.FreeInstances.CreateIterator(); It && Bucket.NumFreeInstances > MaxFreeISKMInstances; ++It)
+	{
+		TArray<FPrimitiveInstanceId>& FreeIds = It.Value();
+		while (FreeIds.Num() > 0 && Bucket.NumFreeInstances > MaxFreeISKMInstances)
+		{
+			ToRemove.Add(FreeIds.Pop(EAllowShrinking::No));
+			--Bucket.NumFreeInstances;
+		}
+		if (FreeIds.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	Bucket.Component->RemoveInstances(ToRemove);
+}
+
+// ---------------------------------------------------------------------------
+// Batch flush
+// ---------------------------------------------------------------------------
+
+void UArcMobileVisSubsystem::FlushInstanceBatches()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisFlushInstanceBatches);
+
+	for (TPair<FRegionKey, FRegionManager>& Pair : RegionManagers)
+	{
+		for (TPair<FObjectKey, FISMBucket>& BucketPair : Pair.Value.ISMBuckets)
+		{
+			FISMBucket& Bucket = BucketPair.Value;
+			if (Bucket.HasPendingChanges() || (Bucket.InstanceOwners.Num() > 0 && !Bucket.InstanceOwners.Last().IsValid()))
+			{
+				FlushISMBucket(Bucket);
+			}
+		}
+
+		for (TPair<FObjectKey, FISKMBucket>& BucketPair : Pair.Value.ISKMBuckets)
+		{
+			FlushISKMBucket(BucketPair.Value);
+		}
+	}
 }
@@ -221,14 +221,24 @@ struct ARCMASS_API FArcMobileVisSourceTag : public FMassTag
 // Subsystem
 // ---------------------------------------------------------------------------
 
+/**
+ * Grid, LOD and instanced representation for mobile entities.
+ *
+ * ISM/ISKM instance changes are not applied when requested. Adds, removes and transform updates are queued
+ * per component and flushed once per frame in Tick, so a crowd crossing an LOD radius costs one bulk update
+ * per component instead of one render state update per entity. Removed instances are hidden and their slots
+ * reused by later adds; instance indices and IDs handed out stay valid until the entity removes them.
+ */
 UCLASS()
-class ARCMASS_API UArcMobileVisSubsystem : public UWorldSubsystem
+class ARCMASS_API UArcMobileVisSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
 
 	// --- Cell size configuration ---
 	float GetCellSize() const { return CellSize; }
@@ -266,8 +276,9 @@ public:
 		bool bCurrentlyHasPhysics) const;
 
 	// --- ISM management ---
+	// Changes are queued and applied by FlushInstanceBatches. Returned indices are final immediately.
 	int32 AddISMInstance(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, UStaticMesh* Mesh, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bCastShadows, const FTransform& Transform, FMassEntityHandle OwnerEntity);
-	void RemoveISMInstance(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, UStaticMesh* Mesh, int32 InstanceId, FMassEntityManager& EntityManager);
+	void RemoveISMInstance(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, UStaticMesh* Mesh, int32 InstanceId);
 	void UpdateISMTransform(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, UStaticMesh* Mesh, int32 InstanceId, const FTransform& NewTransform);
 
 	// --- ISKM management ---
@@ -277,12 +288,15 @@ public:
 		const FTransform& Transform, int32 AnimationIndex, FMassEntityHandle OwnerEntity);
 
 	void RemoveISKMInstance(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass,
-		USkinnedAsset* Asset, FPrimitiveInstanceId InstanceId, FMassEntityManager& EntityManager);
+		USkinnedAsset* Asset, FPrimitiveInstanceId InstanceId);
 
 	void UpdateISKMTransform(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass,
 		USkinnedAsset* Asset, FPrimitiveInstanceId InstanceId,
 		const FTransform& NewTransform, int32 AnimationIndex);
 
+	/** Apply all queued instance changes. Called from Tick; call directly if instance data must be current sooner. */
+	void FlushInstanceBatches();
+
 private:
 	// --- Region manager ---
 	struct FRegionKey
@@ -301,27 +315,70 @@ private:
 		}
 	};
 
-	struct FRegionManager
+	/** ISM component for one mesh in a region, plus the instance changes queued for it. */
+	struct FISMBucket
 	{
-		TObjectPtr<AActor> ManagerActor;
+		TObjectPtr<UInstancedStaticMeshComponent> Component;
+
+		/** Instance index -> owning entity. Invalid handle for free slots. */
+		TArray<FMassEntityHandle> InstanceOwners;
+
+		/** Hidden instance slots reused by the next adds. */
+		TArray<int32> FreeInstances;
+
+		/** Instances appended on flush. Entry i becomes instance Component->GetInstanceCount() + i. */
+		TArray<FTransform> PendingAdds;
 
-		/** Mesh -> ISM component on this manager actor. */
-		TMap<FObjectKey, TObjectPtr<UInstancedStaticMeshComponent>> ISMComponents;
+		/** Transform writes to existing instances, in request order (later writes win). */
+		TArray<int32> PendingUpdateIndices;
+		TArray<FTransform> PendingUpdateTransforms;
 
-		/** Mesh -> (instance index -> owning entity). For RemoveInstance swap fixup. */
-		TMap<FObjectKey, TArray<FMassEntityHandle>> InstanceOwners;
+		int32 GetNumInstances() const { return InstanceOwners.Num(); }
+		bool HasPendingChanges() const { return PendingAdds.Num() > 0 || PendingUpdateIndices.Num() > 0; }
+	};
+
+	/** ISKM component for one skinned asset in a region. Instance IDs are stable, so only removal needs care. */
+	struct FISKMBucket
+	{
+		TObjectPtr<UInstancedSkinnedMeshComponent> Component;
+
+		struct FInstance
+		{
+			FMassEntityHandle Owner;
+			int32 AnimationIndex = 0;
+		};
 
-		/** SkinnedAsset -> ISKM component on this manager actor. */
-		TMap<FObjectKey, TObjectPtr<UInstancedSkinnedMeshComponent>> ISKMComponents;
+		/** Instance ID index -> owning entity and the animation it was added with. */
+		TMap<int32, FInstance> Instances;
 
-		/** SkinnedAsset -> (instance index -> owning entity). For RemoveInstance cleanup. */
-		TMap<FObjectKey, TMap<int32, FMassEntityHandle>> ISKMInstanceOwners;
+		/** Hidden instances keyed by animation index; an add only reuses an instance playing the same animation. */
+		TMap<int32, TArray<FPrimitiveInstanceId>> FreeInstances;
+		int32 NumFreeInstances = 0;
 	};
 
-	UInstancedStaticMeshComponent* GetOrCreateISMComponent(FRegionManager& Manager, UStaticMesh* Mesh, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bCastShadows);
-	UInstancedSkinnedMeshComponent* GetOrCreateISKMComponent(FRegionManager& Manager, USkinnedAsset* Asset, UTransformProviderData* Provider, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bCastShadows);
+	struct FRegionManager
+	{
+		TObjectPtr<AActor> ManagerActor;
+
+		/** Mesh -> ISM bucket on this manager actor. */
+		TMap<FObjectKey, FISMBucket> ISMBuckets;
+
+		/** SkinnedAsset -> ISKM bucket on this manager actor. */
+		TMap<FObjectKey, FISKMBucket> ISKMBuckets;
+	};
+
+	FISMBucket* GetOrCreateISMBucket(FRegionManager& Manager, UStaticMesh* Mesh, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bCastShadows);
+	FISKMBucket* GetOrCreateISKMBucket(FRegionManager& Manager, USkinnedAsset* Asset, UTransformProviderData* Provider, const TArray<TObjectPtr<UMaterialInterface>>& Materials, bool bCastShadows);
+	FISMBucket* FindISMBucket(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, UStaticMesh* Mesh);
+	FISKMBucket* FindISKMBucket(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass, USkinnedAsset* Asset);
 	FRegionManager& GetOrCreateRegionManager(const FIntVector& RegionCoord, TSubclassOf<AActor> ManagerClass);
 
+	/** Queue a transform write, folding it into PendingAdds if the slot has not been created yet. */
+	static void QueueISMTransform(FISMBucket& Bucket, int32 InstanceIndex, const FTransform& Transform);
+
+	void FlushISMBucket(FISMBucket& Bucket);
+	void FlushISKMBucket(FISKMBucket& Bucket);
+
 	// --- Data ---
 
 	/** Spatial grid: cell coordinate -> entities in that cell. */
@@ -342,4 +399,7 @@ private:
 
 	/** Total number of cells per region side (2 * RegionExtent + 1). */
 	int32 RegionStride = 5;
+
+	/** Hidden ISKM instances kept per component for reuse; the excess is removed on flush. */
+	int32 MaxFreeISKMInstances = 256;
 };
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMobileVisualizationProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMobileVisualization.h"
 #include "MassActorSubsystem.h"
@@ -162,13 +163,14 @@ void UArcMobileVisSourceTrackingProcessor::Execute(FMassEntityManager& EntityMan
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisSourceTracking);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 	constexpr int32 SearchRadiusCells = 30;
 
 	TArray<FMassEntityHandle> EntitiesToSignal;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, SignalSubsystem, CellSize, &EntitiesToSignal](FMassExecutionContext& Ctx)
 		{
 			const TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -276,13 +278,14 @@ void UArcMobileVisEntityCellUpdateProcessor::Execute(FMassEntityManager& EntityM
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisEntityCellUpdate);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 	const float HalfCellSizeSq = (CellSize * 0.5f) * (CellSize * 0.5f);
 
 	TArray<FMassEntityHandle> ChangedEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, CellSize, HalfCellSizeSq, &ChangedEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
@@ -382,6 +385,7 @@ void UArcMobileVisEntityCellChangedProcessor::SignalEntities(FMassEntityManager&
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisEntityCellChanged);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 
@@ -392,7 +396,7 @@ void UArcMobileVisEntityCellChangedProcessor::SignalEntities(FMassEntityManager&
 	TArray<FMassEntityHandle> PhysicsRequestEntities;
 	TArray<FMassEntityHandle> PhysicsReleaseEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, CellSize, &UpgradeToActorEntities, &DowngradeToISMEntities, &UpgradeToISMEntities, &DowngradeToNoneEntities, &PhysicsRequestEntities, &PhysicsReleaseEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
@@ -533,10 +537,11 @@ void UArcMobileVisUpgradeToActorProcessor::SignalEntities(FMassEntityManager& En
 	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisUpgradeToActor);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> PhysicsReleaseEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, World, &PhysicsReleaseEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
@@ -565,7 +570,7 @@ void UArcMobileVisUpgradeToActorProcessor::SignalEntities(FMassEntityManager& En
 				// Remove ISM/ISKM instance if has one
 				if (Config.bUseSkinnedMesh && Rep.ISKMInstanceId.IsValid())
 				{
-					Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId, EntityManager);
+					Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId);
 					Rep.ISKMInstanceId = FPrimitiveInstanceId();
 				}
 				else
@@ -573,7 +578,7 @@ void UArcMobileVisUpgradeToActorProcessor::SignalEntities(FMassEntityManager& En
 					UStaticMesh* MeshToRemove = Rep.CurrentISMMesh ? Rep.CurrentISMMesh.Get() : BaseMesh;
 					if (MeshToRemove && Rep.ISMInstanceId != INDEX_NONE)
 					{
-						Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId, EntityManager);
+						Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId);
 						Rep.ISMInstanceId = INDEX_NONE;
 					}
 				}
@@ -658,10 +663,11 @@ void UArcMobileVisDowngradeToISMProcessor::SignalEntities(FMassEntityManager& En
 	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisDowngradeToISM);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> PhysicsRequestEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, World, &PhysicsRequestEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
@@ -792,8 +798,9 @@ void UArcMobileVisUpgradeToISMProcessor::SignalEntities(FMassEntityManager& Enti
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisUpgradeToISM);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
@@ -895,9 +902,10 @@ void UArcMobileVisDowngradeToNoneProcessor::SignalEntities(FMassEntityManager& E
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisDowngradeToNone);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
-		[&EntityManager, Subsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context,
+		[Subsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
 			const FArcMobileVisConfigFragment& Config = Ctx.GetConstSharedFragment<FArcMobileVisConfigFragment>();
@@ -911,7 +919,7 @@ void UArcMobileVisDowngradeToNoneProcessor::SignalEntities(FMassEntityManager& E
 				// Remove ISM/ISKM if has one
 				if (Config.bUseSkinnedMesh && Rep.ISKMInstanceId.IsValid())
 				{
-					Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId, EntityManager);
+					Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId);
 					Rep.ISKMInstanceId = FPrimitiveInstanceId();
 				}
 				else
@@ -919,7 +927,7 @@ void UArcMobileVisDowngradeToNoneProcessor::SignalEntities(FMassEntityManager& E
 					UStaticMesh* MeshToRemove = Rep.CurrentISMMesh ? Rep.CurrentISMMesh.Get() : BaseMesh;
 					if (MeshToRemove && Rep.ISMInstanceId != INDEX_NONE)
 					{
-						Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId, EntityManager);
+						Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId);
 					}
 
 					Rep.ISMInstanceId = INDEX_NONE;
@@ -969,9 +977,10 @@ void UArcMobileVisISMTransformUpdateProcessor::Execute(FMassEntityManager& Entit
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisISMTransformUpdate);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
-		[&EntityManager, Subsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context,
+		[Subsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
 			const TConstArrayView<FArcMobileVisLODFragment> LODFragments = Ctx.GetFragmentView<FArcMobileVisLODFragment>();
@@ -1012,7 +1021,7 @@ void UArcMobileVisISMTransformUpdateProcessor::Execute(FMassEntityManager& Entit
 						// Remove from old region
 						if (MeshToUse)
 						{
-							Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToUse, Rep.ISMInstanceId, EntityManager);
+							Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToUse, Rep.ISMInstanceId);
 						}
 
 						// Add to new region
@@ -1094,12 +1103,13 @@ void UArcMobileVisEntityInitObserver::Execute(FMassEntityManager& EntityManager,
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisEntityInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 
 	TArray<FMassEntityHandle> PhysicsRequestEntities;
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem, CellSize, World, &PhysicsRequestEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FMassActorFragment> ActorFragments = Ctx.GetMutableFragmentView<FMassActorFragment>();
@@ -1276,11 +1286,12 @@ void UArcMobileVisEntityDeinitObserver::Execute(FMassEntityManager& EntityManage
 	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisEntityDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> PhysicsReleaseEntities;
 
-	ObserverQuery.ForEachEntityChunk(Context,
-		[&EntityManager, Subsystem, &PhysicsReleaseEntities](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
+		[Subsystem, &PhysicsReleaseEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMobileVisRepFragment> RepFragments = Ctx.GetMutableFragmentView<FArcMobileVisRepFragment>();
 			const TConstArrayView<FArcMobileVisLODFragment> LODFragments = Ctx.GetFragmentView<FArcMobileVisLODFragment>();
@@ -1310,7 +1321,7 @@ void UArcMobileVisEntityDeinitObserver::Execute(FMassEntityManager& EntityManage
 				{
 					if (Config.bUseSkinnedMesh && Rep.ISKMInstanceId.IsValid())
 					{
-						Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId, EntityManager);
+						Subsystem->RemoveISKMInstance(Rep.RegionCoord, Config.ISMManagerClass, Config.SkinnedAsset, Rep.ISKMInstanceId);
 						Rep.ISKMInstanceId = FPrimitiveInstanceId();
 					}
 					else
@@ -1318,7 +1329,7 @@ void UArcMobileVisEntityDeinitObserver::Execute(FMassEntityManager& EntityManage
 						UStaticMesh* MeshToRemove = Rep.CurrentISMMesh ? Rep.CurrentISMMesh.Get() : BaseMesh;
 						if (MeshToRemove && Rep.ISMInstanceId != INDEX_NONE)
 						{
-							Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId, EntityManager);
+							Subsystem->RemoveISMInstance(Rep.RegionCoord, Config.ISMManagerClass, MeshToRemove, Rep.ISMInstanceId);
 							Rep.ISMInstanceId = INDEX_NONE;
 						}
 					}
@@ -1373,8 +1384,9 @@ void UArcMobileVisSourceDeinitObserver::Execute(FMassEntityManager& EntityManage
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMobileVisSourceDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[Subsystem](FMassExecutionContext& Ctx)
 		{
 			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
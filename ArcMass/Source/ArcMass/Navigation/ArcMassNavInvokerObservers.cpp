@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMass/Navigation/ArcMassNavInvokerObservers.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "MassExecutionContext.h"
 #include "Mass/EntityFragments.h"
@@ -63,8 +64,9 @@ void UArcMassNavInvokerMoveableObserver::Execute(FMassEntityManager& EntityManag
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNavInvokerMoveableAdd);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [Subsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [Subsystem](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FMassNavInvokerFragment> Invokers = Ctx.GetMutableFragmentView<FMassNavInvokerFragment>();
 		TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -107,8 +109,9 @@ void UArcMassNavInvokerStaticObserver::Execute(FMassEntityManager& EntityManager
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNavInvokerStaticAdd);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [Subsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [Subsystem](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FMassNavInvokerFragment> Invokers = Ctx.GetMutableFragmentView<FMassNavInvokerFragment>();
 		TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -149,8 +152,9 @@ void UArcMassNavInvokerRemovalObserver::Execute(FMassEntityManager& EntityManage
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNavInvokerRemove);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [Subsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [Subsystem](FMassExecutionContext& Ctx)
 	{
 		TConstArrayView<FMassNavInvokerFragment> Invokers = Ctx.GetFragmentView<FMassNavInvokerFragment>();
 
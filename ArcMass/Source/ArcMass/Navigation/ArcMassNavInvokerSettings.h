@@ -0,0 +1,37 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ArcMassNavInvokerSettings.generated.h"
+
+/** Tile build scheduling for Mass nav invokers (UArcMassNavInvokerSubsystem). */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "ArcMass Nav Invokers"))
+class ARCMASS_API UArcMassNavInvokerSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FName GetCategoryName() const override { return FName("ArcMass"); }
+	virtual FName GetSectionName() const override { return FName("NavInvokers"); }
+
+	/** Tiles handed to Recast and not yet ready. New builds wait while this many are in flight. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "1"))
+	int32 MaxConcurrentTileBuilds = 32;
+
+	/** Queued tiles handed to Recast per frame. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "1"))
+	int32 MaxTileDispatchesPerFrame = 8;
+
+	/** Seconds a tile stays built after its last invoker leaves. Re-entering within this time costs nothing. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0.0"))
+	float TileRemovalDelay = 3.f;
+
+	/**
+	 * How far ahead (seconds) an invoker's footprint is extended along its velocity. Tiles on the
+	 * predicted path are requested early. Closing speed also raises a queued tile's priority. 0 disables prediction.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0.0"))
+	float PredictionTime = 1.5f;
+};
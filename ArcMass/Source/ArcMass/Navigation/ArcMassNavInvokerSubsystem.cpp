@@ -6,10 +6,19 @@
 #include "NavigationSystem.h"
 #include "NavMesh/RecastNavMesh.h"
 #include "ArcMass/Navigation/ArcMassNavInvokerTypes.h"
+#include "ArcMass/Navigation/ArcMassNavInvokerSettings.h"
 #include "ArcMass/Navigation/ArcRecastNavMesh.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassNavInvokerSubsystem)
 
+DECLARE_STATS_GROUP(TEXT("ArcNavInvoker"), STATGROUP_ArcNavInvoker, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Tile Scheduler Tick"), STAT_ArcNavInvokerSchedulerTick, STATGROUP_ArcNavInvoker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued Tile Builds"), STAT_ArcNavInvokerQueuedBuilds, STATGROUP_ArcNavInvoker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("In-Flight Tile Builds"), STAT_ArcNavInvokerInFlightBuilds, STATGROUP_ArcNavInvoker);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Tile Removals"), STAT_ArcNavInvokerPendingRemovals, STATGROUP_ArcNavInvoker);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Avg Request To Ready (ms)"), STAT_ArcNavInvokerAvgReadyLatency, STATGROUP_ArcNavInvoker);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max Request To Ready (ms)"), STAT_ArcNavInvokerMaxReadyLatency, STATGROUP_ArcNavInvoker);
+
 // ---------------------------------------------------------------------------
 
 void UArcMassNavInvokerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -36,10 +45,42 @@ void UArcMassNavInvokerSubsystem::Deinitialize()
 	InvokerSlots.Empty();
 	TileRefCounts.Empty();
 	PendingDiffs.Empty();
+	QueuedTileBuilds.Empty();
+	InFlightTileBuilds.Empty();
+	PendingTileRemovals.Empty();
 	CachedNavMeshActors.Empty();
 	Super::Deinitialize();
 }
 
+void UArcMassNavInvokerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ArcNavInvokerSchedulerTick);
+
+	const UWorld* World = GetWorld();
+	if (World == nullptr || World->bIsTearingDown)
+	{
+		return;
+	}
+
+	if (QueuedTileBuilds.Num() > 0 || InFlightTileBuilds.Num() > 0 || PendingTileRemovals.Num() > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		CollectReadyTiles(Now);
+		DispatchTileChanges(Now);
+	}
+
+	SET_DWORD_STAT(STAT_ArcNavInvokerQueuedBuilds, QueuedTileBuilds.Num());
+	SET_DWORD_STAT(STAT_ArcNavInvokerInFlightBuilds, InFlightTileBuilds.Num());
+	SET_DWORD_STAT(STAT_ArcNavInvokerPendingRemovals, PendingTileRemovals.Num());
+	SET_FLOAT_STAT(STAT_ArcNavInvokerAvgReadyLatency, SchedulerStats.GetAverageReadyLatency() * 1000.0);
+	SET_FLOAT_STAT(STAT_ArcNavInvokerMaxReadyLatency, SchedulerStats.MaxReadyLatency * 1000.0);
+}
+
+TStatId UArcMassNavInvokerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArcMassNavInvokerSubsystem, STATGROUP_ArcNavInvoker);
+}
+
 // ---------------------------------------------------------------------------
 // Slot management
 // ---------------------------------------------------------------------------
@@ -52,7 +93,15 @@ int32 UArcMassNavInvokerSubsystem::AllocateSlot(const FArcNavInvokerData& Data)
 	}
 
 	const int32 Index = InvokerSlots.Add(Data);
-	AddTilesForInvoker(Data);
+
+	FArcNavInvokerData& Slot = InvokerSlots[Index];
+	Slot.PredictedLocation = Slot.Location;
+	Slot.Velocity = FVector::ZeroVector;
+	Slot.LocationTime = GetWorld() != nullptr ? GetWorld()->GetTimeSeconds() : 0.0;
+	Slot.OwnedTiles.Reset();
+	Slot.Generation = NextSlotGeneration++;
+
+	AddTilesForInvoker(Index);
 	return Index;
 }
 
@@ -62,7 +111,7 @@ void UArcMassNavInvokerSubsystem::FreeSlot(int32 Index)
 	{
 		return;
 	}
-	RemoveTilesForInvoker(InvokerSlots[Index]);
+	RemoveTilesForInvoker(Index);
 	InvokerSlots.RemoveAt(Index);
 }
 
@@ -75,11 +124,57 @@ void UArcMassNavInvokerSubsystem::UpdateSlotLocation(int32 Index, const FVector&
 	InvokerSlots[Index].Location = NewLocation;
 }
 
+void UArcMassNavInvokerSubsystem::ApplySlotDiffs(TConstArrayView<FArcNavTileDiffEntry> Diffs)
+{
+	// Diffs are computed on a worker; a slot freed and reallocated since then belongs to another invoker.
+	for (const FArcNavTileDiffEntry& Diff : Diffs)
+	{
+		FArcNavInvokerData* InvokerPtr = FindSlot(Diff.SlotIndex, Diff.SlotGeneration);
+		if (InvokerPtr == nullptr)
+		{
+			continue;
+		}
+
+		FArcNavInvokerData& Invoker = *InvokerPtr;
+		for (const FIntPoint& Tile : Diff.TileGains)
+		{
+			bool bAlreadyOwned = false;
+			Invoker.OwnedTiles.Add(Tile, &bAlreadyOwned);
+			if (!bAlreadyOwned)
+			{
+				AcquireTile(Tile, Diff.Priority, Diff.SlotIndex, Diff.SlotGeneration);
+			}
+		}
+
+		Invoker.Location = Diff.NewLocation;
+		Invoker.PredictedLocation = Diff.NewPredictedLocation;
+		Invoker.Velocity = Diff.NewVelocity;
+		Invoker.LocationTime = Diff.NewLocationTime;
+	}
+
+	for (const FArcNavTileDiffEntry& Diff : Diffs)
+	{
+		FArcNavInvokerData* Invoker = FindSlot(Diff.SlotIndex, Diff.SlotGeneration);
+		if (Invoker == nullptr)
+		{
+			continue;
+		}
+
+		for (const FIntPoint& Tile : Diff.TileLosses)
+		{
+			if (Invoker->OwnedTiles.Remove(Tile) > 0)
+			{
+				ReleaseTile(Tile);
+			}
+		}
+	}
+}
+
 // ---------------------------------------------------------------------------
 // Tile management
 // ---------------------------------------------------------------------------
 
-void UArcMassNavInvokerSubsystem::AddTilesForInvoker(const FArcNavInvokerData& Invoker)
+void UArcMassNavInvokerSubsystem::AddTilesForInvoker(int32 SlotIndex)
 {
 	const UWorld* World = GetWorld();
 	if (World == nullptr || World->bIsTearingDown)
@@ -87,104 +182,267 @@ void UArcMassNavInvokerSubsystem::AddTilesForInvoker(const FArcNavInvokerData& I
 		return;
 	}
 
-	if (!bRecastConfigCached)
+	if (!bRecastConfigCached || !InvokerSlots.IsValidIndex(SlotIndex))
 	{
 		return;
 	}
 
-	TArray<FNavMeshDirtyTileElement> TilesToRebuild;
-	TilesToRebuild.Reserve(16);
-
-	ArcNavInvoker::ForEachTileInRadius(
+	FArcNavInvokerData& Invoker = InvokerSlots[SlotIndex];
+	ArcNavInvoker::ForEachTileInFootprint(
 		Invoker.Location,
+		Invoker.PredictedLocation,
 		Invoker.RadiusMin,
 		NavmeshOrigin,
 		TileDim,
-		[this, &Invoker, &TilesToRebuild](const FIntPoint& Tile)
+		[this, &Invoker, SlotIndex](const FIntPoint& Tile)
 		{
-			int32& RefCount = TileRefCounts.FindOrAdd(Tile, 0);
-			++RefCount;
-			if (RefCount == 1)
+			bool bAlreadyOwned = false;
+			Invoker.OwnedTiles.Add(Tile, &bAlreadyOwned);
+			if (!bAlreadyOwned)
 			{
-				// First reference — activate the tile on every navmesh
-				ForEachValidNavMesh([&Tile](ARecastNavMesh& NavMesh)
-				{
-					NavMesh.GetActiveTileSet().Add(Tile);
-				});
-
-				FNavMeshDirtyTileElement Element;
-				Element.Coordinates = Tile;
-				Element.InvokerDistanceSquared = 0.f;
-				Element.InvokerPriority = Invoker.Priority;
-				TilesToRebuild.Add(Element);
+				AcquireTile(Tile, Invoker.Priority, SlotIndex, Invoker.Generation);
 			}
 		});
+}
+
+void UArcMassNavInvokerSubsystem::RemoveTilesForInvoker(int32 SlotIndex)
+{
+	const UWorld* World = GetWorld();
+	if (World == nullptr || World->bIsTearingDown)
+	{
+		return;
+	}
+
+	if (!InvokerSlots.IsValidIndex(SlotIndex))
+	{
+		return;
+	}
+
+	FArcNavInvokerData& Invoker = InvokerSlots[SlotIndex];
+	for (const FIntPoint& Tile : Invoker.OwnedTiles)
+	{
+		ReleaseTile(Tile);
+	}
+	Invoker.OwnedTiles.Reset();
+}
+
+FArcNavInvokerData* UArcMassNavInvokerSubsystem::FindSlot(int32 SlotIndex, uint32 Generation)
+{
+	if (!InvokerSlots.IsValidIndex(SlotIndex) || InvokerSlots[SlotIndex].Generation != Generation)
+	{
+		return nullptr;
+	}
+	return &InvokerSlots[SlotIndex];
+}
+
+const FArcNavInvokerData* UArcMassNavInvokerSubsystem::FindSlot(int32 SlotIndex, uint32 Generation) const
+{
+	return const_cast<UArcMassNavInvokerSubsystem*>(this)->FindSlot(SlotIndex, Generation);
+}
+
+void UArcMassNavInvokerSubsystem::AcquireTile(const FIntPoint& Tile, ENavigationInvokerPriority Priority, int32 SlotIndex, uint32 SlotGeneration)
+{
+	int32& RefCount = TileRefCounts.FindOrAdd(Tile, 0);
+	++RefCount;
 
-	if (TilesToRebuild.Num() > 0)
+	if (RefCount > 1)
 	{
-		ForEachValidNavMesh([&TilesToRebuild](ARecastNavMesh& NavMesh)
+		if (FTileBuildRequest* Queued = QueuedTileBuilds.Find(Tile))
 		{
-			AArcRecastNavMesh::FMassApplyScope MassApplyScope(Cast<AArcRecastNavMesh>(&NavMesh));
+			Queued->Priority = FMath::Max(Queued->Priority, Priority);
 
-			NavMesh.RebuildTile(TilesToRebuild);
-		});
+			// The requesting invoker is gone; order the build by this one instead.
+			if (FindSlot(Queued->SlotIndex, Queued->SlotGeneration) == nullptr)
+			{
+				Queued->SlotIndex = SlotIndex;
+				Queued->SlotGeneration = SlotGeneration;
+			}
+		}
+		return;
+	}
+
+	// Still built: the removal hadn't been flushed yet.
+	if (PendingTileRemovals.Remove(Tile) > 0)
+	{
+		++SchedulerStats.RemovalsCancelled;
+		return;
 	}
+
+	FTileBuildRequest& Request = QueuedTileBuilds.FindOrAdd(Tile);
+	Request.Priority = Priority;
+	Request.SlotIndex = SlotIndex;
+	Request.SlotGeneration = SlotGeneration;
+	Request.RequestTime = FPlatformTime::Seconds();
+
+	SchedulerStats.PeakQueuedBuilds = FMath::Max(SchedulerStats.PeakQueuedBuilds, QueuedTileBuilds.Num());
 }
 
-void UArcMassNavInvokerSubsystem::RemoveTilesForInvoker(const FArcNavInvokerData& Invoker)
+void UArcMassNavInvokerSubsystem::ReleaseTile(const FIntPoint& Tile)
 {
-	const UWorld* World = GetWorld();
-	if (World == nullptr || World->bIsTearingDown)
+	int32* RefCount = TileRefCounts.Find(Tile);
+	if (RefCount == nullptr)
 	{
 		return;
 	}
 
-	if (!bRecastConfigCached)
+	--(*RefCount);
+	if (*RefCount > 0)
+	{
+		return;
+	}
+
+	TileRefCounts.Remove(Tile);
+
+	// Never handed to Recast, so there is nothing to remove.
+	if (QueuedTileBuilds.Remove(Tile) > 0)
+	{
+		++SchedulerStats.BuildsCancelled;
+		return;
+	}
+
+	PendingTileRemovals.Add(Tile, FPlatformTime::Seconds());
+}
+
+// ---------------------------------------------------------------------------
+// Tile build scheduler
+// ---------------------------------------------------------------------------
+
+void UArcMassNavInvokerSubsystem::CollectReadyTiles(double Now)
+{
+	if (InFlightTileBuilds.Num() == 0)
 	{
 		return;
 	}
 
+	// A tile is ready once it has navmesh data. Tiles without geometry never get any, so everything
+	// in flight also counts as ready once the generators have no work left.
+	bool bGeneratorsIdle = true;
+	ARecastNavMesh* ProbeNavMesh = nullptr;
+	ForEachValidNavMesh([&bGeneratorsIdle, &ProbeNavMesh](ARecastNavMesh& NavMesh)
+	{
+		if (NavMesh.GetGenerator()->GetNumRemaningBuildTasks() > 0)
+		{
+			bGeneratorsIdle = false;
+		}
+		if (ProbeNavMesh == nullptr)
+		{
+			ProbeNavMesh = &NavMesh;
+		}
+	});
+
+	TArray<int32> TileIndices;
+	for (auto It = InFlightTileBuilds.CreateIterator(); It; ++It)
+	{
+		bool bReady = bGeneratorsIdle || ProbeNavMesh == nullptr;
+		if (!bReady)
+		{
+			TileIndices.Reset();
+			ProbeNavMesh->GetNavMeshTilesAt(It.Key().X, It.Key().Y, TileIndices);
+			bReady = TileIndices.Num() > 0;
+		}
+
+		if (bReady)
+		{
+			const double Latency = Now - It.Value();
+			++SchedulerStats.TilesReady;
+			SchedulerStats.TotalReadyLatency += Latency;
+			SchedulerStats.MaxReadyLatency = FMath::Max(SchedulerStats.MaxReadyLatency, Latency);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UArcMassNavInvokerSubsystem::DispatchTileChanges(double Now)
+{
+	const UArcMassNavInvokerSettings* Settings = GetDefault<UArcMassNavInvokerSettings>();
+
 	TArray<FIntPoint> TilesToRemove;
-	TilesToRemove.Reserve(16);
+	for (auto It = PendingTileRemovals.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value() >= Settings->TileRemovalDelay)
+		{
+			TilesToRemove.Add(It.Key());
+			InFlightTileBuilds.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+	SchedulerStats.TilesRemoved += TilesToRemove.Num();
 
-	ArcNavInvoker::ForEachTileInRadius(
-		Invoker.Location,
-		Invoker.RadiusMax,
-		NavmeshOrigin,
-		TileDim,
-		[this, &TilesToRemove](const FIntPoint& Tile)
+	TArray<FNavMeshDirtyTileElement> TilesToRebuild;
+	const int32 Budget = FMath::Min(Settings->MaxTileDispatchesPerFrame, Settings->MaxConcurrentTileBuilds - InFlightTileBuilds.Num());
+
+	if (Budget > 0 && QueuedTileBuilds.Num() > 0)
+	{
+		struct FScoredTile
 		{
-			int32* RefCount = TileRefCounts.Find(Tile);
-			if (RefCount == nullptr)
+			FIntPoint Tile;
+			ENavigationInvokerPriority Priority;
+			float Score;
+		};
+
+		// Score is the distance the requesting invoker still has to cover after PredictionTime at its
+		// current closing speed, so fast invokers heading for a tile get it before slow or receding ones.
+		TArray<FScoredTile> Candidates;
+		Candidates.Reserve(QueuedTileBuilds.Num());
+		for (const TPair<FIntPoint, FTileBuildRequest>& Pair : QueuedTileBuilds)
+		{
+			float Score = TNumericLimits<float>::Max();
+			if (const FArcNavInvokerData* Invoker = FindSlot(Pair.Value.SlotIndex, Pair.Value.SlotGeneration))
 			{
-				return;
+				FVector ToTile = ArcNavInvoker::GetTileCenter(Pair.Key, NavmeshOrigin, TileDim) - Invoker->Location;
+				ToTile.Z = 0.f;
+
+				const float Distance = ToTile.Size();
+				const float ClosingSpeed = Distance > UE_KINDA_SMALL_NUMBER
+					? FMath::Max(0.f, static_cast<float>(FVector::DotProduct(Invoker->Velocity, ToTile)) / Distance)
+					: 0.f;
+				Score = FMath::Max(0.f, Distance - ClosingSpeed * Settings->PredictionTime);
 			}
+			Candidates.Add({Pair.Key, Pair.Value.Priority, Score});
+		}
 
-			--(*RefCount);
-			if (*RefCount <= 0)
+		Candidates.Sort([](const FScoredTile& A, const FScoredTile& B)
+		{
+			if (A.Priority != B.Priority)
 			{
-				TileRefCounts.Remove(Tile);
-
-				ForEachValidNavMesh([&Tile](ARecastNavMesh& NavMesh)
-				{
-					NavMesh.GetActiveTileSet().Remove(Tile);
-				});
-
-				TilesToRemove.Add(Tile);
+				return A.Priority > B.Priority;
 			}
+			return A.Score < B.Score;
 		});
 
-	if (TilesToRemove.Num() > 0)
-	{
-		ForEachValidNavMesh([&TilesToRemove](ARecastNavMesh& NavMesh)
+		const int32 NumToDispatch = FMath::Min(Budget, Candidates.Num());
+		TilesToRebuild.Reserve(NumToDispatch);
+		for (int32 Idx = 0; Idx < NumToDispatch; ++Idx)
 		{
-			AArcRecastNavMesh::FMassApplyScope MassApplyScope(Cast<AArcRecastNavMesh>(&NavMesh));
+			const FScoredTile& Candidate = Candidates[Idx];
 
-			NavMesh.RemoveTiles(TilesToRemove);
-		});
+			FNavMeshDirtyTileElement Element;
+			Element.Coordinates = Candidate.Tile;
+			Element.InvokerDistanceSquared = Candidate.Score < TNumericLimits<float>::Max() ? FMath::Square(Candidate.Score) : TNumericLimits<float>::Max();
+			Element.InvokerPriority = Candidate.Priority;
+			TilesToRebuild.Add(Element);
+
+			FTileBuildRequest Request;
+			QueuedTileBuilds.RemoveAndCopyValue(Candidate.Tile, Request);
+			InFlightTileBuilds.Add(Candidate.Tile, Request.RequestTime);
+		}
+	}
+
+	if (TilesToRebuild.Num() > 0 || TilesToRemove.Num() > 0)
+	{
+		ApplyBatchedTileChanges(TilesToRebuild, TilesToRemove);
 	}
 }
 
+FArcNavTileSchedulerStats UArcMassNavInvokerSubsystem::GetSchedulerStats() const
+{
+	FArcNavTileSchedulerStats Stats = SchedulerStats;
+	Stats.QueuedBuilds = QueuedTileBuilds.Num();
+	Stats.InFlightBuilds = InFlightTileBuilds.Num();
+	Stats.PendingRemovals = PendingTileRemovals.Num();
+	return Stats;
+}
+
 // ---------------------------------------------------------------------------
 // Diff buffer
 // ---------------------------------------------------------------------------
@@ -202,30 +460,9 @@ TArray<FArcNavTileDiffEntry> UArcMassNavInvokerSubsystem::DrainDiffs()
 }
 
 // ---------------------------------------------------------------------------
-// Refcount manipulation
+// Navmesh dispatch
 // ---------------------------------------------------------------------------
 
-void UArcMassNavInvokerSubsystem::IncrementTileRefCount(const FIntPoint& Tile)
-{
-	int32& RefCount = TileRefCounts.FindOrAdd(Tile, 0);
-	++RefCount;
-}
-
-void UArcMassNavInvokerSubsystem::DecrementTileRefCount(const FIntPoint& Tile)
-{
-	int32* RefCount = TileRefCounts.Find(Tile);
-	if (RefCount == nullptr)
-	{
-		return;
-	}
-
-	--(*RefCount);
-	if (*RefCount <= 0)
-	{
-		TileRefCounts.Remove(Tile);
-	}
-}
-
 void UArcMassNavInvokerSubsystem::ApplyBatchedTileChanges(
 	const TArray<FNavMeshDirtyTileElement>& TilesToRebuild,
 	const TArray<FIntPoint>& TilesToRemove)
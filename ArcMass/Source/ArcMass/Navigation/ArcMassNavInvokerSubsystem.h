@@ -10,17 +10,49 @@
 
 struct FNavMeshDirtyTileElement;
 
+/** Tile build scheduler counters. Queue sizes are current; the rest accumulate over the world's lifetime. */
+struct FArcNavTileSchedulerStats
+{
+	int32 QueuedBuilds = 0;
+	int32 InFlightBuilds = 0;
+	int32 PendingRemovals = 0;
+	int32 PeakQueuedBuilds = 0;
+
+	/** Tiles that reached ready, and the request-to-ready time summed over them. */
+	int64 TilesReady = 0;
+	double TotalReadyLatency = 0.0;
+	double MaxReadyLatency = 0.0;
+
+	/** Queued builds dropped because their last invoker left before dispatch. */
+	int64 BuildsCancelled = 0;
+
+	/** Deferred removals undone because an invoker came back within TileRemovalDelay. */
+	int64 RemovalsCancelled = 0;
+	int64 TilesRemoved = 0;
+
+	double GetAverageReadyLatency() const
+	{
+		return TilesReady > 0 ? TotalReadyLatency / static_cast<double>(TilesReady) : 0.0;
+	}
+};
+
 /**
  * World subsystem that owns a sparse array of FArcNavInvokerData slots and
  * manages navmesh tile activation/deactivation on behalf of Mass entities.
  *
- * Processors allocate a slot per entity (AllocateSlot), update its location each
- * frame (UpdateSlotLocation), and free it on entity removal (FreeSlot).  The
- * subsystem tracks per-tile reference counts so that overlapping invokers share
- * tiles without double-building.
+ * Processors allocate a slot per entity (AllocateSlot), apply cell-change diffs
+ * (ApplySlotDiffs), and free it on entity removal (FreeSlot).  The subsystem tracks
+ * per-tile reference counts so that overlapping invokers share tiles without
+ * double-building.
+ *
+ * Refcount transitions do not touch the navmesh directly. Tiles gaining their first
+ * reference are queued and handed to Recast in Tick, nearest-and-approaching first,
+ * within UArcMassNavInvokerSettings::MaxTileDispatchesPerFrame and MaxConcurrentTileBuilds.
+ * Tiles losing their last reference are removed after TileRemovalDelay, unless an
+ * invoker reclaims them first.
  */
 UCLASS()
-class ARCMASS_API UArcMassNavInvokerSubsystem : public UWorldSubsystem
+class ARCMASS_API UArcMassNavInvokerSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -29,6 +61,10 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	// ---- Slot management ----
 
 	/** Register a new invoker and return its index. */
@@ -40,6 +76,13 @@ public:
 	/** Update the world-space location of an existing slot in-place (no tile rebuild). */
 	void UpdateSlotLocation(int32 Index, const FVector& NewLocation);
 
+	/**
+	 * Apply cell-change diffs: move each slot and acquire/release its gained/lost tiles.
+	 * All gains are applied before any loss, so a tile handed from one invoker to another
+	 * in the same batch never drops to zero references.
+	 */
+	void ApplySlotDiffs(TConstArrayView<FArcNavTileDiffEntry> Diffs);
+
 	// ---- Diff buffer (parallel pipeline) ----
 
 	/** Replace pending diffs with the provided array. Called by cell-detect processor (worker thread). */
@@ -48,19 +91,6 @@ public:
 	/** Drain and return all pending diffs. Called by tile-apply processor (game thread). */
 	TArray<FArcNavTileDiffEntry> DrainDiffs();
 
-	// ---- Refcount manipulation (used by batched apply) ----
-
-	/** Increment refcount for a single tile. Does not trigger navmesh operations. */
-	void IncrementTileRefCount(const FIntPoint& Tile);
-
-	/** Decrement refcount for a single tile. Removes entry at zero. Does not trigger navmesh operations. */
-	void DecrementTileRefCount(const FIntPoint& Tile);
-
-	/** Apply batched tile rebuild/remove in a single ForEachValidNavMesh pass. */
-	void ApplyBatchedTileChanges(
-		const TArray<FNavMeshDirtyTileElement>& TilesToRebuild,
-		const TArray<FIntPoint>& TilesToRemove);
-
 	// ---- Config accessors for parallel processor ----
 
 	FVector GetNavmeshOrigin() const { return NavmeshOrigin; }
@@ -72,15 +102,55 @@ public:
 	float GetCellSize() const { return CellSize; }
 	const TMap<FIntPoint, int32>& GetTileRefCounts() const { return TileRefCounts; }
 
+	/** True if the tile is referenced or waiting out its removal delay; such tiles must not be evicted. */
+	bool IsTileProtected(const FIntPoint& Tile) const { return TileRefCounts.Contains(Tile) || PendingTileRemovals.Contains(Tile); }
+
+	/** Tiles waiting out their removal delay, with the time their last reference was released. */
+	const TMap<FIntPoint, double>& GetPendingTileRemovals() const { return PendingTileRemovals; }
+
+	FArcNavTileSchedulerStats GetSchedulerStats() const;
+
 	// ---- Tile management ----
 
-	/** Add tiles for an invoker (GenerationRadius). Increments refcounts; triggers RebuildTile on 0->1. */
-	void AddTilesForInvoker(const FArcNavInvokerData& Invoker);
+	/** Acquire every tile in the slot's generation footprint and record them in its OwnedTiles. */
+	void AddTilesForInvoker(int32 SlotIndex);
 
-	/** Remove tiles for an invoker (RemovalRadius). Decrements refcounts; triggers RemoveTiles on 1->0. */
-	void RemoveTilesForInvoker(const FArcNavInvokerData& Invoker);
+	/** Release every tile in the slot's OwnedTiles. */
+	void RemoveTilesForInvoker(int32 SlotIndex);
 
 private:
+	struct FTileBuildRequest
+	{
+		ENavigationInvokerPriority Priority = ENavigationInvokerPriority::Default;
+
+		/** Invoker whose distance and velocity order this request. May have been freed, or reused by another invoker, since. */
+		int32 SlotIndex = INDEX_NONE;
+		uint32 SlotGeneration = 0;
+
+		double RequestTime = 0.0;
+	};
+
+	/** The slot at SlotIndex, or null if it was freed or now belongs to an invoker of another generation. */
+	FArcNavInvokerData* FindSlot(int32 SlotIndex, uint32 Generation);
+	const FArcNavInvokerData* FindSlot(int32 SlotIndex, uint32 Generation) const;
+
+	/** Increment a tile's refcount; on 0->1 queue a build or cancel a pending removal. */
+	void AcquireTile(const FIntPoint& Tile, ENavigationInvokerPriority Priority, int32 SlotIndex, uint32 SlotGeneration);
+
+	/** Decrement a tile's refcount; on 1->0 drop a queued build or schedule a deferred removal. */
+	void ReleaseTile(const FIntPoint& Tile);
+
+	/** Move finished builds out of InFlightTileBuilds and record their latency. */
+	void CollectReadyTiles(double Now);
+
+	/** Hand the best queued tiles to Recast and flush expired removals. */
+	void DispatchTileChanges(double Now);
+
+	/** Apply batched tile rebuild/remove in a single ForEachValidNavMesh pass. */
+	void ApplyBatchedTileChanges(
+		const TArray<FNavMeshDirtyTileElement>& TilesToRebuild,
+		const TArray<FIntPoint>& TilesToRemove);
+
 	/** Lazy-cache the Recast navmesh origin and tile dimension from the first valid ARecastNavMesh. */
 	void CacheRecastConfig();
 
@@ -111,12 +181,28 @@ private:
 	/** Sparse array of active invoker slots. Index is stable until FreeSlot is called. */
 	TSparseArray<FArcNavInvokerData> InvokerSlots;
 
+	/** Generation handed to the next allocated slot. */
+	uint32 NextSlotGeneration = 1;
+
 	/** Per-tile reference count. When a count reaches 0 the tile is deactivated. */
 	TMap<FIntPoint, int32> TileRefCounts;
 
 	/** Pending tile diffs from the parallel cell-detect processor, consumed by the apply processor. */
 	TArray<FArcNavTileDiffEntry> PendingDiffs;
 
+	// ---- Tile build scheduler ----
+
+	/** Referenced tiles not yet handed to Recast. */
+	TMap<FIntPoint, FTileBuildRequest> QueuedTileBuilds;
+
+	/** Tiles handed to Recast and not yet ready, with their original request time. */
+	TMap<FIntPoint, double> InFlightTileBuilds;
+
+	/** Unreferenced tiles still built, with the time their last reference was released. */
+	TMap<FIntPoint, double> PendingTileRemovals;
+
+	FArcNavTileSchedulerStats SchedulerStats;
+
 	/** Coarse cell size for dirty-tracking in the Mass processor (not a navmesh parameter). */
 	float CellSize = 1000.f;
 
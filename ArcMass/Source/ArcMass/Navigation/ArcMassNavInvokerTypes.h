@@ -52,6 +52,21 @@ struct FArcNavInvokerData
 	float RadiusMax = 0.f;
 	FNavAgentSelector SupportedAgents;
 	ENavigationInvokerPriority Priority = ENavigationInvokerPriority::Default;
+
+	/** Location extrapolated along Velocity. The tile footprint covers both; equal to Location when not moving. */
+	FVector PredictedLocation = FVector::ZeroVector;
+
+	/** Average velocity between the last two location updates. */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** World time at which Location was written. */
+	double LocationTime = 0.0;
+
+	/** Tiles this invoker holds a reference on. Diffs are computed against this, so refcounts stay exact. */
+	TSet<FIntPoint> OwnedTiles;
+
+	/** Set by AllocateSlot. Tells apart invokers that reuse the same slot index. */
+	uint32 Generation = 0;
 };
 
 /** Pre-computed tile diff for a single invoker that crossed a cell boundary.
@@ -59,7 +74,14 @@ struct FArcNavInvokerData
 struct FArcNavTileDiffEntry
 {
 	int32 SlotIndex = INDEX_NONE;
+
+	/** Generation of the slot the diff was computed against; the diff is dropped if the slot was reused. */
+	uint32 SlotGeneration = 0;
+
 	FVector NewLocation = FVector::ZeroVector;
+	FVector NewPredictedLocation = FVector::ZeroVector;
+	FVector NewVelocity = FVector::ZeroVector;
+	double NewLocationTime = 0.0;
 	ENavigationInvokerPriority Priority = ENavigationInvokerPriority::Default;
 	TArray<FIntPoint, TInlineAllocator<16>> TileGains;
 	TArray<FIntPoint, TInlineAllocator<16>> TileLosses;
@@ -146,4 +168,48 @@ namespace ArcNavInvoker
 			TileCoord.Y * TileDim + TileDim / 2.f, 0.f);
 		return (RelativeLocation - TileCenter).SizeSquared2D() < CheckDistSq;
 	}
+
+	/** Iterate every tile within Radius of Location or of PredictedLocation, each tile once. */
+	template<typename TCallback>
+	void ForEachTileInFootprint(
+		const FVector& Location,
+		const FVector& PredictedLocation,
+		float Radius,
+		const FVector& NavmeshOrigin,
+		float TileDim,
+		TCallback&& Callback)
+	{
+		ForEachTileInRadius(Location, Radius, NavmeshOrigin, TileDim, Callback);
+
+		if (PredictedLocation != Location)
+		{
+			ForEachTileInRadius(PredictedLocation, Radius, NavmeshOrigin, TileDim,
+				[&Location, Radius, &NavmeshOrigin, TileDim, &Callback](const FIntPoint& Tile)
+				{
+					if (!IsTileInRadius(Location, Radius, Tile, NavmeshOrigin, TileDim))
+					{
+						Callback(Tile);
+					}
+				});
+		}
+	}
+
+	/** Point-check counterpart of ForEachTileInFootprint. */
+	inline bool IsTileInFootprint(
+		const FVector& Location,
+		const FVector& PredictedLocation,
+		float Radius,
+		const FIntPoint& TileCoord,
+		const FVector& NavmeshOrigin,
+		float TileDim)
+	{
+		return IsTileInRadius(Location, Radius, TileCoord, NavmeshOrigin, TileDim)
+			|| IsTileInRadius(PredictedLocation, Radius, TileCoord, NavmeshOrigin, TileDim);
+	}
+
+	/** World-space (Z = 0) center of a tile; inverse of the RelativeLocation convention above. */
+	inline FVector GetTileCenter(const FIntPoint& TileCoord, const FVector& NavmeshOrigin, float TileDim)
+	{
+		return NavmeshOrigin - FVector(TileCoord.X * TileDim + TileDim / 2.f, TileCoord.Y * TileDim + TileDim / 2.f, 0.f);
+	}
 } // namespace ArcNavInvoker
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMass/Navigation/ArcNavInvokerCellDetectProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "MassExecutionContext.h"
 #include "MassSignalSubsystem.h"
@@ -8,6 +9,7 @@
 #include "Mass/EntityHandle.h"
 #include "ArcMass/Navigation/ArcMassNavInvokerTypes.h"
 #include "ArcMass/Navigation/ArcMassNavInvokerSubsystem.h"
+#include "ArcMass/Navigation/ArcMassNavInvokerSettings.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNavInvokerCellDetectProcessor)
 
@@ -36,14 +38,17 @@ void UArcNavInvokerCellDetectProcessor::Execute(FMassEntityManager& EntityManage
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNavInvokerCellDetect);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 	const TSparseArray<FArcNavInvokerData>& Slots = Subsystem->GetSlots();
+	const double Now = Context.GetWorld()->GetTimeSeconds();
+	const float PredictionTime = GetDefault<UArcMassNavInvokerSettings>()->PredictionTime;
 
 	TArray<FArcNavTileDiffEntry> LocalDiffs;
 	TArray<FMassEntityHandle> DirtyEntities;
 
-	EntityQuery.ForEachEntityChunk(Context, [CellSize, &Slots, &LocalDiffs, &DirtyEntities](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context, [CellSize, Now, PredictionTime, &Slots, &LocalDiffs, &DirtyEntities](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FMassNavInvokerFragment> Invokers = Ctx.GetMutableFragmentView<FMassNavInvokerFragment>();
 		TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -79,38 +84,46 @@ void UArcNavInvokerCellDetectProcessor::Execute(FMassEntityManager& EntityManage
 			const FVector NavmeshOrigin = Fragment.CachedNavmeshOrigin;
 			const FArcNavInvokerData& OldData = Slots[Fragment.InvokerIndex];
 
+			// Average velocity since the last cell change. The predicted footprint is capped at one
+			// generation radius ahead so a teleport doesn't request a line of tiles.
+			const double Elapsed = Now - OldData.LocationTime;
+			const FVector Velocity = Elapsed > UE_KINDA_SMALL_NUMBER
+				? (NewLocation - OldData.Location) / Elapsed
+				: FVector::ZeroVector;
+			const FVector PredictedLocation = NewLocation + (Velocity * PredictionTime).GetClampedToMaxSize(Fragment.GenerationRadius);
+
 			FArcNavTileDiffEntry Diff;
 			Diff.SlotIndex = Fragment.InvokerIndex;
+			Diff.SlotGeneration = OldData.Generation;
 			Diff.NewLocation = NewLocation;
+			Diff.NewPredictedLocation = PredictedLocation;
+			Diff.NewVelocity = Velocity;
+			Diff.NewLocationTime = Now;
 			Diff.Priority = Fragment.Priority;
 
-			// Pass 1: tiles gained — in new footprint but not in old
-			ArcNavInvoker::ForEachTileInRadius(
+			// Pass 1: tiles gained — in new generation footprint but not yet owned
+			ArcNavInvoker::ForEachTileInFootprint(
 				NewLocation,
+				PredictedLocation,
 				Fragment.GenerationRadius,
 				NavmeshOrigin,
 				TileDim,
-				[&OldData, &Diff, &NavmeshOrigin, TileDim](const FIntPoint& Tile)
+				[&OldData, &Diff](const FIntPoint& Tile)
 				{
-					if (!ArcNavInvoker::IsTileInRadius(OldData.Location, OldData.RadiusMin, Tile, NavmeshOrigin, TileDim))
+					if (!OldData.OwnedTiles.Contains(Tile))
 					{
 						Diff.TileGains.Add(Tile);
 					}
 				});
 
-			// Pass 2: tiles lost — in old removal radius but outside new removal radius (hysteresis)
-			ArcNavInvoker::ForEachTileInRadius(
-				OldData.Location,
-				OldData.RadiusMax,
-				NavmeshOrigin,
-				TileDim,
-				[&NewLocation, &Fragment, &Diff, &NavmeshOrigin, TileDim](const FIntPoint& Tile)
+			// Pass 2: tiles lost — owned but outside the new removal footprint (spatial hysteresis)
+			for (const FIntPoint& Tile : OldData.OwnedTiles)
+			{
+				if (!ArcNavInvoker::IsTileInFootprint(NewLocation, PredictedLocation, Fragment.RemovalRadius, Tile, NavmeshOrigin, TileDim))
 				{
-					if (!ArcNavInvoker::IsTileInRadius(NewLocation, Fragment.RemovalRadius, Tile, NavmeshOrigin, TileDim))
-					{
-						Diff.TileLosses.Add(Tile);
-					}
-				});
+					Diff.TileLosses.Add(Tile);
+				}
+			}
 
 			if (Diff.TileGains.Num() > 0 || Diff.TileLosses.Num() > 0)
 			{
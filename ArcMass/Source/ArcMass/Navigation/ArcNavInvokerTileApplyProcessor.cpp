@@ -4,8 +4,6 @@
 
 #include "MassExecutionContext.h"
 #include "MassSignalSubsystem.h"
-#include "NavMesh/RecastNavMesh.h"
-#include "AI/Navigation/NavigationInvokerPriority.h"
 #include "ArcMass/Navigation/ArcMassNavInvokerTypes.h"
 #include "ArcMass/Navigation/ArcMassNavInvokerSubsystem.h"
 
@@ -49,86 +47,6 @@ void UArcNavInvokerTileApplyProcessor::SignalEntities(
 		return;
 	}
 
-	// Merge all tile changes across entities into batch operations.
-	// Track per-tile refcount deltas and highest priority for gained tiles.
-	struct FTileDeltaEntry
-	{
-		int32 Delta = 0;
-		ENavigationInvokerPriority Priority = ENavigationInvokerPriority::Default;
-	};
-	TMap<FIntPoint, FTileDeltaEntry> TileDelta;
-
-	for (const FArcNavTileDiffEntry& Diff : Diffs)
-	{
-		for (const FIntPoint& Tile : Diff.TileGains)
-		{
-			FTileDeltaEntry& Entry = TileDelta.FindOrAdd(Tile);
-			Entry.Delta += 1;
-			if (Diff.Priority > Entry.Priority)
-			{
-				Entry.Priority = Diff.Priority;
-			}
-		}
-		for (const FIntPoint& Tile : Diff.TileLosses)
-		{
-			TileDelta.FindOrAdd(Tile).Delta -= 1;
-		}
-	}
-
-	// Read current refcounts, compute which tiles are truly new or truly removed
-	TArray<FNavMeshDirtyTileElement> TilesToRebuild;
-	TArray<FIntPoint> TilesToRemove;
-	TilesToRebuild.Reserve(TileDelta.Num());
-	TilesToRemove.Reserve(TileDelta.Num());
-
-	const TMap<FIntPoint, int32>& CurrentRefCounts = Subsystem->GetTileRefCounts();
-
-	for (const TPair<FIntPoint, FTileDeltaEntry>& DeltaEntry : TileDelta)
-	{
-		if (DeltaEntry.Value.Delta == 0)
-		{
-			continue; // net-zero: tile gained by one entity, lost by another
-		}
-
-		const FIntPoint& Tile = DeltaEntry.Key;
-		const int32 Delta = DeltaEntry.Value.Delta;
-
-		const int32* CurrentCount = CurrentRefCounts.Find(Tile);
-		const int32 OldCount = (CurrentCount != nullptr) ? *CurrentCount : 0;
-		const int32 NewCount = OldCount + Delta;
-
-		if (OldCount == 0 && NewCount > 0)
-		{
-			FNavMeshDirtyTileElement Element;
-			Element.Coordinates = Tile;
-			Element.InvokerDistanceSquared = 0.f;
-			Element.InvokerPriority = DeltaEntry.Value.Priority;
-			TilesToRebuild.Add(Element);
-		}
-		else if (OldCount > 0 && NewCount <= 0)
-		{
-			TilesToRemove.Add(Tile);
-		}
-	}
-
-	// Apply refcount changes and update slot locations
-	for (const FArcNavTileDiffEntry& Diff : Diffs)
-	{
-		for (const FIntPoint& Tile : Diff.TileGains)
-		{
-			Subsystem->IncrementTileRefCount(Tile);
-		}
-		for (const FIntPoint& Tile : Diff.TileLosses)
-		{
-			Subsystem->DecrementTileRefCount(Tile);
-		}
-
-		Subsystem->UpdateSlotLocation(Diff.SlotIndex, Diff.NewLocation);
-	}
-
-	// Single batched navmesh operations
-	if (TilesToRebuild.Num() > 0 || TilesToRemove.Num() > 0)
-	{
-		Subsystem->ApplyBatchedTileChanges(TilesToRebuild, TilesToRemove);
-	}
+	// Refcount transitions are queued on the subsystem; its tile scheduler decides when Recast sees them.
+	Subsystem->ApplySlotDiffs(Diffs);
 }
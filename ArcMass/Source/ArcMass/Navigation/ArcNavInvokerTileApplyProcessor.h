@@ -8,7 +8,8 @@
 
 /**
  * Signal-based processor that consumes pre-computed tile diffs from the parallel
- * cell-detect processor and applies them to the navmesh in a single batched pass.
+ * cell-detect processor and applies them to the subsystem's tile refcounts. Navmesh
+ * builds and removals are then scheduled by UArcMassNavInvokerSubsystem::Tick.
  * Only fires when entities have crossed cell boundaries (zero cost on quiet frames).
  */
 UCLASS()
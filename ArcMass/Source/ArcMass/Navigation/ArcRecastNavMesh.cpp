@@ -33,8 +33,7 @@ void AArcRecastNavMesh::RemoveTiles(const TArray<FIntPoint>& Tiles)
 		return;
 	}
 
-	const TMap<FIntPoint, int32>& RefCounts = Subsystem->GetTileRefCounts();
-	if (RefCounts.Num() == 0)
+	if (Subsystem->GetTileRefCounts().Num() == 0 && Subsystem->GetPendingTileRemovals().Num() == 0)
 	{
 		Super::RemoveTiles(Tiles);
 		return;
@@ -44,7 +43,7 @@ void AArcRecastNavMesh::RemoveTiles(const TArray<FIntPoint>& Tiles)
 	bool bHasProtectedTile = false;
 	for (const FIntPoint& Tile : Tiles)
 	{
-		if (RefCounts.Contains(Tile))
+		if (Subsystem->IsTileProtected(Tile))
 		{
 			bHasProtectedTile = true;
 			break;
@@ -61,7 +60,7 @@ void AArcRecastNavMesh::RemoveTiles(const TArray<FIntPoint>& Tiles)
 	FilteredTiles.Reserve(Tiles.Num());
 	for (const FIntPoint& Tile : Tiles)
 	{
-		if (!RefCounts.Contains(Tile))
+		if (!Subsystem->IsTileProtected(Tile))
 		{
 			FilteredTiles.Add(Tile);
 		}
@@ -92,14 +91,20 @@ void AArcRecastNavMesh::UpdateActiveTiles(const TArray<FNavigationInvokerRaw>& I
 	}
 
 	const TMap<FIntPoint, int32>& RefCounts = Subsystem->GetTileRefCounts();
-	if (RefCounts.Num() == 0)
+	const TMap<FIntPoint, double>& PendingRemovals = Subsystem->GetPendingTileRemovals();
+	if (RefCounts.Num() == 0 && PendingRemovals.Num() == 0)
 	{
 		return;
 	}
 
+	// Tiles waiting out their removal delay are still built and must stay active too.
 	TSet<FIntPoint>& ActiveTiles = GetActiveTileSet();
 	for (const TPair<FIntPoint, int32>& TileEntry : RefCounts)
 	{
 		ActiveTiles.Add(TileEntry.Key);
 	}
+	for (const TPair<FIntPoint, double>& TileEntry : PendingRemovals)
+	{
+		ActiveTiles.Add(TileEntry.Key);
+	}
 }
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcNiagaraBatchVisProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcNiagaraBatchVisFragments.h"
 #include "Mass/EntityFragments.h"
@@ -55,6 +56,7 @@ void UArcNiagaraBatchVisProcessor::Execute(FMassEntityManager& EntityManager, FM
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNiagaraBatchVis);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	// -----------------------------------------------------------------------
 	// Phase 1: Clear all position buffers (Reset keeps allocation)
@@ -70,7 +72,7 @@ void UArcNiagaraBatchVisProcessor::Execute(FMassEntityManager& EntityManager, FM
 	// Each chunk shares a const shared fragment (same archetype = same config).
 	// Different chunks may have different configs → different batches.
 	// -----------------------------------------------------------------------
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[this, World](FMassExecutionContext& Ctx)
 		{
 			const FArcNiagaraBatchVisConfigFragment& Config =
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcNiagaraVisProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcNiagaraVisFragments.h"
 #include "ArcNiagaraRenderStateHelper.h"
@@ -37,8 +38,9 @@ void UArcNiagaraVisInitObserver::Execute(FMassEntityManager& EntityManager, FMas
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNiagaraVisInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, World](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcNiagaraVisFragment> VisFragments = Ctx.GetMutableFragmentView<FArcNiagaraVisFragment>();
@@ -95,8 +97,9 @@ void UArcNiagaraVisDeinitObserver::ConfigureQueries(const TSharedRef<FMassEntity
 void UArcNiagaraVisDeinitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNiagaraVisDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcNiagaraVisFragment> VisFragments = Ctx.GetMutableFragmentView<FArcNiagaraVisFragment>();
@@ -141,8 +144,9 @@ void UArcNiagaraVisDynamicDataProcessor::ConfigureQueries(const TSharedRef<FMass
 void UArcNiagaraVisDynamicDataProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNiagaraVisDynamicData);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[](FMassExecutionContext& Ctx)
 		{
 			const TConstArrayView<FArcNiagaraVisFragment> VisFragments = Ctx.GetFragmentView<FArcNiagaraVisFragment>();
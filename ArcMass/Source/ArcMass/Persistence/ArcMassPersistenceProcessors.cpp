@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMass/Persistence/ArcMassPersistenceProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMass/Persistence/ArcMassPersistence.h"
 #include "ArcMass/Persistence/ArcMassEntityPersistenceSubsystem.h"
 #include "MassCommonFragments.h"
@@ -40,10 +41,11 @@ void UArcMassPersistenceSourceTrackingProcessor::Execute(
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPersistenceSourceTracking);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FVector> SourcePositions;
 
-	SourceQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(SourceQuery, Context,
 		[&SourcePositions](FMassExecutionContext& Ctx)
 		{
 			const auto Transforms =
@@ -98,10 +100,11 @@ void UArcMassPersistenceCellTrackingProcessor::Execute(
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPersistenceCellTracking);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const float CellSize = Subsystem->GetCellSize();
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, CellSize](FMassExecutionContext& Ctx)
 		{
 			const auto Transforms =
@@ -160,8 +163,9 @@ void UArcMassPersistenceInitObserver::Execute(
 	const float CellSize = Subsystem ? Subsystem->GetCellSize() : 10000.f;
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPersistenceInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem, CellSize](FMassExecutionContext& Ctx)
 		{
 			const auto Transforms =
@@ -244,8 +248,9 @@ void UArcMassPersistenceDeinitObserver::Execute(
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPersistenceDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[Subsystem](FMassExecutionContext& Ctx)
 		{
 			const TConstArrayView<FArcMassPersistenceFragment> PersistFragments =
@@ -1,8 +1,10 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassPhysicsBodyActivateProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassPhysicsBody.h"
 #include "ArcMassPhysicsBodyConfig.h"
+#include "ArcMassPhysicsBodyPool.h"
 #include "ArcMassPhysicsEntityLink.h"
 #include "ArcMassPhysicsSimulation.h"
 #include "MassCommonFragments.h"
@@ -45,6 +47,7 @@ void UArcMassPhysicsBodyActivateProcessor::SignalEntities(
 	FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPhysicsBodyActivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	UWorld* World = EntityManager.GetWorld();
 	if (!World)
@@ -58,10 +61,12 @@ void UArcMassPhysicsBodyActivateProcessor::SignalEntities(
 		return;
 	}
 
+	UArcMassPhysicsBodyPoolSubsystem* BodyPool = World->GetSubsystem<UArcMassPhysicsBodyPoolSubsystem>();
+
 	TArray<FMassEntityHandle> EntitiesToReSignal;
 
-	EntityQuery.ForEachEntityChunk(Context,
-		[&EntityManager, PhysScene, &EntitiesToReSignal](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context,
+		[&EntityManager, PhysScene, BodyPool, &EntitiesToReSignal](FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
 			TArrayView<FArcMassPhysicsBodyFragment> BodyFragments = Ctx.GetMutableFragmentView<FArcMassPhysicsBodyFragment>();
@@ -82,30 +87,57 @@ void UArcMassPhysicsBodyActivateProcessor::SignalEntities(
 			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
 				FArcMassPhysicsBodyFragment& BodyFrag = BodyFragments[EntityIt];
+				if (BodyPool)
+				{
+					// Back in range before the release delay ran out: the body is still live.
+					BodyPool->CancelRelease(Ctx.GetEntity(EntityIt));
+				}
+
 				if (BodyFrag.Body)
 				{
 					continue;
 				}
 
+				if (BodyPool)
+				{
+					BodyFrag.Body = BodyPool->AcquireBody(PhysicsConfig, Transforms[EntityIt].GetTransform());
+					if (BodyFrag.Body)
+					{
+						continue;
+					}
+				}
+
 				BatchTransforms.Add(Transforms[EntityIt].GetTransform());
 				BatchIndices.Add(*EntityIt);
 			}
 
-			if (BatchTransforms.Num() == 0)
+			// Pool misses create new bodies in one batched scene insertion, up to the frame budget.
+			// The rest retry next frame.
+			const int32 NumToCreate = BodyPool ? BodyPool->ConsumeCreationBudget(BatchIndices.Num()) : BatchIndices.Num();
+			if (NumToCreate < BatchIndices.Num())
 			{
-				return;
+				for (int32 BatchIdx = NumToCreate; BatchIdx < BatchIndices.Num(); ++BatchIdx)
+				{
+					EntitiesToReSignal.Add(Ctx.GetEntity(BatchIndices[BatchIdx]));
+				}
+				BodyPool->NotifyDeferred(BatchIndices.Num() - NumToCreate);
+				BatchTransforms.SetNum(NumToCreate);
+				BatchIndices.SetNum(NumToCreate);
 			}
 
-			TArray<FBodyInstance*> Bodies;
-			UE::ArcMass::Physics::InitBodiesFromConfig(PhysicsConfig, BatchTransforms, PhysScene, Bodies);
-
-			for (int32 BatchIdx = 0; BatchIdx < BatchIndices.Num(); ++BatchIdx)
+			if (BatchTransforms.Num() > 0)
 			{
-				int32 EntityIdx = BatchIndices[BatchIdx];
-				FBodyInstance* Body = Bodies.IsValidIndex(BatchIdx) ? Bodies[BatchIdx] : nullptr;
-				if (Body)
+				TArray<FBodyInstance*> Bodies;
+				UE::ArcMass::Physics::InitBodiesFromConfig(PhysicsConfig, BatchTransforms, PhysScene, Bodies);
+
+				for (int32 BatchIdx = 0; BatchIdx < BatchIndices.Num(); ++BatchIdx)
 				{
-					BodyFragments[EntityIdx].Body = Body;
+					int32 EntityIdx = BatchIndices[BatchIdx];
+					FBodyInstance* Body = Bodies.IsValidIndex(BatchIdx) ? Bodies[BatchIdx] : nullptr;
+					if (Body)
+					{
+						BodyFragments[EntityIdx].Body = Body;
+					}
 				}
 			}
 
@@ -1,7 +1,10 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassPhysicsBodyDeactivateProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassPhysicsBody.h"
+#include "ArcMassPhysicsBodyConfig.h"
+#include "ArcMassPhysicsBodyPool.h"
 #include "ArcMassPhysicsEntityLink.h"
 #include "ArcMassPhysicsSimulation.h"
 #include "MassExecutionContext.h"
@@ -26,11 +29,13 @@ void UArcMassPhysicsBodyDeactivateProcessor::InitializeInternal(
 
 	UMassSignalSubsystem* SignalSubsystem = UWorld::GetSubsystem<UMassSignalSubsystem>(Owner.GetWorld());
 	SubscribeToSignal(*SignalSubsystem, UE::ArcMass::Signals::PhysicsBodyReleased);
+	SubscribeToSignal(*SignalSubsystem, UE::ArcMass::Signals::PhysicsBodyReleaseDue);
 }
 
 void UArcMassPhysicsBodyDeactivateProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	EntityQuery.AddRequirement<FArcMassPhysicsBodyFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FArcMassPhysicsBodyConfigFragment>(EMassFragmentPresence::Optional);
 }
 
 void UArcMassPhysicsBodyDeactivateProcessor::SignalEntities(
@@ -39,14 +44,24 @@ void UArcMassPhysicsBodyDeactivateProcessor::SignalEntities(
 	FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPhysicsBodyDeactivate);
+	FArcMassProcessorStatsScope Stats(*this);
+
+	UWorld* World = EntityManager.GetWorld();
+	UArcMassPhysicsBodyPoolSubsystem* BodyPool = World ? World->GetSubsystem<UArcMassPhysicsBodyPoolSubsystem>() : nullptr;
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
 
 	TArray<FBodyInstance::FAsyncTermBodyPayload> Payloads;
+	TArray<FMassEntityHandle> DelayedReleases;
+	float ReleaseDelay = 0.f;
+	TArray<FName> SignalsForEntity;
 
-	EntityQuery.ForEachEntityChunk(Context,
-		[&Payloads](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context,
+		[&Payloads, &DelayedReleases, &ReleaseDelay, &SignalsForEntity, &EntitySignals, BodyPool, Now](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcMassPhysicsBodyFragment> BodyFragments =
 				Ctx.GetMutableFragmentView<FArcMassPhysicsBodyFragment>();
+			const FArcMassPhysicsBodyConfigFragment* PhysicsConfig =
+				Ctx.GetConstSharedFragmentPtr<FArcMassPhysicsBodyConfigFragment>();
 
 			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
@@ -56,6 +71,33 @@ void UArcMassPhysicsBodyDeactivateProcessor::SignalEntities(
 					continue;
 				}
 
+				if (BodyPool && PhysicsConfig)
+				{
+					const FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
+					SignalsForEntity.Reset();
+					EntitySignals.GetSignalsForEntity(Entity, SignalsForEntity);
+
+					// A new release restarts the delay; a due signal only counts if nothing re-requested the body meanwhile.
+					if (SignalsForEntity.Contains(UE::ArcMass::Signals::PhysicsBodyReleased))
+					{
+						const float Delay = BodyPool->QueueRelease(Entity, Now);
+						if (Delay > 0.f)
+						{
+							DelayedReleases.Add(Entity);
+							ReleaseDelay = Delay;
+							continue;
+						}
+					}
+					else if (!BodyPool->ConsumeDueRelease(Entity, Now))
+					{
+						continue;
+					}
+
+					BodyPool->ReleaseBody(*PhysicsConfig, BodyFrag.Body, Payloads);
+					BodyFrag.Body = nullptr;
+					continue;
+				}
+
 				FBodyInstance::FAsyncTermBodyPayload Payload = BodyFrag.Body->StartAsyncTermBody_GameThread();
 				if (Payload.GetPhysicsActor())
 				{
@@ -67,4 +109,17 @@ void UArcMassPhysicsBodyDeactivateProcessor::SignalEntities(
 		});
 
 	UE::ArcMass::Physics::AsyncTermBodies(MoveTemp(Payloads));
+
+	if (BodyPool)
+	{
+		BodyPool->PruneStaleReleases(Now);
+	}
+
+	if (DelayedReleases.Num() > 0 && World)
+	{
+		if (UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>())
+		{
+			SignalSubsystem->DelaySignalEntities(UE::ArcMass::Signals::PhysicsBodyReleaseDue, DelayedReleases, ReleaseDelay);
+		}
+	}
 }
@@ -0,0 +1,192 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcMassPhysicsBodyPool.h"
+#include "ArcMassPhysicsBodyConfig.h"
+#include "ArcMassPhysicsEntityLink.h"
+#include "ArcMassPhysicsSettings.h"
+#include "Chaos/ChaosUserEntity.h"
+#include "Physics/PhysicsInterfaceCore.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcMassPhysicsBodyPool)
+
+namespace UE::ArcMass::Physics::Private
+{
+	/** Queued releases this far past due belong to destroyed entities. */
+	constexpr double StaleReleaseMargin = 5.0;
+
+	/** Delayed signals can land a fraction of a frame before the recorded due time. */
+	constexpr double DueTolerance = 0.05;
+}
+
+void UArcMassPhysicsBodyPoolSubsystem::Deinitialize()
+{
+	TArray<FBodyInstance::FAsyncTermBodyPayload> Payloads;
+	for (TPair<FPoolKey, TArray<FBodyInstance*>>& Pair : FreeBodies)
+	{
+		for (FBodyInstance* Body : Pair.Value)
+		{
+			FBodyInstance::FAsyncTermBodyPayload Payload = Body->StartAsyncTermBody_GameThread();
+			if (Payload.GetPhysicsActor())
+			{
+				Payloads.Add(MoveTemp(Payload));
+			}
+			delete Body;
+		}
+	}
+	FreeBodies.Empty();
+	PendingReleases.Empty();
+
+	UE::ArcMass::Physics::AsyncTermBodies(MoveTemp(Payloads));
+
+	Super::Deinitialize();
+}
+
+UArcMassPhysicsBodyPoolSubsystem::FPoolKey UArcMassPhysicsBodyPoolSubsystem::MakeKey(const FArcMassPhysicsBodyConfigFragment& Config)
+{
+	FPoolKey Key;
+	Key.BodySetup = Config.BodySetup.Get();
+	Key.BodyType = Config.BodyType;
+	return Key;
+}
+
+FBodyInstance* UArcMassPhysicsBodyPoolSubsystem::AcquireBody(const FArcMassPhysicsBodyConfigFragment& Config, const FTransform& Transform)
+{
+	TArray<FBodyInstance*>* Pool = FreeBodies.Find(MakeKey(Config));
+	while (Pool && Pool->Num() > 0)
+	{
+		FBodyInstance* Body = Pool->Pop(EAllowShrinking::No);
+		if (!FPhysicsInterface::IsValid(Body->GetPhysicsActor()))
+		{
+			delete Body;
+			continue;
+		}
+
+		Body->SetBodyTransform(Transform, ETeleportType::TeleportPhysics);
+
+		// The body keeps the scale and collision setup of its previous owner; entities sharing a body setup
+		// can differ in both.
+		if (Body->UpdateBodyScale(Transform.GetScale3D()) && Config.BodyType != EArcMassPhysicsBodyType::Static)
+		{
+			Body->UpdateMassProperties();
+		}
+		Body->SetObjectType(Config.BodyTemplate.GetObjectType());
+		Body->SetResponseToChannels(Config.BodyTemplate.GetResponseToChannels());
+		Body->SetCollisionEnabled(Config.BodyTemplate.GetCollisionEnabled());
+		++Stats.Hits;
+		return Body;
+	}
+
+	return nullptr;
+}
+
+void UArcMassPhysicsBodyPoolSubsystem::ReleaseBody(const FArcMassPhysicsBodyConfigFragment& Config, FBodyInstance* Body,
+	TArray<FBodyInstance::FAsyncTermBodyPayload>& OutTermPayloads)
+{
+	if (!Body)
+	{
+		return;
+	}
+
+	TArray<FBodyInstance*>& Pool = FreeBodies.FindOrAdd(MakeKey(Config));
+	const FPhysicsActorHandle ActorHandle = Body->GetPhysicsActor();
+	if (!ActorHandle || Pool.Num() >= GetDefault<UArcMassPhysicsSettings>()->MaxPooledBodiesPerShape)
+	{
+		FBodyInstance::FAsyncTermBodyPayload Payload = Body->StartAsyncTermBody_GameThread();
+		if (Payload.GetPhysicsActor())
+		{
+			OutTermPayloads.Add(MoveTemp(Payload));
+		}
+		delete Body;
+		++Stats.Terminated;
+		return;
+	}
+
+	// The body stays in the scene; without collision it is invisible to queries and contacts.
+	if (Body->IsInstanceSimulatingPhysics())
+	{
+		Body->SetInstanceSimulatePhysics(false);
+	}
+	Body->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	void* UserData = ActorHandle->GetGameThreadAPI().UserData();
+	if (FChaosUserEntityAppend* Append = FChaosUserData::Get<FChaosUserEntityAppend>(UserData))
+	{
+		ArcMassPhysicsEntityLink::Detach(*Body, Append);
+	}
+
+	Pool.Add(Body);
+	++Stats.Recycled;
+}
+
+int32 UArcMassPhysicsBodyPoolSubsystem::ConsumeCreationBudget(int32 Requested)
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		CreationsThisFrame = 0;
+	}
+
+	const int32 Budget = GetDefault<UArcMassPhysicsSettings>()->MaxBodyCreationsPerFrame;
+	const int32 Granted = FMath::Clamp(Budget - CreationsThisFrame, 0, Requested);
+	CreationsThisFrame += Granted;
+	Stats.Created += Granted;
+	return Granted;
+}
+
+float UArcMassPhysicsBodyPoolSubsystem::QueueRelease(const FMassEntityHandle& Entity, double Now)
+{
+	const float Delay = GetDefault<UArcMassPhysicsSettings>()->ReleaseDelay;
+	if (Delay <= 0.f)
+	{
+		PendingReleases.Remove(Entity);
+		return 0.f;
+	}
+
+	PendingReleases.Add(Entity, Now + Delay);
+	return Delay;
+}
+
+bool UArcMassPhysicsBodyPoolSubsystem::CancelRelease(const FMassEntityHandle& Entity)
+{
+	if (PendingReleases.Remove(Entity) > 0)
+	{
+		++Stats.ReleasesCancelled;
+		return true;
+	}
+	return false;
+}
+
+bool UArcMassPhysicsBodyPoolSubsystem::ConsumeDueRelease(const FMassEntityHandle& Entity, double Now)
+{
+	const double* DueTime = PendingReleases.Find(Entity);
+	if (!DueTime || *DueTime > Now + UE::ArcMass::Physics::Private::DueTolerance)
+	{
+		return false;
+	}
+
+	PendingReleases.Remove(Entity);
+	return true;
+}
+
+void UArcMassPhysicsBodyPoolSubsystem::PruneStaleReleases(double Now)
+{
+	for (TMap<FMassEntityHandle, double>::TIterator It = PendingReleases.CreateIterator(); It; ++It)
+	{
+		if (It.Value() + UE::ArcMass::Physics::Private::StaleReleaseMargin < Now)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 UArcMassPhysicsBodyPoolSubsystem::GetNumPooledBodies() const
+{
+	int32 Total = 0;
+	for (const TPair<FPoolKey, TArray<FBodyInstance*>>& Pair : FreeBodies)
+	{
+		Total += Pair.Value.Num();
+	}
+	return Total;
+}
@@ -0,0 +1,112 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ArcMassPhysicsBody.h"
+#include "Mass/EntityHandle.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ArcMassPhysicsBodyPool.generated.h"
+
+class UBodySetup;
+struct FArcMassPhysicsBodyConfigFragment;
+
+/** Body pool counters, summed over every shape. */
+struct FArcMassPhysicsBodyPoolStats
+{
+	/** Activations served by a pooled body. */
+	int64 Hits = 0;
+
+	/** Activations that created a new Chaos body. */
+	int64 Created = 0;
+
+	/** Activations pushed to a later frame by the creation budget. */
+	int64 Deferred = 0;
+
+	/** Releases cancelled because the entity asked for physics again within the release delay. */
+	int64 ReleasesCancelled = 0;
+
+	/** Released bodies parked in the pool. */
+	int64 Recycled = 0;
+
+	/** Released bodies terminated because their pool was full. */
+	int64 Terminated = 0;
+};
+
+/**
+ * Keeps Chaos bodies of Mass physics entities alive across activation changes.
+ *
+ * Released bodies are not removed from the scene. Their collision is disabled, the entity link is detached
+ * and they wait in a per-shape pool (body setup + body type) until an entity of the same shape activates,
+ * which teleports the body, rescales it and re-applies the template's collision settings. Releases are delayed by
+ * UArcMassPhysicsSettings::ReleaseDelay so entities flickering at the edge of physics range keep their
+ * body, and new bodies are created under a per-frame budget.
+ *
+ * Driven by UArcMassPhysicsBodyActivateProcessor and UArcMassPhysicsBodyDeactivateProcessor. Game thread only.
+ */
+UCLASS()
+class ARCMASS_API UArcMassPhysicsBodyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * Take a pooled body for Config's shape, move and scale it to Transform and reset its object type,
+	 * channel responses and collision from Config.BodyTemplate. Null if the pool is empty.
+	 */
+	FBodyInstance* AcquireBody(const FArcMassPhysicsBodyConfigFragment& Config, const FTransform& Transform);
+
+	/**
+	 * Disable Body and park it in the pool for Config's shape. If that pool is full the body is terminated
+	 * and its payload appended to OutTermPayloads.
+	 */
+	void ReleaseBody(const FArcMassPhysicsBodyConfigFragment& Config, FBodyInstance* Body, TArray<FBodyInstance::FAsyncTermBodyPayload>& OutTermPayloads);
+
+	/** Grant up to Requested body creations from this frame's budget. Returns how many may be created. */
+	int32 ConsumeCreationBudget(int32 Requested);
+
+	/** Start the release delay for Entity. Returns the delay in seconds, 0 if the body should be released now. */
+	float QueueRelease(const FMassEntityHandle& Entity, double Now);
+
+	/** Drop a queued release. Returns true if one was pending. */
+	bool CancelRelease(const FMassEntityHandle& Entity);
+
+	/** True, and forgets the entry, if Entity's queued release is due. */
+	bool ConsumeDueRelease(const FMassEntityHandle& Entity, double Now);
+
+	/** Forget queued releases long past due; their entities were destroyed before the release ran. */
+	void PruneStaleReleases(double Now);
+
+	void NotifyDeferred(int32 Count) { Stats.Deferred += Count; }
+
+	const FArcMassPhysicsBodyPoolStats& GetStats() const { return Stats; }
+
+	/** Disabled bodies currently pooled, over every shape. */
+	int32 GetNumPooledBodies() const;
+
+private:
+	struct FPoolKey
+	{
+		TObjectKey<UBodySetup> BodySetup;
+		EArcMassPhysicsBodyType BodyType = EArcMassPhysicsBodyType::Static;
+
+		bool operator==(const FPoolKey& Other) const { return BodySetup == Other.BodySetup && BodyType == Other.BodyType; }
+		friend uint32 GetTypeHash(const FPoolKey& Key) { return HashCombine(GetTypeHash(Key.BodySetup), GetTypeHash(Key.BodyType)); }
+	};
+
+	static FPoolKey MakeKey(const FArcMassPhysicsBodyConfigFragment& Config);
+
+	TMap<FPoolKey, TArray<FBodyInstance*>> FreeBodies;
+
+	/** Entity -> world time its release is due. */
+	TMap<FMassEntityHandle, double> PendingReleases;
+
+	uint64 BudgetFrame = 0;
+	int32 CreationsThisFrame = 0;
+
+	FArcMassPhysicsBodyPoolStats Stats;
+};
@@ -0,0 +1,30 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ArcMassPhysicsSettings.generated.h"
+
+/** Body streaming for Mass physics entities (UArcMassPhysicsBodyPoolSubsystem). */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "ArcMass Physics"))
+class ARCMASS_API UArcMassPhysicsSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	virtual FName GetCategoryName() const override { return FName("ArcMass"); }
+	virtual FName GetSectionName() const override { return FName("Physics"); }
+
+	/** New Chaos bodies created per frame. Pool hits are not counted. Entities over budget are retried next frame. */
+	UPROPERTY(config, EditAnywhere, Category = "Streaming", meta = (ClampMin = "1"))
+	int32 MaxBodyCreationsPerFrame = 64;
+
+	/** Seconds a released body stays active. An entity requesting physics again within this time keeps its body. */
+	UPROPERTY(config, EditAnywhere, Category = "Streaming", meta = (ClampMin = "0.0"))
+	float ReleaseDelay = 2.f;
+
+	/** Disabled bodies kept per shape for reuse. Released bodies beyond this are terminated. */
+	UPROPERTY(config, EditAnywhere, Category = "Streaming", meta = (ClampMin = "0"))
+	int32 MaxPooledBodiesPerShape = 256;
+};
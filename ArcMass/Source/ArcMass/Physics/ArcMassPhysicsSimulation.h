@@ -13,6 +13,8 @@ namespace UE::ArcMass::Signals
 	inline const FName PhysicsBodySlept = FName(TEXT("ArcMassPhysicsBodySlept"));
 	inline const FName PhysicsBodyRequested = FName(TEXT("ArcMassPhysicsBodyRequested"));
 	inline const FName PhysicsBodyReleased = FName(TEXT("ArcMassPhysicsBodyReleased"));
+	/** Delayed follow-up of PhysicsBodyReleased, sent once the release delay has passed. */
+	inline const FName PhysicsBodyReleaseDue = FName(TEXT("ArcMassPhysicsBodyReleaseDue"));
 }
 
 /** Sparse tag — entity's transform is owned by Chaos physics simulation.
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassPhysicsTransformSyncProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassPhysicsBody.h"
 #include "ArcMassPhysicsSimulation.h"
 #include "MassCommonFragments.h"
@@ -40,17 +41,25 @@ void UArcMassPhysicsTransformSyncProcessor::Execute(
 	UMassSignalSubsystem* SignalSubsystem = Context.GetWorld()->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassPhysicsTransformSync);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	TArray<FMassEntityHandle> EntitiesToStopSimulating;
 	TArray<FMassEntityHandle> EntitiesToSignal;
 	TArray<FMassEntityHandle> EntitiesToSleep;
+	TArray<FBodyInstance*> BodiesToSleep;
+	FCriticalSection ResultsLock;
 
-	EntityQuery.ForEachEntityChunk(Context,
-		[&EntitiesToStopSimulating, &EntitiesToSignal, &EntitiesToSleep](FMassExecutionContext& Ctx)
+	// Chunks only read their own bodies' game-thread particle state and write their own transforms, so
+	// they run in parallel. Sleep handling changes the body and waits for the game thread below.
+	Stats.ParallelForEachEntityChunk(EntityQuery, Context,
+		[&EntitiesToSignal, &EntitiesToSleep, &BodiesToSleep, &ResultsLock](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FTransformFragment> Transforms = Ctx.GetMutableFragmentView<FTransformFragment>();
 			TConstArrayView<FArcMassPhysicsBodyFragment> Bodies = Ctx.GetFragmentView<FArcMassPhysicsBodyFragment>();
 
+			TArray<FMassEntityHandle, TInlineAllocator<64>> ChunkUpdated;
+			TArray<FMassEntityHandle, TInlineAllocator<16>> ChunkSleeping;
+			TArray<FBodyInstance*, TInlineAllocator<16>> ChunkSleepingBodies;
+
 			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 			{
 				const FArcMassPhysicsBodyFragment& BodyFrag = Bodies[EntityIt];
@@ -64,17 +73,32 @@ void UArcMassPhysicsTransformSyncProcessor::Execute(
 				Transforms[EntityIt].GetMutableTransform() = PhysicsTransform;
 
 				FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
-				EntitiesToSignal.Add(Entity);
+				ChunkUpdated.Add(Entity);
 
 				if (!BodyFrag.Body->IsInstanceAwake())
 				{
-					BodyFrag.Body->SetInstanceSimulatePhysics(false);
-					EntitiesToStopSimulating.Add(Entity);
-					EntitiesToSleep.Add(Entity);
+					ChunkSleeping.Add(Entity);
+					ChunkSleepingBodies.Add(BodyFrag.Body);
 				}
 			}
+
+			if (ChunkUpdated.Num() > 0)
+			{
+				FScopeLock Lock(&ResultsLock);
+				EntitiesToSignal.Append(ChunkUpdated);
+				EntitiesToSleep.Append(ChunkSleeping);
+				BodiesToSleep.Append(ChunkSleepingBodies);
+			}
 		});
 
+	for (FBodyInstance* Body : BodiesToSleep)
+	{
+		Body->SetInstanceSimulatePhysics(false);
+	}
+
+	// Sleeping bodies return to kinematic and stop owning the transform.
+	TArray<FMassEntityHandle> EntitiesToStopSimulating = EntitiesToSleep;
+
 	if (EntitiesToStopSimulating.Num() > 0)
 	{
 		EntityManager.Defer().PushCommand<FMassDeferredCommand<EMassCommandOperationType::Remove>>([Entities = MoveTemp(EntitiesToStopSimulating)](FMassEntityManager& Mgr)
@@ -10,6 +10,9 @@
  * PostPhysics processor that syncs Chaos body transforms back to FTransformFragment
  * for entities with FArcMassPhysicsSimulatingTag. Detects body sleep and restores
  * kinematic mode, removing the sparse tag.
+ *
+ * Transforms are read and written in parallel over chunks; the kinematic switch for sleeping
+ * bodies and the signals run on the game thread afterwards.
  */
 UCLASS()
 class ARCMASS_API UArcMassPhysicsTransformSyncProcessor : public UMassProcessor
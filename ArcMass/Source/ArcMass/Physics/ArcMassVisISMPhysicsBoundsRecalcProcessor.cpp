@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassVisISMPhysicsBoundsRecalcProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassPhysicsSimulation.h"
 #include "ArcMassPhysicsTransformSyncProcessor.h"
 #include "ArcMass/Visualization/ArcMassEntityVisualization.h"
@@ -55,11 +56,12 @@ void UArcMassVisISMPhysicsBoundsRecalcProcessor::SignalEntities(
 	FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassVisISMPhysicsBoundsRecalc);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TSet<FMassEntityHandle> DirtyHolders;
 
 	// Pass 1: gather unique holder entities (multithreaded-safe, no game-thread deps)
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, &DirtyHolders](FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FArcVisISMInstanceFragment> ISMInstances = Ctx.GetFragmentView<FArcVisISMInstanceFragment>();
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassVisISMPhysicsTransformUpdateProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassPhysicsSimulation.h"
 #include "ArcMassPhysicsTransformSyncProcessor.h"
 #include "ArcMass/Visualization/ArcMassEntityVisualization.h"
@@ -56,6 +57,7 @@ void UArcMassVisISMPhysicsTransformUpdateProcessor::SignalEntities(
 	FMassSignalNameLookup& EntitySignals)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassVisISMPhysicsTransformUpdate);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	struct FPendingISMTransformUpdate
 	{
@@ -70,7 +72,7 @@ void UArcMassVisISMPhysicsTransformUpdateProcessor::SignalEntities(
 	TSet<FMassEntityHandle> DirtyHolders;
 
 	// Pass 1: gather resolved pointers and pre-computed matrices
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, &PendingUpdates, &DirtyHolders](FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
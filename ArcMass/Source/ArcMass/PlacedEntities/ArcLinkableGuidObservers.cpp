@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMass/PlacedEntities/ArcLinkableGuidObservers.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMass/PlacedEntities/ArcLinkableGuid.h"
 #include "ArcMass/PlacedEntities/ArcLinkableGuidSubsystem.h"
 #include "MassExecutionContext.h"
@@ -27,6 +28,8 @@ void UArcLinkableGuidInitObserver::ConfigureQueries(const TSharedRef<FMassEntity
 
 void UArcLinkableGuidInitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
+    FArcMassProcessorStatsScope Stats(*this);
+
     UWorld* World = EntityManager.GetWorld();
     UArcLinkableGuidSubsystem* Subsystem = World ? World->GetSubsystem<UArcLinkableGuidSubsystem>() : nullptr;
     if (Subsystem == nullptr)
@@ -34,7 +37,7 @@ void UArcLinkableGuidInitObserver::Execute(FMassEntityManager& EntityManager, FM
         return;
     }
 
-    ObserverQuery.ForEachEntityChunk(EntityManager, Context,
+    Stats.ForEachEntityChunk(ObserverQuery, Context,
         [Subsystem](FMassExecutionContext& Ctx)
         {
             TConstArrayView<FArcLinkableGuidFragment> GuidFragments =
@@ -70,6 +73,8 @@ void UArcLinkableGuidDeinitObserver::ConfigureQueries(const TSharedRef<FMassEnti
 
 void UArcLinkableGuidDeinitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
+    FArcMassProcessorStatsScope Stats(*this);
+
     UWorld* World = EntityManager.GetWorld();
     UArcLinkableGuidSubsystem* Subsystem = World ? World->GetSubsystem<UArcLinkableGuidSubsystem>() : nullptr;
     if (Subsystem == nullptr)
@@ -77,7 +82,7 @@ void UArcLinkableGuidDeinitObserver::Execute(FMassEntityManager& EntityManager,
         return;
     }
 
-    ObserverQuery.ForEachEntityChunk(EntityManager, Context,
+    Stats.ForEachEntityChunk(ObserverQuery, Context,
         [Subsystem](FMassExecutionContext& Ctx)
         {
             TConstArrayView<FArcLinkableGuidFragment> GuidFragments =
@@ -8,9 +8,10 @@
 class AActor;
 /**
  * Chaos collision filter that blocks all hits EXCEPT actors in the ignore list.
- * Used per-entity by the projectile movement processor.
+ * Used per-entity by the projectile simulation processor.
  *
  * Call SetIgnoredActors() before each entity's queries. The pointer is NOT owned.
+ * Holds per-entity state, so each worker chunk needs its own instance.
  */
 class FArcProjectileCollisionFilterCallback : public ICollisionQueryFilterCallback
 {
@@ -23,7 +24,7 @@ public:
 
 	virtual ECollisionQueryHitType PreFilter(const FQueryFilterData& FilterData, const Chaos::FPerShapeData& Shape, const Chaos::FGeometryParticle& Actor) override;
 
-	// PT overload — runs on physics thread; we're game-thread only so just block all.
+	// PT overload — runs on physics thread; projectile queries run on the game thread or Mass workers, so just block all.
 	virtual ECollisionQueryHitType PreFilter(const FQueryFilterData& FilterData, const Chaos::FPerShapeData& Shape, const Chaos::FGeometryParticleHandle& Actor) override
 	{
 		return ECollisionQueryHitType::Block;
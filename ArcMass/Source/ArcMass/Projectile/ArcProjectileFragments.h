@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "MassEntityTypes.h"
 #include "UObject/Interface.h"
 #include "Mass/EntityHandle.h"
@@ -37,6 +38,14 @@ struct ARCMASS_API FArcProjectileConfigFragment : public FMassConstSharedFragmen
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
 	float CollisionRadius = 10.f;
 
+	/** Spatial hash index (UArcMassSpatialHashTrait::IndexTags) holding the Mass entities this projectile can hit. Empty = no entity hits. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Collision")
+	FGameplayTag EntityCollisionIndexTag;
+
+	/** Radius of hittable Mass entities. Added to CollisionRadius for the entity hit test. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Collision", meta = (ClampMin = "0.0"))
+	float EntityCollisionRadius = 40.f;
+
 	/** Actor class to spawn for visualization. nullptr = no actor. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Visualization")
 	TSubclassOf<AActor> ActorClass;
@@ -116,6 +125,10 @@ struct ARCMASS_API FArcProjectileHomingFragment : public FMassFragment
 	/** Entity to home toward. */
 	UPROPERTY()
 	FMassEntityHandle TargetEntity;
+
+	/** TargetEntity's location, sampled on the game thread before the parallel simulation pass. */
+	FVector TargetLocation = FVector::ZeroVector;
+	bool bHasTargetLocation = false;
 };
 
 // ---------------------------------------------------------------------------
@@ -130,6 +143,10 @@ struct ARCMASS_API FArcProjectileCollisionFilterFragment : public FMassFragment
 	/** Actors to skip in collision queries. */
 	UPROPERTY()
 	TArray<TWeakObjectPtr<AActor>> IgnoredActors;
+
+	/** Mass entities to skip in entity hit tests. */
+	UPROPERTY()
+	TArray<FMassEntityHandle> IgnoredEntities;
 };
 
 template<>
@@ -190,6 +207,10 @@ struct ARCMASS_API FArcCollisionHitContext
 	/** True when projectile exceeded max distance rather than hitting something. */
 	UPROPERTY(BlueprintReadOnly, Category = "Collision")
 	bool bExpired = false;
+
+	/** Mass entity that was hit, if the hit came from the spatial hash rather than a physics body. */
+	UPROPERTY(BlueprintReadOnly, Category = "Collision")
+	FMassEntityHandle HitEntity;
 };
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,493 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcProjectileSimulationProcessor.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
+
+#include "ArcProjectileFragments.h"
+#include "ArcProjectileCollisionFilter.h"
+#include "ArcProjectileUtils.h"
+#include "ArcMass/Spatial/ArcMassSpatialHashSubsystem.h"
+
+#include "MassCommandBuffer.h"
+#include "MassCommonFragments.h"
+#include "MassCommonTypes.h"
+#include "MassEntityManager.h"
+#include "MassExecutionContext.h"
+#include "MassActorSubsystem.h"
+#include "Misc/ScopeLock.h"
+
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "Chaos/ChaosScene.h"
+#include "SQAccelerator.h"
+#include "CollisionQueryFilterCallbackCore.h"
+#include "SceneQueryCommonParams.h"
+#include "ChaosSQTypes.h"
+#include "Chaos/Sphere.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcProjectileSimulationProcessor)
+
+namespace UE::ArcMass::Projectile::Private
+{
+	using FSpatialAcceleration = Chaos::ISpatialAcceleration<Chaos::FAccelerationStructureHandle, Chaos::FReal, 3>;
+
+	/** Per-frame inputs shared by every chunk. */
+	struct FStepParams
+	{
+		const FSpatialAcceleration* SpatialAcceleration = nullptr;
+		const UArcMassSpatialHashSubsystem* SpatialHash = nullptr;
+		float DeltaTime = 0.f;
+		float WorldGravityZ = 0.f;
+	};
+
+	struct FPendingActorSync
+	{
+		AActor* Actor = nullptr;
+		FTransform Transform;
+	};
+
+	/** Chunk outputs, merged under a lock and applied on the game thread after the parallel pass. */
+	struct FStepResults
+	{
+		TArray<FMassEntityHandle> EntitiesToDestroy;
+		TArray<FPendingHitNotification> PendingHits;
+		TArray<FPendingActorSync> ActorSyncs;
+
+		void Append(FStepResults&& Other)
+		{
+			EntitiesToDestroy.Append(MoveTemp(Other.EntitiesToDestroy));
+			PendingHits.Append(MoveTemp(Other.PendingHits));
+			ActorSyncs.Append(MoveTemp(Other.ActorSyncs));
+		}
+	};
+
+	struct FEntityHit
+	{
+		FMassEntityHandle Entity;
+		FVector Location = FVector::ZeroVector;
+		float Distance = 0.f;
+	};
+
+	/**
+	 * Nearest Mass entity whose sphere (Radius) the segment Start + Dir * [0, Length] enters.
+	 * Candidates come from a sphere query around the segment midpoint; Scratch is reused across calls.
+	 */
+	bool FindEntityHit(
+		const FMassSpatialHashGrid& Grid,
+		const FVector& Start,
+		const FVector& Dir,
+		float Length,
+		float Radius,
+		FMassEntityHandle Self,
+		TConstArrayView<FMassEntityHandle> IgnoredEntities,
+		TArray<FArcMassEntityInfo>& Scratch,
+		FEntityHit& OutHit)
+	{
+		const float HalfLength = Length * 0.5f;
+		Grid.QueryEntitiesInRadiusFiltered(Start + Dir * HalfLength, HalfLength + Radius,
+			[Self, IgnoredEntities](FMassEntityHandle Candidate, const FVector&)
+			{
+				return Candidate != Self && !IgnoredEntities.Contains(Candidate);
+			},
+			Scratch);
+
+		const float RadiusSq = FMath::Square(Radius);
+		bool bFound = false;
+
+		for (const FArcMassEntityInfo& Candidate : Scratch)
+		{
+			const FVector ToCandidate = Candidate.Location - Start;
+			const float Projection = FVector::DotProduct(ToCandidate, Dir);
+			const float Closest = FMath::Clamp(Projection, 0.f, Length);
+			if ((ToCandidate - Dir * Closest).SizeSquared() > RadiusSq)
+			{
+				continue;
+			}
+
+			// Where the segment enters the sphere; 0 if it starts inside.
+			const float PerpDistSq = FMath::Max(0.f, static_cast<float>(ToCandidate.SizeSquared()) - FMath::Square(Projection));
+			const float Entry = FMath::Clamp(Projection - FMath::Sqrt(FMath::Max(0.f, RadiusSq - PerpDistSq)), 0.f, Length);
+
+			if (!bFound || Entry < OutHit.Distance)
+			{
+				OutHit.Entity = Candidate.Entity;
+				OutHit.Location = Candidate.Location;
+				OutHit.Distance = Entry;
+				bFound = true;
+			}
+		}
+
+		return bFound;
+	}
+
+	void SimulateChunk(FMassExecutionContext& Ctx, const FStepParams& Params, const bool bHoming, const bool bBouncing, FStepResults& Out)
+	{
+		TArrayView<FTransformFragment> Transforms = Ctx.GetMutableFragmentView<FTransformFragment>();
+		TArrayView<FArcProjectileFragment> Projectiles = Ctx.GetMutableFragmentView<FArcProjectileFragment>();
+		const TConstArrayView<FArcProjectileCollisionFilterFragment> CollisionFilters = Ctx.GetFragmentView<FArcProjectileCollisionFilterFragment>();
+		TArrayView<FMassActorFragment> ActorFragments = Ctx.GetMutableFragmentView<FMassActorFragment>();
+		const FArcProjectileConfigFragment& Config = Ctx.GetConstSharedFragment<FArcProjectileConfigFragment>();
+
+		TConstArrayView<FArcProjectileHomingFragment> HomingFragments;
+		const FArcProjectileHomingConfigFragment* HomingConfig = nullptr;
+		if (bHoming)
+		{
+			HomingFragments = Ctx.GetFragmentView<FArcProjectileHomingFragment>();
+			HomingConfig = &Ctx.GetConstSharedFragment<FArcProjectileHomingConfigFragment>();
+		}
+
+		const FArcProjectileBounceConfigFragment* BounceConfig = bBouncing
+			? &Ctx.GetConstSharedFragment<FArcProjectileBounceConfigFragment>()
+			: nullptr;
+
+		const FMassSpatialHashGrid* EntityGrid = (Params.SpatialHash && Config.EntityCollisionIndexTag.IsValid())
+			? Params.SpatialHash->GetIndexedGrid(Config.EntityCollisionIndexTag)
+			: nullptr;
+		const float EntityHitRadius = Config.CollisionRadius + Config.EntityCollisionRadius;
+
+		const bool bHasActors = !ActorFragments.IsEmpty();
+
+		FChaosSQAccelerator SQAccelerator(*Params.SpatialAcceleration);
+
+		const FChaosQueryFlags QueryFlags(
+			FChaosQueryFlag::eSTATIC | FChaosQueryFlag::eDYNAMIC | FChaosQueryFlag::ePREFILTER
+		);
+		const EHitFlags OutputFlags = EHitFlags::Position | EHitFlags::Normal | EHitFlags::Distance;
+
+		FArcProjectileCollisionFilterCallback BlockFilterCallback;
+		TArray<FArcMassEntityInfo> EntityCandidates;
+
+		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
+		{
+			FArcProjectileFragment& Projectile = Projectiles[EntityIt];
+			if (Projectile.bPendingDestroy)
+			{
+				continue;
+			}
+
+			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
+			FTransformFragment& Transform = Transforms[EntityIt];
+			const FVector CurrentPos = Transform.GetTransform().GetLocation();
+
+			// Gravity
+			Projectile.Velocity.Z += Params.WorldGravityZ * Config.GravityScale * Params.DeltaTime;
+
+			// Homing
+			if (HomingConfig)
+			{
+				const FArcProjectileHomingFragment& Homing = HomingFragments[EntityIt];
+				if (Homing.bHasTargetLocation)
+				{
+					const FVector ToTarget = (Homing.TargetLocation - CurrentPos).GetSafeNormal();
+					Projectile.Velocity += ToTarget * HomingConfig->HomingAcceleration * Params.DeltaTime;
+				}
+			}
+
+			// MaxSpeed clamp
+			const float SpeedSq = Projectile.Velocity.SizeSquared();
+			if (SpeedSq > FMath::Square(Config.MaxSpeed))
+			{
+				Projectile.Velocity = Projectile.Velocity.GetSafeNormal() * Config.MaxSpeed;
+			}
+
+			const float Speed = Projectile.Velocity.Size();
+			if (Speed < UE_KINDA_SMALL_NUMBER)
+			{
+				Projectile.bPendingDestroy = true;
+				Out.EntitiesToDestroy.Add(Entity);
+				continue;
+			}
+
+			const FVector MoveDir = Projectile.Velocity / Speed;
+			const float MoveDist = Speed * Params.DeltaTime;
+			const FVector TraceEnd = CurrentPos + MoveDir * MoveDist;
+
+			if (Config.bRotationFollowsVelocity)
+			{
+				Transform.GetMutableTransform().SetRotation(MoveDir.ToOrientationQuat());
+			}
+
+			auto CollectHitNotification = [&](FHitResult&& InHitResult, bool bInExpired, FMassEntityHandle InHitEntity)
+			{
+				FPendingHitNotification& N = Out.PendingHits.AddDefaulted_GetRef();
+				N.HitResult = MoveTemp(InHitResult);
+				N.Instigator = Projectile.Instigator;
+				N.Velocity = Projectile.Velocity;
+				N.HitEntity = InHitEntity;
+				N.bExpired = bInExpired;
+				if (bHasActors)
+				{
+					N.VisualizationActor = ActorFragments[EntityIt].GetMutable();
+				}
+			};
+
+			auto MarkForDestroy = [&]()
+			{
+				Projectile.bPendingDestroy = true;
+				Out.EntitiesToDestroy.Add(Entity);
+			};
+
+			// World collision
+			BlockFilterCallback.SetIgnoredActors(&CollisionFilters[EntityIt].IgnoredActors);
+
+			ChaosInterface::FSQHitBuffer<ChaosInterface::FRaycastHit> HitBuffer(/*bSingle=*/ true);
+			const Chaos::Filter::FQueryFilterData FilterData;
+			const ChaosInterface::FSceneQueryCommonParams CommonParams(BlockFilterCallback, FilterData, QueryFlags);
+
+			SQAccelerator.Raycast(CurrentPos, MoveDir, MoveDist, HitBuffer, OutputFlags, CommonParams);
+
+			const ChaosInterface::FRaycastHit* BlockHit = HitBuffer.HasBlockingHit() ? HitBuffer.GetBlock() : nullptr;
+			const float BlockDistance = BlockHit ? static_cast<float>(BlockHit->Distance) : MoveDist;
+
+			// Mass entity collision, limited to the part of the move before any world hit
+			FEntityHit EntityHit;
+			const bool bHitEntity = EntityGrid && FindEntityHit(*EntityGrid, CurrentPos, MoveDir, BlockDistance, EntityHitRadius,
+				Entity, CollisionFilters[EntityIt].IgnoredEntities, EntityCandidates, EntityHit);
+
+			if (bHitEntity)
+			{
+				const FVector HitPos = CurrentPos + MoveDir * EntityHit.Distance;
+				Transform.GetMutableTransform().SetLocation(HitPos);
+				Projectile.DistanceTraveled += EntityHit.Distance;
+
+				FHitResult HR = BuildEntityHitResult(HitPos, EntityHit.Location, EntityHit.Distance, CurrentPos, TraceEnd);
+				CollectHitNotification(MoveTemp(HR), false, EntityHit.Entity);
+				MarkForDestroy();
+			}
+			else if (BlockHit)
+			{
+				const FVector HitPos = BlockHit->WorldPosition;
+				const FVector HitNormal = BlockHit->WorldNormal;
+				Transform.GetMutableTransform().SetLocation(HitPos);
+				Projectile.DistanceTraveled += static_cast<float>(BlockHit->Distance);
+
+				if (BounceConfig)
+				{
+					// Reflect velocity
+					FVector ReflectedVelocity = FMath::GetReflectionVector(Projectile.Velocity, HitNormal);
+
+					const float NormalComponent = FVector::DotProduct(ReflectedVelocity, HitNormal);
+					const FVector NormalVelocity = HitNormal * NormalComponent;
+					const FVector TangentVelocity = ReflectedVelocity - NormalVelocity;
+
+					ReflectedVelocity = TangentVelocity * (1.f - BounceConfig->Friction) + NormalVelocity * BounceConfig->Bounciness;
+					Projectile.Velocity = ReflectedVelocity;
+
+					if (ReflectedVelocity.SizeSquared() < FMath::Square(BounceConfig->BounceVelocityStopThreshold))
+					{
+						MarkForDestroy();
+					}
+				}
+				else
+				{
+					AActor* HitActor = nullptr;
+					UPrimitiveComponent* HitComponent = nullptr;
+					ResolveHitActorComponent(BlockHit->Actor, HitActor, HitComponent);
+
+					FHitResult HR = BuildRaycastHitResult(
+						HitPos, HitNormal,
+						static_cast<float>(BlockHit->Distance), BlockHit->FaceIndex,
+						HitActor, HitComponent,
+						CurrentPos, TraceEnd);
+
+					CollectHitNotification(MoveTemp(HR), false, FMassEntityHandle());
+					MarkForDestroy();
+				}
+			}
+			else
+			{
+				Transform.GetMutableTransform().SetLocation(TraceEnd);
+				Projectile.DistanceTraveled += MoveDist;
+
+				// Sphere overlap
+				if (Config.CollisionRadius > 0.f)
+				{
+					Chaos::FImplicitSphere3 OverlapSphere(Chaos::FVec3(0), Config.CollisionRadius);
+					const FTransform OverlapPose(FQuat::Identity, TraceEnd);
+
+					ChaosInterface::FSQHitBuffer<ChaosInterface::FOverlapHit> OverlapBuffer;
+					const Chaos::Filter::FQueryFilterData OverlapFilterData;
+					const ChaosInterface::FSceneQueryCommonParams OverlapParams(BlockFilterCallback, OverlapFilterData, QueryFlags);
+
+					SQAccelerator.Overlap(OverlapSphere, OverlapPose, OverlapBuffer, OverlapParams);
+
+					if (OverlapBuffer.GetNumHits() > 0)
+					{
+						AActor* HitActor = nullptr;
+						UPrimitiveComponent* HitComponent = nullptr;
+						const ChaosInterface::FOverlapHit* OverlapHits = OverlapBuffer.GetHits();
+						if (OverlapHits)
+						{
+							ResolveHitActorComponent(OverlapHits[0].Actor, HitActor, HitComponent);
+						}
+
+						FHitResult HR = BuildOverlapHitResult(TraceEnd, HitActor, HitComponent, CurrentPos);
+						CollectHitNotification(MoveTemp(HR), false, FMassEntityHandle());
+						MarkForDestroy();
+					}
+				}
+
+				// Max distance
+				if (!Projectile.bPendingDestroy && Projectile.DistanceTraveled >= Config.MaxDistance)
+				{
+					FHitResult HR;
+					HR.TraceStart = CurrentPos;
+					HR.TraceEnd = TraceEnd;
+					HR.Location = TraceEnd;
+					CollectHitNotification(MoveTemp(HR), true, FMassEntityHandle());
+					MarkForDestroy();
+				}
+			}
+
+			// Actor transforms can only be set on the game thread
+			if (bHasActors)
+			{
+				if (AActor* Actor = ActorFragments[EntityIt].GetMutable())
+				{
+					Out.ActorSyncs.Add({Actor, Transform.GetTransform()});
+				}
+			}
+		}
+	}
+}
+
+UArcProjectileSimulationProcessor::UArcProjectileSimulationProcessor()
+	: LinearQuery{*this}
+	, HomingQuery{*this}
+	, BouncingQuery{*this}
+{
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	bRequiresGameThreadExecution = true;
+	bAutoRegisterWithProcessingPhases = true;
+}
+
+void UArcProjectileSimulationProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	auto AddCommonRequirements = [](FMassEntityQuery& Query)
+	{
+		Query.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+		Query.AddRequirement<FArcProjectileFragment>(EMassFragmentAccess::ReadWrite);
+		Query.AddRequirement<FArcProjectileCollisionFilterFragment>(EMassFragmentAccess::ReadOnly);
+		Query.AddRequirement<FMassActorFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::Optional);
+		Query.AddConstSharedRequirement<FArcProjectileConfigFragment>(EMassFragmentPresence::All);
+		Query.AddTagRequirement<FArcProjectileTag>(EMassFragmentPresence::All);
+	};
+
+	AddCommonRequirements(LinearQuery);
+	LinearQuery.AddTagRequirement<FArcLinearProjectileTag>(EMassFragmentPresence::All);
+
+	AddCommonRequirements(HomingQuery);
+	HomingQuery.AddRequirement<FArcProjectileHomingFragment>(EMassFragmentAccess::ReadWrite, EMassFragmentPresence::All);
+	HomingQuery.AddConstSharedRequirement<FArcProjectileHomingConfigFragment>(EMassFragmentPresence::All);
+	HomingQuery.AddTagRequirement<FArcHomingProjectileTag>(EMassFragmentPresence::All);
+
+	AddCommonRequirements(BouncingQuery);
+	BouncingQuery.AddConstSharedRequirement<FArcProjectileBounceConfigFragment>(EMassFragmentPresence::All);
+	BouncingQuery.AddTagRequirement<FArcBouncingProjectileTag>(EMassFragmentPresence::All);
+}
+
+void UArcProjectileSimulationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	using namespace UE::ArcMass::Projectile;
+	using namespace UE::ArcMass::Projectile::Private;
+
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+	if (DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	UWorld* World = EntityManager.GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FPhysScene* PhysScene = World->GetPhysicsScene();
+	if (!PhysScene)
+	{
+		return;
+	}
+
+	const FSpatialAcceleration* SpatialAcceleration = PhysScene->GetSpacialAcceleration();
+	if (!SpatialAcceleration)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileSimulation);
+	FArcMassProcessorStatsScope Stats(*this);
+
+	// Homing targets may be any entity, including other projectiles written by the parallel pass,
+	// so their locations are sampled up front.
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileSimulation_ResolveHomingTargets);
+
+		Stats.ForEachEntityChunk(HomingQuery, Context, [&EntityManager](FMassExecutionContext& Ctx)
+		{
+			TArrayView<FArcProjectileHomingFragment> HomingFragments = Ctx.GetMutableFragmentView<FArcProjectileHomingFragment>();
+			for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
+			{
+				FArcProjectileHomingFragment& Homing = HomingFragments[EntityIt];
+				const FTransformFragment* TargetTransform = EntityManager.IsEntityValid(Homing.TargetEntity)
+					? EntityManager.GetFragmentDataPtr<FTransformFragment>(Homing.TargetEntity)
+					: nullptr;
+
+				Homing.bHasTargetLocation = TargetTransform != nullptr;
+				if (TargetTransform)
+				{
+					Homing.TargetLocation = TargetTransform->GetTransform().GetLocation();
+				}
+			}
+		});
+	}
+
+	FStepParams Params;
+	Params.SpatialAcceleration = SpatialAcceleration;
+	Params.SpatialHash = World->GetSubsystem<UArcMassSpatialHashSubsystem>();
+	Params.DeltaTime = DeltaTime;
+	Params.WorldGravityZ = World->GetGravityZ();
+
+	FStepResults Results;
+	FCriticalSection ResultsLock;
+
+	auto SimulateQuery = [&](FMassEntityQuery& Query, const bool bHoming, const bool bBouncing)
+	{
+		Stats.ParallelForEachEntityChunk(Query, Context, [&](FMassExecutionContext& Ctx)
+		{
+			FStepResults ChunkResults;
+			SimulateChunk(Ctx, Params, bHoming, bBouncing, ChunkResults);
+
+			FScopeLock Lock(&ResultsLock);
+			Results.Append(MoveTemp(ChunkResults));
+		});
+	};
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileSimulation_Step);
+		SimulateQuery(LinearQuery, false, false);
+		SimulateQuery(HomingQuery, true, false);
+		SimulateQuery(BouncingQuery, false, true);
+	}
+
+	for (const FPendingActorSync& Sync : Results.ActorSyncs)
+	{
+		Sync.Actor->SetActorTransform(Sync.Transform);
+	}
+
+	// Callbacks run on the game thread when the command buffer flushes. Destroy commands flush last,
+	// so actors and instigators are notified before the projectile entities go away.
+	if (Results.PendingHits.Num() > 0)
+	{
+		EntityManager.Defer().PushCommand<FMassDeferredCommand<EMassCommandOperationType::None>>(
+			[PendingHits = MoveTemp(Results.PendingHits)](FMassEntityManager&)
+			{
+				DispatchHitNotifications(PendingHits);
+			});
+	}
+
+	if (Results.EntitiesToDestroy.Num() > 0)
+	{
+		EntityManager.Defer().DestroyEntities(Results.EntitiesToDestroy);
+	}
+}
@@ -0,0 +1,35 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+
+#include "ArcProjectileSimulationProcessor.generated.h"
+
+/**
+ * Single simulation stage for linear, homing and bouncing projectiles.
+ *
+ * Integration and scene queries run in parallel over chunks against the game-thread Chaos acceleration
+ * structure, which is not modified while the game thread waits on the parallel pass. Hits against Mass
+ * entities come from UArcMassSpatialHashSubsystem (FArcProjectileConfigFragment::EntityCollisionIndexTag).
+ * Actor transform sync runs on the game thread afterwards; impact callbacks and destruction are pushed
+ * to the deferred command buffer.
+ */
+UCLASS()
+class ARCMASS_API UArcProjectileSimulationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UArcProjectileSimulationProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery LinearQuery;
+	FMassEntityQuery HomingQuery;
+	FMassEntityQuery BouncingQuery;
+};
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcProjectileSpawning.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcProjectileFragments.h"
 
@@ -39,6 +40,7 @@ void UArcProjectileSpawnProcessor::Execute(FMassEntityManager& EntityManager, FM
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileSpawn);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	FArcProjectileSpawnData& SpawnData = Context.GetMutableAuxData().GetMutable<FArcProjectileSpawnData>();
 
@@ -46,10 +48,11 @@ void UArcProjectileSpawnProcessor::Execute(FMassEntityManager& EntityManager, FM
 	const int32 NumVelocities = SpawnData.Velocities.Num();
 	const int32 NumInstigators = SpawnData.Instigators.Num();
 	const int32 NumIgnoredActors = SpawnData.IgnoredActors.Num();
+	const int32 NumIgnoredEntities = SpawnData.IgnoredEntities.Num();
 
 	int32 NextIndex = 0;
 
-	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(EntityQuery, Context, [&](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FTransformFragment> Transforms = Ctx.GetMutableFragmentView<FTransformFragment>();
 		TArrayView<FArcProjectileFragment> Projectiles = Ctx.GetMutableFragmentView<FArcProjectileFragment>();
@@ -78,6 +81,11 @@ void UArcProjectileSpawnProcessor::Execute(FMassEntityManager& EntityManager, FM
 			{
 				Filters[EntityIt].IgnoredActors = SpawnData.IgnoredActors[Idx];
 			}
+
+			if (Idx < NumIgnoredEntities)
+			{
+				Filters[EntityIt].IgnoredEntities = SpawnData.IgnoredEntities[Idx];
+			}
 		}
 	});
 }
@@ -22,6 +22,7 @@ struct ARCMASS_API FArcProjectileSpawnData
 	TArray<FVector> Velocities;
 	TArray<TWeakObjectPtr<UObject>> Instigators;
 	TArray<TArray<TWeakObjectPtr<AActor>>> IgnoredActors;
+	TArray<TArray<FMassEntityHandle>> IgnoredEntities;
 };
 
 // ---------------------------------------------------------------------------
@@ -103,6 +103,28 @@ FHitResult UE::ArcMass::Projectile::BuildOverlapHitResult(
 	return HitResult;
 }
 
+FHitResult UE::ArcMass::Projectile::BuildEntityHitResult(
+	const FVector& HitPos,
+	const FVector& EntityLocation,
+	float Distance,
+	const FVector& TraceStart,
+	const FVector& TraceEnd)
+{
+	const FVector HitNormal = (HitPos - EntityLocation).GetSafeNormal();
+
+	FHitResult HitResult;
+	HitResult.bBlockingHit = true;
+	HitResult.ImpactPoint = HitPos;
+	HitResult.ImpactNormal = HitNormal;
+	HitResult.Location = HitPos;
+	HitResult.Normal = HitNormal;
+	HitResult.Distance = Distance;
+	HitResult.TraceStart = TraceStart;
+	HitResult.TraceEnd = TraceEnd;
+
+	return HitResult;
+}
+
 void UE::ArcMass::Projectile::DispatchHitNotifications(const TArray<FPendingHitNotification>& PendingHits)
 {
 	for (const FPendingHitNotification& Pending : PendingHits)
@@ -112,9 +134,10 @@ void UE::ArcMass::Projectile::DispatchHitNotifications(const TArray<FPendingHitN
 		HitContext.Instigator = Pending.Instigator;
 		HitContext.Velocity = Pending.Velocity;
 		HitContext.bExpired = Pending.bExpired;
+		HitContext.HitEntity = Pending.HitEntity;
 
 		// Notify visualization actor
-		if (AActor* Actor = Pending.VisualizationActor)
+		if (AActor* Actor = Pending.VisualizationActor.Get())
 		{
 			if (Actor->Implements<UArcProjectileActorInterface>())
 			{
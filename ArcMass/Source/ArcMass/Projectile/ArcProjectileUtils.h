@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Chaos/ParticleHandleFwd.h"
 #include "Engine/HitResult.h"
+#include "Mass/EntityHandle.h"
 
 namespace UE::ArcMass::Projectile
 {
@@ -14,10 +15,12 @@ namespace UE::ArcMass::Projectile
 
 	struct FPendingHitNotification
 	{
-		AActor* VisualizationActor = nullptr;
+		/** Weak because notifications are dispatched from the deferred command buffer. */
+		TWeakObjectPtr<AActor> VisualizationActor;
 		TWeakObjectPtr<UObject> Instigator;
 		FHitResult HitResult;
 		FVector Velocity = FVector::ZeroVector;
+		FMassEntityHandle HitEntity;
 		bool bExpired = false;
 	};
 
@@ -49,6 +52,14 @@ namespace UE::ArcMass::Projectile
 		UPrimitiveComponent* HitComponent,
 		const FVector& TraceStart);
 
+	/** Build an FHitResult for a hit against a Mass entity. Normal points from the entity to the impact point. */
+	ARCMASS_API FHitResult BuildEntityHitResult(
+		const FVector& HitPos,
+		const FVector& EntityLocation,
+		float Distance,
+		const FVector& TraceStart,
+		const FVector& TraceEnd);
+
 	/** Dispatch collected hit notifications to actor (IArcProjectileActorInterface) and instigator (IArcCollisionHitHandler). */
 	ARCMASS_API void DispatchHitNotifications(const TArray<FPendingHitNotification>& PendingHits);
 }
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcProjectileVisualization.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcProjectileActorPool.h"
 #include "ArcProjectileFragments.h"
@@ -43,8 +44,9 @@ void UArcProjectileActorInitObserver::Execute(FMassEntityManager& EntityManager,
 	UArcProjectileActorPoolSubsystem* Pool = World->GetSubsystem<UArcProjectileActorPoolSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileActorInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[Pool](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -99,8 +101,9 @@ void UArcProjectileActorDeinitObserver::Execute(FMassEntityManager& EntityManage
 	UArcProjectileActorPoolSubsystem* Pool = World ? World->GetSubsystem<UArcProjectileActorPoolSubsystem>() : nullptr;
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcProjectileActorDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[Pool](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FMassActorFragment> ActorFragments = Ctx.GetMutableFragmentView<FMassActorFragment>();
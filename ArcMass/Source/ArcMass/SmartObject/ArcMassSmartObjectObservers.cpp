@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassSmartObjectObservers.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 #include "ArcMassSmartObjectFragments.h"
 #include "Mass/EntityFragments.h"
 #include "MassExecutionContext.h"
@@ -35,8 +36,9 @@ void UArcSmartObjectAddObserver::Execute(FMassEntityManager& EntityManager, FMas
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcSmartObjectAdd);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [SOSubsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [SOSubsystem](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcSmartObjectOwnerFragment> SOOwners = Ctx.GetMutableFragmentView<FArcSmartObjectOwnerFragment>();
 		const FArcSmartObjectDefinitionSharedFragment& SODef = Ctx.GetConstSharedFragment<FArcSmartObjectDefinitionSharedFragment>();
@@ -85,8 +87,9 @@ void UArcSmartObjectRemoveObserver::Execute(FMassEntityManager& EntityManager, F
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcSmartObjectRemove);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [SOSubsystem](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [SOSubsystem](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcSmartObjectOwnerFragment> SOOwners = Ctx.GetMutableFragmentView<FArcSmartObjectOwnerFragment>();
 
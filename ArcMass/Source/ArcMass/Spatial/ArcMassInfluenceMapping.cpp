@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassInfluenceMapping.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "Components/BoxComponent.h"
 #include "Components/SphereComponent.h"
@@ -566,6 +567,7 @@ void UArcInfluenceMappingProcessor::Execute(FMassEntityManager& EntityManager, F
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcInfluenceMapping);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	const int32 GridIdx = GridIndex;
 	check(GridIdx >= 0 && GridIdx < Subsystem->GetGridCount());
@@ -574,7 +576,7 @@ void UArcInfluenceMappingProcessor::Execute(FMassEntityManager& EntityManager, F
 	// Phase 1: Collect all influence into a local batch
 	TArray<FArcPendingInfluence> PendingBatch;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&Grid, &PendingBatch](FMassExecutionContext& Ctx)
 		{
 			const FArcInfluenceSourceFragment& SourceConfig = Ctx.GetConstSharedFragment<FArcInfluenceSourceFragment>();
@@ -1,6 +1,7 @@
 ﻿// Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassSpatialHashSubsystem.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "DrawDebugHelpers.h"
 #include "MassCommonFragments.h"
@@ -503,6 +504,7 @@ void UArcMassSpatialHashUpdateProcessor::Execute(FMassEntityManager& EntityManag
     }
 
     TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassSpatialHashUpdate);
+    FArcMassProcessorStatsScope Stats(*this);
 
     FMassSpatialHashGrid& SpatialHashGrid = SpatialHashSubsystem->GetSpatialHashGrid();
     
@@ -540,7 +542,7 @@ void UArcMassSpatialHashUpdateProcessor::Execute(FMassEntityManager& EntityManag
 		}
 	}
 #endif
-    EntityQuery.ForEachEntityChunk(Context,
+    Stats.ForEachEntityChunk(EntityQuery, Context,
         [SpatialHashSubsystem, &SpatialHashGrid](FMassExecutionContext& Ctx)
         {
             const TConstArrayView<FTransformFragment> TransformList = Ctx.GetFragmentView<FTransformFragment>();
@@ -621,8 +623,9 @@ void UArcMassSpatialHashObserver::Execute(FMassEntityManager& EntityManager, FMa
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassSpatialHash);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[SpatialHashSubsystem](FMassExecutionContext& Ctx)
 		{
 			FMassSpatialHashGrid& MainGrid = SpatialHashSubsystem->GetSpatialHashGrid();
@@ -678,8 +681,9 @@ void UArcMassSpatialHashRemoveObserver::Execute(FMassEntityManager& EntityManage
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcMassSpatialHashRemove);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[SpatialHashSubsystem](FMassExecutionContext& Ctx)
 		{
 			FMassSpatialHashGrid& MainGrid = SpatialHashSubsystem->GetSpatialHashGrid();
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassEntityVisualizationProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMassEntityVisualization.h"
 #include "ArcVisLifecycle.h"
@@ -57,8 +58,9 @@ void UArcVisPlayerCellTrackingProcessor::Execute(FMassEntityManager& EntityManag
 	const FArcVisualizationGrid& PhysicsGrid = Subsystem->GetPhysicsGrid();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisPlayerCellTracking);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, World, &MeshGrid, &PhysicsGrid] (FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FTransformFragment> Transforms = Ctx.GetFragmentView<FTransformFragment>();
@@ -424,10 +426,11 @@ void UArcVisMeshActivateProcessor::SignalEntities(FMassEntityManager& EntityMana
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisMeshActivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FArcPendingISMActivation> PendingActivations;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, World, &PendingActivations](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -533,8 +536,9 @@ void UArcVisMeshDeactivateProcessor::SignalEntities(FMassEntityManager& EntityMa
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisMeshDeactivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, &Context](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -611,11 +615,12 @@ void UArcVisEntityInitObserver::Execute(FMassEntityManager& EntityManager, FMass
 	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisEntityInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> ActivateEntities;
 	TArray<FMassEntityHandle> PhysicsActivateEntities;
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem, World, &ActivateEntities, &PhysicsActivateEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -689,8 +694,9 @@ void UArcVisEntityDeinitObserver::Execute(FMassEntityManager& EntityManager, FMa
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisEntityDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
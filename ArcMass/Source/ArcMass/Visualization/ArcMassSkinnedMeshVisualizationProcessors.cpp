@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcMassSkinnedMeshVisualizationProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcMassEntityVisualization.h"
 #include "ArcVisProcessorUtils.h"
@@ -55,11 +56,12 @@ void UArcVisSkinnedMeshEntityInitObserver::Execute(FMassEntityManager& EntityMan
 	UMassSignalSubsystem* SignalSubsystem = World->GetSubsystem<UMassSignalSubsystem>();
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisSkinnedMeshEntityInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> ActivateEntities;
 	TArray<FMassEntityHandle> PhysicsActivateEntities;
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem, World, &ActivateEntities, &PhysicsActivateEntities](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -140,10 +142,11 @@ void UArcVisSkinnedMeshActivateProcessor::SignalEntities(FMassEntityManager& Ent
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisSkinnedMeshActivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FArcPendingSkinnedISMActivation> PendingActivations;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, World, &PendingActivations](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -231,8 +234,9 @@ void UArcVisSkinnedMeshDeactivateProcessor::SignalEntities(FMassEntityManager& E
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisSkinnedMeshDeactivate);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem, &Context](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -306,8 +310,9 @@ void UArcVisSkinnedMeshEntityDeinitObserver::Execute(FMassEntityManager& EntityM
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisSkinnedMeshEntityDeinit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(ObserverQuery, Context,
 		[&EntityManager, Subsystem](FMassExecutionContext& Ctx)
 		{
 			TArrayView<FArcVisRepresentationFragment> Reps = Ctx.GetMutableFragmentView<FArcVisRepresentationFragment>();
@@ -1,6 +1,7 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "ArcVisLifecycleProcessors.h"
+#include "ArcMass/Instrumentation/ArcMassProcessorStats.h"
 
 #include "ArcVisLifecycle.h"
 #include "ArcMassEntityVisualization.h"
@@ -36,8 +37,9 @@ void UArcVisLifecycleInitObserver::ConfigureQueries(const TSharedRef<FMassEntity
 void UArcVisLifecycleInitObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisLifecycleInit);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	ObserverQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Ctx)
+	Stats.ForEachEntityChunk(ObserverQuery, Context, [](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcVisLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcVisLifecycleFragment>();
 		const FArcVisLifecycleConfigFragment& Config = Ctx.GetConstSharedFragment<FArcVisLifecycleConfigFragment>();
@@ -88,11 +90,12 @@ void UArcVisLifecycleTickProcessor::Execute(FMassEntityManager& EntityManager, F
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisLifecycleTick);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	TArray<FMassEntityHandle> PhaseChangedEntities;
 	TArray<FMassEntityHandle> DeadEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[DeltaTime, &PhaseChangedEntities, &DeadEntities](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcVisLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcVisLifecycleFragment>();
@@ -182,6 +185,7 @@ void UArcVisLifecycleForceTransitionProcessor::SignalEntities(FMassEntityManager
 	}
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisLifecycleForceTransition);
+	FArcMassProcessorStatsScope Stats(*this);
 
 	// Drain pending requests
 	TArray<FArcVisLifecycleForceTransitionRequest> Requests = MoveTemp(Subsystem->GetPendingRequests());
@@ -204,7 +208,7 @@ void UArcVisLifecycleForceTransitionProcessor::SignalEntities(FMassEntityManager
 	TArray<FMassEntityHandle> PhaseChangedEntities;
 	TArray<FMassEntityHandle> DeadEntities;
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&Requests, &RequestByEntity, &PhaseChangedEntities, &DeadEntities](FMassExecutionContext& Ctx)
 	{
 		TArrayView<FArcVisLifecycleFragment> LifecycleFragments = Ctx.GetMutableFragmentView<FArcVisLifecycleFragment>();
@@ -297,8 +301,9 @@ void UArcVisLifecycleVisSwitchProcessor::SignalEntities(FMassEntityManager& Enti
 	UArcEntityVisualizationSubsystem* Subsystem = World ? World->GetSubsystem<UArcEntityVisualizationSubsystem>() : nullptr;
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcVisLifecycleVisSwitch);
+	FArcMassProcessorStatsScope Stats(*this);
 
-	EntityQuery.ForEachEntityChunk(Context,
+	Stats.ForEachEntityChunk(EntityQuery, Context,
 		[&EntityManager, Subsystem](FMassExecutionContext& Ctx)
 	{
 		TConstArrayView<FArcVisLifecycleFragment> LifecycleFragments = Ctx.GetFragmentView<FArcVisLifecycleFragment>();
@@ -0,0 +1,24 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ArcMassTests : ModuleRules
+{
+	public ArcMassTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"CQTest",
+			"ArcMass",
+			"MassEntity",
+			"MassCommon",
+			"GameplayTags",
+			"PhysicsCore"
+		});
+	}
+}
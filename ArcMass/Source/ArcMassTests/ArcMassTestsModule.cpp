@@ -0,0 +1,5 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, ArcMassTests);
@@ -0,0 +1,211 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "ArcMassMailbox.h"
+#include "Async/ParallelFor.h"
+#include "Components/ActorTestSpawner.h"
+#include "MassCommonFragments.h"
+#include "MassEntityManager.h"
+#include "MassEntityQuery.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutionContext.h"
+#include "MassProcessingContext.h"
+#include "NativeGameplayTags.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestMailbox_Hit, "TestMailbox.Hit");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_TestMailbox_Heal, "TestMailbox.Heal");
+
+TEST_CLASS(ArcMassMailboxTest, "ArcMass.Messaging.Mailbox")
+{
+	struct FReceived
+	{
+		FMassEntityHandle Entity;
+		FArcMassMailboxMessage Message;
+	};
+
+	FActorTestSpawner Spawner;
+	FMassEntityManager* EntityManager = nullptr;
+	UArcMassMailboxSubsystem* Mailbox = nullptr;
+	UArcMassMailboxSortProcessor* SortProcessor = nullptr;
+	FMassArchetypeHandle Archetype;
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+
+		UMassEntitySubsystem* MES = Spawner.GetWorld().GetSubsystem<UMassEntitySubsystem>();
+		ASSERT_THAT(IsNotNull(MES));
+		EntityManager = &MES->GetMutableEntityManager();
+
+		Mailbox = Spawner.GetWorld().GetSubsystem<UArcMassMailboxSubsystem>();
+		ASSERT_THAT(IsNotNull(Mailbox));
+
+		SortProcessor = NewObject<UArcMassMailboxSortProcessor>();
+		SortProcessor->CallInitialize(&Spawner.GetWorld(), EntityManager->AsShared());
+
+		Archetype = EntityManager->CreateArchetype({FTransformFragment::StaticStruct(), FArcMassMailboxTag::StaticStruct()});
+	}
+
+	TArray<FMassEntityHandle> CreateEntities(int32 Count)
+	{
+		TArray<FMassEntityHandle> Entities;
+		EntityManager->BatchCreateEntities(Archetype, Count, Entities);
+		return Entities;
+	}
+
+	void Send(const FGameplayTag& Type, const FMassEntityHandle& Target, int32 Param)
+	{
+		FArcMassMailboxMessage Message;
+		Message.Type = Type;
+		Message.Target = Target;
+		Message.Param = Param;
+		Mailbox->SendMessage(Message);
+	}
+
+	void Sort()
+	{
+		UE::Mass::FProcessingContext ProcessingContext(*EntityManager, 0.f);
+		SortProcessor->CallExecute(*EntityManager, ProcessingContext.GetExecutionContext());
+	}
+
+	/** ForEachChunkMessage over every mailbox chunk. */
+	TArray<FReceived> Receive(const FGameplayTag& Type)
+	{
+		TArray<FReceived> Received;
+		FMassExecutionContext ExecContext(*EntityManager);
+		FMassEntityQuery Query(EntityManager->AsShared());
+		Query.AddTagRequirement<FArcMassMailboxTag>(EMassFragmentPresence::All);
+		Query.ForEachEntityChunk(ExecContext, [this, &Type, &Received](FMassExecutionContext& Ctx)
+		{
+			Mailbox->ForEachChunkMessage(Ctx, Type, [&Ctx, &Received](int32 EntityIndex, const FArcMassMailboxMessage& Message)
+			{
+				Received.Add(FReceived{Ctx.GetEntity(EntityIndex), Message});
+			});
+		});
+		return Received;
+	}
+
+	TEST_METHOD(SendMessage_FromWorkerThreads_AllMessagesSorted)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(16);
+		constexpr int32 NumSenders = 8;
+		constexpr int32 MessagesPerSender = 500;
+
+		ParallelFor(NumSenders, [this, &Entities](int32 Sender)
+		{
+			for (int32 Idx = 0; Idx < MessagesPerSender; ++Idx)
+			{
+				Send(TAG_TestMailbox_Hit, Entities[Idx % Entities.Num()], Sender * MessagesPerSender + Idx);
+			}
+		});
+		Sort();
+
+		ASSERT_THAT(AreEqual(NumSenders * MessagesPerSender, Mailbox->GetNumSortedMessages()));
+
+		// Per target, each sender's messages keep their send order.
+		const TArray<FReceived> Received = Receive(TAG_TestMailbox_Hit);
+		ASSERT_THAT(AreEqual(NumSenders * MessagesPerSender, Received.Num()));
+
+		TMap<TPair<FMassEntityHandle, int32>, int32> LastParam;
+		for (const FReceived& Entry : Received)
+		{
+			ASSERT_THAT(IsTrue(Entry.Entity == Entry.Message.Target));
+			int32& Last = LastParam.FindOrAdd(MakeTuple(Entry.Entity, Entry.Message.Param / MessagesPerSender), INDEX_NONE);
+			ASSERT_THAT(IsTrue(Entry.Message.Param > Last));
+			Last = Entry.Message.Param;
+		}
+	}
+
+	TEST_METHOD(SortPendingMessages_OrdersByChunkPositionAndSendOrder)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(4);
+		Send(TAG_TestMailbox_Hit, Entities[3], 0);
+		Send(TAG_TestMailbox_Heal, Entities[2], 1);
+		Send(TAG_TestMailbox_Hit, Entities[1], 2);
+		Send(TAG_TestMailbox_Hit, Entities[3], 3);
+		Send(TAG_TestMailbox_Hit, Entities[0], 4);
+		Sort();
+
+		const TArray<FReceived> Hits = Receive(TAG_TestMailbox_Hit);
+		ASSERT_THAT(AreEqual(4, Hits.Num()));
+		ASSERT_THAT(IsTrue(Entities[0] == Hits[0].Entity));
+		ASSERT_THAT(IsTrue(Entities[1] == Hits[1].Entity));
+		ASSERT_THAT(IsTrue(Entities[3] == Hits[2].Entity));
+		ASSERT_THAT(AreEqual(0, Hits[2].Message.Param));
+		ASSERT_THAT(IsTrue(Entities[3] == Hits[3].Entity));
+		ASSERT_THAT(AreEqual(3, Hits[3].Message.Param));
+
+		const TArray<FReceived> Heals = Receive(TAG_TestMailbox_Heal);
+		ASSERT_THAT(AreEqual(1, Heals.Num()));
+		ASSERT_THAT(IsTrue(Entities[2] == Heals[0].Entity));
+	}
+
+	TEST_METHOD(GetChunkMessages_ReturnsOnlyTheRequestedTypeInChunkOrder)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(3);
+		Send(TAG_TestMailbox_Hit, Entities[2], 0);
+		Send(TAG_TestMailbox_Heal, Entities[1], 1);
+		Send(TAG_TestMailbox_Hit, Entities[0], 2);
+		Sort();
+
+		TArray<FMassEntityHandle> Targets;
+		FMassExecutionContext ExecContext(*EntityManager);
+		FMassEntityQuery Query(EntityManager->AsShared());
+		Query.AddTagRequirement<FArcMassMailboxTag>(EMassFragmentPresence::All);
+		Query.ForEachEntityChunk(ExecContext, [this, &Targets](FMassExecutionContext& Ctx)
+		{
+			for (const FArcMassMailboxMessage& Message : Mailbox->GetChunkMessages(Ctx, TAG_TestMailbox_Hit))
+			{
+				Targets.Add(Message.Target);
+			}
+		});
+
+		ASSERT_THAT(AreEqual(2, Targets.Num()));
+		ASSERT_THAT(IsTrue(Entities[0] == Targets[0]));
+		ASSERT_THAT(IsTrue(Entities[2] == Targets[1]));
+	}
+
+	TEST_METHOD(SortPendingMessages_DropsMessagesToEntitiesWithoutMailbox)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(1);
+		const FMassEntityHandle Outsider = EntityManager->CreateEntity(EntityManager->CreateArchetype({FTransformFragment::StaticStruct()}));
+		Send(TAG_TestMailbox_Hit, Entities[0], 0);
+		Send(TAG_TestMailbox_Hit, Outsider, 1);
+		Sort();
+
+		ASSERT_THAT(AreEqual(1, Mailbox->GetNumSortedMessages()));
+	}
+
+	TEST_METHOD(ForEachChunkMessage_EntityMovedAfterSort_StillReceivesItsMessages)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(4);
+		for (int32 Idx = 0; Idx < Entities.Num(); ++Idx)
+		{
+			Send(TAG_TestMailbox_Hit, Entities[Idx], Idx);
+		}
+		Sort();
+
+		// Changes Entities[1]'s archetype and reorders the chunk it left.
+		EntityManager->AddFragmentToEntity(Entities[1], FAgentRadiusFragment::StaticStruct());
+
+		const TArray<FReceived> Received = Receive(TAG_TestMailbox_Hit);
+		ASSERT_THAT(AreEqual(Entities.Num(), Received.Num()));
+		for (const FReceived& Entry : Received)
+		{
+			ASSERT_THAT(IsTrue(Entry.Entity == Entry.Message.Target));
+			ASSERT_THAT(IsTrue(Entities[Entry.Message.Param] == Entry.Entity));
+		}
+	}
+
+	TEST_METHOD(ForEachChunkMessage_MessagesLastOneSort)
+	{
+		const TArray<FMassEntityHandle> Entities = CreateEntities(1);
+		Send(TAG_TestMailbox_Hit, Entities[0], 0);
+		Sort();
+		ASSERT_THAT(AreEqual(1, Receive(TAG_TestMailbox_Hit).Num()));
+
+		Sort();
+		ASSERT_THAT(AreEqual(0, Receive(TAG_TestMailbox_Hit).Num()));
+	}
+};
@@ -0,0 +1,85 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "ArcMassPhysicsBodyConfig.h"
+#include "ArcMassPhysicsBodyPool.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodySetup.h"
+
+TEST_CLASS(ArcMassPhysicsBodyPoolTest, "ArcMass.Physics.BodyPool")
+{
+	UWorld* TestWorld = nullptr;
+	UArcMassPhysicsBodyPoolSubsystem* Pool = nullptr;
+	UBodySetup* BodySetup = nullptr;
+
+	BEFORE_EACH()
+	{
+		TestWorld = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld=*/ false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(TestWorld);
+		Pool = TestWorld->GetSubsystem<UArcMassPhysicsBodyPoolSubsystem>();
+		ASSERT_THAT(IsNotNull(Pool));
+		ASSERT_THAT(IsNotNull(TestWorld->GetPhysicsScene()));
+
+		BodySetup = NewObject<UBodySetup>(TestWorld);
+		BodySetup->AggGeom.BoxElems.Add(FKBoxElem(100.f));
+		BodySetup->CreatePhysicsMeshes();
+	}
+
+	AFTER_EACH()
+	{
+		if (TestWorld != nullptr)
+		{
+			GEngine->DestroyWorldContext(TestWorld);
+			TestWorld->DestroyWorld(false);
+			TestWorld = nullptr;
+		}
+		Pool = nullptr;
+		BodySetup = nullptr;
+	}
+
+	FArcMassPhysicsBodyConfigFragment MakeConfig(FName ProfileName) const
+	{
+		FArcMassPhysicsBodyConfigFragment Config;
+		Config.BodySetup = BodySetup;
+		Config.BodyType = EArcMassPhysicsBodyType::Static;
+		Config.BodyTemplate.SetCollisionProfileName(ProfileName);
+		return Config;
+	}
+
+	FBodyInstance* CreateBody(const FArcMassPhysicsBodyConfigFragment& Config, const FTransform& Transform)
+	{
+		TArray<FBodyInstance*> Bodies;
+		UE::ArcMass::Physics::InitBodiesFromConfig(Config, MakeConstArrayView(&Transform, 1), TestWorld->GetPhysicsScene(), Bodies);
+		return Bodies.Num() == 1 ? Bodies[0] : nullptr;
+	}
+
+	TEST_METHOD(AcquireBody_ResetsScaleAndCollisionFromNewConfig)
+	{
+		const FArcMassPhysicsBodyConfigFragment BlockConfig = MakeConfig(UCollisionProfile::BlockAll_ProfileName);
+		const FArcMassPhysicsBodyConfigFragment OverlapConfig = MakeConfig(TEXT("OverlapAllDynamic"));
+		ASSERT_THAT(IsTrue(BlockConfig.BodyTemplate.GetObjectType() != OverlapConfig.BodyTemplate.GetObjectType()));
+
+		FBodyInstance* Body = CreateBody(BlockConfig, FTransform::Identity);
+		ASSERT_THAT(IsNotNull(Body));
+
+		TArray<FBodyInstance::FAsyncTermBodyPayload> Payloads;
+		Pool->ReleaseBody(BlockConfig, Body, Payloads);
+		ASSERT_THAT(AreEqual(0, Payloads.Num()));
+
+		const FTransform Target(FQuat::Identity, FVector(500.f, 0.f, 0.f), FVector(2.f));
+		FBodyInstance* Reused = Pool->AcquireBody(OverlapConfig, Target);
+		ASSERT_THAT(IsTrue(Body == Reused));
+
+		ASSERT_THAT(IsTrue(Reused->Scale3D.Equals(FVector(2.f))));
+		ASSERT_THAT(IsTrue(Reused->GetUnrealWorldTransform().GetScale3D().Equals(FVector(2.f))));
+		ASSERT_THAT(IsTrue(OverlapConfig.BodyTemplate.GetObjectType() == Reused->GetObjectType()));
+		ASSERT_THAT(IsTrue(Reused->GetResponseToChannel(ECC_WorldDynamic) == ECR_Overlap));
+		ASSERT_THAT(IsTrue(OverlapConfig.BodyTemplate.GetCollisionEnabled() == Reused->GetCollisionEnabled()));
+
+		Reused->TermBody();
+		delete Reused;
+	}
+};
@@ -47,6 +47,6 @@ void FArcMassDamageResistanceHandler::PostChange(FArcAttributeHandlerContext& Co
 			SourceTags,
 			FGameplayTagContainer());
 
-		StatesFragment->States[Mapping.ConditionTypeIndex].Resistance = FMath::Clamp(ResistanceValue, 0.f, 1.f);
+		StatesFragment->Resistance[Mapping.ConditionTypeIndex] = FMath::Clamp(ResistanceValue, 0.f, 1.f);
 	}
 }
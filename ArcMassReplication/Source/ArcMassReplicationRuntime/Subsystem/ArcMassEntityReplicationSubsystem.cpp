@@ -18,6 +18,7 @@
 #include "Replication/ArcMassEntityVessel.h"
 #include "Replication/ArcMassEntityVesselClusterRoot.h"
 #include "Traits/ArcMassEntityReplicationTrait.h"
+#include "UObject/UnrealType.h"
 
 namespace ArcMassEntityReplicationSubsystem_Private
 {
@@ -46,6 +47,38 @@ namespace ArcMassEntityReplicationSubsystem_Private
 		EEndReplicationFlags::Destroy
 		| EEndReplicationFlags::DestroyNetHandle
 		| EEndReplicationFlags::ClearNetPushId;
+
+	/**
+	 * Restore every property a typed subclass adds to its class defaults, so a pooled
+	 * vessel starts a new binding in the same state as a freshly constructed one.
+	 */
+	void ResetTypedVesselState(UArcMassEntityVessel* Vessel)
+	{
+		UClass* VesselClass = Vessel->GetClass();
+		const UObject* Defaults = VesselClass->GetDefaultObject();
+		for (TFieldIterator<FProperty> It(VesselClass); It; ++It)
+		{
+			const UClass* OwnerClass = It->GetOwnerClass();
+			if (OwnerClass != nullptr
+				&& OwnerClass != UArcMassEntityVessel::StaticClass()
+				&& OwnerClass->IsChildOf(UArcMassEntityVessel::StaticClass()))
+			{
+				It->CopyCompleteValue_InContainer(Vessel, Defaults);
+			}
+		}
+	}
+
+	void LogPoolStats(const TCHAR* PoolName, const FArcMassVesselPoolStats& Stats)
+	{
+		const int64 Total = Stats.Hits + Stats.Misses;
+		if (Total == 0)
+		{
+			return;
+		}
+		UE_LOG(LogTemp, Log,
+			TEXT("ArcMassReplication: vessel pool '%s' — %lld acquires, %.1f%% hits, %lld misses, %lld trimmed"),
+			PoolName, Total, 100.0 * static_cast<double>(Stats.Hits) / static_cast<double>(Total), Stats.Misses, Stats.Trimmed);
+	}
 }
 
 bool UArcMassEntityReplicationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
@@ -90,8 +123,15 @@ void UArcMassEntityReplicationSubsystem::Deinitialize()
 		OnNetDriverCreatedHandle.Reset();
 	}
 
+	ArcMassEntityReplicationSubsystem_Private::LogPoolStats(TEXT("UArcMassEntityVessel"), VesselPoolStats);
+	for (const TPair<TSubclassOf<UArcMassEntityVessel>, FArcMassVesselClassPool>& Pair : TypedVesselPools)
+	{
+		ArcMassEntityReplicationSubsystem_Private::LogPoolStats(*GetNameSafe(Pair.Key.Get()), Pair.Value.Stats);
+	}
+
 	EntityToVessel.Empty();
 	VesselPool.Empty();
+	TypedVesselPools.Empty();
 	ConfigToProtocol.Empty();
 	ProtocolToConfig.Empty();
 	VesselClusterRoot = nullptr;
@@ -128,9 +168,11 @@ UArcMassEntityVessel* UArcMassEntityReplicationSubsystem::AcquireVessel()
 {
 	if (VesselPool.Num() > 0)
 	{
+		++VesselPoolStats.Hits;
 		UArcMassEntityVessel* Vessel = VesselPool.Pop(EAllowShrinking::No);
 		return Vessel;
 	}
+	++VesselPoolStats.Misses;
 	UE_LOG(LogTemp, Warning, TEXT("ArcMassReplication: vessel pool exhausted; growing"));
 	UArcMassEntityVessel* Vessel = NewObject<UArcMassEntityVessel>(this);
 #if 0  // GC clustering disabled while smoke-test instability is investigated.
@@ -151,24 +193,79 @@ void UArcMassEntityReplicationSubsystem::ReleaseVessel(UArcMassEntityVessel* Ves
 	Vessel->EntityHandle = FMassEntityHandle();
 	Vessel->Config = nullptr;
 
-	// Only return the exact base class to the pool — typed subclasses must be GC'd
-	// (they have UPROPERTY state that pool reuse would not safely reset).
 	if (Vessel->GetClass() == UArcMassEntityVessel::StaticClass())
 	{
 		VesselPool.Add(Vessel);
+		return;
 	}
-	// Otherwise the vessel becomes unreachable and GC reclaims it.
+
+	ReleaseTypedVessel(Vessel);
+}
+
+UArcMassEntityVessel* UArcMassEntityReplicationSubsystem::AcquireTypedVessel(TSubclassOf<UArcMassEntityVessel> VesselClass)
+{
+	FArcMassVesselClassPool& Pool = TypedVesselPools.FindOrAdd(VesselClass);
+	if (Pool.Free.Num() > 0)
+	{
+		++Pool.Stats.Hits;
+		return Pool.Free.Pop(EAllowShrinking::No);
+	}
+
+	++Pool.Stats.Misses;
+	return NewObject<UArcMassEntityVessel>(this, VesselClass);
+}
+
+void UArcMassEntityReplicationSubsystem::ReleaseTypedVessel(UArcMassEntityVessel* Vessel)
+{
+	FArcMassVesselClassPool& Pool = TypedVesselPools.FindOrAdd(Vessel->GetClass());
+	if (Pool.Free.Num() >= Pool.HighWatermark)
+	{
+		// Above the high watermark the vessel becomes unreachable and GC reclaims it.
+		++Pool.Stats.Trimmed;
+		return;
+	}
+
+	ArcMassEntityReplicationSubsystem_Private::ResetTypedVesselState(Vessel);
+	Pool.Free.Add(Vessel);
+}
+
+const FArcMassVesselPoolStats* UArcMassEntityReplicationSubsystem::FindVesselPoolStats(TSubclassOf<UArcMassEntityVessel> VesselClass) const
+{
+	if (VesselClass == UArcMassEntityVessel::StaticClass())
+	{
+		return &VesselPoolStats;
+	}
+	const FArcMassVesselClassPool* Pool = TypedVesselPools.Find(VesselClass);
+	return Pool != nullptr ? &Pool->Stats : nullptr;
 }
 
 void UArcMassEntityReplicationSubsystem::RegisterVesselClassForConfig(
 	UMassEntityConfigAsset* Config,
-	TSubclassOf<UArcMassEntityVessel> VesselClass)
+	TSubclassOf<UArcMassEntityVessel> VesselClass,
+	int32 LowWatermark,
+	int32 HighWatermark)
 {
 	if (Config == nullptr || VesselClass == nullptr)
 	{
 		return;
 	}
 	ConfigToVesselClass.Add(Config, VesselClass);
+
+	if (VesselClass != UArcMassEntityVessel::StaticClass())
+	{
+		FArcMassVesselClassPool& Pool = TypedVesselPools.FindOrAdd(VesselClass);
+		Pool.LowWatermark = FMath::Max(Pool.LowWatermark, FMath::Max(0, LowWatermark));
+		Pool.HighWatermark = FMath::Max3(Pool.HighWatermark, HighWatermark, Pool.LowWatermark);
+
+		// Pre-warm here, at registration, so the first RegisterEntity / factory instantiation of the
+		// class doesn't pay for NewObject.
+		Pool.Free.Reserve(Pool.LowWatermark);
+		while (Pool.Free.Num() < Pool.LowWatermark)
+		{
+			Pool.Free.Add(NewObject<UArcMassEntityVessel>(this, VesselClass));
+		}
+	}
+
 	UE_LOG(LogTemp, Log,
 		TEXT("ArcMassReplication: registered vessel class '%s' for config '%s'"),
 		*VesselClass->GetName(), *Config->GetName());
@@ -185,13 +282,12 @@ UArcMassEntityVessel* UArcMassEntityReplicationSubsystem::AcquireVesselForConfig
 	UMassEntityConfigAsset* Config)
 {
 	TSubclassOf<UArcMassEntityVessel> VesselClass = FindVesselClassForConfig(Config);
-	if (VesselClass == nullptr)
+	if (VesselClass == nullptr || VesselClass == UArcMassEntityVessel::StaticClass())
 	{
 		// Legacy / un-typed config — fall back to pool-allocated base class.
 		return AcquireVessel();
 	}
-	UArcMassEntityVessel* Vessel = NewObject<UArcMassEntityVessel>(this, VesselClass);
-	return Vessel;
+	return AcquireTypedVessel(VesselClass);
 }
 
 UArcMassEntityVessel* UArcMassEntityReplicationSubsystem::AcquireClientVessel(UMassEntityConfigAsset* Config)
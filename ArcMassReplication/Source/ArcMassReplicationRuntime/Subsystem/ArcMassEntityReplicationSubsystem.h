@@ -14,6 +14,37 @@
 class UArcMassEntityVesselClusterRoot;
 class UMassEntityConfigAsset;
 
+/** Pool hit/miss counters for one vessel class. */
+struct FArcMassVesselPoolStats
+{
+	/** Acquires served from the pool. */
+	int64 Hits = 0;
+
+	/** Acquires that had to NewObject a vessel. */
+	int64 Misses = 0;
+
+	/** Releases dropped because the pool was at its high watermark. */
+	int64 Trimmed = 0;
+};
+
+/**
+ * Free vessels of one typed UArcMassEntityVessel subclass.
+ * Refilled to LowWatermark when the class is registered; releases beyond HighWatermark are left to GC.
+ */
+USTRUCT()
+struct FArcMassVesselClassPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UArcMassEntityVessel>> Free;
+
+	int32 LowWatermark = 0;
+	int32 HighWatermark = 0;
+
+	FArcMassVesselPoolStats Stats;
+};
+
 /**
  * World subsystem owning per-entity Iris replication for Mass entities.
  *
@@ -105,17 +136,26 @@ public:
 	 * Must be called before the corresponding RegisterEntity / first replication.
 	 * Idempotent for the same (Config, VesselClass) pair.
 	 *
+	 * Typed vessels are pooled per class: the pool is pre-warmed to LowWatermark
+	 * here and keeps at most HighWatermark free vessels. When several configs share
+	 * a class the larger watermarks win.
+	 *
 	 * In the test-only path this is called explicitly. Future codegen modules
 	 * register at StartupModule.
 	 */
 	void RegisterVesselClassForConfig(
 		UMassEntityConfigAsset* Config,
-		TSubclassOf<UArcMassEntityVessel> VesselClass);
+		TSubclassOf<UArcMassEntityVessel> VesselClass,
+		int32 LowWatermark = 0,
+		int32 HighWatermark = 64);
 
 	/** Returns the registered subclass for a Config, or null if none registered. */
 	TSubclassOf<UArcMassEntityVessel> FindVesselClassForConfig(
 		UMassEntityConfigAsset* Config) const;
 
+	/** Pool counters for a vessel class (the base class reports the shared untyped pool). Null if never pooled. */
+	const FArcMassVesselPoolStats* FindVesselPoolStats(TSubclassOf<UArcMassEntityVessel> VesselClass) const;
+
 private:
 	friend struct FArcMassEntityReplicationSubsystemTestAccess;
 
@@ -144,14 +184,14 @@ private:
 
 	/**
 	 * Allocate (or pool-acquire) a vessel of the appropriate class for Config.
-	 * If a typed subclass is registered, NewObjects an instance of that subclass.
+	 * If a typed subclass is registered, acquires from that class's pool.
 	 * Otherwise falls back to AcquireVessel (base class, may come from the pool).
-	 *
-	 * Note: typed-subclass instances bypass the pre-allocated pool. This is fine
-	 * for the smoke test (one entity). Future work: per-class pooling.
 	 */
 	UArcMassEntityVessel* AcquireVesselForConfig(UMassEntityConfigAsset* Config);
 
+	UArcMassEntityVessel* AcquireTypedVessel(TSubclassOf<UArcMassEntityVessel> VesselClass);
+	void ReleaseTypedVessel(UArcMassEntityVessel* Vessel);
+
 	UPROPERTY()
 	TMap<TObjectPtr<UMassEntityConfigAsset>, TSubclassOf<UArcMassEntityVessel>> ConfigToVesselClass;
 
@@ -164,6 +204,11 @@ private:
 	UPROPERTY()
 	TArray<TObjectPtr<UArcMassEntityVessel>> VesselPool;
 
+	FArcMassVesselPoolStats VesselPoolStats;
+
+	UPROPERTY()
+	TMap<TSubclassOf<UArcMassEntityVessel>, FArcMassVesselClassPool> TypedVesselPools;
+
 	UPROPERTY()
 	TMap<FMassEntityHandle, TObjectPtr<UArcMassEntityVessel>> EntityToVessel;
 
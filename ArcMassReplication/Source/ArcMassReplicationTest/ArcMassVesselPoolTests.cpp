@@ -1,8 +1,10 @@
 // Copyright Lukasz Baran. All Rights Reserved.
 
 #include "CQTest.h"
+#include "ArcMassRepProxy_TestPayload.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "MassEntityConfigAsset.h"
 #include "Replication/ArcMassEntityVessel.h"
 #include "Subsystem/ArcMassEntityReplicationSubsystem.h"
 #include "UObject/UObjectArray.h"
@@ -23,6 +25,17 @@ struct FArcMassEntityReplicationSubsystemTestAccess
 	{
 		Subsystem.ReleaseVessel(Vessel);
 	}
+
+	static UArcMassEntityVessel* AcquireVesselForConfig(UArcMassEntityReplicationSubsystem& Subsystem, UMassEntityConfigAsset* Config)
+	{
+		return Subsystem.AcquireVesselForConfig(Config);
+	}
+
+	static int32 GetNumFreeTypedVessels(UArcMassEntityReplicationSubsystem& Subsystem, TSubclassOf<UArcMassEntityVessel> VesselClass)
+	{
+		const FArcMassVesselClassPool* Pool = Subsystem.TypedVesselPools.Find(VesselClass);
+		return Pool != nullptr ? Pool->Free.Num() : 0;
+	}
 };
 
 TEST_CLASS(ArcMassVesselPoolTest, "Arc.MassReplication.VesselPool")
@@ -84,4 +97,56 @@ TEST_CLASS(ArcMassVesselPoolTest, "Arc.MassReplication.VesselPool")
 
 		FArcMassEntityReplicationSubsystemTestAccess::ReleaseVessel(*Subsystem, Vessel);
 	}
+
+	TEST_METHOD(RegisterVesselClass_PrewarmsToLowWatermark)
+	{
+		UMassEntityConfigAsset* Config = NewObject<UMassEntityConfigAsset>(TestWorld);
+		Subsystem->RegisterVesselClassForConfig(Config, UArcMassRepProxy_TestPayload::StaticClass(), 4, 8);
+
+		ASSERT_THAT(AreEqual(4, FArcMassEntityReplicationSubsystemTestAccess::GetNumFreeTypedVessels(*Subsystem, UArcMassRepProxy_TestPayload::StaticClass())));
+
+		UArcMassEntityVessel* Vessel = FArcMassEntityReplicationSubsystemTestAccess::AcquireVesselForConfig(*Subsystem, Config);
+		ASSERT_THAT(IsNotNull(Cast<UArcMassRepProxy_TestPayload>(Vessel)));
+
+		const FArcMassVesselPoolStats* Stats = Subsystem->FindVesselPoolStats(UArcMassRepProxy_TestPayload::StaticClass());
+		ASSERT_THAT(IsNotNull(Stats));
+		ASSERT_THAT(AreEqual(int64(1), Stats->Hits));
+		ASSERT_THAT(AreEqual(int64(0), Stats->Misses));
+	}
+
+	TEST_METHOD(TypedVessel_ReturnsToPoolWithDefaultState)
+	{
+		UMassEntityConfigAsset* Config = NewObject<UMassEntityConfigAsset>(TestWorld);
+		Subsystem->RegisterVesselClassForConfig(Config, UArcMassRepProxy_TestPayload::StaticClass());
+
+		UArcMassRepProxy_TestPayload* First = Cast<UArcMassRepProxy_TestPayload>(
+			FArcMassEntityReplicationSubsystemTestAccess::AcquireVesselForConfig(*Subsystem, Config));
+		ASSERT_THAT(IsNotNull(First));
+		First->Payload.Payload = 0xC0FFEE;
+
+		FArcMassEntityReplicationSubsystemTestAccess::ReleaseVessel(*Subsystem, First);
+		UArcMassRepProxy_TestPayload* Second = Cast<UArcMassRepProxy_TestPayload>(
+			FArcMassEntityReplicationSubsystemTestAccess::AcquireVesselForConfig(*Subsystem, Config));
+
+		ASSERT_THAT(AreEqual(First, Second));
+		ASSERT_THAT(AreEqual(uint32(0), Second->Payload.Payload));
+		ASSERT_THAT(IsNull(Second->Config.Get()));
+	}
+
+	TEST_METHOD(TypedVessel_ReleaseAboveHighWatermarkIsTrimmed)
+	{
+		UMassEntityConfigAsset* Config = NewObject<UMassEntityConfigAsset>(TestWorld);
+		Subsystem->RegisterVesselClassForConfig(Config, UArcMassRepProxy_TestPayload::StaticClass(), 0, 1);
+
+		UArcMassEntityVessel* First = FArcMassEntityReplicationSubsystemTestAccess::AcquireVesselForConfig(*Subsystem, Config);
+		UArcMassEntityVessel* Second = FArcMassEntityReplicationSubsystemTestAccess::AcquireVesselForConfig(*Subsystem, Config);
+		FArcMassEntityReplicationSubsystemTestAccess::ReleaseVessel(*Subsystem, First);
+		FArcMassEntityReplicationSubsystemTestAccess::ReleaseVessel(*Subsystem, Second);
+
+		ASSERT_THAT(AreEqual(1, FArcMassEntityReplicationSubsystemTestAccess::GetNumFreeTypedVessels(*Subsystem, UArcMassRepProxy_TestPayload::StaticClass())));
+		const FArcMassVesselPoolStats* Stats = Subsystem->FindVesselPoolStats(UArcMassRepProxy_TestPayload::StaticClass());
+		ASSERT_THAT(IsNotNull(Stats));
+		ASSERT_THAT(AreEqual(int64(2), Stats->Misses));
+		ASSERT_THAT(AreEqual(int64(1), Stats->Trimmed));
+	}
 };
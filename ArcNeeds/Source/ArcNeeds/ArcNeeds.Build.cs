@@ -46,7 +46,9 @@ public class ArcNeeds : ModuleRules
 				"Slate",
 				"SlateCore",
 				"MassActors",
-				"MassGameplayDebug"
+				"MassGameplayDebug",
+				"MassSignals",
+				"DeveloperSettings"
 			}
 		);
 
@@ -0,0 +1,22 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcNeedsSettings.h"
+#include "Fragments/ArcNeedFragment.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNeedsSettings)
+
+UArcNeedsSettings::UArcNeedsSettings()
+{
+	// Needs grow towards 100; the defaults mark "needs attention" and "critical" for the survival needs.
+	for (UScriptStruct* NeedType : { FArcHungerNeedFragment::StaticStruct(), FArcThirstNeedFragment::StaticStruct(), FArcFatigueNeedFragment::StaticStruct() })
+	{
+		for (const float Value : { 60.f, 90.f })
+		{
+			FArcNeedThresholdConfig& Threshold = Thresholds.AddDefaulted_GetRef();
+			Threshold.NeedType = NeedType;
+			Threshold.Value = Value;
+			Threshold.SignalName = UE::ArcNeeds::Signals::NeedThresholdCrossed;
+		}
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ArcNeedsSettings.generated.h"
+
+/** A value of one need type that signals the entity when the need reaches it. */
+USTRUCT()
+struct ARCNEEDS_API FArcNeedThresholdConfig
+{
+	GENERATED_BODY()
+
+	/** Need fragment type (FArcNeedFragment or a subtype). */
+	UPROPERTY(EditAnywhere, Category = "Needs", meta = (BaseStruct = "/Script/ArcNeeds.ArcNeedFragment"))
+	TObjectPtr<UScriptStruct> NeedType;
+
+	UPROPERTY(EditAnywhere, Category = "Needs", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+	float Value = 50.f;
+
+	/** Mass signal sent to the entity when the need crosses Value, in either direction. */
+	UPROPERTY(EditAnywhere, Category = "Needs")
+	FName SignalName;
+};
+
+/** Threshold events for UArcNeedScheduleSubsystem. */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Arc Needs"))
+class ARCNEEDS_API UArcNeedsSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UArcNeedsSettings();
+
+	virtual FName GetCategoryName() const override { return FName("ArcNeeds"); }
+	virtual FName GetSectionName() const override { return FName("Thresholds"); }
+
+	/** Need values that raise a signal when crossed. Needs are never ticked, so these are the only per-entity upkeep. */
+	UPROPERTY(config, EditAnywhere, Category = "Thresholds")
+	TArray<FArcNeedThresholdConfig> Thresholds;
+};
@@ -22,15 +22,15 @@
 #include "ArcNeedsSurvivalAttributeSet.h"
 
 #include "AbilitySystemComponent.h"
-#include "MassEntitySubsystem.h"
 #include "AbilitySystem/ArcGameplayAbilityActorInfo.h"
 #include "Engine/World.h"
 #include "Fragments/ArcNeedFragment.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNeedsSurvivalAttributeSet)
 
 // ---------------------------------------------------------------------------
-// File-scoped helpers: entity handle and entity manager access via
+// File-scoped helpers: entity handle and need scheduler access via
 // FArcGameplayAbilityActorInfo, avoiding the old MassAgentComponent path.
 // ---------------------------------------------------------------------------
 
@@ -46,42 +46,39 @@ namespace ArcNeedsSurvivalAttributes
 		return FMassEntityHandle();
 	}
 
-	static FMassEntityManager* GetEntityManager(const UAbilitySystemComponent* ASC)
+	static UArcNeedScheduleSubsystem* GetNeedScheduler(const UAbilitySystemComponent* ASC)
 	{
 		if (UWorld* World = ASC->GetWorld())
 		{
-			if (UMassEntitySubsystem* MES = World->GetSubsystem<UMassEntitySubsystem>())
-			{
-				return &MES->GetMutableEntityManager();
-			}
+			return World->GetSubsystem<UArcNeedScheduleSubsystem>();
 		}
 		return nullptr;
 	}
 } // namespace ArcNeedsSurvivalAttributes
 
 // ---------------------------------------------------------------------------
-// Internal helper -- retrieves a mutable Mass fragment pointer for the entity.
-// Returns nullptr if the entity is invalid or the fragment is absent.
+// Internal helper -- applies an operation to the entity's need through the
+// schedule subsystem, so the closed-form value and its thresholds stay valid.
 // ---------------------------------------------------------------------------
 
 template <typename FragmentType>
-static FragmentType* GetNeedFragment(UAbilitySystemComponent* ASC)
+static void ModifyNeed(UAbilitySystemComponent* ASC, EArcNeedOperation Operation, float Value)
 {
 	using namespace ArcNeedsSurvivalAttributes;
 
 	FMassEntityHandle Entity = GetEntityHandle(ASC);
 	if (!Entity.IsValid())
 	{
-		return nullptr;
+		return;
 	}
 
-	FMassEntityManager* EntityManager = GetEntityManager(ASC);
-	if (!EntityManager)
+	UArcNeedScheduleSubsystem* NeedScheduler = GetNeedScheduler(ASC);
+	if (!NeedScheduler)
 	{
-		return nullptr;
+		return;
 	}
 
-	return EntityManager->GetFragmentDataPtr<FragmentType>(Entity);
+	NeedScheduler->ModifyNeed(Entity, FragmentType::StaticStruct(), Operation, Value);
 }
 
 // ---------------------------------------------------------------------------
@@ -130,13 +127,7 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, AddHunger)
 		const float Value = GetAddHunger();
 		SetAddHunger(0.f);
 
-		FArcHungerNeedFragment* Fragment = GetNeedFragment<FArcHungerNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue + Value, 0.f, 100.f);
+		ModifyNeed<FArcHungerNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Add, Value);
 	};
 }
 
@@ -147,13 +138,7 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, RemoveHunger)
 		const float Value = GetRemoveHunger();
 		SetRemoveHunger(0.f);
 
-		FArcHungerNeedFragment* Fragment = GetNeedFragment<FArcHungerNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue - Value, 0.f, 100.f);
+		ModifyNeed<FArcHungerNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Subtract, Value);
 	};
 }
 
@@ -168,13 +153,7 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, AddThirst)
 		const float Value = GetAddThirst();
 		SetAddThirst(0.f);
 
-		FArcThirstNeedFragment* Fragment = GetNeedFragment<FArcThirstNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue + Value, 0.f, 100.f);
+		ModifyNeed<FArcThirstNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Add, Value);
 	};
 }
 
@@ -185,13 +164,7 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, RemoveThirst)
 		const float Value = GetRemoveThirst();
 		SetRemoveThirst(0.f);
 
-		FArcThirstNeedFragment* Fragment = GetNeedFragment<FArcThirstNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue - Value, 0.f, 100.f);
+		ModifyNeed<FArcThirstNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Subtract, Value);
 	};
 }
 
@@ -206,13 +179,7 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, AddFatigue)
 		const float Value = GetAddFatigue();
 		SetAddFatigue(0.f);
 
-		FArcFatigueNeedFragment* Fragment = GetNeedFragment<FArcFatigueNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue + Value, 0.f, 100.f);
+		ModifyNeed<FArcFatigueNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Add, Value);
 	};
 }
 
@@ -223,12 +190,6 @@ ARC_DECLARE_ATTRIBUTE_HANDLER(UArcNeedsSurvivalAttributeSet, RemoveFatigue)
 		const float Value = GetRemoveFatigue();
 		SetRemoveFatigue(0.f);
 
-		FArcFatigueNeedFragment* Fragment = GetNeedFragment<FArcFatigueNeedFragment>(GetOwningAbilitySystemComponent());
-		if (!Fragment)
-		{
-			return;
-		}
-
-		Fragment->CurrentValue = FMath::Clamp(Fragment->CurrentValue - Value, 0.f, 100.f);
+		ModifyNeed<FArcFatigueNeedFragment>(GetOwningAbilitySystemComponent(), EArcNeedOperation::Subtract, Value);
 	};
 }
@@ -215,12 +215,15 @@ void FGameplayDebuggerCategory_ArcNeeds::CollectData(APlayerController* OwnerPC,
 
 	AddTextLine(FString::Printf(TEXT("{white}Entity: {yellow}%s"), *CachedEntity.DebugGetDescription()));
 
+	const UWorld* World = EntityManager.GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
 	// --- FArcHungerNeedFragment ---
 	if (const FArcHungerNeedFragment* HungerFragment = EntityManager.GetFragmentDataPtr<FArcHungerNeedFragment>(CachedEntity))
 	{
 		AddTextLine(FString::Printf(TEXT("{cyan}--- Hunger ---")));
 		AddTextLine(FString::Printf(TEXT("  {white}Value: {green}%.1f{white}  Rate: %.2f  Resistance: %.2f  Type: %d"),
-			HungerFragment->CurrentValue, HungerFragment->ChangeRate, HungerFragment->Resistance, HungerFragment->NeedType));
+			HungerFragment->GetValue(Now), HungerFragment->ChangeRate, HungerFragment->Resistance, HungerFragment->NeedType));
 	}
 
 	// --- FArcThirstNeedFragment ---
@@ -228,7 +231,7 @@ void FGameplayDebuggerCategory_ArcNeeds::CollectData(APlayerController* OwnerPC,
 	{
 		AddTextLine(FString::Printf(TEXT("{cyan}--- Thirst ---")));
 		AddTextLine(FString::Printf(TEXT("  {white}Value: {green}%.1f{white}  Rate: %.2f  Resistance: %.2f  Type: %d"),
-			ThirstFragment->CurrentValue, ThirstFragment->ChangeRate, ThirstFragment->Resistance, ThirstFragment->NeedType));
+			ThirstFragment->GetValue(Now), ThirstFragment->ChangeRate, ThirstFragment->Resistance, ThirstFragment->NeedType));
 	}
 
 	// --- FArcFatigueNeedFragment ---
@@ -236,7 +239,7 @@ void FGameplayDebuggerCategory_ArcNeeds::CollectData(APlayerController* OwnerPC,
 	{
 		AddTextLine(FString::Printf(TEXT("{cyan}--- Fatigue ---")));
 		AddTextLine(FString::Printf(TEXT("  {white}Value: {green}%.1f{white}  Rate: %.2f  Resistance: %.2f  Type: %d"),
-			FatigueFragment->CurrentValue, FatigueFragment->ChangeRate, FatigueFragment->Resistance, FatigueFragment->NeedType));
+			FatigueFragment->GetValue(Now), FatigueFragment->ChangeRate, FatigueFragment->Resistance, FatigueFragment->NeedType));
 	}
 }
 
@@ -22,3 +22,21 @@
 #include "Fragments/ArcNeedFragment.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNeedFragment)
+
+double FArcNeedFragment::GetSecondsUntil(float Threshold, double Now) const
+{
+	if (FMath::IsNearlyZero(ChangeRate) || Threshold < MinValue || Threshold > MaxValue)
+	{
+		return -1.0;
+	}
+
+	const float Value = GetValue(Now);
+	const float Distance = Threshold - Value;
+	if (Distance * ChangeRate <= 0.f)
+	{
+		// Already there, or moving away from it.
+		return FMath::IsNearlyZero(Distance) ? 0.0 : -1.0;
+	}
+
+	return static_cast<double>(Distance) / static_cast<double>(ChangeRate);
+}
@@ -40,22 +40,92 @@ enum class EArcNeedFillType : uint8
 	UntilValue
 };
 
+/**
+ * A need stored in closed form: CurrentValue at LastUpdateTime plus ChangeRate per second, clamped to
+ * [MinValue, MaxValue]. Nothing ticks it; read it with GetValue and change it through
+ * UArcNeedScheduleSubsystem so its threshold events are re-planned.
+ */
 USTRUCT(BlueprintType)
 struct ARCNEEDS_API FArcNeedFragment : public FMassFragment
 {
 	GENERATED_BODY()
 
+	static constexpr float MinValue = 0.f;
+	static constexpr float MaxValue = 100.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	uint8 NeedType = 0;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float Resistance = 0.f;
 
+	/** Change per second. Use SetChangeRate at runtime so the value accrued so far is kept. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float ChangeRate = 0.f;
 
+	/** Value at LastUpdateTime (the initial value until the need is anchored). Use GetValue for the current value. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float CurrentValue = 0.f;
+
+	/** World time CurrentValue was taken at. Negative until UArcNeedScheduleSubsystem anchors the need. */
+	double LastUpdateTime = -1.0;
+
+	/** Bumped on every re-plan; scheduled threshold events carrying an older serial are dropped. */
+	uint32 ScheduleSerial = 0;
+
+	bool IsAnchored() const { return LastUpdateTime >= 0.0; }
+
+	/** Value at world time Now. Identical to integrating ChangeRate with per-step clamping. */
+	float GetValue(double Now) const
+	{
+		if (!IsAnchored())
+		{
+			return CurrentValue;
+		}
+		const double Elapsed = FMath::Max(0.0, Now - LastUpdateTime);
+		return static_cast<float>(FMath::Clamp(CurrentValue + ChangeRate * Elapsed, MinValue, MaxValue));
+	}
+
+	/** Start accruing from Now. */
+	void Anchor(double Now)
+	{
+		CurrentValue = GetValue(Now);
+		LastUpdateTime = Now;
+	}
+
+	void SetValue(float NewValue, double Now)
+	{
+		CurrentValue = FMath::Clamp(NewValue, MinValue, MaxValue);
+		LastUpdateTime = Now;
+	}
+
+	void ApplyOperation(EArcNeedOperation Operation, float Value, double Now)
+	{
+		switch (Operation)
+		{
+			case EArcNeedOperation::Add:
+				SetValue(GetValue(Now) + Value, Now);
+				break;
+			case EArcNeedOperation::Subtract:
+				SetValue(GetValue(Now) - Value, Now);
+				break;
+			case EArcNeedOperation::Override:
+				SetValue(Value, Now);
+				break;
+		}
+	}
+
+	void SetChangeRate(float NewRate, double Now)
+	{
+		Anchor(Now);
+		ChangeRate = NewRate;
+	}
+
+	/**
+	 * Seconds from Now until the value reaches Threshold, moving at ChangeRate.
+	 * Returns a negative number if it never does (no rate, wrong direction, or outside the clamp range).
+	 */
+	double GetSecondsUntil(float Threshold, double Now) const;
 };
 
 USTRUCT(BlueprintType)
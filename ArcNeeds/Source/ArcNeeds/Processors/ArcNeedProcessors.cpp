@@ -21,108 +21,138 @@
 
 #include "Processors/ArcNeedProcessors.h"
 #include "MassExecutionContext.h"
+#include "MassSignalSubsystem.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNeedProcessors)
 
+namespace UE::ArcNeeds::Private
+{
+	template <typename TNeedFragment>
+	void ScheduleAddedNeeds(FMassEntityQuery& Query, FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+	{
+		UWorld* World = EntityManager.GetWorld();
+		UArcNeedScheduleSubsystem* Scheduler = World ? World->GetSubsystem<UArcNeedScheduleSubsystem>() : nullptr;
+		if (!Scheduler)
+		{
+			return;
+		}
+
+		const double Now = Scheduler->GetNow();
+		Query.ForEachEntityChunk(Context, [Scheduler, Now](FMassExecutionContext& Ctx)
+		{
+			const TArrayView<TNeedFragment> Needs = Ctx.GetMutableFragmentView<TNeedFragment>();
+
+			for (int32 EntityIndex = 0; EntityIndex < Ctx.GetNumEntities(); ++EntityIndex)
+			{
+				Scheduler->ScheduleNeed(Ctx.GetEntity(EntityIndex), TNeedFragment::StaticStruct(), Needs[EntityIndex], Now);
+			}
+		});
+	}
+}
+
 // ---------------------------------------------------------------------------
-// UArcHungerNeedProcessor
+// UArcHungerNeedAddObserver
 // ---------------------------------------------------------------------------
 
-UArcHungerNeedProcessor::UArcHungerNeedProcessor()
+UArcHungerNeedAddObserver::UArcHungerNeedAddObserver()
 	: NeedsQuery(*this)
 {
-	ProcessingPhase = EMassProcessingPhase::DuringPhysics;
+	ObservedTypes.Add(FArcHungerNeedFragment::StaticStruct());
+	ObservedOperations = EMassObservedOperationFlags::Add;
+	bRequiresGameThreadExecution = true;
 }
 
-void UArcHungerNeedProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+void UArcHungerNeedAddObserver::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	NeedsQuery.Initialize(EntityManager);
 	NeedsQuery.AddRequirement<FArcHungerNeedFragment>(EMassFragmentAccess::ReadWrite);
 	NeedsQuery.RegisterWithProcessor(*this);
 }
 
-void UArcHungerNeedProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+void UArcHungerNeedAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(ArcHungerNeed);
-
-	NeedsQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
-	{
-		const float DeltaTime = Context.GetDeltaTimeSeconds();
-		const TArrayView<FArcHungerNeedFragment> Needs = Context.GetMutableFragmentView<FArcHungerNeedFragment>();
-
-		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
-		{
-			FArcHungerNeedFragment& Need = Needs[EntityIndex];
-			Need.CurrentValue = FMath::Clamp(Need.CurrentValue + (Need.ChangeRate * DeltaTime), 0.f, 100.f);
-		}
-	});
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcHungerNeedAdd);
+	UE::ArcNeeds::Private::ScheduleAddedNeeds<FArcHungerNeedFragment>(NeedsQuery, EntityManager, Context);
 }
 
 // ---------------------------------------------------------------------------
-// UArcThirstNeedProcessor
+// UArcThirstNeedAddObserver
 // ---------------------------------------------------------------------------
 
-UArcThirstNeedProcessor::UArcThirstNeedProcessor()
+UArcThirstNeedAddObserver::UArcThirstNeedAddObserver()
 	: NeedsQuery(*this)
 {
-	ProcessingPhase = EMassProcessingPhase::DuringPhysics;
+	ObservedTypes.Add(FArcThirstNeedFragment::StaticStruct());
+	ObservedOperations = EMassObservedOperationFlags::Add;
+	bRequiresGameThreadExecution = true;
 }
 
-void UArcThirstNeedProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+void UArcThirstNeedAddObserver::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	NeedsQuery.Initialize(EntityManager);
 	NeedsQuery.AddRequirement<FArcThirstNeedFragment>(EMassFragmentAccess::ReadWrite);
 	NeedsQuery.RegisterWithProcessor(*this);
 }
 
-void UArcThirstNeedProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+void UArcThirstNeedAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(ArcThirstNeed);
-
-	NeedsQuery.ForEachEntityChunk(EntityManager, Context, [](FMassExecutionContext& Context)
-	{
-		const float DeltaTime = Context.GetDeltaTimeSeconds();
-		const TArrayView<FArcThirstNeedFragment> Needs = Context.GetMutableFragmentView<FArcThirstNeedFragment>();
-
-		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
-		{
-			FArcThirstNeedFragment& Need = Needs[EntityIndex];
-			Need.CurrentValue = FMath::Clamp(Need.CurrentValue + (Need.ChangeRate * DeltaTime), 0.f, 100.f);
-		}
-	});
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcThirstNeedAdd);
+	UE::ArcNeeds::Private::ScheduleAddedNeeds<FArcThirstNeedFragment>(NeedsQuery, EntityManager, Context);
 }
 
 // ---------------------------------------------------------------------------
-// UArcFatigueNeedProcessor
+// UArcFatigueNeedAddObserver
 // ---------------------------------------------------------------------------
 
-UArcFatigueNeedProcessor::UArcFatigueNeedProcessor()
+UArcFatigueNeedAddObserver::UArcFatigueNeedAddObserver()
 	: NeedsQuery(*this)
 {
-	ProcessingPhase = EMassProcessingPhase::DuringPhysics;
+	ObservedTypes.Add(FArcFatigueNeedFragment::StaticStruct());
+	ObservedOperations = EMassObservedOperationFlags::Add;
 	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	bRequiresGameThreadExecution = true;
 }
 
-void UArcFatigueNeedProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+void UArcFatigueNeedAddObserver::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	NeedsQuery.Initialize(EntityManager);
 	NeedsQuery.AddRequirement<FArcFatigueNeedFragment>(EMassFragmentAccess::ReadWrite);
 	NeedsQuery.RegisterWithProcessor(*this);
 }
 
-void UArcFatigueNeedProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+void UArcFatigueNeedAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcFatigueNeedAdd);
+	UE::ArcNeeds::Private::ScheduleAddedNeeds<FArcFatigueNeedFragment>(NeedsQuery, EntityManager, Context);
+}
+
+// ---------------------------------------------------------------------------
+// UArcNeedScheduleProcessor
+// ---------------------------------------------------------------------------
+
+UArcNeedScheduleProcessor::UArcNeedScheduleProcessor()
+{
+	ProcessingPhase = EMassProcessingPhase::DuringPhysics;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	QueryBasedPruning = EMassQueryBasedPruning::Never;
+	bRequiresGameThreadExecution = true;
+}
+
+void UArcNeedScheduleProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(ArcFatigueNeed);
+}
 
-	NeedsQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
+void UArcNeedScheduleProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNeedSchedule);
+
+	UWorld* World = EntityManager.GetWorld();
+	UArcNeedScheduleSubsystem* Scheduler = World ? World->GetSubsystem<UArcNeedScheduleSubsystem>() : nullptr;
+	if (!Scheduler)
 	{
-		const float DeltaTime = Context.GetDeltaTimeSeconds();
-		const TArrayView<FArcFatigueNeedFragment> Needs = Context.GetMutableFragmentView<FArcFatigueNeedFragment>();
+		return;
+	}
 
-		for (int32 EntityIndex = 0; EntityIndex < Context.GetNumEntities(); ++EntityIndex)
-		{
-			FArcFatigueNeedFragment& Need = Needs[EntityIndex];
-			Need.CurrentValue = FMath::Clamp(Need.CurrentValue + (Need.ChangeRate * DeltaTime), 0.f, 100.f);
-		}
-	});
+	Scheduler->ProcessDueEvents(EntityManager, World->GetSubsystem<UMassSignalSubsystem>(), Scheduler->GetNow());
 }
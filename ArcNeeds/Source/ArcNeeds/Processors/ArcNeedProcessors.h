@@ -21,17 +21,19 @@
 
 #pragma once
 
+#include "MassObserverProcessor.h"
 #include "MassProcessor.h"
 #include "Fragments/ArcNeedFragment.h"
 #include "ArcNeedProcessors.generated.h"
 
-UCLASS(meta = (DisplayName = "Arc Hunger Need Processor"))
-class ARCNEEDS_API UArcHungerNeedProcessor : public UMassProcessor
+/** Anchors new hunger needs and queues their first threshold. Needs are never ticked after this. */
+UCLASS(meta = (DisplayName = "Arc Hunger Need Add Observer"))
+class ARCNEEDS_API UArcHungerNeedAddObserver : public UMassObserverProcessor
 {
 	GENERATED_BODY()
 
 public:
-	UArcHungerNeedProcessor();
+	UArcHungerNeedAddObserver();
 
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
@@ -41,13 +43,14 @@ private:
 	FMassEntityQuery NeedsQuery;
 };
 
-UCLASS(meta = (DisplayName = "Arc Thirst Need Processor"))
-class ARCNEEDS_API UArcThirstNeedProcessor : public UMassProcessor
+/** Anchors new thirst needs and queues their first threshold. */
+UCLASS(meta = (DisplayName = "Arc Thirst Need Add Observer"))
+class ARCNEEDS_API UArcThirstNeedAddObserver : public UMassObserverProcessor
 {
 	GENERATED_BODY()
 
 public:
-	UArcThirstNeedProcessor();
+	UArcThirstNeedAddObserver();
 
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
@@ -57,13 +60,14 @@ private:
 	FMassEntityQuery NeedsQuery;
 };
 
-UCLASS(meta = (DisplayName = "Arc Fatigue Need Processor"))
-class ARCNEEDS_API UArcFatigueNeedProcessor : public UMassProcessor
+/** Anchors new fatigue needs and queues their first threshold. */
+UCLASS(meta = (DisplayName = "Arc Fatigue Need Add Observer"))
+class ARCNEEDS_API UArcFatigueNeedAddObserver : public UMassObserverProcessor
 {
 	GENERATED_BODY()
 
 public:
-	UArcFatigueNeedProcessor();
+	UArcFatigueNeedAddObserver();
 
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
@@ -72,3 +76,20 @@ protected:
 private:
 	FMassEntityQuery NeedsQuery;
 };
+
+/**
+ * Fires due need threshold events (UArcNeedScheduleSubsystem). Cost scales with threshold crossings,
+ * not with the number of entities that have needs.
+ */
+UCLASS(meta = (DisplayName = "Arc Need Schedule Processor"))
+class ARCNEEDS_API UArcNeedScheduleProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UArcNeedScheduleProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+};
@@ -70,8 +70,11 @@ void UArcNeedsFatigueInteropProcessor::Execute(FMassEntityManager& EntityManager
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(ArcNeedsFatigueInterop);
 
+	const UWorld* World = EntityManager.GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
 	FatigueQuery.ForEachEntityChunk(Context,
-		[](FMassExecutionContext& Ctx)
+		[Now](FMassExecutionContext& Ctx)
 		{
 			TConstArrayView<FArcFatigueNeedFragment> FatigueFragments = Ctx.GetFragmentView<FArcFatigueNeedFragment>();
 			TArrayView<FArcCoreAbilitySystemFragment> ASCFragments = Ctx.GetMutableFragmentView<FArcCoreAbilitySystemFragment>();
@@ -89,7 +92,7 @@ void UArcNeedsFatigueInteropProcessor::Execute(FMassEntityManager& EntityManager
 				// Sync fragment -> GAS attribute
 				ASCFrag.AbilitySystem->SetNumericAttributeBase(
 					UArcNeedsSurvivalAttributeSet::GetFatigueAttribute(),
-					FatigueFragment.CurrentValue);
+					FatigueFragment.GetValue(Now));
 			}
 		}
 	);
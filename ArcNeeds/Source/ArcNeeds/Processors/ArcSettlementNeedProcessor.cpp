@@ -23,19 +23,20 @@
 
 #include "MassExecutionContext.h"
 #include "Fragments/ArcSettlementNeedFragments.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(ArcSettlementNeedProcessor)
 
-UArcSettlementNeedProcessor::UArcSettlementNeedProcessor()
+UArcSettlementNeedAddObserver::UArcSettlementNeedAddObserver()
 	: SettlementNeedsQuery(*this)
 {
-	bAutoRegisterWithProcessingPhases = true;
-	bRequiresGameThreadExecution = false;
-	ProcessingPhase = EMassProcessingPhase::DuringPhysics;
+	ObservedTypes.Add(FArcSettlementFoodNeed::StaticStruct());
+	ObservedOperations = EMassObservedOperationFlags::Add;
+	bRequiresGameThreadExecution = true;
 	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
 }
 
-void UArcSettlementNeedProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+void UArcSettlementNeedAddObserver::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
 {
 	SettlementNeedsQuery.Initialize(EntityManager);
 	SettlementNeedsQuery.AddRequirement<FArcSettlementFoodNeed>(EMassFragmentAccess::ReadWrite);
@@ -47,20 +48,19 @@ void UArcSettlementNeedProcessor::ConfigureQueries(const TSharedRef<FMassEntityM
 	SettlementNeedsQuery.RegisterWithProcessor(*this);
 }
 
-void UArcSettlementNeedProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+void UArcSettlementNeedAddObserver::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(ArcSettlementNeed);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcSettlementNeedAdd);
 
-	AccumulatedTime += Context.GetDeltaTimeSeconds();
-	if (AccumulatedTime < 1.0f)
+	UWorld* World = EntityManager.GetWorld();
+	UArcNeedScheduleSubsystem* Scheduler = World ? World->GetSubsystem<UArcNeedScheduleSubsystem>() : nullptr;
+	if (!Scheduler)
 	{
 		return;
 	}
 
-	const float DeltaTime = AccumulatedTime;
-	AccumulatedTime = 0.0f;
-
-	SettlementNeedsQuery.ForEachEntityChunk(Context, [DeltaTime](FMassExecutionContext& Ctx)
+	const double Now = Scheduler->GetNow();
+	SettlementNeedsQuery.ForEachEntityChunk(Context, [Scheduler, Now](FMassExecutionContext& Ctx)
 	{
 		const TArrayView<FArcSettlementFoodNeed> FoodNeeds = Ctx.GetMutableFragmentView<FArcSettlementFoodNeed>();
 		const TArrayView<FArcSettlementWaterNeed> WaterNeeds = Ctx.GetMutableFragmentView<FArcSettlementWaterNeed>();
@@ -71,30 +71,13 @@ void UArcSettlementNeedProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
 		for (int32 EntityIndex = 0; EntityIndex < Ctx.GetNumEntities(); ++EntityIndex)
 		{
-			if (FMath::Abs(FoodNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				FoodNeeds[EntityIndex].CurrentValue = FMath::Clamp(FoodNeeds[EntityIndex].CurrentValue + (FoodNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
-			if (FMath::Abs(WaterNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				WaterNeeds[EntityIndex].CurrentValue = FMath::Clamp(WaterNeeds[EntityIndex].CurrentValue + (WaterNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
-			if (FMath::Abs(ShelterNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				ShelterNeeds[EntityIndex].CurrentValue = FMath::Clamp(ShelterNeeds[EntityIndex].CurrentValue + (ShelterNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
-			if (FMath::Abs(ClothingNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				ClothingNeeds[EntityIndex].CurrentValue = FMath::Clamp(ClothingNeeds[EntityIndex].CurrentValue + (ClothingNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
-			if (FMath::Abs(HealthcareNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				HealthcareNeeds[EntityIndex].CurrentValue = FMath::Clamp(HealthcareNeeds[EntityIndex].CurrentValue + (HealthcareNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
-			if (FMath::Abs(MoraleNeeds[EntityIndex].ChangeRate) > UE_SMALL_NUMBER)
-			{
-				MoraleNeeds[EntityIndex].CurrentValue = FMath::Clamp(MoraleNeeds[EntityIndex].CurrentValue + (MoraleNeeds[EntityIndex].ChangeRate * DeltaTime), 0.f, 100.f);
-			}
+			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIndex);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementFoodNeed::StaticStruct(), FoodNeeds[EntityIndex], Now);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementWaterNeed::StaticStruct(), WaterNeeds[EntityIndex], Now);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementShelterNeed::StaticStruct(), ShelterNeeds[EntityIndex], Now);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementClothingNeed::StaticStruct(), ClothingNeeds[EntityIndex], Now);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementHealthcareNeed::StaticStruct(), HealthcareNeeds[EntityIndex], Now);
+			Scheduler->ScheduleNeed(Entity, FArcSettlementMoraleNeed::StaticStruct(), MoraleNeeds[EntityIndex], Now);
 		}
 	});
 }
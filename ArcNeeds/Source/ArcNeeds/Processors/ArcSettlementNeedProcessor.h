@@ -21,16 +21,20 @@
 
 #pragma once
 
-#include "MassProcessor.h"
+#include "MassObserverProcessor.h"
 #include "ArcSettlementNeedProcessor.generated.h"
 
-UCLASS(meta = (DisplayName = "Arc Settlement Need Processor"))
-class ARCNEEDS_API UArcSettlementNeedProcessor : public UMassProcessor
+/**
+ * Anchors a new settlement's needs and queues their thresholds. Settlement needs are closed-form like
+ * every other need; UArcSettlementNeedsTrait adds all six together, so observing the food need covers them.
+ */
+UCLASS(meta = (DisplayName = "Arc Settlement Need Add Observer"))
+class ARCNEEDS_API UArcSettlementNeedAddObserver : public UMassObserverProcessor
 {
 	GENERATED_BODY()
 
 public:
-	UArcSettlementNeedProcessor();
+	UArcSettlementNeedAddObserver();
 
 protected:
 	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
@@ -38,6 +42,4 @@ protected:
 
 private:
 	FMassEntityQuery SettlementNeedsQuery{*this};
-
-	float AccumulatedTime = 0.0f;
 };
@@ -0,0 +1,230 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
+#include "ArcNeedsSettings.h"
+#include "MassEntityManager.h"
+#include "MassEntityUtils.h"
+#include "MassSignalSubsystem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ArcNeedScheduleSubsystem)
+
+void UArcNeedScheduleSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	for (const FArcNeedThresholdConfig& Config : GetDefault<UArcNeedsSettings>()->Thresholds)
+	{
+		if (!Config.NeedType || Config.Value < FArcNeedFragment::MinValue || Config.Value > FArcNeedFragment::MaxValue)
+		{
+			continue;
+		}
+
+		FThreshold& Threshold = Thresholds.FindOrAdd(Config.NeedType).AddDefaulted_GetRef();
+		Threshold.Value = Config.Value;
+		Threshold.SignalName = Config.SignalName.IsNone() ? UE::ArcNeeds::Signals::NeedThresholdCrossed : Config.SignalName;
+	}
+
+	for (TPair<const UScriptStruct*, TArray<FThreshold>>& Pair : Thresholds)
+	{
+		Pair.Value.Sort([](const FThreshold& A, const FThreshold& B) { return A.Value < B.Value; });
+	}
+}
+
+void UArcNeedScheduleSubsystem::Deinitialize()
+{
+	Thresholds.Empty();
+	EventHeap.Empty();
+
+	Super::Deinitialize();
+}
+
+double UArcNeedScheduleSubsystem::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+FMassEntityManager* UArcNeedScheduleSubsystem::GetEntityManager() const
+{
+	return UE::Mass::Utils::GetEntityManager(GetWorld());
+}
+
+TConstArrayView<UArcNeedScheduleSubsystem::FThreshold> UArcNeedScheduleSubsystem::GetThresholds(const UScriptStruct* NeedType) const
+{
+	const TArray<FThreshold>* Found = Thresholds.Find(NeedType);
+	return Found ? TConstArrayView<FThreshold>(*Found) : TConstArrayView<FThreshold>();
+}
+
+bool UArcNeedScheduleSubsystem::GetNeedValue(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, float& OutValue) const
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !NeedType || !EntityManager->IsEntityValid(Entity))
+	{
+		return false;
+	}
+
+	const FStructView NeedView = EntityManager->GetFragmentDataStruct(Entity, NeedType);
+	if (!NeedView.IsValid())
+	{
+		return false;
+	}
+
+	OutValue = NeedView.Get<FArcNeedFragment>().GetValue(GetNow());
+	return true;
+}
+
+bool UArcNeedScheduleSubsystem::ModifyNeed(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, EArcNeedOperation Operation, float Value)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !NeedType || !EntityManager->IsEntityValid(Entity))
+	{
+		return false;
+	}
+
+	FStructView NeedView = EntityManager->GetFragmentDataStruct(Entity, NeedType);
+	if (!NeedView.IsValid())
+	{
+		return false;
+	}
+
+	const double Now = GetNow();
+	FArcNeedFragment& Need = NeedView.Get<FArcNeedFragment>();
+	Need.ApplyOperation(Operation, Value, Now);
+	ScheduleNeed(Entity, NeedType, Need, Now);
+	return true;
+}
+
+bool UArcNeedScheduleSubsystem::SetNeedChangeRate(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, float ChangeRate)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !NeedType || !EntityManager->IsEntityValid(Entity))
+	{
+		return false;
+	}
+
+	FStructView NeedView = EntityManager->GetFragmentDataStruct(Entity, NeedType);
+	if (!NeedView.IsValid())
+	{
+		return false;
+	}
+
+	const double Now = GetNow();
+	FArcNeedFragment& Need = NeedView.Get<FArcNeedFragment>();
+	Need.SetChangeRate(ChangeRate, Now);
+	ScheduleNeed(Entity, NeedType, Need, Now);
+	return true;
+}
+
+void UArcNeedScheduleSubsystem::ScheduleNeed(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, FArcNeedFragment& Need, double Now)
+{
+	if (!Need.IsAnchored())
+	{
+		Need.Anchor(Now);
+	}
+
+	// Invalidates whatever is queued for this need.
+	++Need.ScheduleSerial;
+
+	const TConstArrayView<FThreshold> NeedThresholds = GetThresholds(NeedType);
+	if (NeedThresholds.IsEmpty() || FMath::IsNearlyZero(Need.ChangeRate))
+	{
+		return;
+	}
+
+	// Sitting exactly on a threshold does not count as crossing it again.
+	const float Value = Need.GetValue(Now);
+	if (Need.ChangeRate > 0.f)
+	{
+		for (int32 Index = 0; Index < NeedThresholds.Num(); ++Index)
+		{
+			if (NeedThresholds[Index].Value > Value)
+			{
+				QueueThreshold(Entity, NeedType, Need, Index, Now);
+				return;
+			}
+		}
+	}
+	else
+	{
+		for (int32 Index = NeedThresholds.Num() - 1; Index >= 0; --Index)
+		{
+			if (NeedThresholds[Index].Value < Value)
+			{
+				QueueThreshold(Entity, NeedType, Need, Index, Now);
+				return;
+			}
+		}
+	}
+}
+
+void UArcNeedScheduleSubsystem::QueueThreshold(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, const FArcNeedFragment& Need, int32 Index, double Now)
+{
+	const TConstArrayView<FThreshold> NeedThresholds = GetThresholds(NeedType);
+	if (!NeedThresholds.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	const double Seconds = Need.GetSecondsUntil(NeedThresholds[Index].Value, Now);
+	if (Seconds < 0.0)
+	{
+		return;
+	}
+
+	FScheduledEvent Event;
+	Event.Time = Now + Seconds;
+	Event.Entity = Entity;
+	Event.NeedType = NeedType;
+	Event.Serial = Need.ScheduleSerial;
+	Event.ThresholdIndex = Index;
+	EventHeap.HeapPush(Event);
+}
+
+void UArcNeedScheduleSubsystem::ProcessDueEvents(FMassEntityManager& EntityManager, UMassSignalSubsystem* SignalSubsystem, double Now)
+{
+	TMap<FName, TArray<FMassEntityHandle>> EntitiesToSignal;
+
+	while (EventHeap.Num() > 0 && EventHeap.HeapTop().Time <= Now)
+	{
+		FScheduledEvent Event;
+		EventHeap.HeapPop(Event, EAllowShrinking::No);
+
+		if (!EntityManager.IsEntityValid(Event.Entity))
+		{
+			continue;
+		}
+
+		FStructView NeedView = EntityManager.GetFragmentDataStruct(Event.Entity, Event.NeedType);
+		if (!NeedView.IsValid())
+		{
+			continue;
+		}
+
+		const FArcNeedFragment& Need = NeedView.Get<FArcNeedFragment>();
+		if (Need.ScheduleSerial != Event.Serial)
+		{
+			continue;
+		}
+
+		const TConstArrayView<FThreshold> NeedThresholds = GetThresholds(Event.NeedType);
+		if (!NeedThresholds.IsValidIndex(Event.ThresholdIndex))
+		{
+			continue;
+		}
+
+		EntitiesToSignal.FindOrAdd(NeedThresholds[Event.ThresholdIndex].SignalName).Add(Event.Entity);
+		++NumFiredEvents;
+
+		// Step to the neighbour instead of searching by value, so float error cannot fire the same threshold twice.
+		const int32 NextIndex = Event.ThresholdIndex + (Need.ChangeRate > 0.f ? 1 : -1);
+		QueueThreshold(Event.Entity, Event.NeedType, Need, NextIndex, Event.Time);
+	}
+
+	if (SignalSubsystem)
+	{
+		for (const TPair<FName, TArray<FMassEntityHandle>>& Pair : EntitiesToSignal)
+		{
+			SignalSubsystem->SignalEntities(Pair.Key, Pair.Value);
+		}
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fragments/ArcNeedFragment.h"
+#include "Mass/EntityHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ArcNeedScheduleSubsystem.generated.h"
+
+struct FMassEntityManager;
+class UMassSignalSubsystem;
+
+namespace UE::ArcNeeds::Signals
+{
+	/** Default signal for configured need thresholds. */
+	inline const FName NeedThresholdCrossed = FName(TEXT("ArcNeedThresholdCrossed"));
+}
+
+/**
+ * Plans need threshold events.
+ *
+ * Needs are closed-form (FArcNeedFragment::GetValue), so nothing walks the population per frame. For every
+ * need this subsystem keeps one pending event: the time its value next reaches a configured threshold
+ * (UArcNeedsSettings) along its current ChangeRate. UArcNeedScheduleProcessor pops due events, signals the
+ * entity and queues the following threshold. Any change to value or rate through this subsystem re-plans
+ * the need and invalidates its queued event, so upkeep is proportional to threshold crossings.
+ *
+ * Game thread only.
+ */
+UCLASS()
+class ARCNEEDS_API UArcNeedScheduleSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** World time needs are evaluated at. */
+	double GetNow() const;
+
+	/** Current value of Entity's NeedType need. Returns false if the entity does not have it. */
+	bool GetNeedValue(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, float& OutValue) const;
+
+	/** Add, subtract or override the need's value and re-plan its thresholds. */
+	bool ModifyNeed(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, EArcNeedOperation Operation, float Value);
+
+	/** Change the need's rate, keeping the value accrued so far, and re-plan its thresholds. */
+	bool SetNeedChangeRate(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, float ChangeRate);
+
+	/**
+	 * Anchor Need if it is not yet and queue its next threshold crossing, replacing any queued one.
+	 * Call after changing a need fragment directly.
+	 */
+	void ScheduleNeed(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, FArcNeedFragment& Need, double Now);
+
+	/** Signal every need whose queued threshold is due by Now and queue its next one. */
+	void ProcessDueEvents(FMassEntityManager& EntityManager, UMassSignalSubsystem* SignalSubsystem, double Now);
+
+	/** Queued events, including stale ones not yet popped. */
+	int32 GetNumQueuedEvents() const { return EventHeap.Num(); }
+
+	/** Threshold events fired since the world started. */
+	int64 GetNumFiredEvents() const { return NumFiredEvents; }
+
+private:
+	struct FThreshold
+	{
+		float Value = 0.f;
+		FName SignalName;
+	};
+
+	struct FScheduledEvent
+	{
+		double Time = 0.0;
+		FMassEntityHandle Entity;
+		const UScriptStruct* NeedType = nullptr;
+		uint32 Serial = 0;
+		int32 ThresholdIndex = INDEX_NONE;
+
+		bool operator<(const FScheduledEvent& Other) const { return Time < Other.Time; }
+	};
+
+	/** Thresholds of NeedType sorted by value, or empty. */
+	TConstArrayView<FThreshold> GetThresholds(const UScriptStruct* NeedType) const;
+
+	/** Queue the crossing of threshold Index if the need is heading towards it. */
+	void QueueThreshold(const FMassEntityHandle& Entity, const UScriptStruct* NeedType, const FArcNeedFragment& Need, int32 Index, double Now);
+
+	FMassEntityManager* GetEntityManager() const;
+
+	/** Need type -> its thresholds sorted by value. */
+	TMap<const UScriptStruct*, TArray<FThreshold>> Thresholds;
+
+	/** Min-heap on FScheduledEvent::Time. */
+	TArray<FScheduledEvent> EventHeap;
+
+	int64 NumFiredEvents = 0;
+};
@@ -0,0 +1,221 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "CQTest.h"
+#include "Components/ActorTestSpawner.h"
+#include "MassEntityManager.h"
+#include "MassEntitySubsystem.h"
+#include "Mass/EntityHandle.h"
+#include "StructUtils/InstancedStruct.h"
+#include "Fragments/ArcNeedFragment.h"
+#include "Subsystems/ArcNeedScheduleSubsystem.h"
+
+namespace ArcNeedsTest
+{
+	/** The per-frame integration the need processors used to run. */
+	float TickNeed(float Value, float ChangeRate, float DeltaTime)
+	{
+		return FMath::Clamp(Value + ChangeRate * DeltaTime, FArcNeedFragment::MinValue, FArcNeedFragment::MaxValue);
+	}
+}
+
+TEST_CLASS(ArcNeedClosedForm_Equivalence, "ArcNeeds.ClosedForm")
+{
+	TEST_METHOD(ConstantRate_MatchesTicking)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 20.f;
+		Need.ChangeRate = 0.35f;
+		Need.Anchor(0.0);
+
+		float Ticked = 20.f;
+		double Now = 0.0;
+		for (int32 Step = 0; Step < 600; ++Step)
+		{
+			const float DeltaTime = 1.f / 60.f;
+			Ticked = ArcNeedsTest::TickNeed(Ticked, Need.ChangeRate, DeltaTime);
+			Now += DeltaTime;
+		}
+
+		ASSERT_THAT(IsNear(Ticked, Need.GetValue(Now), 0.01f));
+	}
+
+	TEST_METHOD(ClampsAtBounds_LikeTicking)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 95.f;
+		Need.ChangeRate = 2.f;
+		Need.Anchor(0.0);
+
+		ASSERT_THAT(IsNear(100.f, Need.GetValue(10.0), 0.001f));
+
+		Need.SetChangeRate(-4.f, 10.0);
+		ASSERT_THAT(IsNear(100.f, Need.CurrentValue, 0.001f));
+		ASSERT_THAT(IsNear(60.f, Need.GetValue(20.0), 0.001f));
+		ASSERT_THAT(IsNear(0.f, Need.GetValue(100.0), 0.001f));
+	}
+
+	TEST_METHOD(RateChangesAndOperations_MatchTicking)
+	{
+		FRandomStream Random(1234);
+
+		FArcNeedFragment Need;
+		Need.CurrentValue = 50.f;
+		Need.ChangeRate = 0.5f;
+		Need.Anchor(0.0);
+
+		float Ticked = 50.f;
+		float TickedRate = 0.5f;
+		double Now = 0.0;
+
+		for (int32 Step = 0; Step < 5000; ++Step)
+		{
+			const float DeltaTime = Random.FRandRange(0.005f, 0.05f);
+			Ticked = ArcNeedsTest::TickNeed(Ticked, TickedRate, DeltaTime);
+			Now += DeltaTime;
+
+			if (Step % 250 == 0)
+			{
+				TickedRate = Random.FRandRange(-3.f, 3.f);
+				Need.SetChangeRate(TickedRate, Now);
+			}
+
+			if (Step % 700 == 0)
+			{
+				const float Amount = Random.FRandRange(0.f, 30.f);
+				const EArcNeedOperation Operation = Random.RandRange(0, 1) == 0 ? EArcNeedOperation::Add : EArcNeedOperation::Subtract;
+				Need.ApplyOperation(Operation, Amount, Now);
+				Ticked = FMath::Clamp(Operation == EArcNeedOperation::Add ? Ticked + Amount : Ticked - Amount, 0.f, 100.f);
+			}
+
+			ASSERT_THAT(IsNear(Ticked, Need.GetValue(Now), 0.05f));
+		}
+	}
+
+	TEST_METHOD(Unanchored_ReturnsInitialValue)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 42.f;
+		Need.ChangeRate = 10.f;
+
+		ASSERT_THAT(IsFalse(Need.IsAnchored()));
+		ASSERT_THAT(IsNear(42.f, Need.GetValue(1000.0), 0.001f));
+	}
+};
+
+TEST_CLASS(ArcNeedClosedForm_SecondsUntil, "ArcNeeds.ClosedForm")
+{
+	TEST_METHOD(Rising_ReachesThresholdAhead)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 40.f;
+		Need.ChangeRate = 2.f;
+		Need.Anchor(5.0);
+
+		ASSERT_THAT(IsNear(10.0, Need.GetSecondsUntil(60.f, 5.0), 0.001));
+		ASSERT_THAT(IsNear(60.f, Need.GetValue(5.0 + Need.GetSecondsUntil(60.f, 5.0)), 0.001f));
+	}
+
+	TEST_METHOD(MovingAway_ReturnsNegative)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 40.f;
+		Need.ChangeRate = -1.f;
+		Need.Anchor(0.0);
+
+		ASSERT_THAT(IsTrue(Need.GetSecondsUntil(60.f, 0.0) < 0.0));
+		ASSERT_THAT(IsNear(10.0, Need.GetSecondsUntil(30.f, 0.0), 0.001));
+	}
+
+	TEST_METHOD(NoRateOrOutOfRange_ReturnsNegative)
+	{
+		FArcNeedFragment Need;
+		Need.CurrentValue = 40.f;
+		Need.Anchor(0.0);
+
+		ASSERT_THAT(IsTrue(Need.GetSecondsUntil(60.f, 0.0) < 0.0));
+
+		Need.SetChangeRate(1.f, 0.0);
+		ASSERT_THAT(IsTrue(Need.GetSecondsUntil(150.f, 0.0) < 0.0));
+	}
+};
+
+TEST_CLASS(ArcNeedSchedule_Thresholds, "ArcNeeds.Schedule")
+{
+	FActorTestSpawner Spawner;
+	FMassEntityManager* EntityManager = nullptr;
+	UArcNeedScheduleSubsystem* Scheduler = nullptr;
+
+	FMassEntityHandle CreateHungerEntity(float Value, float ChangeRate)
+	{
+		FArcHungerNeedFragment Hunger;
+		Hunger.CurrentValue = Value;
+		Hunger.ChangeRate = ChangeRate;
+
+		TArray<FInstancedStruct> Fragments;
+		Fragments.Add(FInstancedStruct::Make(Hunger));
+		return EntityManager->CreateEntity(Fragments);
+	}
+
+	FArcHungerNeedFragment& GetHunger(const FMassEntityHandle& Entity)
+	{
+		return EntityManager->GetFragmentDataChecked<FArcHungerNeedFragment>(Entity);
+	}
+
+	BEFORE_EACH()
+	{
+		Spawner.GetWorld();
+		Spawner.InitializeGameSubsystems();
+		UMassEntitySubsystem* MES = Spawner.GetWorld().GetSubsystem<UMassEntitySubsystem>();
+		check(MES);
+		EntityManager = &MES->GetMutableEntityManager();
+		Scheduler = Spawner.GetWorld().GetSubsystem<UArcNeedScheduleSubsystem>();
+		check(Scheduler);
+	}
+
+	// Relies on the default hunger thresholds at 60 and 90.
+	TEST_METHOD(Rising_FiresEachThresholdOnce)
+	{
+		const FMassEntityHandle Entity = CreateHungerEntity(50.f, 1.f);
+		Scheduler->ScheduleNeed(Entity, FArcHungerNeedFragment::StaticStruct(), GetHunger(Entity), 0.0);
+
+		const int64 FiredBefore = Scheduler->GetNumFiredEvents();
+
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 9.9);
+		ASSERT_THAT(AreEqual(FiredBefore, Scheduler->GetNumFiredEvents()));
+
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 10.0);
+		ASSERT_THAT(AreEqual(FiredBefore + 1, Scheduler->GetNumFiredEvents()));
+
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 1000.0);
+		ASSERT_THAT(AreEqual(FiredBefore + 2, Scheduler->GetNumFiredEvents()));
+	}
+
+	TEST_METHOD(RateChange_DropsStaleEvent)
+	{
+		const FMassEntityHandle Entity = CreateHungerEntity(50.f, 1.f);
+		FArcHungerNeedFragment& Hunger = GetHunger(Entity);
+		Scheduler->ScheduleNeed(Entity, FArcHungerNeedFragment::StaticStruct(), Hunger, 0.0);
+
+		Hunger.SetChangeRate(-1.f, 5.0);
+		Scheduler->ScheduleNeed(Entity, FArcHungerNeedFragment::StaticStruct(), Hunger, 5.0);
+
+		const int64 FiredBefore = Scheduler->GetNumFiredEvents();
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 1000.0);
+		ASSERT_THAT(AreEqual(FiredBefore, Scheduler->GetNumFiredEvents()));
+		ASSERT_THAT(IsNear(0.f, Hunger.GetValue(1000.0), 0.001f));
+	}
+
+	TEST_METHOD(Falling_FiresThresholdsInReverse)
+	{
+		const FMassEntityHandle Entity = CreateHungerEntity(95.f, -1.f);
+		Scheduler->ScheduleNeed(Entity, FArcHungerNeedFragment::StaticStruct(), GetHunger(Entity), 0.0);
+
+		const int64 FiredBefore = Scheduler->GetNumFiredEvents();
+
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 5.0);
+		ASSERT_THAT(AreEqual(FiredBefore + 1, Scheduler->GetNumFiredEvents()));
+
+		Scheduler->ProcessDueEvents(*EntityManager, nullptr, 35.0);
+		ASSERT_THAT(AreEqual(FiredBefore + 2, Scheduler->GetNumFiredEvents()));
+	}
+};
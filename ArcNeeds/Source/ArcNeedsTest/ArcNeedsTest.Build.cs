@@ -0,0 +1,24 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class ArcNeedsTest : ModuleRules
+{
+	public ArcNeedsTest(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"CQTest",
+			"ArcNeeds",
+			"MassEntity",
+			"MassCore",
+			"MassSignals",
+			"StructUtils"
+		});
+	}
+}
@@ -0,0 +1,5 @@
+// Copyright Lukasz Baran. All Rights Reserved.
+
+#include "ArcNeedsTestModule.h"
+
+IMPLEMENT_MODULE(FArcNeedsTestModule, ArcNeedsTest)
@@ -43,20 +43,20 @@ void UArcIceWeatherProcessor::Execute(FMassEntityManager& EntityManager, FMassEx
 
 	const float DeltaTime = Context.GetDeltaTimeSeconds();
 
-	EntityQuery.ForEachEntityChunk(Context, [&EntityManager, WeatherSubsystem, DeltaTime](FMassExecutionContext& Ctx)
+	FArcClimateSampleBatch Climate;
+
+	EntityQuery.ForEachEntityChunk(Context, [&EntityManager, WeatherSubsystem, DeltaTime, &Climate](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FArcIceFragment> IceFragments = Ctx.GetFragmentView<FArcIceFragment>();
 		const TConstArrayView<FTransformFragment> TransformFragments = Ctx.GetFragmentView<FTransformFragment>();
 
+		WeatherSubsystem->SampleClimateBatch(TransformFragments, Climate);
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
 			const FArcIceFragment& Ice = IceFragments[EntityIt];
-			const FTransformFragment& Transform = TransformFragments[EntityIt];
-
-			const FArcClimateParams Weather = WeatherSubsystem->GetWeatherAtLocation(
-				Transform.GetTransform().GetLocation());
 
-			const float EffectiveTemp = Weather.Temperature - Ice.TemperatureResistance;
+			const float EffectiveTemp = Climate.Temperature[EntityIt] - Ice.TemperatureResistance;
 			const float Rate = EffectiveTemp / Ice.ThermalMass;
 			const float DamageThisTick = Rate * DeltaTime;
 
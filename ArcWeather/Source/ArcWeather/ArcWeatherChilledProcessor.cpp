@@ -42,30 +42,30 @@ void UArcWeatherChilledProcessor::Execute(FMassEntityManager& EntityManager, FMa
 
 	const float DeltaTime = Context.GetDeltaTimeSeconds();
 
-	EntityQuery.ForEachEntityChunk(Context, [WeatherSubsystem, ConditionSubsystem, DeltaTime](FMassExecutionContext& Ctx)
+	FArcClimateSampleBatch Climate;
+
+	EntityQuery.ForEachEntityChunk(Context, [WeatherSubsystem, ConditionSubsystem, DeltaTime, &Climate](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FTransformFragment> TransformFragments = Ctx.GetFragmentView<FTransformFragment>();
 		const TConstArrayView<FArcConditionStatesFragment> ConditionFragments = Ctx.GetFragmentView<FArcConditionStatesFragment>();
 
+		WeatherSubsystem->SampleClimateBatch(TransformFragments, Climate);
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
-			const FTransformFragment& Transform = TransformFragments[EntityIt];
 			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
-			const FVector Location = Transform.GetTransform().GetLocation();
+			const float Temperature = Climate.Temperature[EntityIt];
+			const float FrzThreshold = Climate.FreezeThreshold[EntityIt];
 
-			const float ColdIntensity = WeatherSubsystem->GetColdIntensityAtLocation(Location);
+			const float ColdIntensity = WeatherSubsystem->GetColdIntensity(Temperature, FrzThreshold);
 
 			if (ColdIntensity > 0.f)
 			{
 				ConditionSubsystem->ApplyCondition(Entity, EArcConditionType::Chilled, ColdIntensity * DeltaTime);
 			}
-			else if (ConditionFragments[EntityIt].States[(int32)EArcConditionType::Chilled].Saturation > 0.f)
+			else if (ConditionFragments[EntityIt].Saturation[(int32)EArcConditionType::Chilled] > 0.f)
 			{
-				const FArcWeatherCell* Cell = WeatherSubsystem->GetGrid().Find(
-					WeatherSubsystem->WorldToCell(Location));
-				const FArcClimateParams Weather = WeatherSubsystem->GetWeatherAtLocation(Location);
-				const float FrzThreshold = Cell ? Cell->FreezeThreshold : WeatherSubsystem->DefaultFreezeThreshold;
-				const float Warmth = (Weather.Temperature - FrzThreshold) / WeatherSubsystem->ColdNormalizationDelta;
+				const float Warmth = (Temperature - FrzThreshold) / WeatherSubsystem->ColdNormalizationDelta;
 				ConditionSubsystem->ApplyCondition(Entity, EArcConditionType::Chilled, -Warmth * DeltaTime);
 			}
 		}
@@ -2,6 +2,8 @@
 
 #include "ArcWeatherSubsystem.h"
 
+#include "MassCommonFragments.h"
+
 void UArcWeatherSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -10,6 +12,9 @@ void UArcWeatherSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UArcWeatherSubsystem::Deinitialize()
 {
 	Grid.Empty();
+	ClimateTiles.Empty();
+	ClimateTileLookup.Empty();
+	bClimateCacheDirty = true;
 	Super::Deinitialize();
 }
 
@@ -29,6 +34,7 @@ void UArcWeatherSubsystem::SetBaseClimate(const FIntVector& CellCoords, const FA
 	Cell.BaseClimate = Climate;
 	Cell.HumidityThreshold = HumidityThreshold;
 	Cell.FreezeThreshold = FreezeThreshold;
+	bClimateCacheDirty = true;
 }
 
 void UArcWeatherSubsystem::SetBaseClimateInBounds(const FBox& Bounds, const FArcClimateParams& Climate,
@@ -50,6 +56,8 @@ void UArcWeatherSubsystem::SetBaseClimateInBounds(const FBox& Bounds, const FArc
 			}
 		}
 	}
+
+	bClimateCacheDirty = true;
 }
 
 void UArcWeatherSubsystem::ClearCellsInBounds(const FBox& Bounds)
@@ -67,6 +75,8 @@ void UArcWeatherSubsystem::ClearCellsInBounds(const FBox& Bounds)
 			}
 		}
 	}
+
+	bClimateCacheDirty = true;
 }
 
 void UArcWeatherSubsystem::SetWeatherOffset(const FIntVector& CellCoords, float TemperatureOffset, float HumidityOffset)
@@ -75,6 +85,7 @@ void UArcWeatherSubsystem::SetWeatherOffset(const FIntVector& CellCoords, float
 	{
 		Cell->TemperatureOffset = TemperatureOffset;
 		Cell->HumidityOffset = HumidityOffset;
+		bClimateCacheDirty = true;
 	}
 }
 
@@ -89,6 +100,7 @@ void UArcWeatherSubsystem::ClearWeatherOffset(const FIntVector& CellCoords)
 	{
 		Cell->TemperatureOffset = 0.f;
 		Cell->HumidityOffset = 0.f;
+		bClimateCacheDirty = true;
 	}
 }
 
@@ -100,20 +112,16 @@ void UArcWeatherSubsystem::ClearWeatherOffsetAtLocation(const FVector& Location)
 void UArcWeatherSubsystem::SetCurrentSeason(int32 SeasonIndex)
 {
 	CurrentSeasonIndex = Seasons.IsValidIndex(SeasonIndex) ? SeasonIndex : 0;
+	bClimateCacheDirty = true;
 }
 
 FArcClimateParams UArcWeatherSubsystem::GetWeatherAtLocation(const FVector& Location) const
 {
-	const FArcWeatherCell* Cell = Grid.Find(WorldToCell(Location));
-	FArcClimateParams Result = Cell ? Cell->GetEffective() : DefaultClimate;
-
-	if (Seasons.IsValidIndex(CurrentSeasonIndex))
-	{
-		const FArcClimateParams& Season = Seasons[CurrentSeasonIndex];
-		Result.Temperature += Season.Temperature;
-		Result.Humidity = FMath::Clamp(Result.Humidity + Season.Humidity, 0.f, 100.f);
-	}
+	const FArcClimateSample Sample = SampleClimate(Location);
 
+	FArcClimateParams Result;
+	Result.Temperature = Sample.Temperature;
+	Result.Humidity = Sample.Humidity;
 	return Result;
 }
 
@@ -125,46 +133,246 @@ FArcClimateParams UArcWeatherSubsystem::GetBaseClimateAtLocation(const FVector&
 
 bool UArcWeatherSubsystem::IsRainingAtLocation(const FVector& Location) const
 {
-	const FArcWeatherCell* Cell = Grid.Find(WorldToCell(Location));
-	const FArcClimateParams Weather = GetWeatherAtLocation(Location);
-	const float HumThreshold = Cell ? Cell->HumidityThreshold : DefaultHumidityThreshold;
-	const float FrzThreshold = Cell ? Cell->FreezeThreshold : DefaultFreezeThreshold;
-	return Weather.Humidity >= HumThreshold && Weather.Temperature > FrzThreshold;
+	const FArcClimateSample Sample = SampleClimate(Location);
+	return Sample.Humidity >= Sample.HumidityThreshold && Sample.Temperature > Sample.FreezeThreshold;
 }
 
 bool UArcWeatherSubsystem::IsFreezingAtLocation(const FVector& Location) const
 {
-	const FArcWeatherCell* Cell = Grid.Find(WorldToCell(Location));
-	const FArcClimateParams Weather = GetWeatherAtLocation(Location);
-	const float FrzThreshold = Cell ? Cell->FreezeThreshold : DefaultFreezeThreshold;
-	return Weather.Temperature < FrzThreshold;
+	const FArcClimateSample Sample = SampleClimate(Location);
+	return Sample.Temperature < Sample.FreezeThreshold;
 }
 
 float UArcWeatherSubsystem::GetColdIntensityAtLocation(const FVector& Location) const
 {
-	const FArcWeatherCell* Cell = Grid.Find(WorldToCell(Location));
-	const FArcClimateParams Weather = GetWeatherAtLocation(Location);
-	const float FrzThreshold = Cell ? Cell->FreezeThreshold : DefaultFreezeThreshold;
+	const FArcClimateSample Sample = SampleClimate(Location);
+	return GetColdIntensity(Sample.Temperature, Sample.FreezeThreshold);
+}
+
+float UArcWeatherSubsystem::GetRainIntensityAtLocation(const FVector& Location) const
+{
+	const FArcClimateSample Sample = SampleClimate(Location);
+	return GetRainIntensity(Sample.Temperature, Sample.Humidity, Sample.HumidityThreshold, Sample.FreezeThreshold);
+}
+
+// ---------------------------------------------------------------------------
+// Sampling
+// ---------------------------------------------------------------------------
+
+FArcClimateSample UArcWeatherSubsystem::SampleClimate(const FVector& Location) const
+{
+	EnsureClimateCache();
+	return SampleCachedClimate(Location);
+}
+
+void UArcWeatherSubsystem::SampleClimateBatch(TConstArrayView<FTransformFragment> Transforms, FArcClimateSampleBatch& OutBatch) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcWeatherSampleClimateBatch);
+
+	EnsureClimateCache();
 
-	if (Weather.Temperature >= FrzThreshold)
+	const int32 Num = Transforms.Num();
+	OutBatch.SetNumUninitialized(Num);
+
+	float* RESTRICT Temperature = OutBatch.Temperature.GetData();
+	float* RESTRICT Humidity = OutBatch.Humidity.GetData();
+	float* RESTRICT HumidityThreshold = OutBatch.HumidityThreshold.GetData();
+	float* RESTRICT FreezeThreshold = OutBatch.FreezeThreshold.GetData();
+
+	for (int32 Idx = 0; Idx < Num; ++Idx)
 	{
-		return 0.f;
+		const FArcClimateSample Sample = SampleCachedClimate(Transforms[Idx].GetTransform().GetLocation());
+		Temperature[Idx] = Sample.Temperature;
+		Humidity[Idx] = Sample.Humidity;
+		HumidityThreshold[Idx] = Sample.HumidityThreshold;
+		FreezeThreshold[Idx] = Sample.FreezeThreshold;
 	}
+}
+
+FArcClimateSample UArcWeatherSubsystem::SampleCachedClimate(const FVector& Location) const
+{
+	const int32 CellZ = FMath::FloorToInt32(Location.Z / CellSize);
+
+	if (!bBilinearSampling)
+	{
+		return GetCachedCell(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize), CellZ);
+	}
+
+	// Cell values sit at cell centres; blend the four surrounding centres in the horizontal plane.
+	const double U = Location.X / CellSize - 0.5;
+	const double V = Location.Y / CellSize - 0.5;
+	const int32 X0 = FMath::FloorToInt32(U);
+	const int32 Y0 = FMath::FloorToInt32(V);
+	const float Fx = static_cast<float>(U - X0);
+	const float Fy = static_cast<float>(V - Y0);
+
+	const FArcClimateSample S00 = GetCachedCell(X0, Y0, CellZ);
+	const FArcClimateSample S10 = GetCachedCell(X0 + 1, Y0, CellZ);
+	const FArcClimateSample S01 = GetCachedCell(X0, Y0 + 1, CellZ);
+	const FArcClimateSample S11 = GetCachedCell(X0 + 1, Y0 + 1, CellZ);
+
+	auto Bilinear = [Fx, Fy](float A00, float A10, float A01, float A11)
+	{
+		return FMath::Lerp(FMath::Lerp(A00, A10, Fx), FMath::Lerp(A01, A11, Fx), Fy);
+	};
 
-	return (FrzThreshold - Weather.Temperature) / ColdNormalizationDelta;
+	FArcClimateSample Result;
+	Result.Temperature = Bilinear(S00.Temperature, S10.Temperature, S01.Temperature, S11.Temperature);
+	Result.Humidity = Bilinear(S00.Humidity, S10.Humidity, S01.Humidity, S11.Humidity);
+	Result.HumidityThreshold = Bilinear(S00.HumidityThreshold, S10.HumidityThreshold, S01.HumidityThreshold, S11.HumidityThreshold);
+	Result.FreezeThreshold = Bilinear(S00.FreezeThreshold, S10.FreezeThreshold, S01.FreezeThreshold, S11.FreezeThreshold);
+	return Result;
 }
 
-float UArcWeatherSubsystem::GetRainIntensityAtLocation(const FVector& Location) const
+FArcClimateSample UArcWeatherSubsystem::GetCachedCell(int32 X, int32 Y, int32 Z) const
 {
-	const FArcWeatherCell* Cell = Grid.Find(WorldToCell(Location));
-	const FArcClimateParams Weather = GetWeatherAtLocation(Location);
-	const float HumThreshold = Cell ? Cell->HumidityThreshold : DefaultHumidityThreshold;
-	const float FrzThreshold = Cell ? Cell->FreezeThreshold : DefaultFreezeThreshold;
+	// Arithmetic shift floors negative coordinates, matching WorldToCell.
+	const int32 TileX = (X >> FArcClimateTile::Shift) - ClimateTileMin.X;
+	const int32 TileY = (Y >> FArcClimateTile::Shift) - ClimateTileMin.Y;
+	const int32 TileZ = Z - ClimateTileMin.Z;
 
-	if (Weather.Humidity < HumThreshold || Weather.Temperature <= FrzThreshold)
+	if (TileX < 0 || TileY < 0 || TileZ < 0
+		|| TileX >= ClimateTileDims.X || TileY >= ClimateTileDims.Y || TileZ >= ClimateTileDims.Z)
 	{
-		return 0.f;
+		return ClimateDefaultSample;
 	}
 
-	return (Weather.Humidity - HumThreshold) / RainNormalizationDelta;
+	const int32 TileIndex = ClimateTileLookup[(TileZ * ClimateTileDims.Y + TileY) * ClimateTileDims.X + TileX];
+	if (TileIndex == INDEX_NONE)
+	{
+		return ClimateDefaultSample;
+	}
+
+	const FArcClimateTile& Tile = ClimateTiles[TileIndex];
+	const int32 Local = ((Y & (FArcClimateTile::Size - 1)) << FArcClimateTile::Shift) + (X & (FArcClimateTile::Size - 1));
+
+	FArcClimateSample Result;
+	Result.Temperature = Tile.Temperature[Local];
+	Result.Humidity = Tile.Humidity[Local];
+	Result.HumidityThreshold = Tile.HumidityThreshold[Local];
+	Result.FreezeThreshold = Tile.FreezeThreshold[Local];
+	return Result;
+}
+
+FArcClimateParams UArcWeatherSubsystem::GetSeasonOffset() const
+{
+	if (Seasons.IsValidIndex(CurrentSeasonIndex))
+	{
+		return Seasons[CurrentSeasonIndex];
+	}
+
+	FArcClimateParams None;
+	None.Temperature = 0.f;
+	None.Humidity = 0.f;
+	return None;
+}
+
+bool UArcWeatherSubsystem::IsClimateCacheCurrent() const
+{
+	const FArcClimateParams SeasonOffset = GetSeasonOffset();
+
+	return CachedCellSize == CellSize
+		&& CachedDefaultClimate.Temperature == DefaultClimate.Temperature
+		&& CachedDefaultClimate.Humidity == DefaultClimate.Humidity
+		&& CachedDefaultHumidityThreshold == DefaultHumidityThreshold
+		&& CachedDefaultFreezeThreshold == DefaultFreezeThreshold
+		&& CachedSeasonOffset.Temperature == SeasonOffset.Temperature
+		&& CachedSeasonOffset.Humidity == SeasonOffset.Humidity;
+}
+
+void UArcWeatherSubsystem::EnsureClimateCache() const
+{
+	if (bClimateCacheDirty || !IsClimateCacheCurrent())
+	{
+		RebuildClimateCache();
+	}
+}
+
+void UArcWeatherSubsystem::RebuildClimateCache() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ArcWeatherRebuildClimateCache);
+
+	const bool bHasSeason = Seasons.IsValidIndex(CurrentSeasonIndex);
+	const FArcClimateParams SeasonOffset = GetSeasonOffset();
+
+	auto ApplySeason = [bHasSeason, &SeasonOffset](FArcClimateParams Climate)
+	{
+		if (bHasSeason)
+		{
+			Climate.Temperature += SeasonOffset.Temperature;
+			Climate.Humidity = FMath::Clamp(Climate.Humidity + SeasonOffset.Humidity, 0.f, 100.f);
+		}
+		return Climate;
+	};
+
+	const FArcClimateParams DefaultEffective = ApplySeason(DefaultClimate);
+	ClimateDefaultSample.Temperature = DefaultEffective.Temperature;
+	ClimateDefaultSample.Humidity = DefaultEffective.Humidity;
+	ClimateDefaultSample.HumidityThreshold = DefaultHumidityThreshold;
+	ClimateDefaultSample.FreezeThreshold = DefaultFreezeThreshold;
+
+	CachedCellSize = CellSize;
+	CachedDefaultClimate = DefaultClimate;
+	CachedSeasonOffset = SeasonOffset;
+	CachedDefaultHumidityThreshold = DefaultHumidityThreshold;
+	CachedDefaultFreezeThreshold = DefaultFreezeThreshold;
+	bClimateCacheDirty = false;
+
+	ClimateTiles.Reset();
+	ClimateTileLookup.Reset();
+	ClimateTileMin = FIntVector::ZeroValue;
+	ClimateTileDims = FIntVector::ZeroValue;
+
+	if (Grid.IsEmpty())
+	{
+		return;
+	}
+
+	FIntVector TileMax(MIN_int32, MIN_int32, MIN_int32);
+	ClimateTileMin = FIntVector(MAX_int32, MAX_int32, MAX_int32);
+	for (const TPair<FIntVector, FArcWeatherCell>& Pair : Grid)
+	{
+		const FIntVector Tile(Pair.Key.X >> FArcClimateTile::Shift, Pair.Key.Y >> FArcClimateTile::Shift, Pair.Key.Z);
+		ClimateTileMin = FIntVector(FMath::Min(ClimateTileMin.X, Tile.X), FMath::Min(ClimateTileMin.Y, Tile.Y), FMath::Min(ClimateTileMin.Z, Tile.Z));
+		TileMax = FIntVector(FMath::Max(TileMax.X, Tile.X), FMath::Max(TileMax.Y, Tile.Y), FMath::Max(TileMax.Z, Tile.Z));
+	}
+
+	ClimateTileDims = TileMax - ClimateTileMin + FIntVector(1, 1, 1);
+	const int64 NumLookupSlots = static_cast<int64>(ClimateTileDims.X) * ClimateTileDims.Y * ClimateTileDims.Z;
+	if (!ensureMsgf(NumLookupSlots <= MAX_int32, TEXT("Weather grid spans %lld climate tiles; increase CellSize."), NumLookupSlots))
+	{
+		ClimateTileDims = FIntVector::ZeroValue;
+		return;
+	}
+	ClimateTileLookup.Init(INDEX_NONE, static_cast<int32>(NumLookupSlots));
+
+	for (const TPair<FIntVector, FArcWeatherCell>& Pair : Grid)
+	{
+		const FIntVector& CellCoords = Pair.Key;
+		const FIntVector Tile = FIntVector(CellCoords.X >> FArcClimateTile::Shift, CellCoords.Y >> FArcClimateTile::Shift, CellCoords.Z) - ClimateTileMin;
+
+		int32& TileIndex = ClimateTileLookup[(Tile.Z * ClimateTileDims.Y + Tile.Y) * ClimateTileDims.X + Tile.X];
+		if (TileIndex == INDEX_NONE)
+		{
+			TileIndex = ClimateTiles.AddUninitialized();
+			FArcClimateTile& NewTile = ClimateTiles[TileIndex];
+			for (int32 Local = 0; Local < FArcClimateTile::NumCells; ++Local)
+			{
+				NewTile.Temperature[Local] = ClimateDefaultSample.Temperature;
+				NewTile.Humidity[Local] = ClimateDefaultSample.Humidity;
+				NewTile.HumidityThreshold[Local] = ClimateDefaultSample.HumidityThreshold;
+				NewTile.FreezeThreshold[Local] = ClimateDefaultSample.FreezeThreshold;
+			}
+		}
+
+		const FArcWeatherCell& Cell = Pair.Value;
+		const FArcClimateParams Effective = ApplySeason(Cell.GetEffective());
+		const int32 Local = ((CellCoords.Y & (FArcClimateTile::Size - 1)) << FArcClimateTile::Shift) + (CellCoords.X & (FArcClimateTile::Size - 1));
+
+		FArcClimateTile& CellTile = ClimateTiles[TileIndex];
+		CellTile.Temperature[Local] = Effective.Temperature;
+		CellTile.Humidity[Local] = Effective.Humidity;
+		CellTile.HumidityThreshold[Local] = Cell.HumidityThreshold;
+		CellTile.FreezeThreshold[Local] = Cell.FreezeThreshold;
+	}
 }
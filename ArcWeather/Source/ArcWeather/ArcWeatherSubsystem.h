@@ -7,6 +7,8 @@
 #include "Subsystems/WorldSubsystem.h"
 #include "ArcWeatherSubsystem.generated.h"
 
+struct FTransformFragment;
+
 // Minimal climate description: temperature and humidity
 USTRUCT(BlueprintType)
 struct ARCWEATHER_API FArcClimateParams
@@ -54,6 +56,47 @@ struct ARCWEATHER_API FArcWeatherCell
 	}
 };
 
+// Effective climate at one point: base + offset + season, and the thresholds that apply there
+struct FArcClimateSample
+{
+	float Temperature = 20.f;
+	float Humidity = 50.f;
+	float HumidityThreshold = 70.f;
+	float FreezeThreshold = 0.f;
+};
+
+// Climate sampled for a batch of locations, one entry per location in each array
+struct FArcClimateSampleBatch
+{
+	TArray<float> Temperature;
+	TArray<float> Humidity;
+	TArray<float> HumidityThreshold;
+	TArray<float> FreezeThreshold;
+
+	int32 Num() const { return Temperature.Num(); }
+
+	void SetNumUninitialized(int32 NewNum)
+	{
+		Temperature.SetNumUninitialized(NewNum, EAllowShrinking::No);
+		Humidity.SetNumUninitialized(NewNum, EAllowShrinking::No);
+		HumidityThreshold.SetNumUninitialized(NewNum, EAllowShrinking::No);
+		FreezeThreshold.SetNumUninitialized(NewNum, EAllowShrinking::No);
+	}
+};
+
+// Square block of resolved climate cells, stored per field so samplers touch contiguous floats
+struct FArcClimateTile
+{
+	static constexpr int32 Shift = 4;
+	static constexpr int32 Size = 1 << Shift;
+	static constexpr int32 NumCells = Size * Size;
+
+	float Temperature[NumCells];
+	float Humidity[NumCells];
+	float HumidityThreshold[NumCells];
+	float FreezeThreshold[NumCells];
+};
+
 // Ice fragment: two physical properties, melt/freeze rate is derived
 USTRUCT()
 struct ARCWEATHER_API FArcIceFragment : public FMassFragment
@@ -102,6 +145,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather", meta = (ClampMin = "0.01"))
 	float RainNormalizationDelta = 30.f;
 
+	// Blend climate between the four nearest cell centres instead of using the containing cell
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+	bool bBilinearSampling = true;
+
 	// --- Seasons ---
 
 	// Each entry is a climate offset applied globally for that season
@@ -174,14 +221,61 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Weather")
 	float GetRainIntensityAtLocation(const FVector& Location) const;
 
+	// --- Sampling ---
+
+	// Effective climate and thresholds at a world location, read from the resolved climate tiles
+	FArcClimateSample SampleClimate(const FVector& Location) const;
+
+	// Samples every transform of a chunk. OutBatch is resized to Transforms.Num().
+	void SampleClimateBatch(TConstArrayView<FTransformFragment> Transforms, FArcClimateSampleBatch& OutBatch) const;
+
+	float GetColdIntensity(float Temperature, float FreezeThreshold) const
+	{
+		return Temperature < FreezeThreshold ? (FreezeThreshold - Temperature) / ColdNormalizationDelta : 0.f;
+	}
+
+	float GetRainIntensity(float Temperature, float Humidity, float HumidityThreshold, float FreezeThreshold) const
+	{
+		return Humidity >= HumidityThreshold && Temperature > FreezeThreshold ? (Humidity - HumidityThreshold) / RainNormalizationDelta : 0.f;
+	}
+
+	// Resolved tiles are rebuilt on the next sample. Call after editing cells through GetMutableGrid.
+	void MarkClimateDirty() { bClimateCacheDirty = true; }
+
 	// --- Debug accessors ---
 
 	const TMap<FIntVector, FArcWeatherCell>& GetGrid() const { return Grid; }
 	TMap<FIntVector, FArcWeatherCell>& GetMutableGrid() { return Grid; }
 
 private:
+	// Rebuilds the resolved tiles if a cell, the season or a default changed since the last build
+	void EnsureClimateCache() const;
+	void RebuildClimateCache() const;
+	bool IsClimateCacheCurrent() const;
+	FArcClimateParams GetSeasonOffset() const;
+
+	FArcClimateSample GetCachedCell(int32 X, int32 Y, int32 Z) const;
+	FArcClimateSample SampleCachedClimate(const FVector& Location) const;
+
 	// Sparse global grid: only cells that have been written to exist
 	TMap<FIntVector, FArcWeatherCell> Grid;
 
 	int32 CurrentSeasonIndex = 0;
+
+	// Effective climate resolved from Grid, defaults and season into dense tiles.
+	// Tiles cover the bounding box of Grid in tile units; ClimateTileLookup maps each slot to a tile or INDEX_NONE (defaults).
+	// Sampled without locks: weather processors declare ReadWrite access to this subsystem, so Mass never runs them concurrently.
+	mutable TArray<FArcClimateTile> ClimateTiles;
+	mutable TArray<int32> ClimateTileLookup;
+	mutable FIntVector ClimateTileMin = FIntVector::ZeroValue;
+	mutable FIntVector ClimateTileDims = FIntVector::ZeroValue;
+	mutable FArcClimateSample ClimateDefaultSample;
+	mutable bool bClimateCacheDirty = true;
+
+	// Inputs the tiles were resolved with, compared on every sample so Blueprint edits to the defaults are picked up
+	mutable float CachedCellSize = 0.f;
+	mutable FArcClimateParams CachedDefaultClimate;
+	mutable FArcClimateParams CachedSeasonOffset;
+	mutable float CachedDefaultHumidityThreshold = 0.f;
+	mutable float CachedDefaultFreezeThreshold = 0.f;
 };
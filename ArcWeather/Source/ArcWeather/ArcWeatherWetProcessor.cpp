@@ -42,34 +42,31 @@ void UArcWeatherWetProcessor::Execute(FMassEntityManager& EntityManager, FMassEx
 
 	const float DeltaTime = Context.GetDeltaTimeSeconds();
 
-	EntityQuery.ForEachEntityChunk(Context, [WeatherSubsystem, ConditionSubsystem, DeltaTime](FMassExecutionContext& Ctx)
+	FArcClimateSampleBatch Climate;
+
+	EntityQuery.ForEachEntityChunk(Context, [WeatherSubsystem, ConditionSubsystem, DeltaTime, &Climate](FMassExecutionContext& Ctx)
 	{
 		const TConstArrayView<FTransformFragment> TransformFragments = Ctx.GetFragmentView<FTransformFragment>();
 
+		WeatherSubsystem->SampleClimateBatch(TransformFragments, Climate);
+
 		for (FMassExecutionContext::FEntityIterator EntityIt = Ctx.CreateEntityIterator(); EntityIt; ++EntityIt)
 		{
-			const FTransformFragment& Transform = TransformFragments[EntityIt];
 			const FMassEntityHandle Entity = Ctx.GetEntity(EntityIt);
-			const FVector Location = Transform.GetTransform().GetLocation();
+			const float Temperature = Climate.Temperature[EntityIt];
+			const float FrzThreshold = Climate.FreezeThreshold[EntityIt];
 
-			const float RainIntensity = WeatherSubsystem->GetRainIntensityAtLocation(Location);
+			const float RainIntensity = WeatherSubsystem->GetRainIntensity(Temperature, Climate.Humidity[EntityIt],
+				Climate.HumidityThreshold[EntityIt], FrzThreshold);
 
 			if (RainIntensity > 0.f)
 			{
 				ConditionSubsystem->ApplyCondition(Entity, EArcConditionType::Wet, RainIntensity * DeltaTime);
 			}
-			else
+			else if (Temperature > FrzThreshold)
 			{
-				const FArcWeatherCell* Cell = WeatherSubsystem->GetGrid().Find(
-					WeatherSubsystem->WorldToCell(Location));
-				const FArcClimateParams Weather = WeatherSubsystem->GetWeatherAtLocation(Location);
-				const float FrzThreshold = Cell ? Cell->FreezeThreshold : WeatherSubsystem->DefaultFreezeThreshold;
-
-				if (Weather.Temperature > FrzThreshold)
-				{
-					const float DryRate = (Weather.Temperature - FrzThreshold) / WeatherSubsystem->ColdNormalizationDelta;
-					ConditionSubsystem->ApplyCondition(Entity, EArcConditionType::Wet, -DryRate * DeltaTime);
-				}
+				const float DryRate = (Temperature - FrzThreshold) / WeatherSubsystem->ColdNormalizationDelta;
+				ConditionSubsystem->ApplyCondition(Entity, EArcConditionType::Wet, -DryRate * DeltaTime);
 			}
 		}
 	});